@@ -143,6 +143,30 @@ void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& setting
     cli.add_flag("--http-compression", settings.http_compression)
         ->description("Enable compression on HTTP protocol for Execution Layer and Engine JSON RPC API")
         ->capture_default_str();
+
+    cli.add_option("--trace.checkpoint.interval", settings.trace_checkpoint_interval)
+        ->description("Number of transactions between the intra-block state checkpoints cached for tracing (0 = disabled)")
+        ->capture_default_str();
+
+    cli.add_option("--gpo.summary.blocks", settings.fee_summary_blocks)
+        ->description("Number of latest blocks whose fee summaries are kept for gas price and fee history (0 = disabled)")
+        ->capture_default_str();
+
+    cli.add_option("--rpc.cache.size", settings.response_cache_size)
+        ->description("Size in bytes of the cache of the results of deterministic JSON RPC methods (0 = disabled)")
+        ->capture_default_str();
+
+    cli.add_option("--rpc.batch.limit", settings.batch_settings.max_batch_size)
+        ->description("Maximum number of requests in one JSON RPC batch (0 = unlimited)")
+        ->capture_default_str();
+
+    cli.add_option("--rpc.batch.response_max_size", settings.batch_settings.max_response_size)
+        ->description("Maximum size in bytes of one JSON RPC batch response (0 = unlimited)")
+        ->capture_default_str();
+
+    cli.add_option("--rpc.batch.concurrency", settings.batch_settings.max_concurrency)
+        ->description("Maximum number of JSON RPC batch requests executed concurrently per connection (0 = unlimited)")
+        ->capture_default_str();
 }
 
 }  // namespace silkworm::cmd::common
@@ -16,6 +16,8 @@
 
 #include <chrono>
 #include <filesystem>
+#include <iostream>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -89,6 +91,7 @@ enum class SnapshotTool {  // NOLINT(performance-enum-size)
     lookup_body,
     lookup_txn,
     recompress,
+    residency,
     seg_zip,
     seg_unzip,
     sync
@@ -199,6 +202,16 @@ void parse_command_line(int argc, char* argv[], CLI::App& app, SnapshotToolboxSe
         ->add_option("file", snapshot_settings.input_file_path, ".seg file to decompress and compress again")
         ->required()
         ->check(CLI::ExistingFile);
+    std::map<std::string, SnapshotWarmupPolicy> warmup_policy_mapping{
+        {"none", SnapshotWarmupPolicy::kNone},
+        {"advise", SnapshotWarmupPolicy::kAdvise},
+        {"prefault", SnapshotWarmupPolicy::kPrefault},
+    };
+    commands[SnapshotTool::residency]
+        ->add_option("--warmup", snapshot_settings.warmup_policy, "Warmup policy to apply before collecting residency")
+        ->capture_default_str()
+        ->transform(CLI::Transformer(warmup_policy_mapping, CLI::ignore_case))
+        ->default_val(SnapshotWarmupPolicy::kNone);
     commands[SnapshotTool::seg_zip]
         ->add_option("file", snapshot_settings.input_file_path, "Raw words file to compress")
         ->required()
@@ -734,6 +747,38 @@ void sync(const SnapSettings& settings) {
     SILK_INFO << "Sync elapsed: " << duration_as<std::chrono::seconds>(elapsed) << " sec";
 }
 
+void residency(const SnapSettings& settings) {
+    SnapshotRepository snapshot_repo{settings, bundle_factory()};  // NOLINT(cppcoreguidelines-slicing)
+    snapshot_repo.reopen_folder();
+
+    // Page residency of memory-mapped files is tracked by the OS page cache, so it survives restarts
+    uint64_t total_size{0};
+    uint64_t total_resident_size{0};
+    auto print_residency = [&](const MemoryMappedFile* file) {
+        if (!file) return;
+        const auto size = file->size();
+        const auto resident_size = file->resident_size();
+        total_size += size;
+        total_resident_size += resident_size;
+        if (settings.print) {
+            std::cout << file->path().filename().string() << " size: " << human_size(size)
+                      << " resident: " << human_size(resident_size)
+                      << " (" << (size > 0 ? resident_size * 100 / size : 0) << "%)\n";
+        }
+    };
+    for (const SnapshotBundle& bundle : snapshot_repo.view_bundles()) {
+        for (const auto type : magic_enum::enum_values<SnapshotType>()) {
+            if (type != SnapshotType::transactions_to_block) {
+                print_residency(bundle.snapshot(type).memory_file());
+            }
+            print_residency(bundle.index(type).memory_file());
+        }
+    }
+    SILK_INFO << "Snapshot files total size: " << human_size(total_size)
+              << " resident: " << human_size(total_resident_size)
+              << " (" << (total_size > 0 ? total_resident_size * 100 / total_size : 0) << "%)";
+}
+
 int main(int argc, char* argv[]) {
     CLI::App app{"Snapshots toolbox"};
 
@@ -784,6 +829,9 @@ int main(int argc, char* argv[]) {
             case SnapshotTool::recompress:
                 snapshot_file_recompress(settings.snapshot_settings.input_file_path);
                 break;
+            case SnapshotTool::residency:
+                residency(settings.snapshot_settings);
+                break;
             case SnapshotTool::seg_zip:
                 seg::seg_zip(settings.snapshot_settings.input_file_path);
                 break;
@@ -62,7 +62,7 @@ static MemoryMappedRegion make_region(const SilkwormMemoryMappedFile& mmf) {
 }
 
 static constexpr size_t kMaxBlockBufferSize{100};
-static constexpr size_t kAnalysisCacheSize{5'000};
+static constexpr size_t kAnalysisCacheCapacity{64_Mebi};
 static constexpr size_t kMaxPrefetchedBlocks{10'240};
 
 using SteadyTimePoint = std::chrono::time_point<std::chrono::steady_clock>;
@@ -439,7 +439,7 @@ class BlockExecutor {
           write_receipts_{write_receipts},
           write_call_traces_{write_call_traces},
           write_change_sets_{write_change_sets},
-          analysis_cache_{kAnalysisCacheSize},
+          analysis_cache_{kAnalysisCacheCapacity},
           state_pool_{},
           progress_{.start_time = std::chrono::steady_clock::now()},
           log_time_{progress_.start_time + 20s},
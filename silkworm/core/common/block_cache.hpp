@@ -18,30 +18,57 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 
 #include <evmc/evmc.hpp>
 
 #include <silkworm/core/common/base.hpp>
-#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/core/common/sharded_cache.hpp>
 #include <silkworm/core/types/block.hpp>
 
 namespace silkworm {
 
+//! Approximate memory footprint of one block, a rough estimate is enough to bound the cache memory usage
+inline std::size_t block_byte_size(const BlockWithHash& block_with_hash) {
+    const Block& block{block_with_hash.block};
+    std::size_t byte_size{sizeof(BlockWithHash) + block.header.extra_data.size()};
+    for (const auto& txn : block.transactions) {
+        byte_size += sizeof(Transaction) + txn.data.size() + txn.blob_versioned_hashes.size() * sizeof(Hash);
+        for (const auto& entry : txn.access_list) {
+            byte_size += sizeof(AccessListEntry) + entry.storage_keys.size() * sizeof(evmc::bytes32);
+        }
+    }
+    for (const auto& ommer : block.ommers) {
+        byte_size += sizeof(BlockHeader) + ommer.extra_data.size();
+    }
+    if (block.withdrawals) {
+        byte_size += block.withdrawals->size() * sizeof(Withdrawal);
+    }
+    return byte_size;
+}
+
+//! Cache of recent blocks shared among the RPC execution contexts, keyed by block hash and bounded in bytes
 class BlockCache {
   public:
-    explicit BlockCache(std::size_t capacity = 1024, bool shared_cache = true)
-        : block_cache_(capacity, shared_cache) {}
+    static constexpr std::size_t kDefaultCapacity{256_Mebi};
+
+    explicit BlockCache(std::size_t capacity = kDefaultCapacity, std::size_t num_shards = kDefaultCacheShards)
+        : block_cache_(capacity, num_shards) {}
 
     std::optional<std::shared_ptr<BlockWithHash>> get(const evmc::bytes32& key) {
         return block_cache_.get_as_copy(key);
     }
 
     void insert(const evmc::bytes32& key, const std::shared_ptr<BlockWithHash>& block) {
-        block_cache_.put(key, block);
+        block_cache_.put(key, block, block_byte_size(*block));
     }
 
+    [[nodiscard]] std::size_t size() const { return block_cache_.size(); }
+    [[nodiscard]] std::size_t byte_size() const { return block_cache_.byte_size(); }
+    [[nodiscard]] std::size_t capacity() const { return block_cache_.capacity(); }
+
   private:
-    lru_cache<evmc::bytes32, std::shared_ptr<BlockWithHash>> block_cache_;
+    ShardedCache<evmc::bytes32, std::shared_ptr<BlockWithHash>> block_cache_;
 };
 
 }  // namespace silkworm
@@ -20,46 +20,62 @@
 
 namespace silkworm {
 
-TEST_CASE("check get cache key not present(lock)", "[rpc][commands][block_cache]") {
-    BlockCache block_cache(1, true);
-    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
-
-    auto b = block_cache.get(bh1);
-    CHECK(!b);
+static std::shared_ptr<BlockWithHash> make_block(BlockNum number, const evmc::bytes32& hash, std::size_t num_txns = 1) {
+    auto block_with_hash = std::make_shared<BlockWithHash>();
+    block_with_hash->block.header.number = number;
+    block_with_hash->block.transactions.resize(num_txns);
+    block_with_hash->hash = hash;
+    return block_with_hash;
 }
 
-TEST_CASE("check get cache key not present(no-lock)", "[rpc][commands][block_cache]") {
-    BlockCache block_cache(1, false);
+TEST_CASE("check get cache key not present", "[rpc][commands][block_cache]") {
+    BlockCache block_cache;
     evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
 
     auto b = block_cache.get(bh1);
     CHECK(!b);
 }
 
-TEST_CASE("insert entry in cache(lock)", "[rpc][commands][block_cache]") {
+TEST_CASE("insert entry in cache", "[rpc][commands][block_cache]") {
     evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
-    BlockCache block_cache(1, true);
+    BlockCache block_cache;
     auto ret_block_option = block_cache.get(bh1);
     CHECK(!ret_block_option);
 
-    auto block1 = std::make_shared<silkworm::BlockWithHash>();
+    auto block1 = make_block(1, bh1);
     block_cache.insert(bh1, block1);
 
     ret_block_option = block_cache.get(bh1);
+    REQUIRE(ret_block_option);
     CHECK((*ret_block_option)->hash == block1->hash);
+    CHECK(block_cache.size() == 1);
+    CHECK(block_cache.byte_size() == block_byte_size(*block1));
 }
 
-TEST_CASE("insert entry in cache(no-lock)", "[rpc][commands][block_cache]") {
-    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
-    BlockCache block_cache(1, false);
-    auto ret_block_option = block_cache.get(bh1);
-    CHECK(!ret_block_option);
-
-    auto block1 = std::make_shared<silkworm::BlockWithHash>();
-    block_cache.insert(bh1, block1);
-
-    ret_block_option = block_cache.get(bh1);
-    CHECK((*ret_block_option)->hash == block1->hash);
+TEST_CASE("byte capacity is respected", "[rpc][commands][block_cache]") {
+    const auto block_size{block_byte_size(*make_block(0, {}))};
+    BlockCache block_cache{/*capacity=*/4 * block_size, /*num_shards=*/1};
+
+    for (BlockNum number{1}; number <= 10; ++number) {
+        evmc::bytes32 hash;
+        hash.bytes[31] = static_cast<uint8_t>(number);
+        block_cache.insert(hash, make_block(number, hash));
+        CHECK(block_cache.byte_size() <= block_cache.capacity());
+    }
+    CHECK(block_cache.size() == 4);
+
+    // The oldest blocks have been evicted
+    for (BlockNum number{1}; number <= 10; ++number) {
+        evmc::bytes32 hash;
+        hash.bytes[31] = static_cast<uint8_t>(number);
+        CHECK(block_cache.get(hash).has_value() == (number > 6));
+    }
+
+    // Too big blocks are not cached at all
+    evmc::bytes32 big_hash;
+    big_hash.bytes[0] = 1;
+    block_cache.insert(big_hash, make_block(11, big_hash, 100));
+    CHECK(!block_cache.get(big_hash));
 }
 
 }  // namespace silkworm
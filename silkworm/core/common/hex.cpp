@@ -0,0 +1,192 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "hex.hpp"
+
+#include <array>
+
+#if defined(__AVX2__)
+#define SILKWORM_HEX_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SILKWORM_HEX_SSE2
+#endif
+#if defined(SILKWORM_HEX_AVX2) || defined(SILKWORM_HEX_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace silkworm::hex {
+
+static constexpr std::string_view kHexDigits{"0123456789abcdef"};
+
+//! ASCII -> hex value (0xff means bad [hex] char)
+static constexpr std::array<uint8_t, 256> kUnhexTable = [] {
+    std::array<uint8_t, 256> table{};
+    table.fill(0xff);
+    for (uint8_t i{0}; i < 10; ++i) {
+        table['0' + i] = i;
+    }
+    for (uint8_t i{0}; i < 6; ++i) {
+        table['a' + i] = static_cast<uint8_t>(10 + i);
+        table['A' + i] = static_cast<uint8_t>(10 + i);
+    }
+    return table;
+}();
+
+static void encode_scalar(const uint8_t* src, std::size_t size, char* dest) noexcept {
+    for (std::size_t i{0}; i < size; ++i) {
+        *dest++ = kHexDigits[src[i] >> 4];    // Hi
+        *dest++ = kHexDigits[src[i] & 0x0f];  // Lo
+    }
+}
+
+static bool decode_scalar(const char* src, std::size_t size, uint8_t* dest) noexcept {
+    for (std::size_t i{0}; i < size; i += 2) {
+        const auto hi{kUnhexTable[static_cast<uint8_t>(src[i])]};
+        const auto lo{kUnhexTable[static_cast<uint8_t>(src[i + 1])]};
+        if ((hi | lo) == 0xff) {
+            return false;
+        }
+        *dest++ = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+#if defined(SILKWORM_HEX_SSE2)
+
+//! Nibble values [0, 15] -> lowercase hex digits
+static inline __m128i nibbles_to_ascii(__m128i nibbles) noexcept {
+    const __m128i letter_offset = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letter_offset);
+}
+
+//! Encode 16 bytes into 32 hex digits
+static inline void encode_16(const uint8_t* src, char* dest) noexcept {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i hi = nibbles_to_ascii(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+    const __m128i lo = nibbles_to_ascii(_mm_and_si128(bytes, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+//! Hex digits -> nibble values, clearing in \p valid the lanes holding any other char
+static inline __m128i ascii_to_nibbles(__m128i chars, __m128i& valid) noexcept {
+    const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    const __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+    valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_letter));
+    return _mm_or_si128(_mm_and_si128(is_digit, digits), _mm_and_si128(is_letter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+//! Each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte
+static inline __m128i join_nibbles(__m128i nibbles) noexcept {
+    return _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00f0)), _mm_srli_epi16(nibbles, 8));
+}
+
+//! Decode 32 hex digits into 16 bytes
+static inline bool decode_32(const char* src, uint8_t* dest) noexcept {
+    __m128i valid = _mm_set1_epi8(-1);
+    const __m128i first = ascii_to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), valid);
+    const __m128i second = ascii_to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16)), valid);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_packus_epi16(join_nibbles(first), join_nibbles(second)));
+    return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+#endif  // SILKWORM_HEX_SSE2
+
+#if defined(SILKWORM_HEX_AVX2)
+
+static inline __m256i nibbles_to_ascii(__m256i nibbles) noexcept {
+    const __m256i letter_offset = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letter_offset);
+}
+
+//! Encode 32 bytes into 64 hex digits
+static inline void encode_32(const uint8_t* src, char* dest) noexcept {
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i hi = nibbles_to_ascii(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+    const __m256i lo = nibbles_to_ascii(_mm256_and_si256(bytes, mask));
+    // Unpacking works within 128-bit lanes: first holds bytes [0, 8) and [16, 24), second [8, 16) and [24, 32)
+    const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 32), _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+static inline __m256i ascii_to_nibbles(__m256i chars, __m256i& valid) noexcept {
+    const __m256i digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    const __m256i letters = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+    valid = _mm256_and_si256(valid, _mm256_or_si256(is_digit, is_letter));
+    return _mm256_or_si256(_mm256_and_si256(is_digit, digits),
+                           _mm256_and_si256(is_letter, _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+}
+
+static inline __m256i join_nibbles(__m256i nibbles) noexcept {
+    return _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(nibbles, 4), _mm256_set1_epi16(0x00f0)), _mm256_srli_epi16(nibbles, 8));
+}
+
+//! Decode 64 hex digits into 32 bytes
+static inline bool decode_64(const char* src, uint8_t* dest) noexcept {
+    __m256i valid = _mm256_set1_epi8(-1);
+    const __m256i first = ascii_to_nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), valid);
+    const __m256i second = ascii_to_nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)), valid);
+    // Packing works within 128-bit lanes too: restore the order of the 64-bit quarters
+    const __m256i bytes = _mm256_packus_epi16(join_nibbles(first), join_nibbles(second));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permute4x64_epi64(bytes, 0xd8));
+    return _mm256_movemask_epi8(valid) == -1;
+}
+
+#endif  // SILKWORM_HEX_AVX2
+
+void encode(ByteView bytes, char* dest) noexcept {
+    const uint8_t* src{bytes.data()};
+    std::size_t size{bytes.size()};
+#if defined(SILKWORM_HEX_AVX2)
+    for (; size >= 32; size -= 32, src += 32, dest += 64) {
+        encode_32(src, dest);
+    }
+#endif
+#if defined(SILKWORM_HEX_SSE2)
+    for (; size >= 16; size -= 16, src += 16, dest += 32) {
+        encode_16(src, dest);
+    }
+#endif
+    encode_scalar(src, size, dest);
+}
+
+bool decode(std::string_view hex, uint8_t* dest) noexcept {
+    const char* src{hex.data()};
+    std::size_t size{hex.size()};
+    bool valid{true};
+#if defined(SILKWORM_HEX_AVX2)
+    for (; size >= 64; size -= 64, src += 64, dest += 32) {
+        valid &= decode_64(src, dest);
+    }
+#endif
+#if defined(SILKWORM_HEX_SSE2)
+    for (; size >= 32; size -= 32, src += 32, dest += 16) {
+        valid &= decode_32(src, dest);
+    }
+#endif
+    return valid && decode_scalar(src, size, dest);
+}
+
+}  // namespace silkworm::hex
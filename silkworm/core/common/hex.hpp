@@ -0,0 +1,41 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+/*
+Vectorized hex encoding and decoding kernels writing into caller-provided buffers
+SSE2 (baseline on x86-64) and AVX2 (when enabled at compile time) are used when available, scalar code otherwise
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <silkworm/core/common/bytes.hpp>
+
+namespace silkworm::hex {
+
+//! \brief Writes the lowercase hex form of \p bytes (without any prefix) into \p dest
+//! \remarks \p dest must have room for 2 * bytes.size() chars, no null terminator is written
+void encode(ByteView bytes, char* dest) noexcept;
+
+//! \brief Writes the bytes represented by the (case-insensitive) hex digits in \p hex into \p dest
+//! \remarks \p hex must have even length and no prefix, \p dest must have room for hex.size() / 2 bytes
+//! \return true if all chars in \p hex are hex digits, false otherwise (\p dest content is unspecified)
+bool decode(std::string_view hex, uint8_t* dest) noexcept;
+
+}  // namespace silkworm::hex
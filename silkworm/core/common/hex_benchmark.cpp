@@ -0,0 +1,82 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/hex.hpp>
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm {
+
+//! Payload sizes: hash, typical calldata, large calldata, full block
+static void payload_sizes(benchmark::internal::Benchmark* b) {
+    b->Arg(32)->Arg(1024)->Arg(32 * 1024)->Arg(1024 * 1024);
+}
+
+static Bytes make_payload(std::size_t size) {
+    Bytes payload(size, 0);
+    for (std::size_t i{0}; i < size; ++i) {
+        payload[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    return payload;
+}
+
+static void benchmark_hex_encode(benchmark::State& state) {
+    const Bytes payload{make_payload(static_cast<std::size_t>(state.range(0)))};
+    std::string hex(2 * payload.size(), '\0');
+    for ([[maybe_unused]] auto _ : state) {
+        hex::encode(payload, hex.data());
+        benchmark::DoNotOptimize(hex.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(benchmark_hex_encode)->Apply(payload_sizes);
+
+static void benchmark_hex_decode(benchmark::State& state) {
+    const Bytes payload{make_payload(static_cast<std::size_t>(state.range(0)))};
+    const std::string hex{to_hex(payload)};
+    Bytes bytes(payload.size(), 0);
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(hex::decode(hex, bytes.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(benchmark_hex_decode)->Apply(payload_sizes);
+
+static void benchmark_to_hex(benchmark::State& state) {
+    const Bytes payload{make_payload(static_cast<std::size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(to_hex(payload, /*with_prefix=*/true));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(benchmark_to_hex)->Apply(payload_sizes);
+
+static void benchmark_from_hex(benchmark::State& state) {
+    const Bytes payload{make_payload(static_cast<std::size_t>(state.range(0)))};
+    const std::string hex{to_hex(payload, /*with_prefix=*/true)};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(from_hex(hex));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(benchmark_from_hex)->Apply(payload_sizes);
+
+}  // namespace silkworm
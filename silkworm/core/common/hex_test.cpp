@@ -0,0 +1,83 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "hex.hpp"
+
+#include <cctype>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm {
+
+//! Reference encoding, one nibble at a time
+static std::string encode_one_by_one(ByteView bytes) {
+    static constexpr std::string_view kHexDigits{"0123456789abcdef"};
+    std::string out;
+    for (const auto b : bytes) {
+        out.push_back(kHexDigits[b >> 4]);
+        out.push_back(kHexDigits[b & 0x0f]);
+    }
+    return out;
+}
+
+//! Sample bytes covering all the values, with sizes exercising both the vectorized and the scalar code paths
+static Bytes make_bytes(std::size_t size) {
+    Bytes bytes(size, 0);
+    for (std::size_t i{0}; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    return bytes;
+}
+
+TEST_CASE("hex::encode", "[core][common][hex]") {
+    for (std::size_t size{0}; size <= 300; ++size) {
+        const Bytes bytes{make_bytes(size)};
+        std::string hex(2 * size, '?');
+        hex::encode(bytes, hex.data());
+        CHECK(hex == encode_one_by_one(bytes));
+    }
+}
+
+TEST_CASE("hex::decode", "[core][common][hex]") {
+    SECTION("valid digits") {
+        for (std::size_t size{0}; size <= 300; ++size) {
+            const Bytes expected_bytes{make_bytes(size)};
+            std::string hex{encode_one_by_one(expected_bytes)};
+            // Mix lowercase and uppercase digits
+            for (std::size_t i{0}; i < hex.size(); i += 3) {
+                hex[i] = static_cast<char>(std::toupper(hex[i]));
+            }
+            Bytes bytes(size, 0);
+            CHECK(hex::decode(hex, bytes.data()));
+            CHECK(bytes == expected_bytes);
+        }
+    }
+    SECTION("invalid digit at any position") {
+        const Bytes expected_bytes{make_bytes(100)};
+        const std::string hex{encode_one_by_one(expected_bytes)};
+        Bytes bytes(expected_bytes.size(), 0);
+        for (const char invalid_char : {'/', ':', '@', 'G', '`', 'g', ' ', '\0', '\x80', '\xc1', '\xff'}) {
+            for (std::size_t i{0}; i < hex.size(); ++i) {
+                std::string invalid_hex{hex};
+                invalid_hex[i] = invalid_char;
+                CHECK(!hex::decode(invalid_hex, bytes.data()));
+            }
+        }
+    }
+}
+
+}  // namespace silkworm
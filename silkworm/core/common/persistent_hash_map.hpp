@@ -0,0 +1,286 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace silkworm {
+
+//! \brief Immutable hash map implemented as a Hash Array Mapped Trie (HAMT) with structural sharing.
+//! \details Each update returns a new map sharing all the untouched nodes with the original one, so deriving a new
+//! version costs O(log32(n)) per changed key and any version can be read concurrently without locking. Each entry has
+//! an access bit set by find and shared among all the versions containing the entry, which can be used to implement
+//! CLOCK (second-chance) eviction on top of the map.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<>>
+class PersistentHashMap {
+  public:
+    PersistentHashMap() = default;
+
+    //! Find the value for \p key (if any) marking the entry as referenced
+    //! \return pointer to the value, valid as long as this map is alive
+    template <typename K>
+    const Value* find(const K& key) const {
+        const Entry* entry = find_entry(key);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        if (!entry->referenced.load(std::memory_order_relaxed)) {
+            entry->referenced.store(true, std::memory_order_relaxed);
+        }
+        return &entry->value;
+    }
+
+    //! Find the value for \p key (if any) leaving the access bit of the entry untouched
+    template <typename K>
+    const Value* peek(const K& key) const {
+        const Entry* entry = find_entry(key);
+        return entry ? &entry->value : nullptr;
+    }
+
+    //! Clear the access bit of the entry for \p key
+    //! \return true if the entry exists and has been referenced since the last reset
+    template <typename K>
+    bool reset_referenced(const K& key) const {
+        const Entry* entry = find_entry(key);
+        return entry && entry->referenced.exchange(false, std::memory_order_relaxed);
+    }
+
+    //! \return a new map having \p value associated to \p key
+    [[nodiscard]] PersistentHashMap insert_or_assign(Key key, Value value) const {
+        const std::size_t hash = Hash{}(key);
+        EntryPtr entry = std::make_shared<Entry>(hash, std::move(key), std::move(value));
+        bool added{false};
+        return PersistentHashMap{set(root_, std::move(entry), 0, added), added ? size_ + 1 : size_};
+    }
+
+    //! \return a new map without any value associated to \p key
+    template <typename K>
+    [[nodiscard]] PersistentHashMap erase(const K& key) const {
+        bool erased{false};
+        NodePtr root = remove(root_, Hash{}(key), key, 0, erased);
+        return erased ? PersistentHashMap{std::move(root), size_ - 1} : *this;
+    }
+
+    //! Apply \p f to each key-value pair, in no particular order
+    template <typename F>
+    void for_each(F&& f) const {
+        visit(root_.get(), f);
+    }
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  private:
+    static constexpr unsigned kBitsPerLevel{5};
+    static constexpr std::size_t kLevelMask{(1u << kBitsPerLevel) - 1};
+    static constexpr unsigned kHashBits{sizeof(std::size_t) * CHAR_BIT};
+
+    struct Entry {
+        Entry(std::size_t h, Key k, Value v) : hash{h}, key{std::move(k)}, value{std::move(v)} {}
+
+        std::size_t hash;
+        Key key;
+        Value value;
+        mutable std::atomic_bool referenced{false};
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    //! Trie node: slots are either entries or sub-nodes, both stored compressed in slot order.
+    //! When all the hash bits have been consumed the node holds the colliding entries only.
+    struct Node {
+        uint32_t entry_map{0};
+        uint32_t node_map{0};
+        std::vector<EntryPtr> entries;
+        std::vector<NodePtr> children;
+    };
+
+    PersistentHashMap(NodePtr root, std::size_t size) : root_{std::move(root)}, size_{size} {}
+
+    static uint32_t slot_bit(std::size_t hash, unsigned shift) {
+        return uint32_t{1} << ((hash >> shift) & kLevelMask);
+    }
+
+    static std::size_t slot_index(uint32_t map, uint32_t bit) {
+        return static_cast<std::size_t>(std::popcount(map & (bit - 1)));
+    }
+
+    static auto offset(std::size_t index) { return static_cast<std::ptrdiff_t>(index); }
+
+    template <typename K>
+    const Entry* find_entry(const K& key) const {
+        const std::size_t hash = Hash{}(key);
+        const Node* node = root_.get();
+        for (unsigned shift{0}; node != nullptr; shift += kBitsPerLevel) {
+            if (shift >= kHashBits) {
+                for (const auto& entry : node->entries) {
+                    if (KeyEqual{}(entry->key, key)) {
+                        return entry.get();
+                    }
+                }
+                return nullptr;
+            }
+            const uint32_t bit = slot_bit(hash, shift);
+            if (node->entry_map & bit) {
+                const Entry* entry = node->entries[slot_index(node->entry_map, bit)].get();
+                return entry->hash == hash && KeyEqual{}(entry->key, key) ? entry : nullptr;
+            }
+            if (!(node->node_map & bit)) {
+                return nullptr;
+            }
+            node = node->children[slot_index(node->node_map, bit)].get();
+        }
+        return nullptr;
+    }
+
+    static NodePtr set(const NodePtr& node, EntryPtr entry, unsigned shift, bool& added) {
+        auto copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+        if (shift >= kHashBits) {
+            for (auto& colliding : copy->entries) {
+                if (KeyEqual{}(colliding->key, entry->key)) {
+                    colliding = std::move(entry);
+                    return copy;
+                }
+            }
+            copy->entries.push_back(std::move(entry));
+            added = true;
+            return copy;
+        }
+        const uint32_t bit = slot_bit(entry->hash, shift);
+        if (copy->entry_map & bit) {
+            const std::size_t index = slot_index(copy->entry_map, bit);
+            EntryPtr existing = copy->entries[index];
+            if (existing->hash == entry->hash && KeyEqual{}(existing->key, entry->key)) {
+                copy->entries[index] = std::move(entry);
+                return copy;
+            }
+            // Push both the existing and the new entry one level down
+            copy->entries.erase(copy->entries.begin() + offset(index));
+            copy->entry_map ^= bit;
+            NodePtr child = merge(std::move(existing), std::move(entry), shift + kBitsPerLevel);
+            copy->node_map |= bit;
+            copy->children.insert(copy->children.begin() + offset(slot_index(copy->node_map, bit)), std::move(child));
+            added = true;
+        } else if (copy->node_map & bit) {
+            auto& child = copy->children[slot_index(copy->node_map, bit)];
+            child = set(child, std::move(entry), shift + kBitsPerLevel, added);
+        } else {
+            copy->entry_map |= bit;
+            copy->entries.insert(copy->entries.begin() + offset(slot_index(copy->entry_map, bit)), std::move(entry));
+            added = true;
+        }
+        return copy;
+    }
+
+    static NodePtr merge(EntryPtr first, EntryPtr second, unsigned shift) {
+        auto node = std::make_shared<Node>();
+        if (shift >= kHashBits) {
+            node->entries = {std::move(first), std::move(second)};
+            return node;
+        }
+        const uint32_t first_bit = slot_bit(first->hash, shift);
+        const uint32_t second_bit = slot_bit(second->hash, shift);
+        if (first_bit == second_bit) {
+            node->node_map = first_bit;
+            node->children.push_back(merge(std::move(first), std::move(second), shift + kBitsPerLevel));
+            return node;
+        }
+        node->entry_map = first_bit | second_bit;
+        if (first_bit < second_bit) {
+            node->entries = {std::move(first), std::move(second)};
+        } else {
+            node->entries = {std::move(second), std::move(first)};
+        }
+        return node;
+    }
+
+    //! \return the node without the entry for \p key or nullptr if the node becomes empty
+    template <typename K>
+    static NodePtr remove(const NodePtr& node, std::size_t hash, const K& key, unsigned shift, bool& erased) {
+        if (!node) {
+            return node;
+        }
+        if (shift >= kHashBits) {
+            for (std::size_t i{0}; i < node->entries.size(); ++i) {
+                if (KeyEqual{}(node->entries[i]->key, key)) {
+                    auto copy = std::make_shared<Node>(*node);
+                    copy->entries.erase(copy->entries.begin() + offset(i));
+                    erased = true;
+                    return copy->entries.empty() ? nullptr : copy;
+                }
+            }
+            return node;
+        }
+        const uint32_t bit = slot_bit(hash, shift);
+        if (node->entry_map & bit) {
+            const std::size_t index = slot_index(node->entry_map, bit);
+            const auto& entry = node->entries[index];
+            if (entry->hash != hash || !KeyEqual{}(entry->key, key)) {
+                return node;
+            }
+            auto copy = std::make_shared<Node>(*node);
+            copy->entries.erase(copy->entries.begin() + offset(index));
+            copy->entry_map ^= bit;
+            erased = true;
+            return copy->entry_map == 0 && copy->node_map == 0 ? nullptr : copy;
+        }
+        if (node->node_map & bit) {
+            const std::size_t index = slot_index(node->node_map, bit);
+            NodePtr child = remove(node->children[index], hash, key, shift + kBitsPerLevel, erased);
+            if (!erased) {
+                return node;
+            }
+            auto copy = std::make_shared<Node>(*node);
+            if (child) {
+                copy->children[index] = std::move(child);
+            } else {
+                copy->children.erase(copy->children.begin() + offset(index));
+                copy->node_map ^= bit;
+            }
+            return copy->entry_map == 0 && copy->node_map == 0 ? nullptr : copy;
+        }
+        return node;
+    }
+
+    template <typename F>
+    static void visit(const Node* node, F& f) {
+        if (node == nullptr) {
+            return;
+        }
+        for (const auto& entry : node->entries) {
+            f(entry->key, entry->value);
+        }
+        for (const auto& child : node->children) {
+            visit(child.get(), f);
+        }
+    }
+
+    NodePtr root_;
+    std::size_t size_{0};
+};
+
+}  // namespace silkworm
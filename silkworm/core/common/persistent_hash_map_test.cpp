@@ -0,0 +1,107 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "persistent_hash_map.hpp"
+
+#include <map>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm {
+
+//! Hash function mapping all the keys to few values to exercise the collision nodes
+struct CollidingHash {
+    std::size_t operator()(int key) const { return static_cast<std::size_t>(key % 3); }
+};
+
+TEST_CASE("PersistentHashMap insert, find and erase", "[core][common][persistent_hash_map]") {
+    PersistentHashMap<int, std::string> map;
+    CHECK(map.empty());
+    CHECK(map.find(1) == nullptr);
+
+    const auto map1 = map.insert_or_assign(1, "one");
+    const auto map2 = map1.insert_or_assign(2, "two").insert_or_assign(1, "uno");
+    const auto map3 = map2.erase(1);
+
+    // Each version is left untouched by the updates
+    CHECK(map.empty());
+    CHECK(map1.size() == 1);
+    CHECK(*map1.find(1) == "one");
+    CHECK(map2.size() == 2);
+    CHECK(*map2.find(1) == "uno");
+    CHECK(*map2.find(2) == "two");
+    CHECK(map3.size() == 1);
+    CHECK(map3.find(1) == nullptr);
+    CHECK(*map3.find(2) == "two");
+    CHECK(map3.erase(1).size() == 1);
+}
+
+TEST_CASE("PersistentHashMap many keys", "[core][common][persistent_hash_map]") {
+    constexpr int kNumKeys{10'000};
+    PersistentHashMap<int, int> map;
+    std::map<int, int> expected;
+    for (int i{0}; i < kNumKeys; ++i) {
+        map = map.insert_or_assign(i, i * 2);
+        expected[i] = i * 2;
+    }
+    CHECK(map.size() == kNumKeys);
+    for (int i{0}; i < kNumKeys; i += 2) {
+        map = map.erase(i);
+        expected.erase(i);
+    }
+    CHECK(map.size() == expected.size());
+    for (int i{0}; i < kNumKeys; ++i) {
+        const int* value = map.peek(i);
+        CHECK((value != nullptr) == expected.contains(i));
+    }
+    std::size_t visited{0};
+    map.for_each([&](int key, int value) {
+        CHECK(expected.at(key) == value);
+        ++visited;
+    });
+    CHECK(visited == expected.size());
+}
+
+TEST_CASE("PersistentHashMap hash collisions", "[core][common][persistent_hash_map]") {
+    PersistentHashMap<int, int, CollidingHash> map;
+    for (int i{0}; i < 30; ++i) {
+        map = map.insert_or_assign(i, i);
+    }
+    CHECK(map.size() == 30);
+    CHECK(*map.find(29) == 29);
+    map = map.erase(0).erase(3).insert_or_assign(6, 66);
+    CHECK(map.size() == 28);
+    CHECK(map.find(0) == nullptr);
+    CHECK(*map.find(6) == 66);
+}
+
+TEST_CASE("PersistentHashMap referenced bit", "[core][common][persistent_hash_map]") {
+    const auto map1 = PersistentHashMap<int, int>{}.insert_or_assign(1, 1).insert_or_assign(2, 2);
+    const auto map2 = map1.insert_or_assign(3, 3);
+
+    CHECK(!map2.reset_referenced(1));
+    CHECK(map2.peek(1) != nullptr);
+    CHECK(!map2.reset_referenced(1));
+
+    // The access bit is shared among the versions containing the entry
+    CHECK(map1.find(1) != nullptr);
+    CHECK(map2.reset_referenced(1));
+    CHECK(!map1.reset_referenced(1));
+    CHECK(!map2.reset_referenced(4));
+}
+
+}  // namespace silkworm
@@ -0,0 +1,247 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace silkworm {
+
+#ifndef __wasm__
+#define SILKWORM_SHARDED_CACHE_GUARD(shard) std::scoped_lock lock{(shard).mutex};
+#else
+#define SILKWORM_SHARDED_CACHE_GUARD(shard)
+#endif
+
+inline constexpr std::size_t kDefaultCacheShards{16};
+
+//! \brief Concurrent cache with byte-based capacity split into shards selected by key hash.
+//! \details Each shard is guarded by its own mutex and evicts entries using the CLOCK (second-chance) policy: a hit
+//! just sets the reference bit of the slot, so no list splicing happens on the read path. Each entry is inserted with
+//! its (approximate) size in bytes and entries are evicted until the total size of the shard fits its capacity.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedCache {
+  public:
+    explicit ShardedCache(std::size_t capacity, std::size_t num_shards = kDefaultCacheShards)
+        : shard_capacity_{std::max<std::size_t>(capacity / std::max<std::size_t>(num_shards, 1), 1)} {
+        shards_.reserve(std::max<std::size_t>(num_shards, 1));
+        for (std::size_t i{0}; i < shards_.capacity(); ++i) {
+            shards_.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+    std::optional<Value> get_as_copy(const Key& key) {
+        return get_converted(key, [](const Value& value) { return std::optional<Value>{value}; });
+    }
+
+    //! Get the value for \p key converted by \p convert, which returns an std::optional: a value that \p convert
+    //! rejects returning std::nullopt (e.g. holding a different type) is counted as a miss
+    template <typename Converter>
+    std::invoke_result_t<Converter, const Value&> get_converted(const Key& key, Converter&& convert) {
+        Shard& shard = shard_for(key);
+        SILKWORM_SHARDED_CACHE_GUARD(shard)
+        if (const auto it = shard.index.find(key); it != shard.index.end()) {
+            Slot& slot = shard.slots[it->second];
+            if (auto converted_value = std::invoke(std::forward<Converter>(convert), std::as_const(slot.value))) {
+                slot.referenced = true;
+                hit_count_.fetch_add(1, std::memory_order_relaxed);
+                return converted_value;
+            }
+        }
+        miss_count_.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    //! Insert or replace the value for \p key, whose size in bytes is \p byte_size
+    //! \return true if the value has been cached, false if it is too big to fit the shard capacity
+    bool put(const Key& key, Value value, std::size_t byte_size = 1) {
+        Shard& shard = shard_for(key);
+        SILKWORM_SHARDED_CACHE_GUARD(shard)
+        return insert(shard, key, std::move(value), byte_size);
+    }
+
+    //! Update to \p byte_size the size in bytes of the entry for \p key if it still holds \p value, evicting other
+    //! entries if needed (e.g. when the value has grown after its insertion)
+    //! \return true if the value is still cached, false otherwise
+    bool resize(const Key& key, const Value& value, std::size_t byte_size) {
+        Shard& shard = shard_for(key);
+        SILKWORM_SHARDED_CACHE_GUARD(shard)
+        const auto it = shard.index.find(key);
+        if (it == shard.index.end() || !(shard.slots[it->second].value == value)) {
+            return false;
+        }
+        return insert(shard, key, value, byte_size);
+    }
+
+    bool remove(const Key& key) {
+        Shard& shard = shard_for(key);
+        SILKWORM_SHARDED_CACHE_GUARD(shard)
+        const auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return false;
+        }
+        release(shard, it->second);
+        shard.index.erase(it);
+        return true;
+    }
+
+    void clear() {
+        for (auto& shard : shards_) {
+            SILKWORM_SHARDED_CACHE_GUARD(*shard)
+            shard->slots.clear();
+            shard->free_slots.clear();
+            shard->index.clear();
+            shard->hand = 0;
+            shard->byte_size = 0;
+        }
+    }
+
+    //! The number of cached entries
+    [[nodiscard]] std::size_t size() const {
+        std::size_t total_size{0};
+        for (const auto& shard : shards_) {
+            SILKWORM_SHARDED_CACHE_GUARD(*shard)
+            total_size += shard->index.size();
+        }
+        return total_size;
+    }
+
+    //! The total size in bytes of the cached entries
+    [[nodiscard]] std::size_t byte_size() const {
+        std::size_t total_byte_size{0};
+        for (const auto& shard : shards_) {
+            SILKWORM_SHARDED_CACHE_GUARD(*shard)
+            total_byte_size += shard->byte_size;
+        }
+        return total_byte_size;
+    }
+
+    //! The capacity in bytes
+    [[nodiscard]] std::size_t capacity() const { return shard_capacity_ * shards_.size(); }
+    [[nodiscard]] std::size_t num_shards() const { return shards_.size(); }
+
+    uint64_t hit_count() const { return hit_count_.load(std::memory_order_relaxed); }
+    uint64_t miss_count() const { return miss_count_.load(std::memory_order_relaxed); }
+    uint64_t eviction_count() const { return eviction_count_.load(std::memory_order_relaxed); }
+
+  private:
+    struct Slot {
+        Key key;
+        Value value;
+        std::size_t byte_size{0};
+        bool referenced{false};
+        bool occupied{false};
+    };
+
+    struct Shard {
+#ifndef __wasm__
+        mutable std::mutex mutex;
+#endif
+        std::vector<Slot> slots;
+        std::vector<std::size_t> free_slots;
+        std::unordered_map<Key, std::size_t, Hash> index;
+        std::size_t hand{0};
+        std::size_t byte_size{0};
+    };
+
+    Shard& shard_for(const Key& key) {
+        // Mix the hash to decorrelate the shard selection from the bucketing within the shard
+        uint64_t h = static_cast<uint64_t>(Hash{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return *shards_[h % shards_.size()];
+    }
+
+    //! Insert or replace the value for \p key into \p shard, whose lock must be held
+    bool insert(Shard& shard, const Key& key, Value value, std::size_t byte_size) {
+        if (const auto it = shard.index.find(key); it != shard.index.end()) {
+            release(shard, it->second);
+            shard.index.erase(it);
+        }
+        if (byte_size > shard_capacity_) {
+            return false;
+        }
+        while (shard.byte_size + byte_size > shard_capacity_) {
+            evict_one(shard);
+        }
+
+        std::size_t position{0};
+        if (!shard.free_slots.empty()) {
+            position = shard.free_slots.back();
+            shard.free_slots.pop_back();
+            shard.slots[position] = Slot{key, std::move(value), byte_size, false, true};
+        } else {
+            position = shard.slots.size();
+            shard.slots.push_back(Slot{key, std::move(value), byte_size, false, true});
+        }
+        shard.index.emplace(key, position);
+        shard.byte_size += byte_size;
+        return true;
+    }
+
+    //! Free the slot at \p position, leaving the index untouched
+    static void release(Shard& shard, std::size_t position) {
+        Slot& slot = shard.slots[position];
+        shard.byte_size -= slot.byte_size;
+        slot = Slot{};
+        shard.free_slots.push_back(position);
+    }
+
+    //! CLOCK eviction: advance the hand giving a second chance to the referenced slots
+    void evict_one(Shard& shard) {
+        while (true) {
+            if (shard.hand >= shard.slots.size()) {
+                shard.hand = 0;
+            }
+            Slot& slot = shard.slots[shard.hand];
+            if (slot.occupied) {
+                if (!slot.referenced) {
+                    shard.index.erase(slot.key);
+                    release(shard, shard.hand);
+                    eviction_count_.fetch_add(1, std::memory_order_relaxed);
+                    ++shard.hand;
+                    return;
+                }
+                slot.referenced = false;
+            }
+            ++shard.hand;
+        }
+    }
+
+    std::size_t shard_capacity_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    std::atomic_uint64_t hit_count_{0};
+    std::atomic_uint64_t miss_count_{0};
+    std::atomic_uint64_t eviction_count_{0};
+};
+
+}  // namespace silkworm
@@ -0,0 +1,178 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "sharded_cache.hpp"
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm {
+
+TEST_CASE("ShardedCache get and put", "[core][common][sharded_cache]") {
+    ShardedCache<int, std::string> cache{/*capacity=*/100, /*num_shards=*/4};
+    CHECK(cache.capacity() == 100);
+    CHECK(cache.num_shards() == 4);
+
+    SECTION("missing value") {
+        CHECK(!cache.get_as_copy(7));
+        CHECK(cache.miss_count() == 1);
+    }
+    SECTION("present value") {
+        CHECK(cache.put(7, "777", 3));
+        const auto value = cache.get_as_copy(7);
+        REQUIRE(value);
+        CHECK(*value == "777");
+        CHECK(cache.hit_count() == 1);
+        CHECK(cache.size() == 1);
+        CHECK(cache.byte_size() == 3);
+    }
+    SECTION("converted value") {
+        CHECK(cache.put(7, "777", 3));
+        const auto size = cache.get_converted(7, [](const std::string& value) { return std::optional<std::size_t>{value.size()}; });
+        CHECK(size == 3);
+        CHECK(cache.hit_count() == 1);
+    }
+    SECTION("rejected value") {
+        CHECK(cache.put(7, "777", 3));
+        CHECK(!cache.get_converted(7, [](const std::string&) { return std::optional<int>{}; }));
+        CHECK(cache.hit_count() == 0);
+        CHECK(cache.miss_count() == 1);
+    }
+    SECTION("replaced value") {
+        CHECK(cache.put(7, "777", 3));
+        CHECK(cache.put(7, "7777", 4));
+        CHECK(*cache.get_as_copy(7) == "7777");
+        CHECK(cache.size() == 1);
+        CHECK(cache.byte_size() == 4);
+    }
+    SECTION("removed value") {
+        CHECK(cache.put(7, "777", 3));
+        CHECK(cache.remove(7));
+        CHECK(!cache.remove(7));
+        CHECK(!cache.get_as_copy(7));
+        CHECK(cache.byte_size() == 0);
+    }
+    SECTION("resized value") {
+        CHECK(cache.put(7, "777", 3));
+        CHECK(cache.resize(7, "777", 5));
+        CHECK(*cache.get_as_copy(7) == "777");
+        CHECK(cache.byte_size() == 5);
+    }
+    SECTION("resized value no longer cached") {
+        CHECK(!cache.resize(7, "777", 5));
+        CHECK(cache.put(7, "7777", 4));
+        CHECK(!cache.resize(7, "777", 5));
+        CHECK(*cache.get_as_copy(7) == "7777");
+        CHECK(cache.byte_size() == 4);
+    }
+    SECTION("too big value") {
+        CHECK(!cache.put(7, "777", 26));
+        CHECK(!cache.get_as_copy(7));
+    }
+    SECTION("clear") {
+        for (int i{0}; i < 10; ++i) {
+            cache.put(i, std::to_string(i));
+        }
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(cache.byte_size() == 0);
+    }
+}
+
+TEST_CASE("ShardedCache keeps byte size within capacity", "[core][common][sharded_cache]") {
+    static constexpr int kNumRecords{1'000};
+    ShardedCache<int, int> cache{/*capacity=*/400, /*num_shards=*/4};
+
+    for (int i{0}; i < kNumRecords; ++i) {
+        CHECK(cache.put(i, i, 1 + i % 7));
+        CHECK(cache.byte_size() <= cache.capacity());
+    }
+    CHECK(cache.eviction_count() > 0);
+    CHECK(cache.size() + cache.eviction_count() == kNumRecords);
+
+    // The most recent entry is always present
+    CHECK(cache.get_as_copy(kNumRecords - 1) == kNumRecords - 1);
+}
+
+TEST_CASE("ShardedCache gives second chance to referenced entries", "[core][common][sharded_cache]") {
+    ShardedCache<int, int> cache{/*capacity=*/3, /*num_shards=*/1};
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+    CHECK(cache.get_as_copy(1) == 1);
+
+    // Entry 2 is the oldest one not referenced, so it must be evicted first
+    cache.put(4, 4);
+    CHECK(cache.get_as_copy(1) == 1);
+    CHECK(!cache.get_as_copy(2));
+    CHECK(cache.get_as_copy(3) == 3);
+    CHECK(cache.get_as_copy(4) == 4);
+    CHECK(cache.eviction_count() == 1);
+}
+
+TEST_CASE("ShardedCache evicts other entries when resizing", "[core][common][sharded_cache]") {
+    ShardedCache<int, int> cache{/*capacity=*/3, /*num_shards=*/1};
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+
+    CHECK(cache.resize(3, 3, 2));
+    CHECK(cache.byte_size() == 3);
+    CHECK(!cache.get_as_copy(1));
+    CHECK(cache.get_as_copy(2) == 2);
+    CHECK(cache.get_as_copy(3) == 3);
+    CHECK(cache.eviction_count() == 1);
+
+    // Growing beyond the capacity drops the resized entry itself
+    CHECK(!cache.resize(3, 3, 4));
+    CHECK(!cache.get_as_copy(3));
+    CHECK(cache.byte_size() == 1);
+}
+
+TEST_CASE("ShardedCache concurrent access", "[core][common][sharded_cache]") {
+    static constexpr int kNumThreads{4};
+    static constexpr int kNumRecords{10'000};
+    ShardedCache<int, int> cache{/*capacity=*/1'000};
+
+    std::atomic_int mismatch_count{0};
+    std::vector<std::thread> threads;
+    threads.reserve(kNumThreads);
+    for (int t{0}; t < kNumThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i{0}; i < kNumRecords; ++i) {
+                const int key{(i * kNumThreads + t) % 2'000};
+                if (const auto value = cache.get_as_copy(key)) {
+                    if (*value != key) ++mismatch_count;
+                } else {
+                    cache.put(key, key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(mismatch_count == 0);
+    CHECK(cache.byte_size() <= cache.capacity());
+    CHECK(cache.hit_count() + cache.miss_count() == kNumThreads * kNumRecords);
+}
+
+}  // namespace silkworm
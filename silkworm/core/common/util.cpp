@@ -21,6 +21,7 @@
 #include <regex>
 
 #include <silkworm/core/common/assert.hpp>
+#include <silkworm/core/common/hex.hpp>
 
 namespace silkworm {
 
@@ -41,23 +42,6 @@ static constexpr uint8_t kUnhexTable[256] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
 
-// ASCII -> hex value << 4 (upper nibble) (0xff means bad [hex] char)
-static constexpr uint8_t kUnhexTable4[256] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80,
-    0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-
 ByteView zeroless_view(ByteView data) {
     const auto is_zero_byte = [](const auto& b) { return b == 0x0; };
     const auto first_nonzero_byte_it{std::ranges::find_if_not(data, is_zero_byte)};
@@ -65,17 +49,13 @@ ByteView zeroless_view(ByteView data) {
 }
 
 std::string to_hex(ByteView bytes, bool with_prefix) {
-    static const char* kHexDigits{"0123456789abcdef"};
     std::string out(bytes.length() * 2 + (with_prefix ? 2 : 0), '\0');
     char* dest{&out[0]};
     if (with_prefix) {
         *dest++ = '0';
         *dest++ = 'x';
     }
-    for (const auto& b : bytes) {
-        *dest++ = kHexDigits[b >> 4];    // Hi
-        *dest++ = kHexDigits[b & 0x0f];  // Lo
-    }
+    hex::encode(bytes, dest);
     return out;
 }
 
@@ -87,7 +67,6 @@ std::string abridge(std::string_view input, size_t length) {
 }
 
 static inline uint8_t unhex_lut(uint8_t x) { return kUnhexTable[x]; }
-static inline uint8_t unhex_lut4(uint8_t x) { return kUnhexTable4[x]; }
 
 std::optional<uint8_t> decode_hex_digit(char ch) noexcept {
     auto ret{unhex_lut(static_cast<uint8_t>(ch))};
@@ -119,33 +98,8 @@ std::optional<Bytes> from_hex(std::string_view hex) noexcept {
         *dst++ = b;
     }
 
-    // following "while" is unrolling the loop when we have >= 4 target bytes
-    // this is optional, but 5-10% faster
-    while (last - src >= 8) {
-        auto a{unhex_lut4(static_cast<uint8_t>(*src++))};
-        auto b{unhex_lut(static_cast<uint8_t>(*src++))};
-        auto c{unhex_lut4(static_cast<uint8_t>(*src++))};
-        auto d{unhex_lut(static_cast<uint8_t>(*src++))};
-        auto e{unhex_lut4(static_cast<uint8_t>(*src++))};
-        auto f{unhex_lut(static_cast<uint8_t>(*src++))};
-        auto g{unhex_lut4(static_cast<uint8_t>(*src++))};
-        auto h{unhex_lut(static_cast<uint8_t>(*src++))};
-        if ((b | d | f | h) == 0xff || (a | c | e | g) == 0xff) {
-            return std::nullopt;
-        }
-        *dst++ = a | b;
-        *dst++ = c | d;
-        *dst++ = e | f;
-        *dst++ = g | h;
-    }
-
-    while (src < last) {
-        auto a{unhex_lut4(static_cast<uint8_t>(*src++))};
-        auto b{unhex_lut(static_cast<uint8_t>(*src++))};
-        if (a == 0xff || b == 0xff) {
-            return std::nullopt;
-        }
-        *dst++ = a | b;
+    if (!hex::decode({src, static_cast<size_t>(last - src)}, dst)) {
+        return std::nullopt;
     }
     return out;
 }
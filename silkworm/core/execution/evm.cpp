@@ -300,6 +300,11 @@ void EVM::release_state(gsl::owner<evmone::ExecutionState*> state) const noexcep
     }
 }
 
+//! Approximate memory footprint of the code analysis: padded code copy, jumpdest bitmap and bookkeeping
+static std::size_t analysis_byte_size(ByteView code) {
+    return sizeof(evmone::baseline::CodeAnalysis) + code.size() + code.size() / 8 + 64;
+}
+
 evmc_result EVM::execute_with_baseline_interpreter(evmc_revision rev, const evmc_message& message, ByteView code,
                                                    const evmc::bytes32* code_hash) noexcept {
     std::shared_ptr<evmone::baseline::CodeAnalysis> analysis;
@@ -313,7 +318,7 @@ evmc_result EVM::execute_with_baseline_interpreter(evmc_revision rev, const evmc
     if (!analysis) {
         analysis = std::make_shared<evmone::baseline::CodeAnalysis>(evmone::baseline::analyze(rev, code));
         if (use_cache) {
-            analysis_cache->put(*code_hash, analysis);
+            analysis_cache->put(*code_hash, analysis, analysis_byte_size(code));
         }
     }
 
@@ -294,7 +294,7 @@ TEST_CASE("Maximum call depth", "[core][execution]") {
 
     EVM evm{block, state, kMainnetConfig};
 
-    AnalysisCache analysis_cache{/*max_size=*/16};
+    AnalysisCache analysis_cache{/*capacity=*/16_Kibi};
     evm.analysis_cache = &analysis_cache;
 
     Transaction txn{};
@@ -29,7 +29,7 @@ const state::Object* IntraBlockState::get_object(const evmc::address& address) c
         return &it->second;
     }
 
-    std::optional<Account> account{db_.read_account(address)};
+    std::optional<Account> account{db_->read_account(address)};
     if (account == std::nullopt) {
         return nullptr;
     }
@@ -99,7 +99,7 @@ void IntraBlockState::create_contract(const evmc::address& address) noexcept {
     }
 
     if (!prev_incarnation || prev_incarnation == 0) {
-        prev_incarnation = db_.previous_incarnation(address);
+        prev_incarnation = db_->previous_incarnation(address);
     }
     if (prev && prev_incarnation < prev->current->previous_incarnation) {
         prev_incarnation = prev->current->previous_incarnation;
@@ -219,7 +219,7 @@ ByteView IntraBlockState::get_code(const evmc::address& address) const noexcept
         return it->second;
     }
 
-    ByteView code{db_.read_code(code_hash)};
+    ByteView code{db_->read_code(code_hash)};
     existing_code_[code_hash] = code;
     return code;
 }
@@ -291,7 +291,7 @@ evmc::bytes32 IntraBlockState::get_storage(const evmc::address& address, const e
         return evmc::bytes32{};
     }
 
-    evmc::bytes32 val{db_.read_storage(address, incarnation, key)};
+    evmc::bytes32 val{db_->read_storage(address, incarnation, key)};
 
     state::CommittedValue& entry{storage_[address].committed[key]};
     entry.initial = val;
@@ -322,7 +322,7 @@ void IntraBlockState::set_transient_storage(const evmc::address& addr, const evm
 }
 
 void IntraBlockState::write_to_db(uint64_t block_number) {
-    db_.begin_block(block_number, objects_.size());
+    db_->begin_block(block_number, objects_.size());
 
     for (const auto& [address, storage] : storage_) {
         auto it1{objects_.find(address)};
@@ -336,12 +336,12 @@ void IntraBlockState::write_to_db(uint64_t block_number) {
 
         for (const auto& [key, val] : storage.committed) {
             uint64_t incarnation{obj.current->incarnation};
-            db_.update_storage(address, incarnation, key, val.initial, val.original);
+            db_->update_storage(address, incarnation, key, val.initial, val.original);
         }
     }
 
     for (const auto& [address, obj] : objects_) {
-        db_.update_account(address, obj.initial, obj.current);
+        db_->update_account(address, obj.initial, obj.current);
         if (!obj.current) {
             continue;
         }
@@ -350,7 +350,7 @@ void IntraBlockState::write_to_db(uint64_t block_number) {
             (!obj.initial || obj.initial->incarnation != obj.current->incarnation)) {
             if (auto it{new_code_.find(code_hash)}; it != new_code_.end()) {
                 ByteView code_view{it->second.data(), it->second.size()};
-                db_.update_account_code(address, obj.current->incarnation, code_hash, code_view);
+                db_->update_account_code(address, obj.current->incarnation, code_hash, code_view);
             }
         }
     }
@@ -400,6 +400,15 @@ void IntraBlockState::clear_journal_and_substate() {
     transient_storage_.clear();
 }
 
+void IntraBlockState::reset(State& db) noexcept {
+    db_ = &db;
+    objects_.clear();
+    storage_.clear();
+    existing_code_.clear();
+    new_code_.clear();
+    clear_journal_and_substate();
+}
+
 void IntraBlockState::add_log(const Log& log) noexcept { logs_.push_back(log); }
 
 }  // namespace silkworm
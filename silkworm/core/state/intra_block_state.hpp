@@ -52,9 +52,9 @@ class IntraBlockState {
     IntraBlockState(const IntraBlockState&) = delete;
     IntraBlockState& operator=(const IntraBlockState&) = delete;
 
-    explicit IntraBlockState(State& db) noexcept : db_{db} {}
+    explicit IntraBlockState(State& db) noexcept : db_{&db} {}
 
-    State& db() { return db_; }
+    State& db() { return *db_; }
 
     bool exists(const evmc::address& address) const noexcept;
 
@@ -106,6 +106,10 @@ class IntraBlockState {
     // See Section 6.1 "Substate" of the Yellow Paper
     void clear_journal_and_substate();
 
+    // Drop all the cached objects, the journal and the substate, then read from db from now on.
+    // Allows reusing the same instance (and, where the containers keep it, their capacity) across executions.
+    void reset(State& db) noexcept;
+
     void add_log(const Log& log) noexcept;
 
     std::vector<Log>& logs() noexcept { return logs_; }
@@ -139,7 +143,7 @@ class IntraBlockState {
 
     state::Object& get_or_create_object(const evmc::address& address) noexcept;
 
-    State& db_;
+    State* db_;
 
     mutable FlatHashMap<evmc::address, state::Object> objects_;
     mutable FlatHashMap<evmc::address, state::Storage> storage_;
@@ -99,4 +99,26 @@ TEST_CASE("Code view stability") {
     }
 }
 
+TEST_CASE("Reset to another state") {
+    const evmc::address addr{random_address()};
+    InMemoryState db1;
+    db1.update_account(addr, /*initial=*/std::nullopt, /*current=*/Account{.nonce = 1, .balance = 100});
+    InMemoryState db2;
+    db2.update_account(addr, /*initial=*/std::nullopt, /*current=*/Account{.nonce = 2, .balance = 200});
+
+    IntraBlockState state{db1};
+    state.set_balance(addr, 150);
+    state.access_account(addr);
+    state.set_code(random_address(), random_code());
+    CHECK(state.get_balance(addr) == 150);
+
+    state.reset(db2);
+    CHECK(&state.db() == &db2);
+    CHECK(state.get_nonce(addr) == 2);
+    CHECK(state.get_balance(addr) == 200);
+    CHECK(state.access_account(addr) == EVMC_ACCESS_COLD);
+    CHECK(state.touched().empty());
+    CHECK(state.created().empty());
+}
+
 }  // namespace silkworm
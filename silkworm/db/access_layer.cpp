@@ -27,6 +27,7 @@
 #include <silkworm/db/headers/header_queries.hpp>
 #include <silkworm/db/mdbx/bitmap.hpp>
 #include <silkworm/db/receipt_cbor.hpp>
+#include <silkworm/db/receipt_offsets.hpp>
 #include <silkworm/db/snapshots/repository.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/db/transactions/txn_queries.hpp>
@@ -640,6 +641,9 @@ void write_receipts(RWTxn& txn, const std::vector<silkworm::Receipt>& receipts,
     auto key{db::block_key(block_number)};
     Bytes value{cbor_encode(receipts)};
     target->upsert(to_slice(key), to_slice(value));
+
+    target->bind(txn, table::kReceiptOffsets);
+    target->upsert(to_slice(key), to_slice(encode_receipt_offsets(receipts)));
 }
 
 std::optional<ByteView> read_code(ROTxn& txn, const evmc::bytes32& code_hash) {
@@ -661,8 +665,7 @@ static std::optional<ByteView> historical_account(ROTxn& txn, const evmc::addres
         return std::nullopt;
     }
 
-    const auto bitmap{bitmap::parse(data.value)};
-    const auto change_block{bitmap::seek(bitmap, block_number)};
+    const auto change_block{bitmap::seek_serialized(from_slice(data.value), block_number)};
     if (!change_block) {
         return std::nullopt;
     }
@@ -690,8 +693,7 @@ static std::optional<ByteView> historical_storage(ROTxn& txn, const evmc::addres
         return std::nullopt;
     }
 
-    const auto bitmap{bitmap::parse(data.value)};
-    const auto change_block{bitmap::seek(bitmap, block_number)};
+    const auto change_block{bitmap::seek_serialized(from_slice(data.value), block_number)};
     if (!change_block) {
         return std::nullopt;
     }
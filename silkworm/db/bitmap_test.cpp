@@ -14,12 +14,15 @@
    limitations under the License.
 */
 
+#include <limits>
 #include <map>
+#include <optional>
 #include <vector>
 
 #include <absl/container/btree_map.h>
 #include <catch2/catch_test_macros.hpp>
 
+#include <silkworm/core/common/util.hpp>
 #include <silkworm/db/mdbx/bitmap.hpp>
 #include <silkworm/db/mdbx/etl_mdbx_collector.hpp>
 #include <silkworm/db/test_util/temp_chain_data.hpp>
@@ -108,6 +111,71 @@ TEST_CASE("Roaring Bitmaps") {
     }
 }
 
+static void check_seek_serialized(roaring::Roaring64Map& bitmap, const std::vector<uint64_t>& probes) {
+    const Bytes data{to_bytes(bitmap)};
+    for (const auto n : probes) {
+        CHECK(seek_serialized(data, n) == seek(bitmap, n));
+    }
+}
+
+TEST_CASE("Seek in serialized bitmap") {
+    SECTION("empty") {
+        CHECK(!seek_serialized({}, 0));
+        CHECK(!seek_serialized32({}, 0));
+    }
+
+    SECTION("array containers") {
+        roaring::Roaring64Map bitmap;
+        for (uint64_t i{0}; i < 1'000; ++i) {
+            bitmap.add(i * 7'919);
+        }
+        check_seek_serialized(bitmap, {0, 1, 7'918, 7'919, 7'920, 65'535, 65'536, 1'000'000, 7'911'081, 7'911'082});
+    }
+
+    SECTION("bitset containers") {
+        roaring::Roaring64Map bitmap;
+        for (uint64_t i{0}; i < 200'000; i += 3) {
+            bitmap.add(i);
+        }
+        check_seek_serialized(bitmap, {0, 1, 2, 3, 4, 65'535, 65'536, 65'537, 131'071, 199'998, 199'999, 200'000});
+    }
+
+    SECTION("run containers") {
+        roaring::Roaring64Map bitmap{roaring::api::roaring_bitmap_from_range(1'000, 150'000, 1)};
+        bitmap.addRange(300'000, 300'010);
+        bitmap.runOptimize();
+        check_seek_serialized(bitmap, {0, 999, 1'000, 1'001, 65'536, 149'999, 150'000, 299'999, 300'009, 300'010});
+    }
+
+    SECTION("values beyond 32 bits") {
+        roaring::Roaring64Map bitmap;
+        bitmap.add(uint64_t{5});
+        bitmap.add(uint64_t{1} << 33);
+        bitmap.add((uint64_t{1} << 40) + 17);
+        check_seek_serialized(bitmap, {0, 6, uint64_t{1} << 32, uint64_t{1} << 33, (uint64_t{1} << 33) + 1,
+                                       (uint64_t{1} << 40) + 17, (uint64_t{1} << 40) + 18});
+    }
+
+    SECTION("32-bit bitmap") {
+        roaring::Roaring bitmap;
+        for (uint32_t i{10}; i < 70'000; i += 5) {
+            bitmap.add(i);
+        }
+        const Bytes data{to_bytes(bitmap)};
+        for (const uint32_t n : {0u, 10u, 11u, 15u, 65'540u, 69'995u, 69'996u, std::numeric_limits<uint32_t>::max()}) {
+            roaring::Roaring::const_iterator it{bitmap.begin()};
+            it.equalorlarger(n);
+            const auto expected{it != bitmap.end() ? std::make_optional(*it) : std::nullopt};
+            CHECK(seek_serialized32(data, n) == expected);
+        }
+    }
+
+    SECTION("invalid data") {
+        CHECK_THROWS_AS(seek_serialized(*from_hex("0100000000000000"), 0), std::logic_error);
+        CHECK_THROWS_AS(seek_serialized32(*from_hex("01020304"), 0), std::logic_error);
+    }
+}
+
 TEST_CASE("Bitmap Index Loader") {
     db::test_util::TempChainData context;
     db::RWTxn& txn{context.rw_txn()};
@@ -25,6 +25,7 @@
 #include <silkworm/db/access_layer.hpp>
 #include <silkworm/db/log_cbor.hpp>
 #include <silkworm/db/receipt_cbor.hpp>
+#include <silkworm/db/receipt_offsets.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
@@ -237,6 +238,23 @@ void Buffer::write_history_to_db(bool write_change_sets) {
         written_size = 0;
     }
 
+    if (!receipt_offsets_.empty()) {
+        auto receipt_offset_table{db::open_cursor(txn_, table::kReceiptOffsets)};
+        for (const auto& [block_key, receipt_offsets] : receipt_offsets_) {
+            auto k{to_slice(block_key)};
+            auto v{to_slice(receipt_offsets)};
+            mdbx::error::success_or_throw(receipt_offset_table.put(k, &v, MDBX_APPEND));
+            written_size += k.length() + v.length();
+        }
+        receipt_offsets_.clear();
+        total_written_size += written_size;
+        if (should_trace) [[unlikely]] {
+            auto [_, duration]{sw.lap()};
+            log::Trace("Append Receipt Offsets", {"size", human_size(written_size), "in", StopWatch::format(duration)});
+        }
+        written_size = 0;
+    }
+
     if (!logs_.empty()) {
         auto log_table{db::open_cursor(txn_, table::kLogs)};
         for (const auto& [log_key, value] : logs_) {
@@ -426,6 +444,7 @@ void Buffer::insert_receipts(uint64_t block_number, const std::vector<Receipt>&
     Bytes key{block_key(block_number)};
     Bytes value{cbor_encode(receipts)};
     receipts_[key] = value;
+    receipt_offsets_[key] = encode_receipt_offsets(receipts);
 }
 
 void Buffer::insert_call_traces(BlockNum block_number, const CallTraces& traces) {
@@ -186,6 +186,7 @@ class Buffer : public State {
     absl::btree_map<BlockNum, AccountChanges> block_account_changes_;  // per block
     absl::btree_map<BlockNum, StorageChanges> block_storage_changes_;  // per block
     absl::btree_map<Bytes, Bytes> receipts_;
+    absl::btree_map<Bytes, Bytes> receipt_offsets_;
     absl::btree_map<Bytes, Bytes> logs_;
     absl::btree_map<BlockNum, absl::btree_set<Bytes>> call_traces_;
 
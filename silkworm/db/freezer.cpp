@@ -16,12 +16,21 @@
 
 #include "freezer.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <exception>
 #include <filesystem>
+#include <future>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/types/block_body_for_storage.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
+#include <silkworm/infra/common/ensure.hpp>
+#include <silkworm/infra/common/log.hpp>
 
 #include "access_layer.hpp"
 #include "bodies/body_snapshot_freezer.hpp"
@@ -31,7 +40,10 @@
 #include "snapshots/path.hpp"
 #include "snapshots/snapshot_bundle.hpp"
 #include "snapshots/snapshot_writer.hpp"
+#include "stages.hpp"
+#include "tables.hpp"
 #include "transactions/txn_snapshot_freezer.hpp"
+#include "util.hpp"
 
 namespace silkworm::db {
 
@@ -53,14 +65,115 @@ struct FreezerResult : public DataMigrationResult {
     ~FreezerResult() override = default;
 };
 
+//! Number of snapshot types produced for each block range, i.e. headers, bodies and transactions
+static constexpr unsigned kSnapshotTypeCount{3};
+
 static BlockNum get_tip_num(ROTxn& txn) {
     auto [num, _] = db::read_canonical_head(txn);
     return num;
 }
 
-std::unique_ptr<DataMigrationCommand> Freezer::next_command() {
+//! Wait for all the tasks to complete, then rethrow the first error (if any)
+static void wait_for_all(std::vector<std::future<void>>& futures) {
+    std::exception_ptr first_error;
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_error) first_error = std::current_exception();
+        }
+    }
+    futures.clear();
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+Freezer::Freezer(
+    db::RWAccess db_access,
+    snapshots::SnapshotRepository& snapshots,
+    std::filesystem::path tmp_dir_path,
+    bool prune_blocks)
+    : db_access_(std::move(db_access)),
+      snapshots_(snapshots),
+      tmp_dir_path_(std::move(tmp_dir_path)),
+      prune_blocks_(prune_blocks),
+      compress_workers_(kSnapshotTypeCount),
+      index_workers_(std::max(1u, std::thread::hardware_concurrency() / 2)) {}
+
+Freezer::~Freezer() {
+    stop();
+    join();
+}
+
+void Freezer::start() {
+    ensure(!pipeline_thread_.joinable(), "Freezer::start: already started");
+    pipeline_thread_ = std::thread{[this] {
+        log::set_thread_name("freezer");
+        run_pipeline();
+    }};
+}
+
+bool Freezer::stop() {
+    const bool stop_requested = Stoppable::stop();
+    {
+        // Synchronize with the idle wait, so that the notification cannot be lost
+        std::scoped_lock lock{stop_mutex_};
+    }
+    stop_cv_.notify_all();
+    return stop_requested;
+}
+
+void Freezer::join() {
+    if (pipeline_thread_.joinable()) {
+        pipeline_thread_.join();
+    }
+}
+
+void Freezer::run_pipeline() {
+    // The range migrated last, whose indexes are built while the next range is compressed
+    std::shared_ptr<DataMigrationResult> pending_result;
+    std::vector<std::future<void>> pending_indexing;
+    BlockNum pending_block_to{0};
+    auto commit_pending = [&]() {
+        if (!pending_result) return;
+        wait_for_all(pending_indexing);
+        commit(pending_result);
+        pending_result.reset();
+        cleanup();
+    };
+
+    try {
+        cleanup();
+        while (!is_stopping()) {
+            // The pending range is not in the repository yet, so it must be skipped explicitly
+            auto range = next_range(pending_result ? pending_block_to : 0);
+            if (!range) {
+                commit_pending();
+                std::unique_lock lock{stop_mutex_};
+                stop_cv_.wait_for(lock, kIdleInterval, [this] { return is_stopping(); });
+                continue;
+            }
+            auto result = migrate(std::make_unique<FreezerCommand>(*range));
+            commit_pending();
+            pending_indexing = start_indexing(result);
+            pending_result = std::move(result);
+            pending_block_to = range->second;
+        }
+        commit_pending();
+    } catch (const std::exception& ex) {
+        SILK_ERROR << "Freezer: pipeline aborted: " << ex.what();
+    }
+    // The index builders of an aborted range must not outlive the pipeline
+    for (auto& future : pending_indexing) {
+        if (future.valid()) future.wait();
+    }
+}
+
+std::optional<BlockNumRange> Freezer::next_range(BlockNum min_block_num) {
     BlockNum last_frozen = snapshots_.max_block_available();
     BlockNum start = (last_frozen > 0) ? last_frozen + 1 : 0;
+    start = std::max(start, min_block_num);
     BlockNum end = start + kChunkSize;
 
     BlockNum tip = [this] {
@@ -69,9 +182,15 @@ std::unique_ptr<DataMigrationCommand> Freezer::next_command() {
     }();
 
     if (end + kFullImmutabilityThreshold <= tip) {
-        return std::make_unique<FreezerCommand>(FreezerCommand{{start, end}});
+        return BlockNumRange{start, end};
     }
-    return {};
+    return std::nullopt;
+}
+
+std::unique_ptr<DataMigrationCommand> Freezer::next_command() {
+    auto range = next_range(0);
+    if (!range) return {};
+    return std::make_unique<FreezerCommand>(FreezerCommand{*range});
 }
 
 static const SnapshotFreezer& get_snapshot_freezer(SnapshotType type) {
@@ -97,31 +216,45 @@ std::shared_ptr<DataMigrationResult> Freezer::migrate(std::unique_ptr<DataMigrat
     auto range = freezer_command.range;
 
     auto bundle = snapshots_.bundle_factory().make(tmp_dir_path_, range);
+
+    // Each snapshot type is streamed into its compressor on a dedicated worker using its own read-only transaction,
+    // kept open for the whole range
+    std::vector<std::future<void>> copies;
     for (auto& snapshot_ref : bundle.snapshots()) {
         auto path = snapshot_ref.get().path();
-        SnapshotFileWriter file_writer{path, tmp_dir_path_};
-        {
-            auto db_tx = db_access_.start_ro_tx();
-            auto& freezer = get_snapshot_freezer(path.type());
-            freezer.copy(db_tx, range, file_writer);
-        }
-        SnapshotFileWriter::flush(std::move(file_writer));
+        copies.push_back(compress_workers_.submit([this, path, range]() {
+            SnapshotFileWriter file_writer{path, tmp_dir_path_};
+            {
+                auto db_tx = db_access_.start_ro_tx();
+                auto& freezer = get_snapshot_freezer(path.type());
+                freezer.copy(db_tx, range, file_writer);
+            }
+            SnapshotFileWriter::flush(std::move(file_writer));
+        }));
     }
+    wait_for_all(copies);
 
     return std::make_shared<FreezerResult>(std::move(bundle));
 }
 
-void Freezer::index(std::shared_ptr<DataMigrationResult> result) {
+std::vector<std::future<void>> Freezer::start_indexing(const std::shared_ptr<DataMigrationResult>& result) {
     auto& freezer_result = dynamic_cast<FreezerResult&>(*result);
     auto& bundle = freezer_result.bundle;
 
+    std::vector<std::future<void>> builds;
     for (auto& snapshot_ref : bundle.snapshots()) {
         SnapshotPath snapshot_path = snapshot_ref.get().path();
         auto index_builders = snapshots_.bundle_factory().index_builders(snapshot_path);
         for (auto& index_builder : index_builders) {
-            index_builder->build();
+            builds.push_back(index_workers_.submit([index_builder]() { index_builder->build(); }));
         }
     }
+    return builds;
+}
+
+void Freezer::index(std::shared_ptr<DataMigrationResult> result) {
+    auto builds = start_indexing(result);
+    wait_for_all(builds);
 }
 
 static void move_file(const std::filesystem::path& path, const std::filesystem::path& target_dir_path) {
@@ -144,7 +277,72 @@ void Freezer::commit(std::shared_ptr<DataMigrationResult> result) {
 }
 
 void Freezer::cleanup() {
-    // TODO
+    if (!prune_blocks_) return;
+
+    const BlockNum max_block_num = max_prunable_block();
+    if (max_block_num == 0) return;
+
+    // Prune in small commits, so that neither the write lock nor the dirty pages grow with the frozen range
+    size_t pruned_count{0};
+    size_t pruned{0};
+    do {
+        pruned = prune_frozen_blocks(max_block_num, kPruneBlocksPerCommit);
+        pruned_count += pruned;
+    } while (pruned == kPruneBlocksPerCommit);
+
+    if (pruned_count > 0) {
+        SILK_DEBUG << "Freezer: pruned " << pruned_count << " frozen blocks up to " << max_block_num;
+    }
+}
+
+BlockNum Freezer::max_prunable_block() {
+    const BlockNum max_frozen = snapshots_.max_block_available();
+    if (max_frozen == 0) return 0;
+
+    // The stages reading the block bodies and transactions straight from the database may lag behind the frozen tip
+    auto db_tx = db_access_.start_ro_tx();
+    BlockNum max_block_num = max_frozen;
+    for (const char* stage_name : {stages::kSendersKey, stages::kExecutionKey, stages::kTxLookupKey}) {
+        max_block_num = std::min(max_block_num, stages::read_stage_progress(db_tx, stage_name));
+    }
+    return max_block_num;
+}
+
+size_t Freezer::prune_frozen_blocks(BlockNum max_block_num, size_t max_count) {
+    auto db_tx = db_access_.start_rw_tx();
+
+    // Genesis is always kept in the database
+    const Bytes first_key{block_key(1)};
+
+    size_t pruned_bodies{0};
+    auto bodies_cursor = db_tx.rw_cursor(table::kBlockBodies);
+    auto txs_cursor = db_tx.rw_cursor(table::kBlockTransactions);
+    for (auto data = bodies_cursor->lower_bound(to_slice(first_key), /*throw_notfound=*/false);
+         data && block_number_from_key(data.key) <= max_block_num && pruned_bodies < max_count;
+         data = bodies_cursor->to_next(/*throw_notfound=*/false)) {
+        ByteView body_view{from_slice(data.value)};
+        const auto body{unwrap_or_throw(decode_stored_block_body(body_view))};
+        const uint64_t end_txn_id{body.base_txn_id + body.txn_count};
+        for (auto tx_data = txs_cursor->lower_bound(to_slice(block_key(body.base_txn_id)), /*throw_notfound=*/false);
+             tx_data && endian::load_big_u64(static_cast<const uint8_t*>(tx_data.key.data())) < end_txn_id;
+             tx_data = txs_cursor->to_next(/*throw_notfound=*/false)) {
+            txs_cursor->erase();
+        }
+        bodies_cursor->erase();
+        ++pruned_bodies;
+    }
+
+    size_t pruned_headers{0};
+    auto headers_cursor = db_tx.rw_cursor(table::kHeaders);
+    for (auto data = headers_cursor->lower_bound(to_slice(first_key), /*throw_notfound=*/false);
+         data && block_number_from_key(data.key) <= max_block_num && pruned_headers < max_count;
+         data = headers_cursor->to_next(/*throw_notfound=*/false)) {
+        headers_cursor->erase();
+        ++pruned_headers;
+    }
+
+    db_tx.commit_and_stop();
+    return std::max(pruned_bodies, pruned_headers);
 }
 
 }  // namespace silkworm::db
@@ -16,24 +16,53 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <silkworm/infra/concurrency/stoppable.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+
 #include "data_migration.hpp"
 #include "mdbx/mdbx.hpp"
 #include "snapshots/repository.hpp"
 
 namespace silkworm::db {
 
-class Freezer : public DataMigration {
+//! \brief Migrates the immutable blocks from the database to snapshot files.
+//! \details The freezer can either run one migration step at a time (DataMigration::run) or as a continuous
+//! background pipeline (start/stop): the snapshot files of one block range are compressed concurrently while the
+//! indexes of the previous range are still being built, and each range is added to the repository only once all its
+//! indexes are built. When pruning is enabled, the frozen blocks are then deleted from the database in small write
+//! transactions, but only up to the lowest progress of the stages reading them from the database.
+class Freezer : public DataMigration, public Stoppable {
   public:
     Freezer(
-        db::ROAccess db_access,
+        db::RWAccess db_access,
         snapshots::SnapshotRepository& snapshots,
-        std::filesystem::path tmp_dir_path)
-        : db_access_(std::move(db_access)),
-          snapshots_(snapshots),
-          tmp_dir_path_(std::move(tmp_dir_path)) {}
+        std::filesystem::path tmp_dir_path,
+        bool prune_blocks = false);
+    ~Freezer() override;
 
-  private:
+    //! Start the background freezing pipeline
+    void start();
+
+    //! Request the background pipeline to stop: the range being processed, if any, is completed before exiting
+    bool stop() override;
+
+    //! Wait for the background pipeline to exit
+    void join();
+
+  protected:
     static constexpr size_t kChunkSize = 1000;
+    //! Max number of blocks pruned from the database in one write transaction
+    static constexpr size_t kPruneBlocksPerCommit = 100;
+    //! Interval between two checks for new immutable blocks when the pipeline is idle
+    static constexpr std::chrono::seconds kIdleInterval{10};
 
     std::unique_ptr<DataMigrationCommand> next_command() override;
     std::shared_ptr<DataMigrationResult> migrate(std::unique_ptr<DataMigrationCommand> command) override;
@@ -41,9 +70,34 @@ class Freezer : public DataMigration {
     void commit(std::shared_ptr<DataMigrationResult> result) override;
     void cleanup() override;
 
-    db::ROAccess db_access_;
+    //! \return the next range of immutable blocks to migrate, starting not before min_block_num (if any)
+    std::optional<BlockNumRange> next_range(BlockNum min_block_num);
+
+    //! Submit the index builders of the migrated snapshots to the indexing workers
+    std::vector<std::future<void>> start_indexing(const std::shared_ptr<DataMigrationResult>& result);
+
+    //! \return the highest block that can be pruned from the database, i.e. frozen and processed by all the stages
+    //! reading blocks from the database
+    BlockNum max_prunable_block();
+
+    //! Delete up to max_count blocks not greater than max_block_num (genesis excluded) in a single write transaction
+    //! \return the number of deleted blocks
+    size_t prune_frozen_blocks(BlockNum max_block_num, size_t max_count);
+
+  private:
+    void run_pipeline();
+
+    db::RWAccess db_access_;
     snapshots::SnapshotRepository& snapshots_;
     std::filesystem::path tmp_dir_path_;
+    bool prune_blocks_;
+
+    ThreadPool compress_workers_;
+    ThreadPool index_workers_;
+
+    std::thread pipeline_thread_;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
 };
 
 }  // namespace silkworm::db
@@ -0,0 +1,288 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "freezer.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/headers/header_queries.hpp>
+#include <silkworm/db/prune_mode.hpp>
+#include <silkworm/db/snapshot_bundle_factory_impl.hpp>
+#include <silkworm/db/stages.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+
+namespace silkworm::db {
+
+using evmc::literals::operator""_address;
+using silkworm::test_util::SetLogVerbosityGuard;
+
+class Freezer_ForTest : public Freezer {
+  public:
+    using Freezer::Freezer;
+    using Freezer::max_prunable_block;
+    using Freezer::prune_frozen_blocks;
+};
+
+//! Number of blocks written by populate_blocks by default, i.e. exactly one freezer chunk
+static constexpr BlockNum kBlockCount{1'000};
+
+//! Write the canonical blocks in [0, block_count) with one transaction each and make them immutable
+//! \param skip_header the block whose header must not be written (if any)
+static void populate_blocks(RWTxn& txn, std::optional<BlockNum> skip_header = std::nullopt, BlockNum block_count = kBlockCount) {
+    evmc::bytes32 parent_hash{};
+    for (BlockNum block_num{0}; block_num < block_count; ++block_num) {
+        BlockHeader header;
+        header.number = block_num;
+        header.parent_hash = parent_hash;
+        header.gas_limit = 5'000'000;
+        const auto hash = header.hash();
+        write_canonical_header_hash(txn, hash.bytes, block_num);
+        if (block_num != skip_header) {
+            write_header(txn, header, /*with_header_numbers=*/true);
+        }
+
+        BlockBody body;
+        body.transactions.resize(1);
+        body.transactions[0].nonce = block_num;
+        body.transactions[0].gas_limit = 21'000;
+        body.transactions[0].to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+        body.transactions[0].value = 1;
+        REQUIRE(body.transactions[0].set_v(27));
+        body.transactions[0].r = 1;
+        body.transactions[0].s = 1;
+        write_body(txn, body, hash, block_num);
+
+        parent_hash = hash;
+    }
+    // The canonical chain tip must be beyond the immutability threshold for the blocks to be frozen
+    const evmc::bytes32 tip_hash{0x01};
+    write_canonical_header_hash(txn, tip_hash.bytes, block_count + kFullImmutabilityThreshold);
+}
+
+static void write_block_reader_stages_progress(RWTxn& txn, BlockNum block_num) {
+    for (const char* stage_name : {stages::kSendersKey, stages::kExecutionKey, stages::kTxLookupKey}) {
+        stages::write_stage_progress(txn, stage_name, block_num);
+    }
+}
+
+static bool has_block_in_db(ROTxn& txn, BlockNum block_num) {
+    BlockBody body;
+    return read_canonical_header(txn, block_num) && read_canonical_body(txn, block_num, /*read_senders=*/false, body);
+}
+
+class FreezerTest {
+  public:
+    FreezerTest() {
+        std::filesystem::create_directories(snapshots_dir_path_);
+        std::filesystem::create_directories(freezer_tmp_dir_path_);
+    }
+
+  protected:
+    SetLogVerbosityGuard log_guard_{log::Level::kNone};
+    test_util::TempChainData context_;
+    TemporaryDirectory tmp_dir_;
+    std::filesystem::path snapshots_dir_path_{tmp_dir_.path() / "snapshots"};
+    std::filesystem::path freezer_tmp_dir_path_{tmp_dir_.path() / "tmp"};
+    snapshots::SnapshotRepository repository_{snapshots::SnapshotSettings{snapshots_dir_path_},
+                                              std::make_unique<SnapshotBundleFactoryImpl>()};
+};
+
+TEST_CASE_METHOD(FreezerTest, "Freezer::run", "[db][freezer]") {
+    SECTION("no immutable blocks") {
+        context_.commit_txn();
+        Freezer freezer{RWAccess{context_.env()}, repository_, freezer_tmp_dir_path_};
+        CHECK_NOTHROW(freezer.run());
+        CHECK(repository_.bundles_count() == 0);
+    }
+
+    SECTION("immutable blocks are frozen and kept in the database by default") {
+        populate_blocks(context_.rw_txn());
+        context_.commit_txn();
+
+        Freezer freezer{RWAccess{context_.env()}, repository_, freezer_tmp_dir_path_};
+        freezer.run();
+        REQUIRE(repository_.bundles_count() == 1);
+        CHECK(repository_.max_block_available() == kBlockCount - 1);
+
+        const auto& bundle = *repository_.view_bundles().begin();
+        snapshots::HeaderFindByBlockNumQuery header_by_number{bundle.snapshot_and_index(snapshots::SnapshotType::headers)};
+        for (const BlockNum block_num : {BlockNum{0}, BlockNum{500}, kBlockCount - 1}) {
+            const auto header = header_by_number.exec(block_num);
+            REQUIRE(header);
+            CHECK(header->number == block_num);
+        }
+
+        auto ro_txn = RWAccess{context_.env()}.start_ro_tx();
+        CHECK(has_block_in_db(ro_txn, 1));
+        CHECK(has_block_in_db(ro_txn, kBlockCount - 1));
+
+        // The next range is not immutable yet
+        freezer.run();
+        CHECK(repository_.bundles_count() == 1);
+    }
+
+    SECTION("missing block") {
+        populate_blocks(context_.rw_txn(), /*skip_header=*/500);
+        context_.commit_txn();
+
+        Freezer freezer{RWAccess{context_.env()}, repository_, freezer_tmp_dir_path_};
+        CHECK_THROWS_AS(freezer.run(), std::runtime_error);
+        CHECK(repository_.bundles_count() == 0);
+        CHECK(repository_.max_block_available() == 0);
+    }
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer pruning", "[db][freezer]") {
+    populate_blocks(context_.rw_txn());
+    write_block_reader_stages_progress(context_.rw_txn(), 500);
+    context_.commit_txn();
+    RWAccess db_access{context_.env()};
+
+    Freezer_ForTest freezer{db_access, repository_, freezer_tmp_dir_path_, /*prune_blocks=*/true};
+    CHECK(freezer.max_prunable_block() == 0);
+
+    // Blocks are pruned only up to the lowest progress of the stages reading them
+    freezer.run();
+    REQUIRE(repository_.max_block_available() == kBlockCount - 1);
+    {
+        auto ro_txn = db_access.start_ro_tx();
+        CHECK(has_block_in_db(ro_txn, 0));  // genesis is always kept
+        CHECK_FALSE(has_block_in_db(ro_txn, 1));
+        CHECK_FALSE(has_block_in_db(ro_txn, 500));
+        CHECK(has_block_in_db(ro_txn, 501));
+        CHECK(has_block_in_db(ro_txn, kBlockCount - 1));
+    }
+
+    SECTION("any lagging stage stops pruning") {
+        auto rw_txn = db_access.start_rw_tx();
+        write_block_reader_stages_progress(rw_txn, kBlockCount + 1);
+        stages::write_stage_progress(rw_txn, stages::kTxLookupKey, 700);
+        rw_txn.commit_and_stop();
+        CHECK(freezer.max_prunable_block() == 700);
+
+        freezer.run();
+        auto ro_txn = db_access.start_ro_tx();
+        CHECK_FALSE(has_block_in_db(ro_txn, 700));
+        CHECK(has_block_in_db(ro_txn, 701));
+    }
+
+    SECTION("pruning stops at the frozen blocks") {
+        auto rw_txn = db_access.start_rw_tx();
+        write_block_reader_stages_progress(rw_txn, kBlockCount + 1);
+        rw_txn.commit_and_stop();
+        CHECK(freezer.max_prunable_block() == kBlockCount - 1);
+
+        freezer.run();
+        auto ro_txn = db_access.start_ro_tx();
+        CHECK(has_block_in_db(ro_txn, 0));
+        CHECK_FALSE(has_block_in_db(ro_txn, kBlockCount - 1));
+        CHECK(read_canonical_header_hash(ro_txn, kBlockCount + kFullImmutabilityThreshold));
+    }
+
+    SECTION("prune_frozen_blocks deletes at most the requested count") {
+        CHECK(freezer.prune_frozen_blocks(kBlockCount - 1, 10) == 10);
+        auto ro_txn = db_access.start_ro_tx();
+        CHECK_FALSE(has_block_in_db(ro_txn, 510));
+        CHECK(has_block_in_db(ro_txn, 511));
+    }
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer pruning is disabled by default", "[db][freezer]") {
+    populate_blocks(context_.rw_txn());
+    write_block_reader_stages_progress(context_.rw_txn(), kBlockCount + 1);
+    context_.commit_txn();
+    RWAccess db_access{context_.env()};
+
+    Freezer freezer{db_access, repository_, freezer_tmp_dir_path_};
+    freezer.run();
+    REQUIRE(repository_.max_block_available() == kBlockCount - 1);
+    auto ro_txn = db_access.start_ro_tx();
+    CHECK(has_block_in_db(ro_txn, 1));
+    CHECK(has_block_in_db(ro_txn, kBlockCount - 1));
+}
+
+TEST_CASE_METHOD(FreezerTest, "Freezer background pipeline", "[db][freezer]") {
+    SECTION("stop while idle") {
+        context_.commit_txn();
+        Freezer freezer{RWAccess{context_.env()}, repository_, freezer_tmp_dir_path_};
+        freezer.start();
+        CHECK_THROWS(freezer.start());
+        const auto start_time = std::chrono::steady_clock::now();
+        CHECK(freezer.stop());
+        freezer.join();
+        // The idle wait is interrupted by the stop request
+        CHECK(std::chrono::steady_clock::now() - start_time < std::chrono::seconds{5});
+        CHECK(repository_.bundles_count() == 0);
+    }
+
+    SECTION("consecutive ranges are frozen while the repository is read") {
+        populate_blocks(context_.rw_txn(), /*skip_header=*/std::nullopt, 2 * kBlockCount);
+        write_block_reader_stages_progress(context_.rw_txn(), 2 * kBlockCount + 1);
+        context_.commit_txn();
+        RWAccess db_access{context_.env()};
+
+        Freezer freezer{db_access, repository_, freezer_tmp_dir_path_, /*prune_blocks=*/true};
+        freezer.start();
+
+        // Readers can iterate over the bundles while the freezer adds new ones
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::minutes{1};
+        while (repository_.bundles_count() < 2 && std::chrono::steady_clock::now() < deadline) {
+            BlockNum expected_from{0};
+            for (const auto& bundle : repository_.view_bundles()) {
+                CHECK(bundle.block_from() == expected_from);
+                CHECK(bundle.block_to() == expected_from + kBlockCount);
+                expected_from = bundle.block_to();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        freezer.stop();
+        freezer.join();
+
+        REQUIRE(repository_.bundles_count() == 2);
+        CHECK(repository_.max_block_available() == 2 * kBlockCount - 1);
+        CHECK(repository_.find_segment(snapshots::SnapshotType::headers, kBlockCount + 500));
+
+        // Frozen blocks are pruned once committed to the repository
+        auto ro_txn = db_access.start_ro_tx();
+        CHECK(has_block_in_db(ro_txn, 0));
+        CHECK_FALSE(has_block_in_db(ro_txn, kBlockCount - 1));
+        CHECK_FALSE(has_block_in_db(ro_txn, 2 * kBlockCount - 1));
+    }
+
+    SECTION("missing block aborts the pipeline") {
+        populate_blocks(context_.rw_txn(), /*skip_header=*/500);
+        context_.commit_txn();
+
+        Freezer freezer{RWAccess{context_.env()}, repository_, freezer_tmp_dir_path_};
+        freezer.start();
+        // The pipeline exits on its own after logging the error
+        freezer.join();
+        CHECK(repository_.bundles_count() == 0);
+        CHECK(repository_.max_block_available() == 0);
+    }
+}
+
+}  // namespace silkworm::db
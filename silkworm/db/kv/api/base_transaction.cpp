@@ -33,6 +33,15 @@ Task<KeyValue> BaseTransaction::get(const std::string& table, ByteView key) {
     co_return kv_pair;
 }
 
+Task<KeyValueView> BaseTransaction::get_view(const std::string& table, ByteView key) {
+    // Keep the cursor alive until the next get_view, whatever the cursor ownership of the concrete transaction
+    view_cursor_ = co_await cursor(table);
+    SILK_TRACE << "BaseTransaction::get_view cursor_id: " << view_cursor_->cursor_id();
+    const auto kv_pair = co_await view_cursor_->seek_view(key);
+    SILK_TRACE << "BaseTransaction::get_view key: " << kv_pair.key << " value: " << kv_pair.value;
+    co_return kv_pair;
+}
+
 Task<silkworm::Bytes> BaseTransaction::get_one(const std::string& table, ByteView key) {
     co_return co_await std::invoke(get_one_impl_, *this, table, key);
 }
@@ -40,13 +49,14 @@ Task<silkworm::Bytes> BaseTransaction::get_one(const std::string& table, ByteVie
 Task<std::optional<Bytes>> BaseTransaction::get_both_range(const std::string& table, ByteView key, ByteView subkey) {
     const auto new_cursor = co_await cursor_dup_sort(table);
     SILK_TRACE << "BaseTransaction::get_both_range cursor_id: " << new_cursor->cursor_id();
-    const auto value{co_await new_cursor->seek_both(key, subkey)};
+    const auto value{co_await new_cursor->seek_both_view(key, subkey)};
     SILK_DEBUG << "BaseTransaction::get_both_range value: " << value << " subkey: " << subkey;
     if (value.substr(0, subkey.size()) != subkey) {
         SILK_DEBUG << "BaseTransaction::get_both_range value: " << value << " subkey: " << subkey;
         co_return std::nullopt;
     }
-    co_return value.substr(subkey.length());
+    // Copy just the bytes after the subkey out of the cursor
+    co_return Bytes{value.substr(subkey.length())};
 }
 
 Task<Bytes> BaseTransaction::get_one_impl_with_cache(const std::string& table, ByteView key) {
@@ -73,9 +83,9 @@ Task<Bytes> BaseTransaction::get_one_impl_with_cache(const std::string& table, B
 Task<Bytes> BaseTransaction::get_one_impl_no_cache(const std::string& table, ByteView key) {
     const auto new_cursor = co_await cursor(table);
     SILK_TRACE << "BaseTransaction::get_one cursor_id: " << new_cursor->cursor_id();
-    const auto kv_pair = co_await new_cursor->seek_exact(key);
+    const auto kv_pair = co_await new_cursor->seek_exact_view(key);
     SILK_TRACE << "BaseTransaction::get_one key: " << kv_pair.key << " value: " << kv_pair.value;
-    co_return kv_pair.value;
+    co_return Bytes{kv_pair.value};
 }
 
 }  // namespace silkworm::db::kv::api
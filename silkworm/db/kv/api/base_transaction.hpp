@@ -31,6 +31,8 @@ class BaseTransaction : public Transaction {
 
     Task<KeyValue> get(const std::string& table, ByteView key) override;
 
+    Task<KeyValueView> get_view(const std::string& table, ByteView key) override;
+
     Task<Bytes> get_one(const std::string& table, ByteView key) override;
 
     Task<std::optional<Bytes>> get_both_range(const std::string& table, ByteView key, ByteView subkey) override;
@@ -44,6 +46,9 @@ class BaseTransaction : public Transaction {
     GetOneImpl get_one_impl_with_cache_{&BaseTransaction::get_one_impl_with_cache};
     GetOneImpl get_one_impl_{get_one_impl_no_cache_};
     StateCache* state_cache_;
+
+    //! The cursor owning the pair returned by the last get_view
+    std::shared_ptr<Cursor> view_cursor_;
 };
 
 }  // namespace silkworm::db::kv::api
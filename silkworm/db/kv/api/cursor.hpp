@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 #include <silkworm/infra/concurrency/task.hpp>
@@ -27,6 +28,13 @@
 
 namespace silkworm::db::kv::api {
 
+//! Error raised by Cursor::open_cursor when the requested table does not exist in the database
+class TableNotFoundError : public std::runtime_error {
+  public:
+    explicit TableNotFoundError(const std::string& table_name)
+        : std::runtime_error{"unknown table: " + table_name} {}
+};
+
 class Cursor {
   public:
     Cursor() = default;
@@ -48,6 +56,29 @@ class Cursor {
     virtual Task<KeyValue> previous() = 0;
 
     virtual Task<void> close_cursor() = 0;
+
+    //! \brief Zero-copy variants of seek, seek_exact and next
+    //! \details The returned views are valid only until the next operation on this cursor. The default implementation
+    //! keeps the last copied pair alive inside the cursor, cursors on a local transaction override them to view directly
+    //! into the database pages and save the key/value copy.
+    virtual Task<KeyValueView> seek_view(ByteView key) {
+        view_storage_ = co_await seek(key);
+        co_return KeyValueView{view_storage_.key, view_storage_.value};
+    }
+
+    virtual Task<KeyValueView> seek_exact_view(ByteView key) {
+        view_storage_ = co_await seek_exact(key);
+        co_return KeyValueView{view_storage_.key, view_storage_.value};
+    }
+
+    virtual Task<KeyValueView> next_view() {
+        view_storage_ = co_await next();
+        co_return KeyValueView{view_storage_.key, view_storage_.value};
+    }
+
+  protected:
+    //! The last key/value pair returned by the default view operations
+    KeyValue view_storage_;
 };
 
 class CursorDupSort : public Cursor {
@@ -57,6 +88,12 @@ class CursorDupSort : public Cursor {
     virtual Task<KeyValue> seek_both_exact(ByteView key, ByteView value) = 0;
 
     virtual Task<KeyValue> next_dup() = 0;
+
+    //! Zero-copy variant of seek_both, the returned view has the same validity as the ones returned by Cursor::seek_view
+    virtual Task<ByteView> seek_both_view(ByteView key, ByteView value) {
+        view_storage_.value = co_await seek_both(key, value);
+        co_return ByteView{view_storage_.value};
+    }
 };
 
 }  // namespace silkworm::db::kv::api
@@ -25,6 +25,12 @@ struct KeyValue {
     Bytes value;
 };
 
+//! Non-owning counterpart of KeyValue: the viewed bytes are owned by the cursor which produced them
+struct KeyValueView {
+    ByteView key;
+    ByteView value;
+};
+
 inline bool operator<(const KeyValue& lhs, const KeyValue& rhs) {
     return lhs.key < rhs.key;
 }
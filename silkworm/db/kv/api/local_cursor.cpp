@@ -16,26 +16,46 @@
 
 #include "local_cursor.hpp"
 
-#include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/infra/common/clock_time.hpp>
 #include <silkworm/infra/common/log.hpp>
 
 namespace silkworm::db::kv::api {
 
+//! Build a key/value view pointing directly into the database pages (valid until the transaction is alive)
+static KeyValueView view_of(const CursorResult& result) {
+    return KeyValueView{from_slice(result.key), from_slice(result.value)};
+}
+
+//! Copy once the viewed key/value pair into owned bytes
+static KeyValue copy_of(const KeyValueView& kv) {
+    return KeyValue{Bytes{kv.key}, Bytes{kv.value}};
+}
+
 Task<void> LocalCursor::open_cursor(const std::string& table_name, bool is_dup_sorted) {
     const auto start_time = clock_time::now();
     SILK_DEBUG << "LocalCursor::open_cursor opening new cursor for table: " << table_name;
     // table_name name must be a valid MDBX map name
     if (!has_map(txn_, table_name.c_str())) {
-        const auto error_message = "unknown table: " + table_name;
-        SILK_ERROR << "open_cursor !has_map: " << table_name << " " << is_dup_sorted << error_message;
-        throw std::runtime_error(error_message);
+        SILK_ERROR << "open_cursor !has_map: " << table_name << " " << is_dup_sorted;
+        throw TableNotFoundError{table_name};
     }
     SILK_DEBUG << "LocalCursor::open_cursor [" << table_name << "] c=" << cursor_id_ << " t=" << clock_time::since(start_time);
     co_return;
 }
 
 Task<KeyValue> LocalCursor::seek(ByteView key) {
+    co_return copy_of(co_await seek_view(key));
+}
+
+Task<KeyValue> LocalCursor::seek_exact(ByteView key) {
+    co_return copy_of(co_await seek_exact_view(key));
+}
+
+Task<KeyValue> LocalCursor::next() {
+    co_return copy_of(co_await next_view());
+}
+
+Task<KeyValueView> LocalCursor::seek_view(ByteView key) {
     SILK_DEBUG << "LocalCursor::seek cursor: " << cursor_id_ << " key: " << key;
     mdbx::slice mdbx_key{key};
 
@@ -43,15 +63,15 @@ Task<KeyValue> LocalCursor::seek(ByteView key) {
     SILK_DEBUG << "LocalCursor::seek result: " << detail::dump_mdbx_result(result);
 
     if (result) {
-        SILK_DEBUG << "LocalCursor::seek found: key: " << key << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+        SILK_DEBUG << "LocalCursor::seek found: key: " << key << " value: " << from_slice(result.value);
+        co_return view_of(result);
     } else {
         SILK_DEBUG << "LocalCursor::seek not found key: " << key;
-        co_return KeyValue{};
+        co_return KeyValueView{};
     }
 }
 
-Task<KeyValue> LocalCursor::seek_exact(ByteView key) {
+Task<KeyValueView> LocalCursor::seek_exact_view(ByteView key) {
     SILK_DEBUG << "LocalCursor::seek_exact cursor: " << cursor_id_ << " key: " << key;
 
     const bool found = db_cursor_.seek(key);
@@ -60,15 +80,15 @@ Task<KeyValue> LocalCursor::seek_exact(ByteView key) {
         SILK_DEBUG << "LocalCursor::seek_exact result: " << detail::dump_mdbx_result(result);
         if (result) {
             SILK_DEBUG << "LocalCursor::seek_exact found: "
-                       << " key: " << key << " value: " << string_view_to_byte_view(result.value.as_string());
-            co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+                       << " key: " << key << " value: " << from_slice(result.value);
+            co_return view_of(result);
         }
         SILK_ERROR << "LocalCursor::seek_exact !result key: " << key;
     }
-    co_return KeyValue{};
+    co_return KeyValueView{};
 }
 
-Task<KeyValue> LocalCursor::next() {
+Task<KeyValueView> LocalCursor::next_view() {
     SILK_DEBUG << "LocalCursor::next: " << cursor_id_;
 
     const auto result = db_cursor_.to_next(/*throw_notfound=*/false);
@@ -76,12 +96,12 @@ Task<KeyValue> LocalCursor::next() {
 
     if (result) {
         SILK_DEBUG << "LocalCursor::next: "
-                   << " key: " << string_view_to_byte_view(result.key.as_string()) << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+                   << " key: " << from_slice(result.key) << " value: " << from_slice(result.value);
+        co_return view_of(result);
     } else {
         SILK_ERROR << "LocalCursor::next !result";
     }
-    co_return KeyValue{};
+    co_return KeyValueView{};
 }
 
 Task<KeyValue> LocalCursor::previous() {
@@ -92,8 +112,8 @@ Task<KeyValue> LocalCursor::previous() {
 
     if (result) {
         SILK_DEBUG << "LocalCursor::previous: "
-                   << " key: " << string_view_to_byte_view(result.key.as_string()) << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+                   << " key: " << from_slice(result.key) << " value: " << from_slice(result.value);
+        co_return copy_of(view_of(result));
     } else {
         SILK_ERROR << "LocalCursor::previous !result";
     }
@@ -108,8 +128,8 @@ Task<KeyValue> LocalCursor::next_dup() {
 
     if (result) {
         SILK_DEBUG << "LocalCursor::next_dup: "
-                   << " key: " << string_view_to_byte_view(result.key.as_string()) << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+                   << " key: " << from_slice(result.key) << " value: " << from_slice(result.value);
+        co_return copy_of(view_of(result));
     } else {
         SILK_ERROR << "LocalCursor::next_dup !result";
     }
@@ -117,16 +137,20 @@ Task<KeyValue> LocalCursor::next_dup() {
 }
 
 Task<Bytes> LocalCursor::seek_both(ByteView key, ByteView value) {
+    co_return Bytes{co_await seek_both_view(key, value)};
+}
+
+Task<ByteView> LocalCursor::seek_both_view(ByteView key, ByteView value) {
     SILK_DEBUG << "LocalCursor::seek_both cursor: " << cursor_id_ << " key: " << key << " subkey: " << value;
 
     const auto result = db_cursor_.lower_bound_multivalue(key, value, /*throw_notfound=*/false);
     SILK_DEBUG << "LocalCursor::seek_both result: " << detail::dump_mdbx_result(result);
 
     if (result) {
-        SILK_DEBUG << "LocalCursor::seek_both key: " << string_view_to_byte_view(result.key.as_string()) << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return string_to_bytes(result.value.as_string());
+        SILK_DEBUG << "LocalCursor::seek_both key: " << from_slice(result.key) << " value: " << from_slice(result.value);
+        co_return from_slice(result.value);
     }
-    co_return string_to_bytes("");
+    co_return ByteView{};
 }
 
 Task<KeyValue> LocalCursor::seek_both_exact(ByteView key, ByteView value) {
@@ -137,8 +161,8 @@ Task<KeyValue> LocalCursor::seek_both_exact(ByteView key, ByteView value) {
 
     if (result) {
         SILK_DEBUG << "LocalCursor::seek_both_exact: "
-                   << " key: " << string_view_to_byte_view(result.key.as_string()) << " value: " << string_view_to_byte_view(result.value.as_string());
-        co_return KeyValue{string_to_bytes(result.key.as_string()), string_to_bytes(result.value.as_string())};
+                   << " key: " << from_slice(result.key) << " value: " << from_slice(result.value);
+        co_return copy_of(view_of(result));
     } else {
         SILK_ERROR << "LocalCursor::seek_both_exact !found key: " << key << " subkey:" << value;
     }
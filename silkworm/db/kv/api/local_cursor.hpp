@@ -59,6 +59,15 @@ class LocalCursor : public CursorDupSort {
 
     Task<KeyValue> seek_both_exact(ByteView key, ByteView value) override;
 
+    //! The views returned by LocalCursor point into the database pages and stay valid as long as the read-only transaction
+    Task<KeyValueView> seek_view(ByteView key) override;
+
+    Task<KeyValueView> seek_exact_view(ByteView key) override;
+
+    Task<KeyValueView> next_view() override;
+
+    Task<ByteView> seek_both_view(ByteView key, ByteView value) override;
+
   private:
     uint32_t cursor_id_;
     PooledCursor db_cursor_;
@@ -0,0 +1,164 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "local_cursor.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/infra/test_util/context_test_base.hpp>
+
+namespace silkworm::db::kv::api {
+
+static const Bytes kKey1{*from_hex("01")};
+static const Bytes kKey2{*from_hex("03")};
+static const Bytes kKey3{*from_hex("05")};
+static const Bytes kValue1{*from_hex("aa01")};
+static const Bytes kValue2{*from_hex("bb03")};
+static const Bytes kValue3{*from_hex("cc05")};
+
+static const Bytes kDupKey{*from_hex("0a")};
+static const Bytes kDupValue1{*from_hex("01aa")};
+static const Bytes kDupValue2{*from_hex("02bb")};
+
+class LocalCursorTest : public silkworm::test_util::ContextTestBase {
+  protected:
+    LocalCursorTest() {
+        auto code_cursor = tmp_db_.rw_txn().rw_cursor(table::kCode);
+        code_cursor->upsert(to_slice(kKey1), to_slice(kValue1));
+        code_cursor->upsert(to_slice(kKey2), to_slice(kValue2));
+        code_cursor->upsert(to_slice(kKey3), to_slice(kValue3));
+        auto state_cursor = tmp_db_.rw_txn().rw_cursor_dup_sort(table::kPlainState);
+        state_cursor->upsert(to_slice(kDupKey), to_slice(kDupValue1));
+        state_cursor->upsert(to_slice(kDupKey), to_slice(kDupValue2));
+        tmp_db_.commit_txn();
+    }
+
+    //! Check that the zero-copy result matches the copying one
+    static void check_same(const KeyValueView& view, const KeyValue& copy) {
+        CHECK(view.key == ByteView{copy.key});
+        CHECK(view.value == ByteView{copy.value});
+    }
+
+    db::test_util::TempChainData tmp_db_;
+};
+
+TEST_CASE_METHOD(LocalCursorTest, "LocalCursor::seek_view", "[db][kv][api][local_cursor]") {
+    ROTxnManaged ro_txn{tmp_db_.env()};
+    LocalCursor cursor{ro_txn, 1, table::kCodeName};
+
+    SECTION("existing key") {
+        const auto view = spawn_and_wait(cursor.seek_view(kKey2));
+        CHECK(view.key == kKey2);
+        CHECK(view.value == kValue2);
+        check_same(view, spawn_and_wait(cursor.seek(kKey2)));
+    }
+
+    SECTION("lower bound key") {
+        const auto view = spawn_and_wait(cursor.seek_view(*from_hex("02")));
+        CHECK(view.key == kKey2);
+        check_same(view, spawn_and_wait(cursor.seek(*from_hex("02"))));
+    }
+
+    SECTION("empty key") {
+        const auto view = spawn_and_wait(cursor.seek_view({}));
+        CHECK(view.key == kKey1);
+        check_same(view, spawn_and_wait(cursor.seek({})));
+    }
+
+    SECTION("not found") {
+        const auto view = spawn_and_wait(cursor.seek_view(*from_hex("06")));
+        CHECK(view.key.empty());
+        CHECK(view.value.empty());
+        check_same(view, spawn_and_wait(cursor.seek(*from_hex("06"))));
+    }
+}
+
+TEST_CASE_METHOD(LocalCursorTest, "LocalCursor::seek_exact_view", "[db][kv][api][local_cursor]") {
+    ROTxnManaged ro_txn{tmp_db_.env()};
+    LocalCursor cursor{ro_txn, 1, table::kCodeName};
+
+    SECTION("existing key") {
+        const auto view = spawn_and_wait(cursor.seek_exact_view(kKey3));
+        CHECK(view.key == kKey3);
+        CHECK(view.value == kValue3);
+        check_same(view, spawn_and_wait(cursor.seek_exact(kKey3)));
+    }
+
+    SECTION("not found") {
+        const auto view = spawn_and_wait(cursor.seek_exact_view(*from_hex("02")));
+        CHECK(view.key.empty());
+        CHECK(view.value.empty());
+        check_same(view, spawn_and_wait(cursor.seek_exact(*from_hex("02"))));
+    }
+}
+
+TEST_CASE_METHOD(LocalCursorTest, "LocalCursor::next_view", "[db][kv][api][local_cursor]") {
+    ROTxnManaged ro_txn{tmp_db_.env()};
+    LocalCursor view_cursor{ro_txn, 1, table::kCodeName};
+    LocalCursor copy_cursor{ro_txn, 2, table::kCodeName};
+
+    const auto first_view = spawn_and_wait(view_cursor.seek_view({}));
+    check_same(first_view, spawn_and_wait(copy_cursor.seek({})));
+    for (const auto& key : {kKey2, kKey3}) {
+        const auto view = spawn_and_wait(view_cursor.next_view());
+        CHECK(view.key == key);
+        check_same(view, spawn_and_wait(copy_cursor.next()));
+    }
+
+    // The end of the table is reached
+    const auto view = spawn_and_wait(view_cursor.next_view());
+    CHECK(view.key.empty());
+    CHECK(view.value.empty());
+    check_same(view, spawn_and_wait(copy_cursor.next()));
+
+    // Views point into the database pages, so they outlive the following cursor operations
+    CHECK(first_view.key == kKey1);
+    CHECK(first_view.value == kValue1);
+}
+
+TEST_CASE_METHOD(LocalCursorTest, "LocalCursor::seek_both_view", "[db][kv][api][local_cursor]") {
+    ROTxnManaged ro_txn{tmp_db_.env()};
+    LocalCursor cursor{ro_txn, 1, table::kPlainStateName};
+
+    SECTION("existing subkey") {
+        const auto value = spawn_and_wait(cursor.seek_both_view(kDupKey, *from_hex("02")));
+        CHECK(value == kDupValue2);
+        CHECK(value == ByteView{spawn_and_wait(cursor.seek_both(kDupKey, *from_hex("02")))});
+    }
+
+    SECTION("lower bound subkey") {
+        const auto value = spawn_and_wait(cursor.seek_both_view(kDupKey, *from_hex("00")));
+        CHECK(value == kDupValue1);
+        CHECK(value == ByteView{spawn_and_wait(cursor.seek_both(kDupKey, *from_hex("00")))});
+    }
+
+    SECTION("subkey not found") {
+        const auto value = spawn_and_wait(cursor.seek_both_view(kDupKey, *from_hex("03")));
+        CHECK(value.empty());
+        CHECK(spawn_and_wait(cursor.seek_both(kDupKey, *from_hex("03"))).empty());
+    }
+
+    SECTION("key not found") {
+        const auto value = spawn_and_wait(cursor.seek_both_view(*from_hex("0b"), *from_hex("01")));
+        CHECK(value.empty());
+        CHECK(spawn_and_wait(cursor.seek_both(*from_hex("0b"), *from_hex("01"))).empty());
+    }
+}
+
+}  // namespace silkworm::db::kv::api
@@ -50,6 +50,10 @@ Task<std::shared_ptr<CursorDupSort>> LocalTransaction::get_cursor(const std::str
             co_return cursor_it->second;
         }
     }
+    // Opening a missing map fails within a read-only transaction, so check the table before binding the cursor
+    if (!has_map(txn_, table.c_str())) {
+        throw TableNotFoundError{table};
+    }
     auto cursor = std::make_shared<LocalCursor>(txn_, ++last_cursor_id_, table);
     co_await cursor->open_cursor(table, is_cursor_dup_sort);
     if (is_cursor_dup_sort) {
@@ -0,0 +1,155 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "local_transaction.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/temp_chain_data.hpp>
+#include <silkworm/infra/test_util/context_test_base.hpp>
+
+namespace silkworm::db::kv::api {
+
+static const Bytes kCodeKey1{*from_hex("01")};
+static const Bytes kCodeKey2{*from_hex("03")};
+static const Bytes kCodeValue1{*from_hex("aa01")};
+static const Bytes kCodeValue2{*from_hex("bb03")};
+
+static const Bytes kStateKey{*from_hex("0a")};
+static const Bytes kStateValue1{*from_hex("01aa")};
+static const Bytes kStateValue2{*from_hex("02bb")};
+
+class LocalTransactionTest : public silkworm::test_util::ContextTestBase {
+  protected:
+    LocalTransactionTest() {
+        auto code_cursor = tmp_db_.rw_txn().rw_cursor(table::kCode);
+        code_cursor->upsert(to_slice(kCodeKey1), to_slice(kCodeValue1));
+        code_cursor->upsert(to_slice(kCodeKey2), to_slice(kCodeValue2));
+        auto state_cursor = tmp_db_.rw_txn().rw_cursor_dup_sort(table::kPlainState);
+        state_cursor->upsert(to_slice(kStateKey), to_slice(kStateValue1));
+        state_cursor->upsert(to_slice(kStateKey), to_slice(kStateValue2));
+        tmp_db_.commit_txn();
+    }
+
+    //! Check that the zero-copy result matches the copying one
+    static void check_same(const KeyValueView& view, const KeyValue& copy) {
+        CHECK(view.key == ByteView{copy.key});
+        CHECK(view.value == ByteView{copy.value});
+    }
+
+    db::test_util::TempChainData tmp_db_;
+};
+
+TEST_CASE_METHOD(LocalTransactionTest, "LocalTransaction::cursor", "[db][kv][api][local_transaction]") {
+    LocalTransaction tx{tmp_db_.env(), /*state_cache=*/nullptr};
+    spawn_and_wait(tx.open());
+
+    SECTION("existing table") {
+        CHECK(spawn_and_wait(tx.cursor(table::kCodeName)));
+        CHECK(spawn_and_wait(tx.cursor_dup_sort(table::kPlainStateName)));
+    }
+
+    SECTION("unknown table") {
+        CHECK_THROWS_AS(spawn_and_wait(tx.cursor("UnknownTable")), TableNotFoundError);
+        CHECK_THROWS_AS(spawn_and_wait(tx.cursor_dup_sort("UnknownTable")), TableNotFoundError);
+        // The transaction is still usable after the failure
+        CHECK(spawn_and_wait(tx.get_one(table::kCodeName, kCodeKey1)) == kCodeValue1);
+    }
+
+    spawn_and_wait(tx.close());
+}
+
+TEST_CASE_METHOD(LocalTransactionTest, "LocalTransaction::get_view", "[db][kv][api][local_transaction]") {
+    LocalTransaction tx{tmp_db_.env(), /*state_cache=*/nullptr};
+    spawn_and_wait(tx.open());
+
+    SECTION("existing key") {
+        const auto view = spawn_and_wait(tx.get_view(table::kCodeName, kCodeKey2));
+        CHECK(view.key == kCodeKey2);
+        CHECK(view.value == kCodeValue2);
+        check_same(view, spawn_and_wait(tx.get(table::kCodeName, kCodeKey2)));
+    }
+
+    SECTION("lower bound key") {
+        const auto view = spawn_and_wait(tx.get_view(table::kCodeName, *from_hex("02")));
+        CHECK(view.key == kCodeKey2);
+        check_same(view, spawn_and_wait(tx.get(table::kCodeName, *from_hex("02"))));
+    }
+
+    SECTION("not found") {
+        const auto view = spawn_and_wait(tx.get_view(table::kCodeName, *from_hex("04")));
+        CHECK(view.key.empty());
+        CHECK(view.value.empty());
+        check_same(view, spawn_and_wait(tx.get(table::kCodeName, *from_hex("04"))));
+    }
+
+    SECTION("repeated calls on different tables") {
+        const auto code_view = spawn_and_wait(tx.get_view(table::kCodeName, kCodeKey1));
+        CHECK(code_view.key == kCodeKey1);
+        CHECK(code_view.value == kCodeValue1);
+
+        const auto state_view = spawn_and_wait(tx.get_view(table::kPlainStateName, kStateKey));
+        CHECK(state_view.key == kStateKey);
+        CHECK(state_view.value == kStateValue1);
+        check_same(state_view, spawn_and_wait(tx.get(table::kPlainStateName, kStateKey)));
+
+        // Back to the first table, with the cursor kept by the previous call replaced
+        const auto code_view2 = spawn_and_wait(tx.get_view(table::kCodeName, kCodeKey2));
+        CHECK(code_view2.key == kCodeKey2);
+        CHECK(code_view2.value == kCodeValue2);
+        check_same(code_view2, spawn_and_wait(tx.get(table::kCodeName, kCodeKey2)));
+
+        const auto missing_view = spawn_and_wait(tx.get_view(table::kPlainStateName, *from_hex("0b")));
+        CHECK(missing_view.key.empty());
+        CHECK(missing_view.value.empty());
+    }
+
+    spawn_and_wait(tx.close());
+}
+
+TEST_CASE_METHOD(LocalTransactionTest, "LocalTransaction::get_one", "[db][kv][api][local_transaction]") {
+    LocalTransaction tx{tmp_db_.env(), /*state_cache=*/nullptr};
+    spawn_and_wait(tx.open());
+
+    CHECK(spawn_and_wait(tx.get_one(table::kCodeName, kCodeKey1)) == kCodeValue1);
+    CHECK(spawn_and_wait(tx.get_one(table::kCodeName, *from_hex("02"))).empty());
+
+    spawn_and_wait(tx.close());
+}
+
+TEST_CASE_METHOD(LocalTransactionTest, "LocalTransaction::get_both_range", "[db][kv][api][local_transaction]") {
+    LocalTransaction tx{tmp_db_.env(), /*state_cache=*/nullptr};
+    spawn_and_wait(tx.open());
+
+    SECTION("existing subkey") {
+        const auto value = spawn_and_wait(tx.get_both_range(table::kPlainStateName, kStateKey, *from_hex("02")));
+        CHECK(value == *from_hex("bb"));
+    }
+
+    SECTION("subkey not matching") {
+        CHECK_FALSE(spawn_and_wait(tx.get_both_range(table::kPlainStateName, kStateKey, *from_hex("03"))));
+    }
+
+    SECTION("key not found") {
+        CHECK_FALSE(spawn_and_wait(tx.get_both_range(table::kPlainStateName, *from_hex("0b"), *from_hex("01"))));
+    }
+
+    spawn_and_wait(tx.close());
+}
+
+}  // namespace silkworm::db::kv::api
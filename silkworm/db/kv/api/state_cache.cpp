@@ -20,7 +20,6 @@
 
 #include <magic_enum.hpp>
 
-#include <silkworm/core/common/assert.hpp>
 #include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/address.hpp>
@@ -30,14 +29,16 @@
 
 namespace silkworm::db::kv::api {
 
-CoherentStateView::CoherentStateView(Transaction& txn, CoherentStateCache* cache) : txn_(txn), cache_(cache) {}
+CoherentStateView::CoherentStateView(Transaction& txn, CoherentStateCache* cache, StateViewId view_id,
+                                     std::shared_ptr<const CoherentStateRoot> root)
+    : txn_(txn), cache_(cache), view_id_(view_id), root_(std::move(root)) {}
 
 Task<std::optional<Bytes>> CoherentStateView::get(ByteView key) {
-    co_return co_await cache_->get(key, txn_);
+    co_return co_await cache_->get(key, txn_, view_id_, root_);
 }
 
 Task<std::optional<Bytes>> CoherentStateView::get_code(ByteView key) {
-    co_return co_await cache_->get_code(key, txn_);
+    co_return co_await cache_->get_code(key, txn_, view_id_, root_);
 }
 
 CoherentStateCache::CoherentStateCache(CoherentCacheConfig config) : config_(config) {
@@ -48,25 +49,27 @@ CoherentStateCache::CoherentStateCache(CoherentCacheConfig config) : config_(con
 
 std::unique_ptr<StateView> CoherentStateCache::get_view(Transaction& txn) {
     const auto view_id = txn.view_id();
-    std::unique_lock write_lock{rw_mutex_};
-    CoherentStateRoot* root = get_root(view_id);
-    return root->ready ? std::make_unique<CoherentStateView>(txn, this) : nullptr;
+    auto root = get_root(view_id);
+    if (!root || !root->ready) {
+        return nullptr;
+    }
+    return std::make_unique<CoherentStateView>(txn, this, view_id, std::move(root));
 }
 
 std::size_t CoherentStateCache::latest_data_size() {
-    std::shared_lock read_lock{rw_mutex_};
+    std::scoped_lock roots_lock{roots_mutex_};
     if (latest_state_view_ == nullptr) {
         return 0;
     }
-    return static_cast<std::size_t>(latest_state_view_->cache.size());
+    return latest_state_view_->cache.size();
 }
 
 std::size_t CoherentStateCache::latest_code_size() {
-    std::shared_lock read_lock{rw_mutex_};
+    std::scoped_lock roots_lock{roots_mutex_};
     if (latest_state_view_ == nullptr) {
         return 0;
     }
-    return static_cast<std::size_t>(latest_state_view_->code_cache.size());
+    return latest_state_view_->code_cache.size();
 }
 
 void CoherentStateCache::on_new_block(const ::remote::StateChangeBatch& state_changes) {
@@ -75,10 +78,11 @@ void CoherentStateCache::on_new_block(const ::remote::StateChangeBatch& state_ch
         return;
     }
 
-    std::unique_lock write_lock{rw_mutex_};
+    // Readers are not blocked while the new root is built: they keep using the roots already published
+    std::scoped_lock update_lock{update_mutex_};
 
     const auto view_id = state_changes.state_version_id();
-    CoherentStateRoot* root = advance_root(view_id);
+    CoherentStateRoot root = advance_root(view_id);
     for (const auto& state_change : state_changes.change_batch()) {
         for (const auto& account_change : state_change.changes()) {
             switch (account_change.action()) {
@@ -112,13 +116,20 @@ void CoherentStateCache::on_new_block(const ::remote::StateChangeBatch& state_ch
         }
     }
 
-    state_key_count_ = static_cast<std::size_t>(latest_state_view_->cache.size());
-    code_key_count_ = static_cast<std::size_t>(latest_state_view_->code_cache.size());
+    state_key_count_ = root.cache.size();
+    code_key_count_ = root.code_cache.size();
+
+    root.ready = true;
+    auto new_root = std::make_shared<const CoherentStateRoot>(std::move(root));
 
-    root->ready = true;
+    std::scoped_lock roots_lock{roots_mutex_};
+    state_view_roots_.insert_or_assign(view_id, new_root);
+    evict_roots(view_id);
+    latest_state_view_id_ = view_id;
+    latest_state_view_ = std::move(new_root);
 }
 
-void CoherentStateCache::process_upsert_change(CoherentStateRoot* root, StateViewId view_id,
+void CoherentStateCache::process_upsert_change(CoherentStateRoot& root, StateViewId view_id,
                                                const remote::AccountChange& change) {
     const auto address = rpc::address_from_H160(change.address());
     const auto data_bytes = string_to_bytes(change.data());
@@ -127,7 +138,7 @@ void CoherentStateCache::process_upsert_change(CoherentStateRoot* root, StateVie
     add({address_key, data_bytes}, root, view_id);
 }
 
-void CoherentStateCache::process_code_change(CoherentStateRoot* root, StateViewId view_id, const remote::AccountChange& change) {
+void CoherentStateCache::process_code_change(CoherentStateRoot& root, StateViewId view_id, const remote::AccountChange& change) {
     const auto code_bytes = string_to_bytes(change.code());
     const ethash::hash256 code_hash{keccak256(code_bytes)};
     const Bytes code_hash_key{code_hash.bytes, kHashLength};
@@ -135,7 +146,7 @@ void CoherentStateCache::process_code_change(CoherentStateRoot* root, StateViewI
     add_code({code_hash_key, code_bytes}, root, view_id);
 }
 
-void CoherentStateCache::process_delete_change(CoherentStateRoot* root, StateViewId view_id,
+void CoherentStateCache::process_delete_change(CoherentStateRoot& root, StateViewId view_id,
                                                const remote::AccountChange& change) {
     const auto address = rpc::address_from_H160(change.address());
     SILK_DEBUG << "CoherentStateCache::process_delete_change address: " << address;
@@ -143,7 +154,7 @@ void CoherentStateCache::process_delete_change(CoherentStateRoot* root, StateVie
     add({address_key, {}}, root, view_id);
 }
 
-void CoherentStateCache::process_storage_change(CoherentStateRoot* root, StateViewId view_id,
+void CoherentStateCache::process_storage_change(CoherentStateRoot& root, StateViewId view_id,
                                                 const remote::AccountChange& change) {
     const auto address = rpc::address_from_H160(change.address());
     SILK_DEBUG << "CoherentStateCache::process_storage_change address=" << address;
@@ -156,92 +167,65 @@ void CoherentStateCache::process_storage_change(CoherentStateRoot* root, StateVi
     }
 }
 
-bool CoherentStateCache::add(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id) {
-    auto [it, inserted] = root->cache.insert(kv);
-    SILK_DEBUG << "Data cache kv.key=" << to_hex(kv.key) << " inserted=" << inserted << " view=" << view_id;
-    std::optional<KeyValue> replaced;
-    if (!inserted) {
-        replaced = *it;
-        root->cache.erase(it);
-        std::tie(it, inserted) = root->cache.insert(kv);
-        SILKWORM_ASSERT(inserted);
-    }
-    if (latest_state_view_id_ != view_id) {
-        return inserted;
-    }
-    if (replaced) {
-        state_evictions_.remove(*replaced);
-        SILK_DEBUG << "Data evictions removed replaced.key=" << to_hex(replaced->key);
-    }
-    state_evictions_.push_front(std::move(kv));
-
-    // Remove the longest unused key-value pair when size exceeded
-    if (state_evictions_.size() > config_.max_state_keys) {
-        const auto oldest = state_evictions_.back();
-        SILK_DEBUG << "Data cache resize oldest.key=" << to_hex(oldest.key);
-        state_evictions_.pop_back();
-        const auto num_erased = root->cache.erase(oldest);
-        SILKWORM_ASSERT(num_erased == 1);
-    }
-    return inserted;
+bool CoherentStateCache::add(KeyValue&& kv, CoherentStateRoot& root, StateViewId view_id) {
+    return add_to(root.cache, std::move(kv), view_id, state_evictions_, config_.max_state_bytes, state_eviction_count_);
+}
+
+bool CoherentStateCache::add_code(KeyValue&& kv, CoherentStateRoot& root, StateViewId view_id) {
+    return add_to(root.code_cache, std::move(kv), view_id, code_evictions_, config_.max_code_bytes, code_eviction_count_);
 }
 
-bool CoherentStateCache::add_code(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id) {
-    auto [it, inserted] = root->code_cache.insert(kv);
-    SILK_DEBUG << "Code cache kv.key=" << to_hex(kv.key) << " inserted=" << inserted << " view=" << view_id;
-    std::optional<KeyValue> replaced;
-    if (!inserted) {
-        replaced = *it;
-        root->code_cache.erase(it);
-        std::tie(it, inserted) = root->code_cache.insert(kv);
-        SILKWORM_ASSERT(inserted);
+bool CoherentStateCache::add_to(StateMap& map, KeyValue&& kv, StateViewId view_id, EvictionQueue& queue,
+                                uint64_t max_bytes, std::atomic_uint64_t& eviction_count) {
+    const Bytes* replaced = map.peek(kv.key);
+    const bool inserted = replaced == nullptr;
+    SILK_DEBUG << "Cache kv.key=" << to_hex(kv.key) << " inserted=" << inserted << " view=" << view_id;
+    const bool tracked = queue.view_id == view_id;
+    if (tracked) {
+        if (replaced) {
+            queue.size -= replaced->size();
+        } else {
+            queue.size += kv.key.size();
+            queue.keys.push_back(kv.key);
+        }
+        queue.size += kv.value.size();
     }
-    if (latest_state_view_id_ != view_id) {
+    map = map.insert_or_assign(std::move(kv.key), std::move(kv.value));
+    if (!tracked) {
         return inserted;
     }
-    if (replaced) {
-        code_evictions_.remove(*replaced);
-        SILK_DEBUG << "Code evictions removed replaced.key=" << to_hex(replaced->key);
-    }
-    code_evictions_.push_front(std::move(kv));
-
-    // Remove the longest unused key-value pair when size exceeded
-    if (code_evictions_.size() > config_.max_code_keys) {
-        const auto oldest = code_evictions_.back();
-        SILK_DEBUG << "Code cache resize oldest.key=" << to_hex(oldest.key);
-        code_evictions_.pop_back();
-        const auto num_erased = root->code_cache.erase(oldest);
-        SILKWORM_ASSERT(num_erased == 1);
+
+    // Evict the oldest entries not referenced since their last chance until the total size fits
+    std::size_t second_chances{queue.keys.size()};
+    while (queue.size > max_bytes && !queue.keys.empty()) {
+        Bytes key = std::move(queue.keys.front());
+        queue.keys.pop_front();
+        const Bytes* value = map.peek(key);
+        if (value == nullptr) {
+            continue;
+        }
+        if (second_chances > 0 && map.reset_referenced(key)) {
+            --second_chances;
+            queue.keys.push_back(std::move(key));
+            continue;
+        }
+        SILK_DEBUG << "Cache resize oldest.key=" << to_hex(key);
+        queue.size -= key.size() + value->size();
+        map = map.erase(key);
+        eviction_count.fetch_add(1, std::memory_order_relaxed);
     }
     return inserted;
 }
 
-Task<std::optional<Bytes>> CoherentStateCache::get(ByteView key, Transaction& tx) {
-    std::shared_lock read_lock{rw_mutex_};
-
-    const auto view_id = tx.view_id();
-    const auto root_it = state_view_roots_.find(view_id);
-    if (root_it == state_view_roots_.end()) {
-        co_return std::nullopt;
-    }
-
-    KeyValue kv{Bytes{key}};
-    auto& cache = root_it->second->cache;
-    const auto kv_it = cache.find(kv);
-    if (kv_it != cache.end()) {
-        ++state_hit_count_;
-
-        SILK_DEBUG << "Hit in state cache key=" << key << " value=" << kv_it->value;
-
-        if (view_id == latest_state_view_id_) {
-            state_evictions_.remove(kv);
-            state_evictions_.push_front(kv);
-        }
-
-        co_return kv_it->value;
+Task<std::optional<Bytes>> CoherentStateCache::get(ByteView key, Transaction& tx, StateViewId view_id,
+                                                   std::shared_ptr<const CoherentStateRoot>& root) {
+    if (const Bytes* value = root->cache.find(key)) {
+        state_hit_count_.fetch_add(1, std::memory_order_relaxed);
+        SILK_DEBUG << "Hit in state cache key=" << key << " value=" << *value;
+        co_return *value;
     }
 
-    ++state_miss_count_;
+    state_miss_count_.fetch_add(1, std::memory_order_relaxed);
 
     const auto value = co_await tx.get_one(db::table::kPlainStateName, key);
     SILK_DEBUG << "Miss in state cache: lookup in PlainState key=" << key << " value=" << value;
@@ -249,41 +233,22 @@ Task<std::optional<Bytes>> CoherentStateCache::get(ByteView key, Transaction& tx
         co_return std::nullopt;
     }
 
-    read_lock.unlock();
-    std::unique_lock write_lock{rw_mutex_};
-
-    kv.value = value;
-    add(std::move(kv), root_it->second.get(), view_id);
+    if (auto new_root = fill_root(view_id, KeyValue{Bytes{key}, value}, /*is_code=*/false)) {
+        root = std::move(new_root);
+    }
 
     co_return value;
 }
 
-Task<std::optional<Bytes>> CoherentStateCache::get_code(ByteView key, Transaction& tx) {
-    std::shared_lock read_lock{rw_mutex_};
-
-    const auto view_id = tx.view_id();
-    const auto root_it = state_view_roots_.find(view_id);
-    if (root_it == state_view_roots_.end()) {
-        co_return std::nullopt;
-    }
-
-    KeyValue kv{Bytes{key}};
-    auto& code_cache = root_it->second->code_cache;
-    const auto kv_it = code_cache.find(kv);
-    if (kv_it != code_cache.end()) {
-        ++code_hit_count_;
-
-        SILK_DEBUG << "Hit in code cache key=" << key << " value=" << kv_it->value;
-
-        if (view_id == latest_state_view_id_) {
-            code_evictions_.remove(kv);
-            code_evictions_.push_front(kv);
-        }
-
-        co_return kv_it->value;
+Task<std::optional<Bytes>> CoherentStateCache::get_code(ByteView key, Transaction& tx, StateViewId view_id,
+                                                        std::shared_ptr<const CoherentStateRoot>& root) {
+    if (const Bytes* value = root->code_cache.find(key)) {
+        code_hit_count_.fetch_add(1, std::memory_order_relaxed);
+        SILK_DEBUG << "Hit in code cache key=" << key << " value=" << *value;
+        co_return *value;
     }
 
-    ++code_miss_count_;
+    code_miss_count_.fetch_add(1, std::memory_order_relaxed);
 
     const auto value = co_await tx.get_one(db::table::kCodeName, key);
     SILK_DEBUG << "Miss in code cache: lookup in Code key=" << key << " value=" << value;
@@ -291,58 +256,91 @@ Task<std::optional<Bytes>> CoherentStateCache::get_code(ByteView key, Transactio
         co_return std::nullopt;
     }
 
-    read_lock.unlock();
-    std::unique_lock write_lock{rw_mutex_};
-
-    kv.value = value;
-    add_code(std::move(kv), root_it->second.get(), view_id);
+    if (auto new_root = fill_root(view_id, KeyValue{Bytes{key}, value}, /*is_code=*/true)) {
+        root = std::move(new_root);
+    }
 
     co_return value;
 }
 
-CoherentStateRoot* CoherentStateCache::get_root(StateViewId view_id) {
+std::shared_ptr<const CoherentStateRoot> CoherentStateCache::get_root(StateViewId view_id) {
+    std::scoped_lock roots_lock{roots_mutex_};
     const auto root_it = state_view_roots_.find(view_id);
-    if (root_it != state_view_roots_.end()) {
-        SILK_DEBUG << "CoherentStateCache::get_root view_id=" << view_id << " root=" << root_it->second.get() << " found";
-        return root_it->second.get();
+    if (root_it == state_view_roots_.end()) {
+        SILK_DEBUG << "CoherentStateCache::get_root view_id=" << view_id << " not found";
+        return nullptr;
     }
-    const auto [new_root_it, _] = state_view_roots_.emplace(view_id, std::make_unique<CoherentStateRoot>());
-    SILK_DEBUG << "CoherentStateCache::get_root view_id=" << view_id << " root=" << root_it->second.get() << " created";
-    return new_root_it->second.get();
+    return root_it->second;
 }
 
-CoherentStateRoot* CoherentStateCache::advance_root(StateViewId view_id) {
-    CoherentStateRoot* root = get_root(view_id);
+std::shared_ptr<const CoherentStateRoot> CoherentStateCache::fill_root(StateViewId view_id, KeyValue&& kv, bool is_code) {
+    // Never wait for a block update just to cache a value read on a miss
+    std::unique_lock update_lock{update_mutex_, std::try_to_lock};
+    if (!update_lock) {
+        return nullptr;
+    }
+    const auto current_root = get_root(view_id);
+    if (!current_root) {
+        return nullptr;
+    }
 
-    const auto previous_root_it = state_view_roots_.find(view_id - 1);
-    if (previous_root_it != state_view_roots_.end() && previous_root_it->second->canonical) {
-        SILK_DEBUG << "CoherentStateCache::advance_root canonical view_id-1=" << (view_id - 1) << " found";
-        root->cache = previous_root_it->second->cache;
-        root->code_cache = previous_root_it->second->code_cache;
+    CoherentStateRoot root{*current_root};
+    if (is_code) {
+        add_code(std::move(kv), root, view_id);
     } else {
-        SILK_DEBUG << "CoherentStateCache::advance_root canonical view_id-1=" << (view_id - 1) << " not found";
-        state_evictions_.clear();
-        for (const auto& kv : root->cache) {
-            state_evictions_.push_front(kv);
-        }
-        code_evictions_.clear();
-        for (const auto& kv : root->code_cache) {
-            code_evictions_.push_front(kv);
-        }
+        add(std::move(kv), root, view_id);
     }
-    root->canonical = true;
+    auto new_root = std::make_shared<const CoherentStateRoot>(std::move(root));
 
-    evict_roots(view_id);
+    std::scoped_lock roots_lock{roots_mutex_};
+    state_view_roots_.insert_or_assign(view_id, new_root);
+    if (latest_state_view_ == current_root) {
+        latest_state_view_ = new_root;
+    }
+    return new_root;
+}
 
-    latest_state_view_id_ = view_id;
-    latest_state_view_ = root;
+CoherentStateRoot CoherentStateCache::advance_root(StateViewId view_id) {
+    CoherentStateRoot root;
+    bool parent_found{false};
+    {
+        std::scoped_lock roots_lock{roots_mutex_};
+        const auto previous_root_it = state_view_roots_.find(view_id - 1);
+        if (previous_root_it != state_view_roots_.end() && previous_root_it->second->canonical) {
+            SILK_DEBUG << "CoherentStateCache::advance_root canonical view_id-1=" << (view_id - 1) << " found";
+            root.cache = previous_root_it->second->cache;
+            root.code_cache = previous_root_it->second->code_cache;
+            parent_found = true;
+        } else if (const auto root_it = state_view_roots_.find(view_id); root_it != state_view_roots_.end()) {
+            SILK_DEBUG << "CoherentStateCache::advance_root canonical view_id-1=" << (view_id - 1) << " not found";
+            root.cache = root_it->second->cache;
+            root.code_cache = root_it->second->code_cache;
+        }
+    }
+    root.canonical = true;
 
-    state_eviction_count_ = state_evictions_.size();
-    code_eviction_count_ = code_evictions_.size();
+    // Keep tracking the entries inherited from the parent if it was the tracked view, otherwise start from scratch
+    if (parent_found && state_evictions_.view_id == view_id - 1) {
+        state_evictions_.view_id = view_id;
+        code_evictions_.view_id = view_id;
+    } else {
+        reset_queue(state_evictions_, view_id, root.cache);
+        reset_queue(code_evictions_, view_id, root.code_cache);
+    }
 
     return root;
 }
 
+void CoherentStateCache::reset_queue(EvictionQueue& queue, StateViewId view_id, const StateMap& map) {
+    queue.view_id = view_id;
+    queue.keys.clear();
+    queue.size = 0;
+    map.for_each([&](const Bytes& key, const Bytes& value) {
+        queue.keys.push_back(key);
+        queue.size += key.size() + value.size();
+    });
+}
+
 void CoherentStateCache::evict_roots(StateViewId next_view_id) {
     SILK_DEBUG << "CoherentStateCache::evict_roots state_view_roots_.size()=" << state_view_roots_.size();
     if (state_view_roots_.size() <= config_.max_views) {
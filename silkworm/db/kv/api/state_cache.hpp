@@ -16,19 +16,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
-#include <list>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
-#include <shared_mutex>
+#include <string_view>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
-#include <absl/container/btree_set.h>
-
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/core/common/persistent_hash_map.hpp>
 #include <silkworm/interfaces/remote/kv.pb.h>  // weird but currently needed
 
 #include "transaction.hpp"
@@ -65,9 +68,19 @@ class StateCache {
     virtual uint64_t code_eviction_count() const = 0;
 };
 
+struct BytesHash {
+    std::size_t operator()(ByteView bytes) const noexcept {
+        return std::hash<std::string_view>{}(byte_view_to_string_view(bytes));
+    }
+};
+
+using StateMap = PersistentHashMap<Bytes, Bytes, BytesHash>;
+
+//! Immutable snapshot of the cached state for one state view: a new root is derived from its parent sharing all the
+//! untouched entries, so readers can use a root without locking while the next one is being built
 struct CoherentStateRoot {
-    absl::btree_set<KeyValue> cache;
-    absl::btree_set<KeyValue> code_cache;
+    StateMap cache;
+    StateMap code_cache;
     bool ready{false};
     bool canonical{false};
 };
@@ -75,21 +88,24 @@ struct CoherentStateRoot {
 using StateViewId = uint64_t;
 
 constexpr auto kDefaultMaxViews{5ul};
-constexpr auto kDefaultMaxStateKeys{1'000'000u};
-constexpr auto kDefaultMaxCodeKeys{10'000u};
+constexpr auto kDefaultMaxStateBytes{128_Mebi};
+constexpr auto kDefaultMaxCodeBytes{128_Mebi};
 
 struct CoherentCacheConfig {
     uint64_t max_views{kDefaultMaxViews};
     bool with_storage{true};
-    uint32_t max_state_keys{kDefaultMaxStateKeys};
-    uint32_t max_code_keys{kDefaultMaxCodeKeys};
+    //! Max total size in bytes of the keys and values cached for the latest state view
+    uint64_t max_state_bytes{kDefaultMaxStateBytes};
+    //! Max total size in bytes of the code hashes and codes cached for the latest state view
+    uint64_t max_code_bytes{kDefaultMaxCodeBytes};
 };
 
 class CoherentStateCache;
 
 class CoherentStateView : public StateView {
   public:
-    explicit CoherentStateView(Transaction& txn, CoherentStateCache* cache);
+    CoherentStateView(Transaction& txn, CoherentStateCache* cache, StateViewId view_id,
+                      std::shared_ptr<const CoherentStateRoot> root);
 
     CoherentStateView(const CoherentStateView&) = delete;
     CoherentStateView& operator=(const CoherentStateView&) = delete;
@@ -101,8 +117,15 @@ class CoherentStateView : public StateView {
   private:
     Transaction& txn_;
     CoherentStateCache* cache_;
+    StateViewId view_id_;
+    std::shared_ptr<const CoherentStateRoot> root_;
 };
 
+//! \brief State cache keeping one immutable CoherentStateRoot for each of the latest state views.
+//! \details Readers capture the root of their view once in get_view and then look it up without any locking. Block
+//! changes derive the new root from the canonical parent in O(changes) and publish it by swapping a pointer, cache fills
+//! after misses do the same for the root of the view (or are skipped if a block update is in progress). The entries of
+//! the latest view are evicted using the CLOCK policy when their total size exceeds the configured bytes.
 class CoherentStateCache : public StateCache {
   public:
     explicit CoherentStateCache(CoherentCacheConfig config = {});
@@ -117,47 +140,67 @@ class CoherentStateCache : public StateCache {
     std::size_t latest_data_size() override;
     std::size_t latest_code_size() override;
 
-    uint64_t state_hit_count() const override { return state_hit_count_; }
-    uint64_t state_miss_count() const override { return state_miss_count_; }
-    uint64_t state_key_count() const override { return state_key_count_; }
-    uint64_t state_eviction_count() const override { return state_eviction_count_; }
-    uint64_t code_hit_count() const override { return code_hit_count_; }
-    uint64_t code_miss_count() const override { return code_miss_count_; }
-    uint64_t code_key_count() const override { return code_key_count_; }
-    uint64_t code_eviction_count() const override { return code_eviction_count_; }
+    uint64_t state_hit_count() const override { return state_hit_count_.load(std::memory_order_relaxed); }
+    uint64_t state_miss_count() const override { return state_miss_count_.load(std::memory_order_relaxed); }
+    uint64_t state_key_count() const override { return state_key_count_.load(std::memory_order_relaxed); }
+    uint64_t state_eviction_count() const override { return state_eviction_count_.load(std::memory_order_relaxed); }
+    uint64_t code_hit_count() const override { return code_hit_count_.load(std::memory_order_relaxed); }
+    uint64_t code_miss_count() const override { return code_miss_count_.load(std::memory_order_relaxed); }
+    uint64_t code_key_count() const override { return code_key_count_.load(std::memory_order_relaxed); }
+    uint64_t code_eviction_count() const override { return code_eviction_count_.load(std::memory_order_relaxed); }
 
   private:
     friend class CoherentStateView;
 
-    void process_upsert_change(CoherentStateRoot* root, StateViewId view_id, const remote::AccountChange& change);
-    void process_code_change(CoherentStateRoot* root, StateViewId view_id, const remote::AccountChange& change);
-    void process_delete_change(CoherentStateRoot* root, StateViewId view_id, const remote::AccountChange& change);
-    void process_storage_change(CoherentStateRoot* root, StateViewId view_id, const remote::AccountChange& change);
-    bool add(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id);
-    bool add_code(KeyValue&& kv, CoherentStateRoot* root, StateViewId view_id);
-    Task<std::optional<Bytes>> get(ByteView key, Transaction& txn);
-    Task<std::optional<Bytes>> get_code(ByteView key, Transaction& txn);
-    CoherentStateRoot* get_root(StateViewId view_id);
-    CoherentStateRoot* advance_root(StateViewId view_id);
+    //! Byte-based CLOCK eviction bookkeeping for the entries of the latest state view
+    struct EvictionQueue {
+        //! The state view whose entries are tracked
+        StateViewId view_id{0};
+        //! The cached keys in insertion order
+        std::deque<Bytes> keys;
+        //! The total size in bytes of the cached keys and values
+        uint64_t size{0};
+    };
+
+    void process_upsert_change(CoherentStateRoot& root, StateViewId view_id, const remote::AccountChange& change);
+    void process_code_change(CoherentStateRoot& root, StateViewId view_id, const remote::AccountChange& change);
+    void process_delete_change(CoherentStateRoot& root, StateViewId view_id, const remote::AccountChange& change);
+    void process_storage_change(CoherentStateRoot& root, StateViewId view_id, const remote::AccountChange& change);
+    bool add(KeyValue&& kv, CoherentStateRoot& root, StateViewId view_id);
+    bool add_code(KeyValue&& kv, CoherentStateRoot& root, StateViewId view_id);
+    bool add_to(StateMap& map, KeyValue&& kv, StateViewId view_id, EvictionQueue& queue, uint64_t max_bytes,
+                std::atomic_uint64_t& eviction_count);
+    Task<std::optional<Bytes>> get(ByteView key, Transaction& txn, StateViewId view_id,
+                                   std::shared_ptr<const CoherentStateRoot>& root);
+    Task<std::optional<Bytes>> get_code(ByteView key, Transaction& txn, StateViewId view_id,
+                                        std::shared_ptr<const CoherentStateRoot>& root);
+    std::shared_ptr<const CoherentStateRoot> get_root(StateViewId view_id);
+    std::shared_ptr<const CoherentStateRoot> fill_root(StateViewId view_id, KeyValue&& kv, bool is_code);
+    CoherentStateRoot advance_root(StateViewId view_id);
     void evict_roots(StateViewId next_view_id);
+    static void reset_queue(EvictionQueue& queue, StateViewId view_id, const StateMap& map);
 
     CoherentCacheConfig config_;
 
-    std::map<StateViewId, std::unique_ptr<CoherentStateRoot>> state_view_roots_;
+    //! The state view roots, guarded by roots_mutex_ which is held just to look up or swap the root pointers
+    std::map<StateViewId, std::shared_ptr<const CoherentStateRoot>> state_view_roots_;
     StateViewId latest_state_view_id_{0};
-    CoherentStateRoot* latest_state_view_{nullptr};
-    std::list<KeyValue> state_evictions_;
-    std::list<KeyValue> code_evictions_;
-    std::shared_mutex rw_mutex_;
-
-    uint64_t state_hit_count_{0};
-    uint64_t state_miss_count_{0};
-    uint64_t state_key_count_{0};
-    uint64_t state_eviction_count_{0};
-    uint64_t code_hit_count_{0};
-    uint64_t code_miss_count_{0};
-    uint64_t code_key_count_{0};
-    uint64_t code_eviction_count_{0};
+    std::shared_ptr<const CoherentStateRoot> latest_state_view_;
+    std::mutex roots_mutex_;
+
+    //! Serializes the root updates: block changes and cache fills after misses
+    std::mutex update_mutex_;
+    EvictionQueue state_evictions_;
+    EvictionQueue code_evictions_;
+
+    std::atomic_uint64_t state_hit_count_{0};
+    std::atomic_uint64_t state_miss_count_{0};
+    std::atomic_uint64_t state_key_count_{0};
+    std::atomic_uint64_t state_eviction_count_{0};
+    std::atomic_uint64_t code_hit_count_{0};
+    std::atomic_uint64_t code_miss_count_{0};
+    std::atomic_uint64_t code_key_count_{0};
+    std::atomic_uint64_t code_eviction_count_{0};
 };
 
 }  // namespace silkworm::db::kv::api
@@ -89,8 +89,8 @@ TEST_CASE("CoherentCacheConfig", "[rpc][ethdb][kv][state_cache]") {
         CoherentCacheConfig config;
         CHECK(config.max_views == kDefaultMaxViews);
         CHECK(config.with_storage);
-        CHECK(config.max_state_keys == kDefaultMaxStateKeys);
-        CHECK(config.max_code_keys == kDefaultMaxCodeKeys);
+        CHECK(config.max_state_bytes == kDefaultMaxStateBytes);
+        CHECK(config.max_code_bytes == kDefaultMaxCodeBytes);
     }
 }
 
@@ -235,7 +235,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::CoherentStateCache", "[rpc
     }
 
     SECTION("wrong config") {
-        CoherentCacheConfig config{0, true, kDefaultMaxStateKeys, kDefaultMaxCodeKeys};
+        CoherentCacheConfig config{0, true, kDefaultMaxStateBytes, kDefaultMaxCodeBytes};
         CHECK_THROWS_AS(CoherentStateCache{config}, std::invalid_argument);
     }
 }
@@ -279,14 +279,14 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_data_size() == 1);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(2).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
 
         get_and_check_upsert(cache, txn, kTestAddress1, kTestAccountData);
 
         CHECK(cache.state_hit_count() == 1);
         CHECK(cache.state_miss_count() == 0);
         CHECK(cache.state_key_count() == 1);
-        CHECK(cache.state_eviction_count() == 1);
+        CHECK(cache.state_eviction_count() == 0);
     }
 
     SECTION("single upsert+code change batch => double search hit") {
@@ -297,7 +297,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_code_size() == 1);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(4).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).Times(2).WillRepeatedly(Return(kTestViewId0));
 
         get_and_check_upsert(cache, txn, kTestAddress1, kTestAccountData);
 
@@ -321,7 +321,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_data_size() == 1);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(2).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
 
         std::unique_ptr<StateView> view = cache.get_view(txn);
         CHECK(view != nullptr);
@@ -346,7 +346,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_data_size() == 1);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(2).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
 
         std::unique_ptr<StateView> view = cache.get_view(txn);
         CHECK(view != nullptr);
@@ -391,6 +391,12 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
             CHECK(cache.state_miss_count() == 1);
             CHECK(cache.state_key_count() == 1);
             CHECK(cache.state_eviction_count() == 0);
+
+            // The value read on miss is then found in the cache
+            const auto cached_value = spawn_and_wait(view->get(storage_key2));
+            CHECK(cached_value == kTestStorageData2);
+            CHECK(cache.state_hit_count() == 1);
+            CHECK(cache.latest_data_size() == 2);
         }
     }
 
@@ -401,7 +407,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_data_size() == 2);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(3).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
         std::unique_ptr<StateView> view = cache.get_view(txn);
 
         CHECK(view != nullptr);
@@ -432,7 +438,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view one view", "[rpc]
         CHECK(cache.latest_code_size() == 1);
 
         test_util::MockTransaction txn;
-        EXPECT_CALL(txn, view_id()).Times(2).WillRepeatedly(Return(kTestViewId0));
+        EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
 
         std::unique_ptr<StateView> view = cache.get_view(txn);
         CHECK(view != nullptr);
@@ -465,22 +471,22 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view two views", "[rpc
         CHECK(cache.latest_data_size() == 1);
 
         test_util::MockTransaction txn1, txn2;
-        EXPECT_CALL(txn1, view_id()).Times(2).WillRepeatedly(Return(kTestViewId1));
-        EXPECT_CALL(txn2, view_id()).Times(2).WillRepeatedly(Return(kTestViewId2));
+        EXPECT_CALL(txn1, view_id()).WillOnce(Return(kTestViewId1));
+        EXPECT_CALL(txn2, view_id()).WillOnce(Return(kTestViewId2));
 
         get_and_check_upsert(cache, txn1, kTestAddress1, kTestAccountData);
 
         CHECK(cache.state_hit_count() == 1);
         CHECK(cache.state_miss_count() == 0);
         CHECK(cache.state_key_count() == 1);
-        CHECK(cache.state_eviction_count() == 1);
+        CHECK(cache.state_eviction_count() == 0);
 
         get_and_check_upsert(cache, txn2, kTestAddress1, kTestAccountData);
 
         CHECK(cache.state_hit_count() == 2);
         CHECK(cache.state_miss_count() == 0);
         CHECK(cache.state_key_count() == 1);
-        CHECK(cache.state_eviction_count() == 1);
+        CHECK(cache.state_eviction_count() == 0);
     }
 
     SECTION("two code change batches => two search hits in different views") {
@@ -493,15 +499,15 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view two views", "[rpc
         CHECK(cache.latest_code_size() == 2);
 
         test_util::MockTransaction txn1, txn2;
-        EXPECT_CALL(txn1, view_id()).Times(2).WillRepeatedly(Return(kTestViewId1));
-        EXPECT_CALL(txn2, view_id()).Times(4).WillRepeatedly(Return(kTestViewId2));
+        EXPECT_CALL(txn1, view_id()).WillOnce(Return(kTestViewId1));
+        EXPECT_CALL(txn2, view_id()).Times(2).WillRepeatedly(Return(kTestViewId2));
 
         get_and_check_code(cache, txn1, kTestCode1);
 
         CHECK(cache.code_hit_count() == 1);
         CHECK(cache.code_miss_count() == 0);
         CHECK(cache.code_key_count() == 2);
-        CHECK(cache.code_eviction_count() == 1);
+        CHECK(cache.code_eviction_count() == 0);
 
         get_and_check_code(cache, txn2, kTestCode1);
         get_and_check_code(cache, txn2, kTestCode2);
@@ -509,7 +515,7 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::get_view two views", "[rpc
         CHECK(cache.code_hit_count() == 3);
         CHECK(cache.code_miss_count() == 0);
         CHECK(cache.code_key_count() == 2);
-        CHECK(cache.code_eviction_count() == 1);
+        CHECK(cache.code_eviction_count() == 0);
     }
 }
 
@@ -540,9 +546,12 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max vi
     CHECK(cache.get_view(txn0) == nullptr);
 }
 
-TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max keys", "[rpc][ethdb][kv][state_cache]") {
+TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max bytes", "[rpc][ethdb][kv][state_cache]") {
+    // Enough bytes for two accounts and for the two largest codes
     constexpr auto kMaxKeys{2u};
-    const CoherentCacheConfig config{kDefaultMaxViews, /*with_storage=*/true, kMaxKeys, kMaxKeys};
+    const uint64_t max_state_bytes{kMaxKeys * (kAddressLength + kTestAccountData.size())};
+    const uint64_t max_code_bytes{kMaxKeys * (kHashLength + kTestCode1.size())};
+    const CoherentCacheConfig config{kDefaultMaxViews, /*with_storage=*/true, max_state_bytes, max_code_bytes};
     CoherentStateCache cache{config};
 
     // Create as many data and code keys as the maximum allowed number
@@ -553,13 +562,44 @@ TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block exceed max ke
     CHECK(cache.state_eviction_count() == 0);
     CHECK(cache.code_eviction_count() == 0);
 
-    // Next incoming batch with *new keys* overflows the data and code keys
+    // Next incoming batch with *new keys* overflows the data and code bytes
     cache.on_new_block(new_batch_with_upsert_code(kTestViewId1, kTestBlockNumber + 1, kTestBlockHash, kTestZeroTxs,
                                                   /*unwind=*/false, /*num_changes=*/4, /*offset=*/2));
     CHECK(cache.state_key_count() == kMaxKeys);
     CHECK(cache.code_key_count() == kMaxKeys);
     CHECK(cache.state_eviction_count() == kMaxKeys);
     CHECK(cache.code_eviction_count() == kMaxKeys);
+
+    // The previous state view is left untouched by the evictions in the latest one
+    test_util::MockTransaction txn;
+    EXPECT_CALL(txn, view_id()).WillOnce(Return(kTestViewId0));
+    get_and_check_upsert(cache, txn, kTestAddress1, kTestAccountData);
+    CHECK(cache.state_hit_count() == 1);
+}
+
+TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block keeps referenced keys", "[rpc][ethdb][kv][state_cache]") {
+    constexpr auto kMaxKeys{2u};
+    const uint64_t max_state_bytes{kMaxKeys * (kAddressLength + kTestAccountData.size())};
+    const CoherentCacheConfig config{kDefaultMaxViews, /*with_storage=*/true, max_state_bytes, kDefaultMaxCodeBytes};
+    CoherentStateCache cache{config};
+
+    cache.on_new_block(new_batch_with_upsert_code(kTestViewId0, kTestBlockNumber, kTestBlockHash, kTestZeroTxs,
+                                                  /*unwind=*/false, /*num_changes=*/kMaxKeys));
+
+    // Reading the oldest key gives it a second chance
+    test_util::MockTransaction txn;
+    EXPECT_CALL(txn, view_id()).WillRepeatedly(Return(kTestViewId0));
+    get_and_check_upsert(cache, txn, kTestAddress1, kTestAccountData);
+
+    cache.on_new_block(new_batch_with_upsert_code(kTestViewId1, kTestBlockNumber + 1, kTestBlockHash, kTestZeroTxs,
+                                                  /*unwind=*/false, /*num_changes=*/3, /*offset=*/2));
+    CHECK(cache.state_key_count() == kMaxKeys);
+    CHECK(cache.state_eviction_count() == 1);
+
+    test_util::MockTransaction txn1;
+    EXPECT_CALL(txn1, view_id()).WillOnce(Return(kTestViewId1));
+    get_and_check_upsert(cache, txn1, kTestAddress1, kTestAccountData);
+    CHECK(cache.state_hit_count() == 2);
 }
 
 TEST_CASE_METHOD(StateCacheTest, "CoherentStateCache::on_new_block clear the cache on view ID wrapping", "[rpc][ethdb][kv][state_cache]") {
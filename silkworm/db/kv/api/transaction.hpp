@@ -60,9 +60,21 @@ class Transaction {
 
     virtual Task<kv::api::KeyValue> get(const std::string& table, ByteView key) = 0;
 
+    //! \brief Zero-copy variant of get
+    //! \details The returned views are valid only until the next operation on this transaction. The default
+    //! implementation keeps the last copied pair alive inside the transaction.
+    virtual Task<KeyValueView> get_view(const std::string& table, ByteView key) {
+        view_storage_ = co_await get(table, key);
+        co_return KeyValueView{view_storage_.key, view_storage_.value};
+    }
+
     virtual Task<Bytes> get_one(const std::string& table, ByteView key) = 0;
 
     virtual Task<std::optional<Bytes>> get_both_range(const std::string& table, ByteView key, ByteView subkey) = 0;
+
+  protected:
+    //! The last key/value pair returned by the default get_view
+    KeyValue view_storage_;
 };
 
 }  // namespace silkworm::db::kv::api
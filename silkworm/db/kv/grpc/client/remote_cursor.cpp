@@ -16,6 +16,12 @@
 
 #include "remote_cursor.hpp"
 
+#include <algorithm>
+#include <system_error>
+
+#include <boost/system/system_error.hpp>
+#include <grpcpp/support/status.h>
+
 #include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/infra/common/clock_time.hpp>
 #include <silkworm/infra/common/log.hpp>
@@ -34,7 +40,16 @@ Task<void> RemoteCursor::open_cursor(const std::string& table_name, bool is_dup_
             open_message.set_op(remote::Op::OPEN);
         }
         open_message.set_bucket_name(table_name);
-        cursor_id_ = (co_await tx_rpc_.write_and_read(open_message)).cursor_id();
+        try {
+            cursor_id_ = (co_await tx_rpc_.write_and_read(open_message)).cursor_id();
+        } catch (const boost::system::system_error& se) {
+            // The KV server rejects the opening of an unknown table as invalid argument
+            if (std::error_code(se.code()).value() == ::grpc::StatusCode::INVALID_ARGUMENT) {
+                throw api::TableNotFoundError{table_name};
+            }
+            throw;
+        }
+        is_dup_sorted_ = is_dup_sorted;
         SILK_DEBUG << "RemoteCursor::open_cursor cursor: " << cursor_id_ << " for table: " << table_name;
     }
     SILK_DEBUG << "RemoteCursor::open_cursor [" << table_name << "] c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -48,11 +63,13 @@ Task<api::KeyValue> RemoteCursor::seek(ByteView key) {
     seek_message.set_op(remote::Op::SEEK);
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
+    reset_read_ahead();
     auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
     const auto k = string_to_bytes(seek_pair.k());
     const auto v = string_to_bytes(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    current_ = api::KeyValue{k, v};
+    co_return current_;
 }
 
 Task<api::KeyValue> RemoteCursor::seek_exact(ByteView key) {
@@ -62,27 +79,26 @@ Task<api::KeyValue> RemoteCursor::seek_exact(ByteView key) {
     seek_message.set_op(remote::Op::SEEK_EXACT);
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
+    reset_read_ahead();
     auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
     const auto k = string_to_bytes(seek_pair.k());
     const auto v = string_to_bytes(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_exact k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    current_ = api::KeyValue{k, v};
+    co_return current_;
 }
 
 Task<api::KeyValue> RemoteCursor::next() {
     const auto start_time = clock_time::now();
-    auto next_message = remote::Cursor{};
-    next_message.set_op(remote::Op::NEXT);
-    next_message.set_cursor(cursor_id_);
-    auto next_pair = co_await tx_rpc_.write_and_read(next_message);
-    const auto k = string_to_bytes(next_pair.k());
-    const auto v = string_to_bytes(next_pair.v());
-    SILK_DEBUG << "RemoteCursor::next k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    auto kv = co_await read_ahead(remote::Op::NEXT);
+    SILK_DEBUG << "RemoteCursor::next k: " << kv.key << " v: " << kv.value << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
+    co_return kv;
 }
 
 Task<api::KeyValue> RemoteCursor::previous() {
     const auto start_time = clock_time::now();
+    co_await realign();
+    reset_read_ahead();
     auto next_message = remote::Cursor{};
     next_message.set_op(remote::Op::PREV);
     next_message.set_cursor(cursor_id_);
@@ -90,19 +106,15 @@ Task<api::KeyValue> RemoteCursor::previous() {
     const auto k = string_to_bytes(next_pair.k());
     const auto v = string_to_bytes(next_pair.v());
     SILK_DEBUG << "RemoteCursor::previous k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    current_ = api::KeyValue{k, v};
+    co_return current_;
 }
 
 Task<api::KeyValue> RemoteCursor::next_dup() {
     const auto start_time = clock_time::now();
-    auto next_message = remote::Cursor{};
-    next_message.set_op(remote::Op::NEXT_DUP);
-    next_message.set_cursor(cursor_id_);
-    auto next_pair = co_await tx_rpc_.write_and_read(next_message);
-    const auto k = string_to_bytes(next_pair.k());
-    const auto v = string_to_bytes(next_pair.v());
-    SILK_DEBUG << "RemoteCursor::next k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    auto kv = co_await read_ahead(remote::Op::NEXT_DUP);
+    SILK_DEBUG << "RemoteCursor::next_dup k: " << kv.key << " v: " << kv.value << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
+    co_return kv;
 }
 
 Task<Bytes> RemoteCursor::seek_both(ByteView key, ByteView value) {
@@ -113,10 +125,12 @@ Task<Bytes> RemoteCursor::seek_both(ByteView key, ByteView value) {
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
     seek_message.set_v(value.data(), value.length());
+    reset_read_ahead();
     auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
     const auto k = string_to_bytes(seek_pair.k());
     const auto v = string_to_bytes(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_both k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
+    current_ = api::KeyValue{Bytes{key}, v};
     co_return v;
 }
 
@@ -128,11 +142,13 @@ Task<api::KeyValue> RemoteCursor::seek_both_exact(ByteView key, ByteView value)
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
     seek_message.set_v(value.data(), value.length());
+    reset_read_ahead();
     auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
     const auto k = string_to_bytes(seek_pair.k());
     const auto v = string_to_bytes(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_both_exact k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
-    co_return api::KeyValue{k, v};
+    current_ = api::KeyValue{k, v};
+    co_return current_;
 }
 
 Task<void> RemoteCursor::close_cursor() {
@@ -143,6 +159,7 @@ Task<void> RemoteCursor::close_cursor() {
         auto close_message = remote::Cursor{};
         close_message.set_op(remote::Op::CLOSE);
         close_message.set_cursor(cursor_id_);
+        reset_read_ahead();
         co_await tx_rpc_.write_and_read(close_message);
         SILK_DEBUG << "RemoteCursor::close_cursor cursor: " << cursor_id_;
         cursor_id_ = 0;
@@ -151,4 +168,60 @@ Task<void> RemoteCursor::close_cursor() {
     co_return;
 }
 
+Task<api::KeyValue> RemoteCursor::read_ahead(remote::Op op) {
+    if (!read_ahead_.empty() && read_ahead_op_ != op) {
+        co_await realign();
+    }
+    if (read_ahead_.empty()) {
+        auto message = remote::Cursor{};
+        message.set_op(op);
+        message.set_cursor(cursor_id_);
+        // The server handles the requests in order, so write them all before reading any reply
+        const auto replies = co_await tx_rpc_.write_and_read(message, read_ahead_size_);
+        std::size_t read_ahead_bytes{0};
+        bool end_reached{false};
+        for (const auto& pair : replies) {
+            // Replies past the end of the table (or of the duplicates) are empty and must be just discarded
+            if (end_reached) {
+                continue;
+            }
+            auto kv = api::KeyValue{string_to_bytes(pair.k()), string_to_bytes(pair.v())};
+            read_ahead_bytes += kv.key.size() + kv.value.size();
+            end_reached = kv.key.empty();
+            read_ahead_.push_back(std::move(kv));
+        }
+        read_ahead_op_ = op;
+        if (!end_reached && read_ahead_bytes < kCursorReadAheadByteBudget) {
+            read_ahead_size_ = std::min(read_ahead_size_ * 2, kMaxCursorReadAhead);
+        }
+    }
+    current_ = std::move(read_ahead_.front());
+    read_ahead_.pop_front();
+    co_return current_;
+}
+
+Task<void> RemoteCursor::realign() {
+    if (read_ahead_.empty()) {
+        co_return;
+    }
+    SILK_DEBUG << "RemoteCursor::realign c=" << cursor_id_ << " discarding " << read_ahead_.size() << " entries";
+    reset_read_ahead();
+    // The server cursor is ahead of the last entry returned, so move it back there
+    auto seek_message = remote::Cursor{};
+    seek_message.set_cursor(cursor_id_);
+    seek_message.set_k(current_.key.data(), current_.key.length());
+    if (is_dup_sorted_) {
+        seek_message.set_op(remote::Op::SEEK_BOTH_EXACT);
+        seek_message.set_v(current_.value.data(), current_.value.length());
+    } else {
+        seek_message.set_op(remote::Op::SEEK_EXACT);
+    }
+    co_await tx_rpc_.write_and_read(seek_message);
+}
+
+void RemoteCursor::reset_read_ahead() {
+    read_ahead_.clear();
+    read_ahead_size_ = 1;
+}
+
 }  // namespace silkworm::db::kv::grpc::client
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -32,6 +34,17 @@
 
 namespace silkworm::db::kv::grpc::client {
 
+//! Max number of NEXT/NEXT_DUP requests pipelined by one cursor read-ahead
+inline constexpr std::size_t kMaxCursorReadAhead{256};
+
+//! Size in bytes of the read-ahead replies above which the read-ahead window stops growing
+inline constexpr std::size_t kCursorReadAheadByteBudget{256 * 1024};
+
+//! \brief Cursor over the remote KV Tx bidirectional stream.
+//! \details Consecutive next/next_dup calls are served by a read-ahead buffer: the cursor pipelines a window of
+//! requests without waiting for each reply and doubles the window at each refill (up to kMaxCursorReadAhead), so
+//! walking N entries takes O(log N) round-trips instead of N. Any other positioning operation drops the buffer and,
+//! if it is relative, first moves the server cursor back to the last entry returned.
 class RemoteCursor : public api::CursorDupSort {
   public:
     explicit RemoteCursor(TxRpc& tx_rpc) : tx_rpc_(tx_rpc), cursor_id_{0} {}
@@ -57,8 +70,21 @@ class RemoteCursor : public api::CursorDupSort {
     Task<api::KeyValue> seek_both_exact(ByteView key, ByteView value) override;
 
   private:
+    Task<api::KeyValue> read_ahead(remote::Op op);
+    Task<void> realign();
+    void reset_read_ahead();
+
     TxRpc& tx_rpc_;
     uint32_t cursor_id_;
+    bool is_dup_sorted_{false};
+
+    //! Entries read from the server but not returned yet, all produced by read_ahead_op_
+    std::deque<api::KeyValue> read_ahead_;
+    remote::Op read_ahead_op_{remote::Op::NEXT};
+    std::size_t read_ahead_size_{1};
+
+    //! The last entry returned, i.e. the position seen by the user when the server cursor is ahead of it
+    api::KeyValue current_;
 };
 
 }  // namespace silkworm::db::kv::grpc::client
@@ -110,6 +110,35 @@ TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::open_cursor", "[rpc][ethdb][kv
                              boost::system::system_error,
                              test::exception_has_cancelled_grpc_status_code());
     }
+    SECTION("unknown table") {
+        // Set the call expectations:
+        // 1. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor on specified table succeeds
+        EXPECT_CALL(reader_writer_, Write(_, _)).WillOnce(test::write_success(grpc_context_));
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read call fails
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_failure(grpc_context_));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Finish call succeeds w/ status invalid argument
+        EXPECT_CALL(reader_writer_, Finish)
+            .WillOnce(test::finish_streaming_with_status(grpc_context_,
+                                                         ::grpc::Status{::grpc::StatusCode::INVALID_ARGUMENT, "unknown bucket: table1"},
+                                                         /*ok=*/true));
+
+        // Execute the test: opening a cursor should raise the table-not-found exception
+        CHECK_THROWS_AS(spawn_and_wait(remote_cursor_.open_cursor("table1", false)), api::TableNotFoundError);
+    }
+    SECTION("other server error") {
+        // Set the call expectations:
+        // 1. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor on specified table succeeds
+        EXPECT_CALL(reader_writer_, Write(_, _)).WillOnce(test::write_success(grpc_context_));
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read call fails
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_failure(grpc_context_));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Finish call succeeds w/ status aborted
+        EXPECT_CALL(reader_writer_, Finish).WillOnce(test::finish_streaming_aborted(grpc_context_));
+
+        // Execute the test: opening a cursor should raise an exception w/ expected gRPC status code
+        CHECK_THROWS_MATCHES(spawn_and_wait(remote_cursor_.open_cursor("table1", false)),
+                             boost::system::system_error,
+                             test::exception_has_grpc_status_code(::grpc::StatusCode::ABORTED));
+    }
 }
 
 TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::close_cursor", "[rpc][ethdb][kv][remote_cursor]") {
@@ -456,6 +485,81 @@ TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::next", "[rpc][ethdb][kv][remot
     }
 }
 
+TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::next read-ahead", "[rpc][ethdb][kv][remote_cursor]") {
+    remote::Pair open_pair;
+    open_pair.set_cursor_id(3);
+    remote::Pair next_pair1;
+    next_pair1.set_k("k1");
+    next_pair1.set_v("v1");
+    remote::Pair next_pair2;
+    next_pair2.set_k("k2");
+    next_pair2.set_v("v2");
+    remote::Pair next_pair3;
+    next_pair3.set_k("k3");
+    next_pair3.set_v("v3");
+
+    SECTION("consecutive next calls are pipelined") {
+        // Set the call expectations:
+        // 1. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor succeeds
+        Expectation open = EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::op, Eq(remote::Op::OPEN)), _))
+                               .WillOnce(test::write_success(grpc_context_));
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write calls to move next: 1st read-ahead of 1, 2nd of 2
+        EXPECT_CALL(reader_writer_, Write(AllOf(Property(&remote::Cursor::op, Eq(remote::Op::NEXT)), Property(&remote::Cursor::cursor, Eq(3))), _))
+            .Times(3)
+            .After(open)
+            .WillRepeatedly(test::write_success(grpc_context_));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read calls succeed
+        EXPECT_CALL(reader_writer_, Read)
+            .WillOnce(test::read_success_with(grpc_context_, open_pair))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair1))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair2))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair3));
+
+        // Execute the test preconditions: open a new cursor on specified table
+        REQUIRE_NOTHROW(spawn_and_wait(remote_cursor_.open_cursor("table1", false)));
+
+        // Execute the test: the 2nd and 3rd next calls should be served by one read-ahead
+        CHECK(spawn_and_wait(remote_cursor_.next()).key == string_to_bytes("k1"));
+        CHECK(spawn_and_wait(remote_cursor_.next()).key == string_to_bytes("k2"));
+        CHECK(spawn_and_wait(remote_cursor_.next()).key == string_to_bytes("k3"));
+    }
+    SECTION("previous after read-ahead realigns the cursor") {
+        // Set the call expectations:
+        // 1. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor succeeds
+        Expectation open = EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::op, Eq(remote::Op::OPEN)), _))
+                               .WillOnce(test::write_success(grpc_context_));
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write calls to move next succeed
+        Expectation next = EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::op, Eq(remote::Op::NEXT)), _))
+                               .Times(3)
+                               .After(open)
+                               .WillRepeatedly(test::write_success(grpc_context_));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to seek back to the last returned key succeeds
+        Expectation realign = EXPECT_CALL(reader_writer_, Write(AllOf(Property(&remote::Cursor::op, Eq(remote::Op::SEEK_EXACT)), Property(&remote::Cursor::k, Eq("k2"))), _))
+                                  .After(next)
+                                  .WillOnce(test::write_success(grpc_context_));
+        // 4. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to move previous succeeds
+        EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::op, Eq(remote::Op::PREV)), _))
+            .After(realign)
+            .WillOnce(test::write_success(grpc_context_));
+        // 5. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read calls succeed
+        EXPECT_CALL(reader_writer_, Read)
+            .WillOnce(test::read_success_with(grpc_context_, open_pair))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair1))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair2))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair3))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair2))
+            .WillOnce(test::read_success_with(grpc_context_, next_pair1));
+
+        // Execute the test preconditions: open a new cursor on specified table and read ahead k2 and k3
+        REQUIRE_NOTHROW(spawn_and_wait(remote_cursor_.open_cursor("table1", false)));
+        REQUIRE(spawn_and_wait(remote_cursor_.next()).key == string_to_bytes("k1"));
+        REQUIRE(spawn_and_wait(remote_cursor_.next()).key == string_to_bytes("k2"));
+
+        // Execute the test: moving previous should return the entry before the last returned one
+        CHECK(spawn_and_wait(remote_cursor_.previous()).key == string_to_bytes("k1"));
+    }
+}
+
 TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::next_dup", "[rpc][ethdb][kv][remote_cursor]") {
     SECTION("success") {
         // Set the call expectations:
@@ -28,10 +28,12 @@ RemoteTransaction::RemoteTransaction(
     agrpc::GrpcContext& grpc_context,
     api::StateCache* state_cache,
     chain::BlockProvider block_provider,
-    chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider)
+    chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider,
+    state::CodeCache* code_cache)
     : BaseTransaction(state_cache),
       block_provider_{std::move(block_provider)},
       block_number_from_txn_hash_provider_{std::move(block_number_from_txn_hash_provider)},
+      code_cache_{code_cache},
       tx_rpc_{stub, grpc_context} {}
 
 Task<void> RemoteTransaction::open() {
@@ -67,6 +69,7 @@ Task<std::shared_ptr<api::CursorDupSort>> RemoteTransaction::get_cursor(const st
             co_return cursor_it->second;
         }
     }
+    // Concurrent requests may open the same table twice: the extra cursor just lives until the transaction ends
     auto cursor = std::make_shared<RemoteCursor>(tx_rpc_);
     co_await cursor->open_cursor(table, is_cursor_dup_sort);
     if (is_cursor_dup_sort) {
@@ -78,7 +81,7 @@ Task<std::shared_ptr<api::CursorDupSort>> RemoteTransaction::get_cursor(const st
 }
 
 std::shared_ptr<silkworm::State> RemoteTransaction::create_state(boost::asio::any_io_executor& executor, const chain::ChainStorage& storage, BlockNum block_number) {
-    return std::make_shared<db::state::RemoteState>(executor, *this, storage, block_number);
+    return std::make_shared<db::state::RemoteState>(executor, *this, storage, block_number, code_cache_);
 }
 
 std::shared_ptr<chain::ChainStorage> RemoteTransaction::create_storage() {
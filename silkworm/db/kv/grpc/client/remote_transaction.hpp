@@ -29,6 +29,7 @@
 #include <silkworm/db/chain/remote_chain_storage.hpp>
 #include <silkworm/db/kv/api/base_transaction.hpp>
 #include <silkworm/db/kv/api/cursor.hpp>
+#include <silkworm/db/state/code_cache.hpp>
 
 #include "remote_cursor.hpp"
 #include "rpc.hpp"
@@ -41,7 +42,8 @@ class RemoteTransaction : public api::BaseTransaction {
                       agrpc::GrpcContext& grpc_context,
                       api::StateCache* state_cache,
                       chain::BlockProvider block_provider,
-                      chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider);
+                      chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider,
+                      state::CodeCache* code_cache = nullptr);
     ~RemoteTransaction() override = default;
 
     uint64_t tx_id() const override { return tx_id_; }
@@ -64,6 +66,7 @@ class RemoteTransaction : public api::BaseTransaction {
 
     chain::BlockProvider block_provider_;
     chain::BlockNumberFromTxnHashProvider block_number_from_txn_hash_provider_;
+    state::CodeCache* code_cache_;
     std::map<std::string, std::shared_ptr<api::CursorDupSort>> cursors_;
     std::map<std::string, std::shared_ptr<api::CursorDupSort>> dup_cursors_;
     TxRpc tx_rpc_;
@@ -0,0 +1,87 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "rpc.hpp"
+
+#include <utility>
+
+namespace silkworm::db::kv::grpc::client {
+
+Task<remote::Pair> TxRpc::write_and_read(const remote::Cursor& request) {
+    auto replies = co_await write_and_read(request, 1);
+    co_return std::move(replies.front());
+}
+
+Task<std::vector<remote::Pair>> TxRpc::write_and_read(const remote::Cursor& request, std::size_t count) {
+    // Requests are numbered in the order they are written on the stream, which is the order of their replies
+    while (writing_) {
+        auto waiter = write_turn_.waiter();
+        co_await waiter();
+    }
+    rethrow_if_failed();
+    writing_ = true;
+    const uint64_t first_reply{next_reply_};
+    try {
+        for (std::size_t i{0}; i < count; ++i) {
+            co_await TxStreamingRpc::write(request);
+        }
+    } catch (...) {
+        fail(std::current_exception());
+        throw;
+    }
+    next_reply_ += count;
+    writing_ = false;
+    write_turn_.notify_all();
+
+    // Once the requests are written, giving up before their replies are read would hand them to the next requests
+    std::vector<remote::Pair> replies;
+    replies.reserve(count);
+    try {
+        while (reading_reply_ != first_reply) {
+            rethrow_if_failed();
+            auto waiter = read_turn_.waiter();
+            co_await waiter();
+        }
+        rethrow_if_failed();
+        for (std::size_t i{0}; i < count; ++i) {
+            replies.push_back(co_await TxStreamingRpc::read());
+        }
+    } catch (...) {
+        fail(std::current_exception());
+        throw;
+    }
+    reading_reply_ += count;
+    read_turn_.notify_all();
+    co_return replies;
+}
+
+void TxRpc::fail(std::exception_ptr failure) {
+    // Keep the original failure, not the ones it causes in the pending requests
+    if (!failure_) {
+        failure_ = std::move(failure);
+    }
+    writing_ = false;
+    write_turn_.notify_all();
+    read_turn_.notify_all();
+}
+
+void TxRpc::rethrow_if_failed() const {
+    if (failure_) {
+        std::rethrow_exception(failure_);
+    }
+}
+
+}  // namespace silkworm::db::kv::grpc::client
@@ -16,13 +16,54 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <silkworm/infra/concurrency/awaitable_condition_variable.hpp>
 #include <silkworm/infra/grpc/client/bidi_streaming_rpc.hpp>
 #include <silkworm/infra/grpc/client/server_streaming_rpc.hpp>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
 
 namespace silkworm::db::kv::grpc::client {
 
-using TxRpc = BidiStreamingRpc<&::remote::KV::StubInterface::PrepareAsyncTx>;
+using TxStreamingRpc = BidiStreamingRpc<&::remote::KV::StubInterface::PrepareAsyncTx>;
+
+//! \brief The KV Tx bidirectional stream shared by all the cursors of one remote transaction.
+//! \details The server handles the requests in order, so concurrent requests are pipelined instead of waiting for
+//! each other: a request is written as soon as the stream is free for writing and its replies are read as soon as
+//! the replies to all the previous requests have been read. Any failure leaves the stream out of sync, so it is
+//! raised again by all the pending and later requests.
+class TxRpc : private TxStreamingRpc {
+  public:
+    using TxStreamingRpc::TxStreamingRpc;
+
+    using TxStreamingRpc::get_executor;
+    using TxStreamingRpc::request_and_read;
+    using TxStreamingRpc::writes_done_and_finish;
+
+    //! Write \p request and read its reply
+    Task<::remote::Pair> write_and_read(const ::remote::Cursor& request);
+
+    //! Write \p count copies of \p request back-to-back and read all their replies
+    Task<std::vector<::remote::Pair>> write_and_read(const ::remote::Cursor& request, std::size_t count);
+
+  private:
+    void fail(std::exception_ptr failure);
+    void rethrow_if_failed() const;
+
+    concurrency::AwaitableConditionVariable write_turn_;
+    concurrency::AwaitableConditionVariable read_turn_;
+    bool writing_{false};
+    //! Sequence number of the next reply to be requested
+    uint64_t next_reply_{0};
+    //! Sequence number of the next reply to be read
+    uint64_t reading_reply_{0};
+    std::exception_ptr failure_;
+};
 
 using StateChangesRpc = ServerStreamingRpc<&::remote::KV::StubInterface::PrepareAsyncStateChanges>;
 
@@ -0,0 +1,122 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "rpc.hpp"
+
+#include <array>
+#include <string>
+
+#include <boost/asio/use_future.hpp>
+#include <boost/system/system_error.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_predicate.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/db/test_util/kv_test_base.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/infra/grpc/test_util/grpc_actions.hpp>
+#include <silkworm/infra/grpc/test_util/grpc_matcher.hpp>
+
+namespace silkworm::db::kv::grpc::client {
+
+using testing::_;
+using testing::AtLeast;
+using testing::Eq;
+using testing::Property;
+using testing::Sequence;
+namespace test = rpc::test;
+
+struct TxRpcTest : test_util::KVTestBase {
+    TxRpcTest() {
+        // Start a new Tx RPC and read the first incoming message (tx_id)
+        expect_request_async_tx(true);
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_success_with(grpc_context_, remote::Pair{}));
+        REQUIRE_NOTHROW(tx_rpc_.request_and_read(boost::asio::use_future).get());
+    }
+
+    static remote::Cursor make_request(uint32_t cursor_id) {
+        remote::Cursor request;
+        request.set_op(remote::Op::SEEK);
+        request.set_cursor(cursor_id);
+        return request;
+    }
+
+    static remote::Pair make_reply(const std::string& key) {
+        remote::Pair reply;
+        reply.set_k(key);
+        return reply;
+    }
+
+    TxRpc tx_rpc_{*stub_, grpc_context_};
+};
+
+#ifndef SILKWORM_SANITIZE
+TEST_CASE_METHOD(TxRpcTest, "TxRpc::write_and_read", "[db][kv][grpc][tx_rpc]") {
+    SECTION("single request") {
+        EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::cursor, Eq(1u)), _)).WillOnce(test::write_success(grpc_context_));
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_success_with(grpc_context_, make_reply("01")));
+        CHECK(spawn_and_wait(tx_rpc_.write_and_read(make_request(1))).k() == "01");
+    }
+
+    SECTION("multiple copies of one request") {
+        Sequence reads;
+        EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::cursor, Eq(1u)), _)).Times(3).WillRepeatedly(test::write_success(grpc_context_));
+        EXPECT_CALL(reader_writer_, Read).InSequence(reads).WillOnce(test::read_success_with(grpc_context_, make_reply("01")));
+        EXPECT_CALL(reader_writer_, Read).InSequence(reads).WillOnce(test::read_success_with(grpc_context_, make_reply("02")));
+        EXPECT_CALL(reader_writer_, Read).InSequence(reads).WillOnce(test::read_success_with(grpc_context_, make_reply("03")));
+        const auto replies = spawn_and_wait(tx_rpc_.write_and_read(make_request(1), 3));
+        REQUIRE(replies.size() == 3);
+        CHECK(replies[0].k() == "01");
+        CHECK(replies[1].k() == "02");
+        CHECK(replies[2].k() == "03");
+    }
+
+    SECTION("concurrent requests get the replies in request order") {
+        Sequence writes, reads;
+        EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::cursor, Eq(1u)), _)).InSequence(writes).WillOnce(test::write_success(grpc_context_));
+        EXPECT_CALL(reader_writer_, Write(Property(&remote::Cursor::cursor, Eq(2u)), _)).InSequence(writes).WillOnce(test::write_success(grpc_context_));
+        EXPECT_CALL(reader_writer_, Read).InSequence(reads).WillOnce(test::read_success_with(grpc_context_, make_reply("01")));
+        EXPECT_CALL(reader_writer_, Read).InSequence(reads).WillOnce(test::read_success_with(grpc_context_, make_reply("02")));
+
+        std::array<std::string, 2> keys;
+        auto request = [&](size_t i) -> Task<void> {
+            const auto reply = co_await tx_rpc_.write_and_read(make_request(static_cast<uint32_t>(i + 1)));
+            keys[i] = reply.k();
+        };
+        spawn_and_wait(concurrency::generate_parallel_group_task(keys.size(), request));
+        CHECK(keys[0] == "01");
+        CHECK(keys[1] == "02");
+    }
+
+    SECTION("failure is raised by pending and later requests") {
+        EXPECT_CALL(reader_writer_, Write(_, _)).Times(AtLeast(1)).WillRepeatedly(test::write_success(grpc_context_));
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_failure(grpc_context_));
+        EXPECT_CALL(reader_writer_, Finish).WillOnce(test::finish_streaming_cancelled(grpc_context_));
+
+        auto request = [&](size_t i) -> Task<void> {
+            co_await tx_rpc_.write_and_read(make_request(static_cast<uint32_t>(i + 1)));
+        };
+        CHECK_THROWS_AS(spawn_and_wait(concurrency::generate_parallel_group_task(2, request)), boost::system::system_error);
+
+        // The stream is out of sync, so no further request is written
+        CHECK_THROWS_MATCHES(spawn_and_wait(tx_rpc_.write_and_read(make_request(3))),
+                             boost::system::system_error,
+                             test::exception_has_cancelled_grpc_status_code());
+    }
+}
+#endif  // SILKWORM_SANITIZE
+
+}  // namespace silkworm::db::kv::grpc::client
@@ -17,6 +17,7 @@
 #include "state_changes_stream.hpp"
 
 #include <ostream>
+#include <utility>
 
 #include <boost/asio/experimental/as_tuple.hpp>
 #include <boost/asio/use_future.hpp>
@@ -45,6 +46,14 @@ StateChangesStream::StateChangesStream(rpc::ClientContext& context, remote::KV::
       cache_(must_use_shared_service<api::StateCache>(scheduler_)),
       retry_timer_{scheduler_} {}
 
+void StateChangesStream::add_consumer(StateChangesConsumer consumer) {
+    consumers_.push_back(std::move(consumer));
+}
+
+void StateChangesStream::add_subscription_handler(SubscriptionHandler handler) {
+    subscription_handlers_.push_back(std::move(handler));
+}
+
 std::future<void> StateChangesStream::open() {
     return concurrency::co_spawn_sw(scheduler_, run(), boost::asio::use_future);
 }
@@ -95,6 +104,9 @@ Task<void> StateChangesStream::run() {
             continue;
         }
         SILK_INFO << "State changes stream opened";
+        for (const auto& handler : subscription_handlers_) {
+            handler();
+        }
 
         std::error_code read_ec;
         remote::StateChangeBatch reply;
@@ -103,6 +115,9 @@ Task<void> StateChangesStream::run() {
             if (!read_ec) {
                 SILK_TRACE << "State changes batch received: " << reply << "";
                 cache_->on_new_block(reply);
+                for (const auto& consumer : consumers_) {
+                    consumer(reply);
+                }
             } else {
                 if (read_ec.value() == ::grpc::StatusCode::CANCELLED || read_ec.value() == ::grpc::StatusCode::ABORTED) {
                     closed = true;
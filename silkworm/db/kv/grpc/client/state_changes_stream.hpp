@@ -21,6 +21,7 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 #ifndef BOOST_ASIO_HAS_BOOST_DATE_TIME
@@ -61,8 +62,21 @@ class StateChangesStream {
     //! Set the retry interval between successive registration attempts
     static void set_registration_interval(std::chrono::milliseconds registration_interval);
 
+    //! Consumer of the received state changes in addition to the state cache, called on the stream scheduler
+    using StateChangesConsumer = std::function<void(const remote::StateChangeBatch&)>;
+
+    //! Handler of each (re)subscription to the state changes, called on the stream scheduler
+    using SubscriptionHandler = std::function<void()>;
+
     explicit StateChangesStream(rpc::ClientContext& context, remote::KV::StubInterface* stub);
 
+    //! Register an additional consumer of the state changes, must be called before opening the stream
+    void add_consumer(StateChangesConsumer consumer);
+
+    //! Register a handler notified each time the stream is (re)subscribed, must be called before opening the stream
+    //! \details Any state change (e.g. unwind) may have been missed before a subscription
+    void add_subscription_handler(SubscriptionHandler handler);
+
     //! Open up the stream, starting the register-and-receive loop
     std::future<void> open();
 
@@ -88,6 +102,12 @@ class StateChangesStream {
     //! The local state cache where the received state changes will be applied
     api::StateCache* cache_;
 
+    //! The additional consumers of the received state changes
+    std::vector<StateChangesConsumer> consumers_;
+
+    //! The handlers notified on each (re)subscription
+    std::vector<SubscriptionHandler> subscription_handlers_;
+
     //! The signal used to cancel the register-and-receive stream loop
     boost::asio::cancellation_signal cancellation_signal_;
 
@@ -122,8 +122,14 @@ TEST_CASE_METHOD(StateChangesStreamTest, "StateChangesStream::run", "[rpc][ethdb
                 return statechanges_reader_ptr_.release();
             }));
 
+        std::size_t subscriptions{0}, batches{0};
+        stream_.add_subscription_handler([&]() { ++subscriptions; });
+        stream_.add_consumer([&](const remote::StateChangeBatch&) { ++batches; });
+
         // Execute the test: running the stream should succeed until finishes
         CHECK_NOTHROW(spawn_and_wait(stream_.run()));
+        CHECK(subscriptions == 1);
+        CHECK(batches == 3);
     }
     SECTION("failure in first read") {
         // Set the call expectations:
@@ -116,6 +116,11 @@ Task<void> TxCall::operator()(mdbx::env* chaindata_env) {
                     // Handle incoming request from client
                     remote::Pair response{};
                     handle(&request, response);
+                    // Clients may pipeline requests (e.g. cursor read-ahead), so previous write may still be running
+                    if (write_stream.is_running() && !co_await write_stream.next()) {
+                        SILK_WARN << "Tx closed by peer: " << server_context_.peer() << " error: write failed";
+                        break;
+                    }
                     // Schedule write for response
                     write_stream.initiate(agrpc::write, responder_, std::move(response));
                     // Reset request and schedule subsequent read
@@ -124,6 +129,10 @@ Task<void> TxCall::operator()(mdbx::env* chaindata_env) {
                     // Update idle timer deadline every time we receive an incoming request
                     max_idle_deadline += max_idle_duration_;
                 }
+                // Wait for the last response to be written
+                if (write_stream.is_running()) {
+                    co_await write_stream.next();
+                }
             } catch (const mdbx::exception& e) {
                 const auto error_message = "start tx failed: " + std::string{e.what()};
                 SILK_ERROR << "Tx peer: " << peer() << " " << error_message;
@@ -138,10 +147,6 @@ Task<void> TxCall::operator()(mdbx::env* chaindata_env) {
                 status = ::grpc::Status{::grpc::StatusCode::INTERNAL, exc.what()};
             }
         };
-        const auto write = [&]() -> Task<void> {
-            while (co_await write_stream.next()) {
-            }
-        };
         const auto max_idle_timer = [&]() -> Task<void> {
             while (true) {
                 const auto [ec] = co_await max_idle_alarm.async_wait(as_tuple(use_awaitable));
@@ -163,7 +168,7 @@ Task<void> TxCall::operator()(mdbx::env* chaindata_env) {
             }
         };
 
-        co_await (read() || write() || max_idle_timer() || max_ttl_timer());
+        co_await (read() || max_idle_timer() || max_ttl_timer());
 
         SILK_DEBUG << "TxCall peer: " << peer() << " read/write loop completed";
     } catch (const mdbx::exception& e) {
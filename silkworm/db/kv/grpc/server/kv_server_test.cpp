@@ -1048,6 +1048,40 @@ TEST_CASE("KvServer E2E: Tx cursor valid operations", "[silkworm][node][rpc]") {
         CHECK(responses[6].cursor_id() == 0);
     }
 
+    SECTION("Tx OK: pipelined NEXT operations") {
+        ::grpc::ClientContext context;
+        const auto tx_reader_writer = kv_client.tx_start(&context);
+        remote::Pair tx_id_pair;
+        CHECK(tx_reader_writer->Read(&tx_id_pair));
+        CHECK(tx_id_pair.tx_id() != 0);
+        remote::Cursor open;
+        open.set_op(remote::Op::OPEN);
+        open.set_bucket_name(kTestMap.name);
+        CHECK(tx_reader_writer->Write(open));
+        remote::Pair open_pair;
+        CHECK(tx_reader_writer->Read(&open_pair));
+        CHECK(open_pair.cursor_id() != 0);
+        // Write all the requests before reading any response, as the cursor read-ahead does
+        remote::Cursor next;
+        next.set_op(remote::Op::NEXT);
+        next.set_cursor(open_pair.cursor_id());
+        for (int i{0}; i < 3; ++i) {
+            CHECK(tx_reader_writer->Write(next));
+        }
+        std::vector<remote::Pair> responses(3);
+        for (auto& response : responses) {
+            CHECK(tx_reader_writer->Read(&response));
+        }
+        CHECK(responses[0].k() == "AA");
+        CHECK(responses[0].v() == "00");
+        CHECK(responses[1].k() == "BB");
+        CHECK(responses[1].v() == "11");
+        CHECK(responses[2].k().empty());
+        CHECK(responses[2].v().empty());
+        CHECK(tx_reader_writer->WritesDone());
+        CHECK(tx_reader_writer->Finish().ok());
+    }
+
     SECTION("Tx OK: one PREV operation") {
         remote::Cursor open;
         open.set_op(remote::Op::OPEN);
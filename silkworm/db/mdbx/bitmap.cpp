@@ -16,7 +16,11 @@
 
 #include "bitmap.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 #include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/core/common/endian.hpp>
@@ -134,6 +138,16 @@ void IndexLoader::merge_bitmaps_impl(RWTxn& txn, size_t key_size, etl_mdbx::Coll
     bitmaps_collector->clear();
 }
 
+//! Check if the serialized bitmap contains any value greater than \p n without deserializing it
+template <typename RoaringMap>
+bool has_value_above(ByteView data, uint64_t n) {
+    if constexpr (std::is_same_v<RoaringMap, roaring::Roaring>) {
+        return n < std::numeric_limits<uint32_t>::max() && seek_serialized32(data, static_cast<uint32_t>(n + 1));
+    } else {
+        return n < std::numeric_limits<uint64_t>::max() && seek_serialized(data, n + 1);
+    }
+}
+
 template <typename RoaringMap, typename BlockUpperBound>
 void IndexLoader::unwind_bitmaps_impl(RWTxn& txn, BlockNum to, const std::map<Bytes, bool>& keys) {
     using namespace std::chrono_literals;
@@ -168,11 +182,13 @@ void IndexLoader::unwind_bitmaps_impl(RWTxn& txn, BlockNum to, const std::map<By
                 break;
             }
 
-            auto db_bitmap{db::bitmap::parse_impl<RoaringMap>(index_data.value)};
-            if (db_bitmap.maximum() <= to) {
+            // Check on the serialized bitmap if there's anything to unwind before deserializing it
+            if (!has_value_above<RoaringMap>(db::from_slice(index_data.value), to)) {
                 break;
             }
 
+            auto db_bitmap{db::bitmap::parse_impl<RoaringMap>(index_data.value)};
+
             while (!db_bitmap.isEmpty() && db_bitmap.maximum() > to) {
                 db_bitmap.remove(db_bitmap.maximum());
             }
@@ -300,6 +316,209 @@ std::optional<uint64_t> seek(const roaring::Roaring64Map& bitmap, uint64_t n) {
     return std::nullopt;
 }
 
+namespace {
+
+    // Constants of the portable serialization format, see https://github.com/RoaringBitmap/RoaringFormatSpec
+    constexpr uint32_t kSerialCookieNoRunContainer{12346};
+    constexpr uint32_t kSerialCookie{12347};
+    constexpr std::size_t kNoOffsetThreshold{4};
+    constexpr uint32_t kMaxArrayContainerCardinality{4096};
+    constexpr std::size_t kBitsetContainerWords{1024};
+
+    //! Read-only view over a 32-bit roaring bitmap serialized in portable format
+    class PortableBitmapView {
+      public:
+        explicit PortableBitmapView(ByteView data) : data_{data} {
+            ensure(data_.size() >= sizeof(uint32_t), "bitmap: serialized data too short");
+            const uint32_t cookie{endian::load_little_u32(data_.data())};
+            std::size_t position{sizeof(uint32_t)};
+            bool has_offsets{true};
+            if ((cookie & 0xFFFF) == kSerialCookie) {
+                num_containers_ = (cookie >> 16) + 1;
+                run_flags_offset_ = position;
+                position += (num_containers_ + 7) / 8;
+                ensure(position <= data_.size(), "bitmap: serialized data too short");
+                has_offsets = num_containers_ >= kNoOffsetThreshold;
+            } else if (cookie == kSerialCookieNoRunContainer) {
+                ensure(data_.size() >= 2 * sizeof(uint32_t), "bitmap: serialized data too short");
+                num_containers_ = endian::load_little_u32(&data_[position]);
+                position += sizeof(uint32_t);
+            } else {
+                throw std::logic_error{"bitmap: unexpected cookie " + std::to_string(cookie)};
+            }
+            ensure(num_containers_ <= (data_.size() - position) / 4, "bitmap: too many containers");
+            descriptors_offset_ = position;
+            position += 4 * num_containers_;
+            if (has_offsets) {
+                ensure(num_containers_ <= (data_.size() - position) / 4, "bitmap: too many containers");
+                offsets_offset_ = position;
+                position += 4 * num_containers_;
+            }
+            first_container_offset_ = position;
+        }
+
+        //! The first value not less than n (if any)
+        [[nodiscard]] std::optional<uint32_t> seek(uint32_t n) const {
+            const auto high{static_cast<uint16_t>(n >> 16)};
+            const auto low{static_cast<uint16_t>(n & 0xFFFF)};
+
+            // Binary search the first container whose key is not less than the high bits
+            std::size_t first{0}, last{num_containers_};
+            while (first < last) {
+                const std::size_t middle{first + (last - first) / 2};
+                if (key(middle) < high) {
+                    first = middle + 1;
+                } else {
+                    last = middle;
+                }
+            }
+            for (std::size_t i{first}; i < num_containers_; ++i) {
+                const uint16_t container_key{key(i)};
+                if (const auto value{seek_in_container(i, container_key == high ? low : uint16_t{0})}) {
+                    return (uint32_t{container_key} << 16) | *value;
+                }
+            }
+            return std::nullopt;
+        }
+
+        //! The total size in bytes of the serialized bitmap
+        [[nodiscard]] std::size_t size_in_bytes() const {
+            if (num_containers_ == 0) {
+                return first_container_offset_;
+            }
+            const std::size_t last{num_containers_ - 1};
+            const std::size_t offset{container_offset(last)};
+            return offset + container_size(last, offset);
+        }
+
+      private:
+        [[nodiscard]] uint16_t load_u16(std::size_t offset) const {
+            ensure(offset + sizeof(uint16_t) <= data_.size(), "bitmap: serialized data truncated");
+            return endian::load_little_u16(&data_[offset]);
+        }
+
+        [[nodiscard]] uint16_t key(std::size_t i) const { return load_u16(descriptors_offset_ + 4 * i); }
+        [[nodiscard]] uint32_t cardinality(std::size_t i) const { return load_u16(descriptors_offset_ + 4 * i + 2) + 1u; }
+
+        [[nodiscard]] bool is_run(std::size_t i) const {
+            return run_flags_offset_ != 0 && (data_[run_flags_offset_ + i / 8] & (1u << (i % 8))) != 0;
+        }
+
+        [[nodiscard]] std::size_t container_offset(std::size_t i) const {
+            if (offsets_offset_ != 0) {
+                ensure(offsets_offset_ + 4 * (i + 1) <= data_.size(), "bitmap: serialized data truncated");
+                return endian::load_little_u32(&data_[offsets_offset_ + 4 * i]);
+            }
+            // No offset header means less than kNoOffsetThreshold containers: just add up the previous sizes
+            std::size_t offset{first_container_offset_};
+            for (std::size_t j{0}; j < i; ++j) {
+                offset += container_size(j, offset);
+            }
+            return offset;
+        }
+
+        [[nodiscard]] std::size_t container_size(std::size_t i, std::size_t offset) const {
+            if (is_run(i)) {
+                return sizeof(uint16_t) + 2 * sizeof(uint16_t) * load_u16(offset);
+            }
+            if (cardinality(i) <= kMaxArrayContainerCardinality) {
+                return sizeof(uint16_t) * cardinality(i);
+            }
+            return sizeof(uint64_t) * kBitsetContainerWords;
+        }
+
+        [[nodiscard]] std::optional<uint16_t> seek_in_container(std::size_t i, uint16_t n) const {
+            const std::size_t offset{container_offset(i)};
+            ensure(offset + container_size(i, offset) <= data_.size(), "bitmap: serialized data truncated");
+            if (is_run(i)) {
+                // Runs are sorted and disjoint: binary search the first run ending at or after n
+                const std::size_t num_runs{load_u16(offset)};
+                const std::size_t runs_offset{offset + sizeof(uint16_t)};
+                std::size_t first{0}, last{num_runs};
+                while (first < last) {
+                    const std::size_t middle{first + (last - first) / 2};
+                    const uint32_t run_end{uint32_t{load_u16(runs_offset + 4 * middle)} + load_u16(runs_offset + 4 * middle + 2)};
+                    if (run_end < n) {
+                        first = middle + 1;
+                    } else {
+                        last = middle;
+                    }
+                }
+                if (first == num_runs) {
+                    return std::nullopt;
+                }
+                return std::max(load_u16(runs_offset + 4 * first), n);
+            }
+            const uint32_t container_cardinality{cardinality(i)};
+            if (container_cardinality <= kMaxArrayContainerCardinality) {
+                // Sorted array of values: binary search the first value not less than n
+                std::size_t first{0}, last{container_cardinality};
+                while (first < last) {
+                    const std::size_t middle{first + (last - first) / 2};
+                    if (load_u16(offset + 2 * middle) < n) {
+                        first = middle + 1;
+                    } else {
+                        last = middle;
+                    }
+                }
+                if (first == container_cardinality) {
+                    return std::nullopt;
+                }
+                return load_u16(offset + 2 * first);
+            }
+            // Bitset: look for the first bit set starting from n
+            std::size_t word_index{n / 64u};
+            uint64_t word{endian::load_little_u64(&data_[offset + sizeof(uint64_t) * word_index]) & (~uint64_t{0} << (n % 64u))};
+            while (word == 0) {
+                if (++word_index == kBitsetContainerWords) {
+                    return std::nullopt;
+                }
+                word = endian::load_little_u64(&data_[offset + sizeof(uint64_t) * word_index]);
+            }
+            return static_cast<uint16_t>(word_index * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+        }
+
+        ByteView data_;
+        std::size_t num_containers_{0};
+        std::size_t run_flags_offset_{0};
+        std::size_t descriptors_offset_{0};
+        std::size_t offsets_offset_{0};
+        std::size_t first_container_offset_{0};
+    };
+
+}  // namespace
+
+std::optional<uint64_t> seek_serialized(ByteView data, uint64_t n) {
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    // Roaring64Map portable format: number of 32-bit bitmaps followed by each high 32-bit key and its bitmap
+    ensure(data.size() >= sizeof(uint64_t), "bitmap: serialized data too short");
+    const uint64_t num_bitmaps{endian::load_little_u64(data.data())};
+    const auto high{static_cast<uint32_t>(n >> 32)};
+    std::size_t position{sizeof(uint64_t)};
+    for (uint64_t i{0}; i < num_bitmaps; ++i) {
+        ensure(position + sizeof(uint32_t) <= data.size(), "bitmap: serialized data truncated");
+        const uint32_t bitmap_key{endian::load_little_u32(&data[position])};
+        position += sizeof(uint32_t);
+        const PortableBitmapView bitmap{data.substr(position)};
+        if (bitmap_key >= high) {
+            if (const auto value{bitmap.seek(bitmap_key == high ? static_cast<uint32_t>(n) : 0)}) {
+                return (uint64_t{bitmap_key} << 32) | *value;
+            }
+        }
+        position += bitmap.size_in_bytes();
+    }
+    return std::nullopt;
+}
+
+std::optional<uint32_t> seek_serialized32(ByteView data, uint32_t n) {
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    return PortableBitmapView{data}.seek(n);
+}
+
 roaring::Roaring cut_left(roaring::Roaring& bitmap, uint64_t size_limit) {
     return cut_left_impl(bitmap, size_limit);
 }
@@ -113,6 +113,15 @@ class IndexLoader {
 // See Erigon SeekInBitmap64.
 std::optional<uint64_t> seek(const roaring::Roaring64Map& bitmap, uint64_t n);
 
+//! \brief Same as seek but working directly on a 64-bit roaring bitmap serialized in portable format (see to_bytes).
+//! \details No deserialization and no allocation happen: the container directory is binary searched and then the
+//! value is searched within the array, bitset or run container. Empty data is considered an empty bitmap.
+//! \throws std::logic_error if data is not a valid serialized bitmap
+std::optional<uint64_t> seek_serialized(ByteView data, uint64_t n);
+
+//! \brief Same as seek_serialized but for 32-bit roaring bitmap serialized in portable format
+std::optional<uint32_t> seek_serialized32(ByteView data, uint32_t n);
+
 // Remove from a bitmap and return its biggest left part not exceeding a given size
 roaring::Roaring64Map cut_left(roaring::Roaring64Map& bitmap, uint64_t size_limit);
 
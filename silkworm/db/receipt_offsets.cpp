@@ -0,0 +1,57 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_offsets.hpp"
+
+#include <silkworm/core/common/endian.hpp>
+
+namespace silkworm::db {
+
+Bytes encode_receipt_offsets(const std::vector<Receipt>& receipts) {
+    Bytes data(receipts.size() * kReceiptOffsetSize, '\0');
+    uint32_t log_index{0};
+    uint8_t* entry{data.data()};
+    for (const Receipt& receipt : receipts) {
+        endian::store_big_u64(entry, receipt.cumulative_gas_used);
+        endian::store_big_u32(entry + sizeof(uint64_t), log_index);
+        entry[sizeof(uint64_t) + sizeof(uint32_t)] = receipt.success ? 1 : 0;
+        log_index += static_cast<uint32_t>(receipt.logs.size());
+        entry += kReceiptOffsetSize;
+    }
+    return data;
+}
+
+std::optional<std::size_t> receipt_offsets_count(ByteView data) {
+    if (data.size() % kReceiptOffsetSize != 0) {
+        return std::nullopt;
+    }
+    return data.size() / kReceiptOffsetSize;
+}
+
+std::optional<ReceiptOffset> decode_receipt_offset(ByteView data, std::size_t tx_index) {
+    const auto count{receipt_offsets_count(data)};
+    if (!count || tx_index >= *count) {
+        return std::nullopt;
+    }
+    const uint8_t* entry{&data[tx_index * kReceiptOffsetSize]};
+    return ReceiptOffset{
+        .cumulative_gas_used = endian::load_big_u64(entry),
+        .first_log_index = endian::load_big_u32(entry + sizeof(uint64_t)),
+        .success = entry[sizeof(uint64_t) + sizeof(uint32_t)] != 0,
+    };
+}
+
+}  // namespace silkworm::db
@@ -0,0 +1,52 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/types/receipt.hpp>
+
+namespace silkworm::db {
+
+//! \brief The fixed-size entry for one transaction in the receipt offset table (see table::kReceiptOffsets)
+//! \details It contains all the receipt fields that depend on the previous transactions in the same block, so that
+//! one receipt can be rebuilt from its own entry, the previous one and its own logs
+struct ReceiptOffset {
+    uint64_t cumulative_gas_used{0};
+    uint32_t first_log_index{0};
+    bool success{false};
+
+    friend bool operator==(const ReceiptOffset&, const ReceiptOffset&) = default;
+};
+
+inline constexpr std::size_t kReceiptOffsetSize{sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint8_t)};
+
+//! \brief Encode the receipt offset table for all the receipts of one block
+Bytes encode_receipt_offsets(const std::vector<Receipt>& receipts);
+
+//! \brief Number of transactions in the encoded receipt offset table or std::nullopt if malformed
+std::optional<std::size_t> receipt_offsets_count(ByteView data);
+
+//! \brief Decode the entry for the transaction at \p tx_index in the encoded receipt offset table in O(1)
+//! \return the decoded entry or std::nullopt if the table is malformed or \p tx_index is out of range
+std::optional<ReceiptOffset> decode_receipt_offset(ByteView data, std::size_t tx_index);
+
+}  // namespace silkworm::db
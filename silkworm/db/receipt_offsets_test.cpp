@@ -0,0 +1,54 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "receipt_offsets.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::db {
+
+TEST_CASE("Receipt offsets of empty receipts") {
+    const Bytes encoded{encode_receipt_offsets({})};
+    CHECK(encoded.empty());
+    CHECK(receipt_offsets_count(encoded) == 0);
+    CHECK(!decode_receipt_offset(encoded, 0));
+}
+
+TEST_CASE("Receipt offsets of receipts") {
+    auto receipts{test::sample_receipts()};
+    receipts.push_back(Receipt{.success = true, .cumulative_gas_used = 0xbeadd1, .logs = {Log{}}});
+    const Bytes encoded{encode_receipt_offsets(receipts)};
+    CHECK(to_hex(encoded) ==
+          "000000000032f05d0000000000"
+          "0000000000beadd00000000201"
+          "0000000000beadd10000000201");
+    CHECK(receipt_offsets_count(encoded) == 3);
+    CHECK(decode_receipt_offset(encoded, 0) == ReceiptOffset{.cumulative_gas_used = 0x32f05d, .first_log_index = 0, .success = false});
+    CHECK(decode_receipt_offset(encoded, 1) == ReceiptOffset{.cumulative_gas_used = 0xbeadd0, .first_log_index = 2, .success = true});
+    CHECK(decode_receipt_offset(encoded, 2) == ReceiptOffset{.cumulative_gas_used = 0xbeadd1, .first_log_index = 2, .success = true});
+    CHECK(!decode_receipt_offset(encoded, 3));
+}
+
+TEST_CASE("Receipt offsets malformed") {
+    const Bytes encoded(kReceiptOffsetSize + 1, '\0');
+    CHECK(!receipt_offsets_count(encoded));
+    CHECK(!decode_receipt_offset(encoded, 0));
+}
+
+}  // namespace silkworm::db
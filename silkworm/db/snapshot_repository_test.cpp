@@ -16,11 +16,14 @@
 
 #include <chrono>
 #include <filesystem>
+#include <functional>
+#include <thread>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <silkworm/db/bodies/body_index.hpp>
 #include <silkworm/db/headers/header_index.hpp>
+#include <silkworm/db/headers/header_queries.hpp>
 #include <silkworm/db/snapshot_bundle_factory_impl.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/snapshots/repository.hpp>
@@ -30,6 +33,7 @@
 #include <silkworm/db/transactions/txn_to_block_index.hpp>
 #include <silkworm/infra/common/directories.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/common/memory_mapped_file.hpp>
 #include <silkworm/infra/test_util/log.hpp>
 
 namespace silkworm::snapshots {
@@ -116,6 +120,7 @@ TEST_CASE("SnapshotRepository::view", "[silkworm][node][snapshot]") {
             index_builder->build();
         }
 
+        const auto view_before_reopen = repository.view_bundles();
         repository.reopen_folder();
 
         size_t bundles_count = 0;
@@ -124,6 +129,9 @@ TEST_CASE("SnapshotRepository::view", "[silkworm][node][snapshot]") {
         }
         CHECK(bundles_count == 1);
 
+        // The bundles added after taking a view are not visible through it
+        CHECK(view_before_reopen.begin() == view_before_reopen.end());
+
         CHECK(repository.find_segment(SnapshotType::headers, 1'500'000).has_value());
         CHECK(repository.find_segment(SnapshotType::bodies, 1'500'000).has_value());
         CHECK(repository.find_segment(SnapshotType::transactions, 1'500'000).has_value());
@@ -258,6 +266,122 @@ TEST_CASE("SnapshotRepository::find_block_number", "[silkworm][node][snapshot]")
     // CHECK_FALSE(block_number.has_value());  // needs correct key check in index
 }
 
+TEST_CASE("SnapshotRepository::word_cache_stats", "[silkworm][node][snapshot]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+
+    test::SampleHeaderSnapshotFile header_snapshot{tmp_dir.path()};
+    test::SampleBodySnapshotFile body_snapshot{tmp_dir.path()};
+    test::SampleTransactionSnapshotFile txn_snapshot{tmp_dir.path()};
+
+    SECTION("disabled") {
+        SnapshotSettings settings{tmp_dir.path()};
+        settings.word_cache_capacity = 0;
+        SnapshotRepository repository{settings, bundle_factory()};
+        CHECK(repository.word_cache() == nullptr);
+        CHECK(repository.word_cache_stats() == SnapshotWordCacheStats{});
+    }
+
+    SECTION("enabled") {
+        SnapshotSettings settings{tmp_dir.path()};
+        settings.word_cache_capacity = 1024;
+        SnapshotRepository repository{settings, bundle_factory()};
+
+        test::SampleHeaderSnapshotPath header_snapshot_path{header_snapshot.path()};  // necessary to tweak the block numbers
+        REQUIRE_NOTHROW(HeaderIndex::make(header_snapshot_path).build());
+        test::SampleBodySnapshotPath body_snapshot_path{body_snapshot.path()};  // necessary to tweak the block numbers
+        REQUIRE_NOTHROW(BodyIndex::make(body_snapshot_path).build());
+        test::SampleTransactionSnapshotPath txn_snapshot_path{txn_snapshot.path()};  // necessary to tweak the block numbers
+        REQUIRE_NOTHROW(TransactionIndex::make(body_snapshot_path, txn_snapshot_path).build());
+        REQUIRE_NOTHROW(TransactionToBlockIndex::make(body_snapshot_path, txn_snapshot_path).build());
+        repository.reopen_folder();
+        REQUIRE(repository.bundles_count() == 1);
+        CHECK(repository.word_cache_stats().capacity >= 1024);
+
+        const auto& bundle = *repository.view_bundles().begin();
+        HeaderFindByBlockNumQuery header_by_number{bundle.snapshot_and_index(SnapshotType::headers)};
+        // The first lookup decodes the header, the second one is served by the cache
+        const auto header = header_by_number.exec(1'500'013);
+        REQUIRE(header);
+        CHECK(header_by_number.exec(1'500'013) == header);
+        const auto stats = repository.word_cache_stats();
+        CHECK(stats.hit_count == 1);
+        CHECK(stats.miss_count == 1);
+        CHECK(stats.size == 1);
+    }
+}
+
+#ifndef _WIN32
+//! Wait until the predicate holds for all the index files in the repository, or give up after a timeout
+static bool wait_for_index_files(const SnapshotRepository& repository, const std::function<bool(const MemoryMappedFile&)>& predicate) {
+    for (int i{0}; i < 100; ++i) {
+        bool satisfied{true};
+        for (const auto& bundle : repository.view_bundles()) {
+            for (const Index* index : {&bundle.idx_header_hash, &bundle.idx_body_number, &bundle.idx_txn_hash, &bundle.idx_txn_hash_2_block}) {
+                const auto index_file = index->memory_file();
+                satisfied = satisfied && index_file && predicate(*index_file);
+            }
+        }
+        if (satisfied) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return false;
+}
+
+TEST_CASE("SnapshotRepository warmup policy", "[silkworm][node][snapshot][index]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+
+    test::SampleHeaderSnapshotFile header_snapshot{tmp_dir.path()};
+    test::SampleBodySnapshotFile body_snapshot{tmp_dir.path()};
+    test::SampleTransactionSnapshotFile txn_snapshot{tmp_dir.path()};
+    test::SampleHeaderSnapshotPath header_snapshot_path{header_snapshot.path()};  // necessary to tweak the block numbers
+    REQUIRE_NOTHROW(HeaderIndex::make(header_snapshot_path).build());
+    test::SampleBodySnapshotPath body_snapshot_path{body_snapshot.path()};  // necessary to tweak the block numbers
+    REQUIRE_NOTHROW(BodyIndex::make(body_snapshot_path).build());
+    test::SampleTransactionSnapshotPath txn_snapshot_path{txn_snapshot.path()};  // necessary to tweak the block numbers
+    REQUIRE_NOTHROW(TransactionIndex::make(body_snapshot_path, txn_snapshot_path).build());
+    REQUIRE_NOTHROW(TransactionToBlockIndex::make(body_snapshot_path, txn_snapshot_path).build());
+
+    SnapshotSettings settings{tmp_dir.path()};
+    auto is_resident = [](const MemoryMappedFile& file) { return file.resident_size() > 0; };
+    auto is_fully_resident = [](const MemoryMappedFile& file) { return file.resident_size() == file.size(); };
+
+    SECTION("none") {
+        settings.warmup_policy = SnapshotWarmupPolicy::kNone;
+        SnapshotRepository repository{settings, bundle_factory()};
+        repository.reopen_folder();
+        REQUIRE(repository.bundles_count() == 1);
+
+        // Index pages are faulted-in on demand by the lookups
+        const auto& bundle = *repository.view_bundles().begin();
+        HeaderFindByBlockNumQuery header_by_number{bundle.snapshot_and_index(SnapshotType::headers)};
+        REQUIRE(header_by_number.exec(1'500'013));
+        CHECK(bundle.idx_header_hash.memory_file()->resident_size() > 0);
+    }
+
+    SECTION("advise") {
+        settings.warmup_policy = SnapshotWarmupPolicy::kAdvise;
+        SnapshotRepository repository{settings, bundle_factory()};
+        repository.reopen_folder();
+        REQUIRE(repository.bundles_count() == 1);
+
+        // The read-ahead of the index files is asynchronous
+        CHECK(wait_for_index_files(repository, is_resident));
+    }
+
+    SECTION("prefault") {
+        settings.warmup_policy = SnapshotWarmupPolicy::kPrefault;
+        SnapshotRepository repository{settings, bundle_factory()};
+        repository.reopen_folder();
+        REQUIRE(repository.bundles_count() == 1);
+
+        // All the pages of the index files are touched by the background warmup
+        CHECK(wait_for_index_files(repository, is_fully_resident));
+    }
+}
+#endif  // _WIN32
+
 static auto move_last_write_time(const std::filesystem::path& p, const std::filesystem::file_time_type::duration& d) {
     const auto ftime = std::filesystem::last_write_time(p);
     std::filesystem::last_write_time(p, ftime + d);
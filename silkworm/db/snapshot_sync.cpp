@@ -17,11 +17,14 @@
 #include "snapshot_sync.hpp"
 
 #include <atomic>
+#include <deque>
 #include <exception>
+#include <future>
 #include <latch>
 
 #include <magic_enum.hpp>
 
+#include <silkworm/core/rlp/encode.hpp>
 #include <silkworm/core/types/hash.hpp>
 #include <silkworm/db/headers/header_snapshot.hpp>
 #include <silkworm/db/mdbx/etl_mdbx_collector.hpp>
@@ -233,6 +236,56 @@ void SnapshotSync::update_database(db::RWTxn& txn, BlockNum max_block_available)
     update_block_senders(txn, max_block_available);
 }
 
+//! Header data extracted from one snapshot bundle, ready to be written into the database
+struct BundleHeaders {
+    std::vector<BlockNum> block_numbers;
+    std::vector<evmc::bytes32> block_hashes;
+    //! Total difficulty relative to the bundle start, i.e. inclusive prefix sum of the header difficulties
+    std::vector<intx::uint256> bundle_difficulties;
+};
+
+//! Writes records into a table in ascending key order using MDBX_APPEND for keys beyond the last one already present
+class OrderedTableWriter {
+  public:
+    OrderedTableWriter(db::RWTxn& txn, const db::MapConfig& table) : cursor_{txn.rw_cursor(table)} {
+        if (const auto last = cursor_->to_last(/*throw_notfound=*/false)) {
+            last_key_ = Bytes{db::from_slice(last.key)};
+        }
+    }
+
+    void put(ByteView key, ByteView value) {
+        if (last_key_ && key <= ByteView{*last_key_}) {
+            cursor_->upsert(db::to_slice(key), db::to_slice(value));
+            return;
+        }
+        db::Slice value_slice{db::to_slice(value)};
+        mdbx::error::success_or_throw(cursor_->put(db::to_slice(key), &value_slice, MDBX_put_flags_t::MDBX_APPEND));
+    }
+
+  private:
+    std::unique_ptr<db::RWCursor> cursor_;
+    std::optional<Bytes> last_key_;
+};
+
+static BundleHeaders read_bundle_headers(const SnapshotBundle& bundle, BlockNum max_block_available, Stoppable& stoppable) {
+    BundleHeaders headers;
+    const auto header_count = bundle.header_snapshot.item_count();
+    headers.block_numbers.reserve(header_count);
+    headers.block_hashes.reserve(header_count);
+    headers.bundle_difficulties.reserve(header_count);
+
+    intx::uint256 bundle_difficulty{0};
+    for (const BlockHeader& header : HeaderSnapshotReader{bundle.header_snapshot}) {
+        if (header.number > max_block_available) continue;
+        bundle_difficulty += header.difficulty;
+        headers.block_numbers.push_back(header.number);
+        headers.block_hashes.push_back(header.hash());
+        headers.bundle_difficulties.push_back(bundle_difficulty);
+        if (headers.block_numbers.size() % 10'000 == 0 && stoppable.is_stopping()) break;
+    }
+    return headers;
+}
+
 void SnapshotSync::update_block_headers(db::RWTxn& txn, BlockNum max_block_available) {
     // Check if Headers stage progress has already reached the max block in snapshots
     const auto last_progress{db::stages::read_stage_progress(txn, db::stages::kHeadersKey)};
@@ -242,25 +295,51 @@ void SnapshotSync::update_block_headers(db::RWTxn& txn, BlockNum max_block_avail
 
     SILK_INFO << "SnapshotSync: database update started";
 
-    // Iterate on block header snapshots and write header-related tables
+    // Header decoding and hashing are done per bundle by the workers, while this thread writes the results into
+    // the database in block order: the total difficulty is the bundle-local prefix sum computed by the workers
+    // plus the total difficulty of all previous bundles, so the scan is parallel except for the carry propagation.
+    // The number of bundles in flight is bounded to limit the memory footprint independently of the available cores
+    ThreadPool workers{kMaxHeaderBundlesInFlight};
+    std::deque<std::future<BundleHeaders>> bundles_in_flight;
+
+    std::vector<const SnapshotBundle*> bundles;
+    for (const SnapshotBundle& bundle : repository_->view_bundles()) {
+        bundles.push_back(&bundle);
+    }
+    auto next_bundle = bundles.cbegin();
+    auto schedule_bundles = [&]() {
+        for (; next_bundle != bundles.cend() && bundles_in_flight.size() < kMaxHeaderBundlesInFlight; ++next_bundle) {
+            bundles_in_flight.push_back(workers.submit([this, bundle = *next_bundle, max_block_available]() {
+                return read_bundle_headers(*bundle, max_block_available, *this);
+            }));
+        }
+    };
+
     db::etl_mdbx::Collector hash2bn_collector{};
+    OrderedTableWriter difficulty_writer{txn, db::table::kDifficulty};
+    OrderedTableWriter canonical_hashes_writer{txn, db::table::kCanonicalHashes};
     intx::uint256 total_difficulty{0};
     uint64_t block_count{0};
+    Bytes difficulty_value;
 
-    for (const SnapshotBundle& bundle : repository_->view_bundles()) {
-        for (const BlockHeader& header : HeaderSnapshotReader{bundle.header_snapshot}) {
-            SILK_TRACE << "SnapshotSync: header number=" << header.number << " hash=" << Hash{header.hash()}.to_hex();
-            const auto block_number = header.number;
-            if (block_number > max_block_available) continue;
+    schedule_bundles();
+    while (!bundles_in_flight.empty()) {
+        const BundleHeaders headers = bundles_in_flight.front().get();
+        bundles_in_flight.pop_front();
+        schedule_bundles();
+        if (is_stopping()) return;
 
-            const auto block_hash = header.hash();
+        for (std::size_t i{0}; i < headers.block_numbers.size(); ++i) {
+            const auto block_number = headers.block_numbers[i];
+            const auto& block_hash = headers.block_hashes[i];
 
             // Write block header into kDifficulty table
-            total_difficulty += header.difficulty;
-            db::write_total_difficulty(txn, block_number, block_hash, total_difficulty);
+            difficulty_value.clear();
+            rlp::encode(difficulty_value, total_difficulty + headers.bundle_difficulties[i]);
+            difficulty_writer.put(db::block_key(block_number, block_hash.bytes), difficulty_value);
 
             // Write block header into kCanonicalHashes table
-            db::write_canonical_hash(txn, block_number, block_hash);
+            canonical_hashes_writer.put(db::block_key(block_number), ByteView{block_hash.bytes, kHashLength});
 
             // Collect entries for later loading kHeaderNumbers table
             Bytes block_hash_bytes{block_hash.bytes, kHashLength};
@@ -270,13 +349,18 @@ void SnapshotSync::update_block_headers(db::RWTxn& txn, BlockNum max_block_avail
 
             if (++block_count % 1'000'000 == 0) {
                 SILK_INFO << "SnapshotSync: processing block header=" << block_number << " count=" << block_count;
-                if (is_stopping()) return;
             }
         }
+        if (!headers.bundle_difficulties.empty()) {
+            total_difficulty += headers.bundle_difficulties.back();
+        }
     }
 
     db::PooledCursor header_numbers_cursor{txn, db::table::kHeaderNumbers};
-    hash2bn_collector.load(header_numbers_cursor);
+    OrderedTableWriter header_numbers_writer{txn, db::table::kHeaderNumbers};
+    hash2bn_collector.load(header_numbers_cursor, [&](const db::etl::Entry& entry, auto&, auto) {
+        header_numbers_writer.put(entry.key, entry.value);
+    });
     SILK_INFO << "SnapshotSync: database table HeaderNumbers updated";
 
     // Update head block header in kHeadHeader table
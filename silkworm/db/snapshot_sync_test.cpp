@@ -16,12 +16,19 @@
 
 #include "snapshot_sync.hpp"
 
+#include <filesystem>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
+#include <evmc/evmc.hpp>
 
 #include <silkworm/core/chain/config.hpp>
+#include <silkworm/db/access_layer.hpp>
 #include <silkworm/db/bodies/body_index.hpp>
+#include <silkworm/db/freezer.hpp>
 #include <silkworm/db/headers/header_index.hpp>
 #include <silkworm/db/snapshot_bundle_factory_impl.hpp>
+#include <silkworm/db/stages.hpp>
 #include <silkworm/db/test_util/temp_chain_data.hpp>
 #include <silkworm/db/test_util/temp_snapshots.hpp>
 #include <silkworm/db/transactions/txn_index.hpp>
@@ -34,6 +41,7 @@ namespace silkworm::db {
 
 using namespace snapshots;
 using namespace silkworm::test_util;
+using evmc::literals::operator""_address;
 
 static std::unique_ptr<SnapshotBundleFactory> bundle_factory() {
     return std::make_unique<db::SnapshotBundleFactoryImpl>();
@@ -96,6 +104,7 @@ TEST_CASE("SnapshotSync::download_and_index_snapshots", "[db][snapshot][sync]")
 
 struct SnapshotSync_ForTest : public SnapshotSync {
     using SnapshotSync::build_missing_indexes;
+    using SnapshotSync::kMaxHeaderBundlesInFlight;
     using SnapshotSync::SnapshotSync;
     using SnapshotSync::update_block_bodies;
     using SnapshotSync::update_block_hashes;
@@ -172,4 +181,132 @@ TEST_CASE("SnapshotSync::update_block_headers", "[db][snapshot][sync]") {
     CHECK(block_is_canonical(1'500'013, block_1500013_hash));
 }
 
+//! Number of blocks in each bundle produced by the freezer
+static constexpr BlockNum kFreezerChunkSize{1'000};
+
+//! Write the canonical blocks in [0, block_count) with non-zero difficulties and make them immutable
+//! \return the hashes of the written blocks
+static std::vector<evmc::bytes32> populate_blocks(RWTxn& txn, BlockNum block_count) {
+    std::vector<evmc::bytes32> block_hashes;
+    evmc::bytes32 parent_hash{};
+    for (BlockNum block_num{0}; block_num < block_count; ++block_num) {
+        BlockHeader header;
+        header.number = block_num;
+        header.parent_hash = parent_hash;
+        header.difficulty = block_num + 1;
+        header.gas_limit = 5'000'000;
+        const auto hash = header.hash();
+        write_canonical_header_hash(txn, hash.bytes, block_num);
+        write_header(txn, header, /*with_header_numbers=*/true);
+
+        BlockBody body;
+        body.transactions.resize(1);
+        body.transactions[0].nonce = block_num;
+        body.transactions[0].gas_limit = 21'000;
+        body.transactions[0].to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+        body.transactions[0].value = 1;
+        REQUIRE(body.transactions[0].set_v(27));
+        body.transactions[0].r = 1;
+        body.transactions[0].s = 1;
+        write_body(txn, body, hash, block_num);
+
+        block_hashes.push_back(hash);
+        parent_hash = hash;
+    }
+    // The canonical chain tip must be beyond the immutability threshold for the blocks to be frozen
+    const evmc::bytes32 tip_hash{0x01};
+    write_canonical_header_hash(txn, tip_hash.bytes, block_count + kFullImmutabilityThreshold);
+    return block_hashes;
+}
+
+//! Total difficulty of the block with the specified number when each block difficulty is its number plus one
+static intx::uint256 expected_total_difficulty(BlockNum block_num) {
+    return intx::uint256{block_num + 1} * intx::uint256{block_num + 2} / 2;
+}
+
+TEST_CASE("SnapshotSync::update_block_headers multiple bundles", "[db][snapshot][sync]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+    const auto snapshots_dir_path = tmp_dir.path() / "snapshots";
+    const auto freezer_tmp_dir_path = tmp_dir.path() / "tmp";
+    std::filesystem::create_directories(snapshots_dir_path);
+    std::filesystem::create_directories(freezer_tmp_dir_path);
+    SnapshotSettings settings{
+        .repository_dir = snapshots_dir_path,
+        .bittorrent_settings = bittorrent::BitTorrentSettings{
+            .repository_path = tmp_dir.path() / bittorrent::BitTorrentSettings::kDefaultTorrentRepoPath,
+        },
+    };
+    SnapshotRepository repository{settings, bundle_factory()};
+
+    // Freeze more bundles than the ones decoded in parallel from a source database
+    const size_t bundle_count = SnapshotSync_ForTest::kMaxHeaderBundlesInFlight + 1;
+    const BlockNum block_count = bundle_count * kFreezerChunkSize;
+    db::test_util::TempChainData source_db;
+    const auto block_hashes = populate_blocks(source_db.rw_txn(), block_count);
+    source_db.commit_txn();
+    Freezer freezer{RWAccess{source_db.env()}, repository, freezer_tmp_dir_path};
+    for (size_t i{0}; i < bundle_count; ++i) {
+        freezer.run();
+    }
+    REQUIRE(repository.bundles_count() == bundle_count);
+    const BlockNum max_block_available = repository.max_block_available();
+    REQUIRE(max_block_available == block_count - 1);
+
+    db::test_util::TempChainData tmp_db;
+    SnapshotSync_ForTest snapshot_sync{&repository, kMainnetConfig};
+    auto& txn = tmp_db.rw_txn();
+
+    auto check_block = [&](BlockNum block_num) {
+        const auto& block_hash = block_hashes[block_num];
+        CHECK(db::read_canonical_hash(txn, block_num) == block_hash);
+        CHECK(db::read_block_number(txn, block_hash) == block_num);
+        CHECK(db::read_total_difficulty(txn, block_num, block_hash) == expected_total_difficulty(block_num));
+    };
+    auto check_all_blocks = [&]() {
+        // Total difficulty is carried across the bundle boundaries
+        for (BlockNum block_num : {BlockNum{0}, BlockNum{1}, kFreezerChunkSize - 1, kFreezerChunkSize,
+                                   2 * kFreezerChunkSize - 1, 2 * kFreezerChunkSize, block_count - 1}) {
+            check_block(block_num);
+        }
+        CHECK(db::read_head_header_hash(txn) == block_hashes[block_count - 1]);
+        CHECK(db::stages::read_stage_progress(txn, db::stages::kHeadersKey) == max_block_available);
+    };
+
+    SECTION("empty database") {
+        snapshot_sync.update_block_headers(txn, max_block_available);
+        check_all_blocks();
+        for (BlockNum block_num{0}; block_num < block_count; ++block_num) {
+            REQUIRE(db::read_canonical_hash(txn, block_num) == block_hashes[block_num]);
+        }
+    }
+
+    SECTION("max block in the middle of the last bundle") {
+        const BlockNum max_block_num = block_count - kFreezerChunkSize / 2;
+        snapshot_sync.update_block_headers(txn, max_block_num);
+        check_block(max_block_num);
+        CHECK_FALSE(db::read_canonical_hash(txn, max_block_num + 1));
+        CHECK(db::stages::read_stage_progress(txn, db::stages::kHeadersKey) == max_block_num);
+    }
+
+    SECTION("headers already present are overwritten") {
+        // Records beyond the first ones force the writers to update in place up to them, then to append
+        const BlockNum stale_block_num = kFreezerChunkSize + 500;
+        const evmc::bytes32 stale_hash{0x02};
+        db::write_canonical_header_hash(txn, stale_hash.bytes, stale_block_num);
+        db::write_total_difficulty(txn, stale_block_num, block_hashes[stale_block_num], 1);
+        snapshot_sync.update_block_headers(txn, max_block_available);
+        check_all_blocks();
+        check_block(stale_block_num);
+        check_block(stale_block_num + 1);
+    }
+
+    SECTION("headers fully present are updated in place") {
+        snapshot_sync.update_block_headers(txn, max_block_available);
+        db::stages::write_stage_progress(txn, db::stages::kHeadersKey, 0);
+        snapshot_sync.update_block_headers(txn, max_block_available);
+        check_all_blocks();
+    }
+}
+
 }  // namespace silkworm::db
@@ -28,4 +28,20 @@ void Index::close_index() {
     index_.reset();
 }
 
+std::vector<std::optional<std::size_t>> Index::lookup_ordinals_by_hashes(std::span<const Hash> hashes) const {
+    std::vector<ByteView> keys;
+    keys.reserve(hashes.size());
+    for (const auto& hash : hashes) {
+        keys.emplace_back(hash.bytes, kHashLength);
+    }
+    const auto results = index_->lookup_many(keys);
+
+    std::vector<std::optional<std::size_t>> ordinals;
+    ordinals.reserve(results.size());
+    for (const auto& [ordinal, found] : results) {
+        ordinals.push_back(found ? std::optional{ordinal} : std::nullopt);
+    }
+    return ordinals;
+}
+
 }  // namespace silkworm::snapshots
@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
+#include <vector>
 
 #include <silkworm/core/types/hash.hpp>
 
@@ -44,6 +46,9 @@ class Index {
         return found ? std::optional{result} : std::nullopt;
     }
 
+    //! Batched version of lookup_ordinal_by_hash interleaving the index accesses of all the hashes
+    std::vector<std::optional<std::size_t>> lookup_ordinals_by_hashes(std::span<const Hash> hashes) const;
+
     void reopen_index();
     void close_index();
 
@@ -54,6 +59,10 @@ class Index {
         return index_ ? index_->memory_file_region() : MemoryMappedRegion{};
     }
 
+    const MemoryMappedFile* memory_file() const {
+        return index_ ? index_->memory_file() : nullptr;
+    }
+
     uint64_t base_data_id() const {
         assert(index_);
         return index_->base_data_id();
@@ -155,6 +155,17 @@ inline uint64_t remap128(uint64_t x, uint64_t n) {
 #endif  // __SIZEOF_INT128__
 }
 
+/** Hint the CPU to bring the cache line containing the given address into the cache hierarchy.
+ * @param address any address, also invalid ones because prefetch never faults.
+ */
+inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
 /** Count the number of 1-bits in a word.
  * @param word binary word.
  *
@@ -178,8 +189,7 @@ inline uint64_t nu(uint64_t word) { return static_cast<uint64_t>(std::popcount(w
  * [4] Facebook Folly library: https://github.com/facebook/folly
  *
  */
-inline uint64_t select64(uint64_t x, uint64_t k) {
-#ifndef __BMI2__
+inline uint64_t select64_broadword(uint64_t x, uint64_t k) {
     constexpr uint64_t kOnesStep4 = 0x1111111111111111ULL;
     constexpr uint64_t kOnesStep8 = 0x0101010101010101ULL;
     constexpr uint64_t kLAMBDAsStep8 = 0x80ULL * kOnesStep8;
@@ -195,7 +205,12 @@ inline uint64_t select64(uint64_t x, uint64_t k) {
     uint64_t place = nu(geqKStep8) * 8;
     uint64_t byteRank = k - (((byteSums << 8) >> place) & uint64_t{0xFF});
     return place + kSelectInByte[((x >> place) & 0xFF) | (byteRank << 8)];
-#elif defined(__GNUC__) || defined(__clang__)
+}
+
+#if defined(__BMI2__)
+
+inline uint64_t select64(uint64_t x, uint64_t k) {
+#if defined(__GNUC__) || defined(__clang__)
     // GCC and Clang won't inline the intrinsics.
     uint64_t result = uint64_t{1} << k;
 
@@ -210,4 +225,32 @@ inline uint64_t select64(uint64_t x, uint64_t k) {
 #endif
 }
 
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+/** BMI2 variant of select64 compiled independently of the target flags, see select64 for the runtime dispatch. */
+__attribute__((target("bmi,bmi2"))) inline uint64_t select64_bmi2(uint64_t x, uint64_t k) {
+    return _tzcnt_u64(_pdep_u64(uint64_t{1} << k, x));
+}
+
+/** True if PDEP is available *and* fast: on AMD Zen1/Zen2 it is microcoded and much slower than broadword. */
+inline const bool kHasFastPdep = [] {
+    __builtin_cpu_init();
+    const bool has_bmi2 = __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2");
+    return has_bmi2 && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2");
+}();
+
+/** Returns the index of the k-th 1-bit in the 64-bit word x (see select64_broadword).
+ * The binary is not built with -mbmi2 so the PDEP/TZCNT sequence is selected at runtime: the branch on the
+ * constant CPU flag is perfectly predicted and much cheaper than the broadword algorithm.
+ */
+inline uint64_t select64(uint64_t x, uint64_t k) {
+    return likely(kHasFastPdep) ? select64_bmi2(x, k) : select64_broadword(x, k);
+}
+
+#else
+
+inline uint64_t select64(uint64_t x, uint64_t k) { return select64_broadword(x, k); }
+
+#endif  // __BMI2__
+
 }  // namespace silkworm::snapshots::rec_split
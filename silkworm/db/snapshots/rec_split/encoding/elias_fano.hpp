@@ -81,6 +81,11 @@ static constexpr uint64_t kSuperQMask = kSuperQ - 1;
 static constexpr uint64_t kQPerSuperQ = kSuperQ / kQ;
 static constexpr uint64_t kSuperQSize16 = 1 + kQPerSuperQ / 4;
 static constexpr uint64_t kSuperQSize32 = 1 + kQPerSuperQ / 2;
+//! Log2 of the sampling rate of the in-memory select directory (must divide Q)
+static constexpr uint64_t kLog2SelectSample = 6;
+static constexpr uint64_t kSelectSample = 1 << kLog2SelectSample;  // 64
+static constexpr uint64_t kSelectSampleMask = kSelectSample - 1;
+static_assert(kQ % kSelectSample == 0);
 
 template <class T, std::size_t Extent>
 inline static void set(std::span<T, Extent> bits, const uint64_t pos) {
@@ -122,6 +127,7 @@ class EliasFanoList32 {
         SILKWORM_ASSERT(total_words * sizeof(uint64_t) <= data.size());
         data = data.subspan(0, total_words * sizeof(uint64_t));
         std::copy(data.begin(), data.end(), reinterpret_cast<uint8_t*>(data_.data()));
+        build_select_samples();
     }
 
     [[nodiscard]] std::size_t sequence_length() const { return count_ + 1; }
@@ -152,12 +158,13 @@ class EliasFanoList32 {
         const uint64_t mask = uint64_t(0xffffffff) << shift;
         SILKWORM_ASSERT(jump_super_q < jump_.size());
         SILKWORM_ASSERT(idx64 < jump_.size());
-        const uint64_t jump = jump_[jump_super_q] + ((jump_[idx64] & mask) >> shift);
+        SILKWORM_ASSERT((i >> kLog2SelectSample) < select_samples_.size());
+        const uint64_t jump = jump_[jump_super_q] + ((jump_[idx64] & mask) >> shift) + select_samples_[i >> kLog2SelectSample];
 
         uint64_t current_word = jump / 64;
         SILKWORM_ASSERT(current_word < upper_bits_.size());
         uint64_t window = upper_bits_[current_word] & (0xffffffffffffffff << (jump % 64));
-        uint64_t d = i & kQMask;
+        uint64_t d = i & kSelectSampleMask;
 
         for (auto bit_count{std::popcount(window)}; uint64_t(bit_count) <= d; bit_count = std::popcount(window)) {
             current_word++;
@@ -205,6 +212,7 @@ class EliasFanoList32 {
                 }
             }
         }
+        build_select_samples();
     }
 
     friend std::ostream& operator<<(std::ostream& os, const EliasFanoList32& ef) {
@@ -239,6 +247,27 @@ class EliasFanoList32 {
         return total_words;
     }
 
+    //! Build the in-memory select directory: for every kSelectSample-th one in the upper bits, store its distance
+    //! from the first one of the enclosing quantum, so that get() scans at most a few words instead of up to Q ones.
+    //! This is not part of the serialized format, hence the index files are unchanged.
+    void build_select_samples() {
+        select_samples_.assign((count_ + kSelectSample) >> kLog2SelectSample, 0);
+        uint64_t quantum_start{0};
+        for (uint64_t w{0}, c{0}; w < upper_bits_.size() && c <= count_; ++w) {
+            const uint64_t word = upper_bits_[w];
+            const auto ones = static_cast<uint64_t>(std::popcount(word));
+            for (uint64_t next = (c + kSelectSampleMask) & ~kSelectSampleMask; next < c + ones && next <= count_; next += kSelectSample) {
+                const uint64_t position = w * 64 + select64(word, next - c);
+                if ((next & kQMask) == 0) {
+                    quantum_start = position;
+                }
+                SILKWORM_ASSERT(position - quantum_start < (uint64_t{1} << 32));
+                select_samples_[next >> kLog2SelectSample] = static_cast<uint32_t>(position - quantum_start);
+            }
+            c += ones;
+        }
+    }
+
     [[nodiscard]] inline uint64_t jump_size_words() const {
         uint64_t size = ((count_ + 1) / kSuperQ) * kSuperQSize32;  // Whole blocks
         if ((count_ + 1) % kSuperQ != 0) {
@@ -257,6 +286,8 @@ class EliasFanoList32 {
     uint64_t max_offset_{0};
     uint64_t i_{0};
     Uint64Sequence data_;
+    //! In-memory select directory (see build_select_samples)
+    std::vector<uint32_t> select_samples_;
 };
 
 //! 16-bit Double Elias-Fano list that used to encode *two* monotone non-decreasing sequences in RecSplit
@@ -351,6 +382,15 @@ class DoubleEliasFanoList16 {
         }
     }
 
+    //! Prefetch the lower bits and jump table entries read by get2/get3 for the i-th bucket
+    void prefetch(const uint64_t i) const {
+        const uint64_t pos_lower = i * (l_cum_keys + l_position);
+        rec_split::prefetch(lower_bits.data() + pos_lower / 64);
+        const uint64_t jump_super_q = (i / kSuperQ) * kSuperQSize16 * 2;
+        rec_split::prefetch(jump.data() + jump_super_q);
+        rec_split::prefetch(jump.data() + jump_super_q + 2 + (i % kSuperQ) / kQ / 2);
+    }
+
     void get2(const uint64_t i, uint64_t& cum_keys, uint64_t& position) const {
         uint64_t window_cum_keys{0}, select_cum_keys{0}, curr_word_cum_keys{0}, lower{0}, cum_delta{0};
         get(i, cum_keys, position, window_cum_keys, select_cum_keys, curr_word_cum_keys, lower, cum_delta);
@@ -239,6 +239,12 @@ class GolombRiceVector {
 
     [[nodiscard]] Reader reader() const { return Reader{data}; }
 
+    //! Prefetch the first fixed and unary words read by Reader::read_reset with the same arguments
+    void prefetch(const std::size_t bit_pos, const std::size_t unary_offset) const {
+        rec_split::prefetch(data.data() + bit_pos / 64);
+        rec_split::prefetch(data.data() + (bit_pos + unary_offset) / 64);
+    }
+
   private:
     Uint64Sequence data;
 
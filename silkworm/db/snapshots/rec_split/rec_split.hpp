@@ -57,6 +57,7 @@
 #include <numbers>
 #include <optional>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -155,6 +156,9 @@ class SplittingStrategy {
     }
 };
 
+//! Number of keys whose lookup stages are interleaved in RecSplit::lookup_many
+static constexpr std::size_t kLookupBatchSize{16};
+
 //! Size in bytes of 1st fixed metadata header fields in RecSplit-encoded file
 static constexpr std::size_t kBaseDataIdLength{sizeof(uint64_t)};
 static constexpr std::size_t kKeyCountLength{sizeof(uint64_t)};
@@ -605,50 +609,7 @@ class RecSplit {
         uint64_t cum_keys{0}, cum_keys_next{0}, bit_pos{0};
         double_ef_index_.get3(bucket, cum_keys, cum_keys_next, bit_pos);
 
-        // Number of keys in this bucket
-        std::size_t m = cum_keys_next - cum_keys;
-        auto reader = golomb_rice_codes_.reader();
-        reader.read_reset(bit_pos, skip_bits(m));
-        int level = 0;
-
-        while (m > kUpperAggregationBound) {  // fanout = 2
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const std::size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const std::size_t split = ((static_cast<uint16_t>((m + 1) / 2 + kUpperAggregationBound - 1) / kUpperAggregationBound)) * kUpperAggregationBound;
-            if (hmod < split) {
-                m = split;
-            } else {
-                reader.skip_subtree(skip_nodes(split), skip_bits(split));
-                m -= split;
-                cum_keys += split;
-            }
-            level++;
-        }
-        if (m > kLowerAggregationBound) {
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const int part = uint16_t(hmod) / kLowerAggregationBound;
-            m = std::min(kLowerAggregationBound, m - part * kLowerAggregationBound);
-            cum_keys += kLowerAggregationBound * part;
-            if (part) reader.skip_subtree(skip_nodes(kLowerAggregationBound) * part, skip_bits(kLowerAggregationBound) * part);
-            level++;
-        }
-
-        if (m > LEAF_SIZE) {
-            const auto d = reader.read_next(golomb_param(m, memo));
-            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
-
-            const int part = uint16_t(hmod) / LEAF_SIZE;
-            m = std::min(LEAF_SIZE, m - part * LEAF_SIZE);
-            cum_keys += LEAF_SIZE * part;
-            if (part) reader.skip_subtree(part, skip_bits(LEAF_SIZE) * part);
-            level++;
-        }
-
-        const auto b = reader.read_next(golomb_param(m, memo));
-        return cum_keys + remap16(remix(hash.second + b + kStartSeed[level]), m);
+        return record_in_bucket(hash, cum_keys, cum_keys_next, bit_pos);
     }
 
     //! Return the value associated with the given key within the MPHF mapping
@@ -667,16 +628,55 @@ class RecSplit {
     LookupResult lookup(ByteView key) const {
         const hash128_t& hashed_key{murmur_hash_3(key)};
         const auto record = operator()(hashed_key);
-        const auto position = 1 + 8 + bytes_per_record_ * (record + 1);
+        return lookup_result(hashed_key, record_position(record));
+    }
 
-        const auto region = encoded_file_->region();
-        ensure(position + sizeof(uint64_t) < region.size(),
-               [&]() { return "position: " + std::to_string(position) + " plus 8 exceeds file length"; });
-        const auto value = endian::load_big_u64(region.data() + position) & record_mask_;
-        if (less_false_positives_ && value < existence_filter_.size()) {
-            return {value, existence_filter_.at(value) == static_cast<uint8_t>(hashed_key.first)};
+    //! Batched version of lookup: results[i] is the same as lookup(keys[i])
+    //! \details The keys are processed in groups of kLookupBatchSize and each group goes through the lookup stages
+    //! (bucket directory, Golomb-Rice tree walk, record read) together: the memory accesses of one stage are prefetched
+    //! for all the keys in the group before any of them is waited on, so that cache misses overlap instead of adding up
+    void lookup_many(std::span<const ByteView> keys, std::span<LookupResult> results) const {
+        ensure(keys.size() == results.size(), "RecSplit::lookup_many: keys and results size mismatch");
+        ensure(built_, "RecSplit: perfect hash function not built yet");
+        ensure(key_count_ > 0, "RecSplit: invalid lookup with zero keys, use empty() to guard");
+
+        std::array<hash128_t, kLookupBatchSize> hashes{};
+        std::array<uint64_t, kLookupBatchSize> buckets{};
+        std::array<std::array<uint64_t, 3>, kLookupBatchSize> bucket_bounds{};  // cum_keys, cum_keys_next, bit_pos
+        std::array<std::size_t, kLookupBatchSize> positions{};
+        for (std::size_t first{0}; first < keys.size(); first += kLookupBatchSize) {
+            const std::size_t batch_size = std::min(kLookupBatchSize, keys.size() - first);
+            for (std::size_t j{0}; j < batch_size; ++j) {
+                hashes[j] = murmur_hash_3(keys[first + j]);
+                if (key_count_ > 1) {
+                    buckets[j] = hash128_to_bucket(hashes[j]);
+                    double_ef_index_.prefetch(buckets[j]);
+                }
+            }
+            if (key_count_ > 1) {
+                for (std::size_t j{0}; j < batch_size; ++j) {
+                    auto& [cum_keys, cum_keys_next, bit_pos] = bucket_bounds[j];
+                    double_ef_index_.get3(buckets[j], cum_keys, cum_keys_next, bit_pos);
+                    golomb_rice_codes_.prefetch(bit_pos, skip_bits(cum_keys_next - cum_keys));
+                }
+            }
+            for (std::size_t j{0}; j < batch_size; ++j) {
+                const auto& [cum_keys, cum_keys_next, bit_pos] = bucket_bounds[j];
+                const std::size_t record = key_count_ > 1 ? record_in_bucket(hashes[j], cum_keys, cum_keys_next, bit_pos) : 0;
+                positions[j] = record_position(record);
+                prefetch(encoded_file_->region().data() + positions[j]);
+            }
+            for (std::size_t j{0}; j < batch_size; ++j) {
+                results[first + j] = lookup_result(hashes[j], positions[j]);
+            }
         }
-        return {value, true};
+    }
+
+    //! Batched version of lookup returning the results in a new vector
+    [[nodiscard]] std::vector<LookupResult> lookup_many(std::span<const ByteView> keys) const {
+        std::vector<LookupResult> results(keys.size());
+        lookup_many(keys, results);
+        return results;
     }
 
     //! Return the offset of the i-th element in the index. Perfect hash table lookup is not performed,
@@ -722,6 +722,8 @@ class RecSplit {
 
     [[nodiscard]] MemoryMappedRegion memory_file_region() const { return encoded_file_ ? encoded_file_->region() : MemoryMappedRegion{}; }
 
+    [[nodiscard]] const MemoryMappedFile* memory_file() const { return encoded_file_ ? &*encoded_file_ : nullptr; }
+
   private:
     static inline std::size_t skip_bits(std::size_t m) { return memo[m] & 0xFFFF; }
 
@@ -916,6 +918,75 @@ class RecSplit {
         return h;
     }
 
+    //! Walk the Golomb-Rice coded splitting tree of one bucket to find the record of the given hash
+    //! \param hash the 128-bit bucket hash
+    //! \param cum_keys the cumulative number of keys before the bucket
+    //! \param cum_keys_next the cumulative number of keys up to the bucket (included)
+    //! \param bit_pos the position of the bucket splitting tree in the Golomb-Rice codes
+    std::size_t record_in_bucket(const hash128_t& hash, uint64_t cum_keys, uint64_t cum_keys_next, uint64_t bit_pos) const {
+        // Number of keys in this bucket
+        std::size_t m = cum_keys_next - cum_keys;
+        auto reader = golomb_rice_codes_.reader();
+        reader.read_reset(bit_pos, skip_bits(m));
+        int level = 0;
+
+        while (m > kUpperAggregationBound) {  // fanout = 2
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const std::size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const std::size_t split = ((static_cast<uint16_t>((m + 1) / 2 + kUpperAggregationBound - 1) / kUpperAggregationBound)) * kUpperAggregationBound;
+            if (hmod < split) {
+                m = split;
+            } else {
+                reader.skip_subtree(skip_nodes(split), skip_bits(split));
+                m -= split;
+                cum_keys += split;
+            }
+            level++;
+        }
+        if (m > kLowerAggregationBound) {
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const int part = uint16_t(hmod) / kLowerAggregationBound;
+            m = std::min(kLowerAggregationBound, m - part * kLowerAggregationBound);
+            cum_keys += kLowerAggregationBound * part;
+            if (part) reader.skip_subtree(skip_nodes(kLowerAggregationBound) * part, skip_bits(kLowerAggregationBound) * part);
+            level++;
+        }
+
+        if (m > LEAF_SIZE) {
+            const auto d = reader.read_next(golomb_param(m, memo));
+            const size_t hmod = remap16(remix(hash.second + d + kStartSeed[level]), m);
+
+            const int part = uint16_t(hmod) / LEAF_SIZE;
+            m = std::min(LEAF_SIZE, m - part * LEAF_SIZE);
+            cum_keys += LEAF_SIZE * part;
+            if (part) reader.skip_subtree(part, skip_bits(LEAF_SIZE) * part);
+            level++;
+        }
+
+        const auto b = reader.read_next(golomb_param(m, memo));
+        return cum_keys + remap16(remix(hash.second + b + kStartSeed[level]), m);
+    }
+
+    //! Return the position of the given record in the index file
+    [[nodiscard]] std::size_t record_position(std::size_t record) const {
+        return 1 + 8 + bytes_per_record_ * (record + 1);
+    }
+
+    //! Read the value stored at the given record position and check the key hash against the existence filter
+    LookupResult lookup_result(const hash128_t& hashed_key, std::size_t position) const {
+        const auto region = encoded_file_->region();
+        ensure(position + sizeof(uint64_t) < region.size(),
+               [&]() { return "position: " + std::to_string(position) + " plus 8 exceeds file length"; });
+        const auto value = endian::load_big_u64(region.data() + position) & record_mask_;
+        if (less_false_positives_ && value < existence_filter_.size()) {
+            return {value, existence_filter_.at(value) == static_cast<uint8_t>(hashed_key.first)};
+        }
+        return {value, true};
+    }
+
     //! Maps a 128-bit to a bucket using the first 64-bit half
     [[nodiscard]] inline uint64_t hash128_to_bucket(const hash128_t& hash) const { return remap128(hash.first, bucket_count_); }
 
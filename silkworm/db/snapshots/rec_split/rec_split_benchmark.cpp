@@ -0,0 +1,107 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/db/snapshots/rec_split/rec_split_seq.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/infra/test_util/temporary_file.hpp>
+
+namespace silkworm::snapshots::rec_split {
+
+using silkworm::test_util::SetLogVerbosityGuard;
+using silkworm::test_util::TemporaryFile;
+
+//! Number of keys looked up in each benchmark iteration
+constexpr std::size_t kLookupCount{1'024};
+
+static std::vector<std::string> build_index(const std::filesystem::path& index_path, std::size_t key_count) {
+    RecSplitSettings settings{
+        .keys_count = key_count,
+        .bucket_size = 2'000,
+        .index_path = index_path,
+        .base_data_id = 0,
+        .less_false_positives = true};
+    RecSplit8 rec_split{settings, seq_build_strategy(), /*.salt=*/1};
+    std::vector<std::string> keys;
+    keys.reserve(key_count);
+    for (std::size_t i{0}; i < key_count; ++i) {
+        keys.push_back("key " + std::to_string(i));
+        rec_split.add_key(keys.back(), i * 17);
+    }
+    [[maybe_unused]] const bool collision_detected = rec_split.build();
+    return keys;
+}
+
+//! Keys spread across the whole index, so that consecutive lookups hit unrelated buckets
+static std::vector<ByteView> lookup_keys(const std::vector<std::string>& keys) {
+    std::vector<ByteView> lookup_keys;
+    lookup_keys.reserve(kLookupCount);
+    for (std::size_t i{0}; i < kLookupCount; ++i) {
+        lookup_keys.push_back(string_view_to_byte_view(keys[(i * 7'919) % keys.size()]));
+    }
+    return lookup_keys;
+}
+
+static void rec_split_lookup(benchmark::State& state) {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryFile index_file;
+    const auto keys = build_index(index_file.path(), static_cast<std::size_t>(state.range(0)));
+    RecSplit8 index{index_file.path()};
+    const auto batch = lookup_keys(keys);
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto key : batch) {
+            benchmark::DoNotOptimize(index.lookup(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLookupCount));
+}
+BENCHMARK(rec_split_lookup)->Arg(100'000)->Arg(1'000'000);
+
+static void rec_split_lookup_many(benchmark::State& state) {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryFile index_file;
+    const auto keys = build_index(index_file.path(), static_cast<std::size_t>(state.range(0)));
+    RecSplit8 index{index_file.path()};
+    const auto batch = lookup_keys(keys);
+    std::vector<RecSplit8::LookupResult> results(batch.size());
+    for ([[maybe_unused]] auto _ : state) {
+        index.lookup_many(batch, results);
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLookupCount));
+}
+BENCHMARK(rec_split_lookup_many)->Arg(100'000)->Arg(1'000'000);
+
+static void rec_split_lookup_by_ordinal(benchmark::State& state) {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryFile index_file;
+    const auto key_count = static_cast<std::size_t>(state.range(0));
+    build_index(index_file.path(), key_count);
+    RecSplit8 index{index_file.path()};
+    for ([[maybe_unused]] auto _ : state) {
+        for (std::size_t i{0}; i < kLookupCount; ++i) {
+            benchmark::DoNotOptimize(index.lookup_by_ordinal((i * 7'919) % key_count));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLookupCount));
+}
+BENCHMARK(rec_split_lookup_by_ordinal)->Arg(100'000)->Arg(1'000'000);
+
+}  // namespace silkworm::snapshots::rec_split
@@ -261,6 +261,50 @@ TEST_CASE("RecSplit8: double index lookup", "[silkworm][snapshots][recsplit][ign
     }
 }
 
+TEST_CASE("RecSplit8: lookup_many", "[silkworm][snapshots][recsplit]") {
+    SetLogVerbosityGuard guard{log::Level::kNone};
+    for (const std::size_t key_count : {2, 15, 16, 17, 1'000}) {
+        SECTION("key_count=" + std::to_string(key_count)) {
+            TemporaryFile index_file;
+            RecSplitSettings settings{
+                .keys_count = key_count,
+                .bucket_size = 100,
+                .index_path = index_file.path(),
+                .base_data_id = 0,
+                .less_false_positives = true};
+            RecSplit8 rs1{settings, seq_build_strategy(), /*.salt=*/kTestSalt};
+            std::vector<std::string> keys;
+            for (size_t i{0}; i < key_count; ++i) {
+                keys.push_back("key " + std::to_string(i));
+                rs1.add_key(keys.back(), i * 17);
+            }
+            // Add some keys not present in the index to exercise the existence filter
+            for (size_t i{0}; i < key_count; ++i) {
+                keys.push_back("absent key " + std::to_string(i));
+            }
+            CHECK(rs1.build() == false /*collision_detected*/);
+
+            RecSplit8 rs2{settings.index_path};
+            std::vector<ByteView> key_views;
+            for (const auto& key : keys) {
+                key_views.push_back(string_view_to_byte_view(key));
+            }
+            const auto results = rs2.lookup_many(key_views);
+            REQUIRE(results.size() == keys.size());
+            for (size_t i{0}; i < keys.size(); ++i) {
+                CHECK(results[i] == rs2.lookup(keys[i]));
+            }
+            for (size_t i{0}; i < key_count; ++i) {
+                CHECK(results[i].second);
+                CHECK(rs2.lookup_by_ordinal(results[i].first) == i * 17);
+            }
+
+            std::vector<RecSplit8::LookupResult> short_results(keys.size() - 1);
+            CHECK_THROWS_AS(rs2.lookup_many(key_views, short_results), std::logic_error);
+        }
+    }
+}
+
 TEST_CASE("RecSplit8: unsupported feature", "[silkworm][snapshots][recsplit][ignore]") {
     SetLogVerbosityGuard guard{log::Level::kInfo};
 
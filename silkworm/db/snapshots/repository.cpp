@@ -31,45 +31,71 @@ SnapshotRepository::SnapshotRepository(
     SnapshotSettings settings,
     std::unique_ptr<SnapshotBundleFactory> bundle_factory)
     : settings_(std::move(settings)),
-      bundle_factory_(std::move(bundle_factory)) {}
+      bundle_factory_(std::move(bundle_factory)),
+      bundles_(std::make_shared<SnapshotBundlesView::Bundles>()) {
+    if (settings_.word_cache_capacity > 0) {
+        word_cache_ = std::make_shared<SnapshotWordCache>(settings_.word_cache_capacity);
+    }
+}
 
 SnapshotRepository::~SnapshotRepository() {
     close();
 }
 
 void SnapshotRepository::add_snapshot_bundle(SnapshotBundle bundle) {
+    bundle.set_word_cache(word_cache_);
     bundle.reopen();
+    const auto block_from = bundle.block_from();
+    auto new_bundle = std::make_shared<SnapshotBundle>(std::move(bundle));
+
+    // Readers keep iterating over the current bundle set, so a new one is published instead of changing it in place
     std::scoped_lock lock(bundles_mutex_);
-    bundles_.emplace(bundle.block_from(), std::move(bundle));
+    auto bundles = std::make_shared<SnapshotBundlesView::Bundles>(*bundles_);
+    bundles->emplace(block_from, std::move(new_bundle));
+    bundles_ = std::move(bundles);
 }
 
 std::size_t SnapshotRepository::bundles_count() const {
     std::scoped_lock lock(bundles_mutex_);
-    return bundles_.size();
+    return bundles_->size();
+}
+
+SnapshotBundlesView SnapshotRepository::view_bundles() const {
+    std::scoped_lock lock(bundles_mutex_);
+    return SnapshotBundlesView{bundles_};
 }
 
 void SnapshotRepository::close() {
     SILK_TRACE << "Close snapshot repository folder: " << settings_.repository_dir.string();
 
-    std::map<BlockNum, SnapshotBundle> bundles;
+    stop_warmup();
+
+    std::shared_ptr<const SnapshotBundlesView::Bundles> bundles;
     {
         std::scoped_lock lock(bundles_mutex_);
-        bundles = std::exchange(bundles_, {});
+        bundles = std::exchange(bundles_, std::make_shared<SnapshotBundlesView::Bundles>());
     }
 
-    for (auto& entry : bundles) {
+    for (auto& entry : *bundles) {
         auto& bundle = entry.second;
-        bundle.close();
+        bundle->close();
+    }
+
+    if (word_cache_) {
+        const auto stats = word_cache_->stats();
+        SILK_DEBUG << "Snapshot word cache hits: " << stats.hit_count << " misses: " << stats.miss_count
+                   << " evictions: " << stats.eviction_count;
+        word_cache_->clear();
     }
 }
 
 BlockNum SnapshotRepository::max_block_available() const {
     std::scoped_lock lock(bundles_mutex_);
-    if (bundles_.empty())
+    if (bundles_->empty())
         return 0;
 
     // a bundle with the max block range is last in the sorted bundles map
-    auto& bundle = bundles_.rbegin()->second;
+    auto& bundle = *bundles_->rbegin()->second;
     return (bundle.block_from() < bundle.block_to()) ? bundle.block_to() - 1 : bundle.block_from();
 }
 
@@ -138,11 +164,13 @@ void SnapshotRepository::reopen_folder() {
     }
 
     std::unique_lock lock(bundles_mutex_);
+    auto bundles = std::make_shared<SnapshotBundlesView::Bundles>(*bundles_);
 
+    std::vector<const MemoryMappedFile*> reopened_index_files;
     while (groups.contains(num) &&
            (groups[num][false].size() == SnapshotBundle::kSnapshotsCount) &&
            (groups[num][true].size() == SnapshotBundle::kIndexesCount)) {
-        if (!bundles_.contains(num)) {
+        if (!bundles->contains(num)) {
             auto snapshot_path = [&](SnapshotType type) {
                 return all_snapshot_paths[groups[num][false][type]];
             };
@@ -150,12 +178,19 @@ void SnapshotRepository::reopen_folder() {
                 return all_index_paths[groups[num][true][type]];
             };
             SnapshotBundle bundle = bundle_factory_->make(snapshot_path, index_path);
+            bundle.set_word_cache(word_cache_);
             bundle.reopen();
 
-            bundles_.emplace(num, std::move(bundle));
+            for (auto& index_ref : bundle.indexes()) {
+                if (const auto index_file = index_ref.get().memory_file()) {
+                    reopened_index_files.push_back(index_file);
+                }
+            }
+
+            bundles->emplace(num, std::make_shared<SnapshotBundle>(std::move(bundle)));
         }
 
-        auto& bundle = bundles_.at(num);
+        auto& bundle = *bundles->at(num);
 
         if (num < bundle.block_to()) {
             num = bundle.block_to();
@@ -164,16 +199,57 @@ void SnapshotRepository::reopen_folder() {
         }
     }
 
+    bundles_ = std::move(bundles);
     lock.unlock();
 
     SILK_INFO << "Total reopened bundles: " << bundles_count()
               << " snapshots: " << total_snapshots_count()
               << " indexes: " << total_indexes_count();
+
+    warmup_indexes(std::move(reopened_index_files));
 }
 
-const SnapshotBundle* SnapshotRepository::find_bundle(BlockNum number) const {
-    std::scoped_lock lock(bundles_mutex_);
+void SnapshotRepository::warmup_indexes(std::vector<const MemoryMappedFile*> index_files) {
+    if (index_files.empty()) return;
+
+    // Index files are memory-mapped, so their addresses are stable even if bundles are moved
+    for (const auto index_file : index_files) {
+        if (settings_.index_huge_pages) {
+            index_file->advise_hugepage();
+        }
+        if (settings_.warmup_policy == SnapshotWarmupPolicy::kAdvise) {
+            index_file->advise_willneed();
+        }
+    }
+    if (settings_.warmup_policy != SnapshotWarmupPolicy::kPrefault) return;
+
+    // Prefault the index pages in background: any previous warmup must be completed or stopped first
+    stop_warmup();
+    warmup_thread_ = std::thread{[this, index_files = std::move(index_files)]() {
+        log::set_thread_name("snap-warmup");
+        SILK_DEBUG << "SnapshotRepository: prefault started for " << index_files.size() << " index files";
+        // Touch the pages in chunks to check for stop requests in between
+        static constexpr std::size_t kPrefaultChunkSize{16 * 1024 * 1024};
+        for (const auto index_file : index_files) {
+            const auto region = index_file->region();
+            for (std::size_t offset{0}; offset < region.size(); offset += kPrefaultChunkSize) {
+                if (warmup_stop_requested_) return;
+                index_file->prefault(region.subspan(offset, std::min(kPrefaultChunkSize, region.size() - offset)));
+            }
+        }
+        SILK_DEBUG << "SnapshotRepository: prefault completed for " << index_files.size() << " index files";
+    }};
+}
+
+void SnapshotRepository::stop_warmup() {
+    if (warmup_thread_.joinable()) {
+        warmup_stop_requested_ = true;
+        warmup_thread_.join();
+    }
+    warmup_stop_requested_ = false;
+}
 
+const SnapshotBundle* SnapshotRepository::find_bundle(BlockNum number) const {
     // Search for target segment in reverse order (from the newest segment to the oldest one)
     for (const auto& bundle : this->view_bundles_reverse()) {
         // We're looking for the segment containing the target block number in its block range
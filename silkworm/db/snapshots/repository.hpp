@@ -16,32 +16,88 @@
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <ranges>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <silkworm/core/common/base.hpp>
-#include <silkworm/db/snapshots/common/iterator/map_values_view.hpp>
 #include <silkworm/db/snapshots/index_builder.hpp>
 #include <silkworm/db/snapshots/path.hpp>
 #include <silkworm/db/snapshots/settings.hpp>
 #include <silkworm/db/snapshots/snapshot_and_index.hpp>
 #include <silkworm/db/snapshots/snapshot_bundle.hpp>
 #include <silkworm/db/snapshots/snapshot_bundle_factory.hpp>
+#include <silkworm/db/snapshots/snapshot_word_cache.hpp>
+#include <silkworm/infra/common/memory_mapped_file.hpp>
 
 namespace silkworm::snapshots {
 
 struct IndexBuilder;
 
+//! A view over the snapshot bundles which shares the ownership of the bundle set it has been taken from, so that
+//! it stays valid while new bundles are added to the repository
+class SnapshotBundlesView : public std::ranges::view_interface<SnapshotBundlesView> {
+  public:
+    using Bundles = std::map<BlockNum, std::shared_ptr<SnapshotBundle>>;
+
+    class Iterator {
+      public:
+        using value_type = SnapshotBundle;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        Iterator(Bundles::const_iterator it) : it_(it) {}
+        Iterator() = default;
+
+        reference operator*() const { return *it_->second; }
+
+        Iterator operator++(int) { return std::exchange(*this, ++Iterator{*this}); }
+        Iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        Iterator operator--(int) { return std::exchange(*this, --Iterator{*this}); }
+        Iterator& operator--() {
+            --it_;
+            return *this;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) = default;
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) = default;
+
+      private:
+        Bundles::const_iterator it_;
+    };
+
+    static_assert(std::bidirectional_iterator<Iterator>);
+
+    explicit SnapshotBundlesView(std::shared_ptr<const Bundles> bundles) : bundles_(std::move(bundles)) {}
+    SnapshotBundlesView() = default;
+
+    Iterator begin() const { return bundles_ ? Iterator{bundles_->cbegin()} : Iterator{}; }
+    Iterator end() const { return bundles_ ? Iterator{bundles_->cend()} : Iterator{}; }
+
+  private:
+    std::shared_ptr<const Bundles> bundles_;
+};
+
 //! Read-only repository for all snapshot files.
 //! @details Some simplifications are currently in place:
-//! - it opens snapshots only on startup and they are immutable
+//! - snapshots are immutable, new bundles can be added at any time (e.g. by the freezer) without affecting the
+//! bundles already visible to readers
 //! - all snapshots of given blocks range must exist (to make such range available)
 //! - gaps in blocks range are not allowed
 //! - segments have [from:to) semantic
@@ -56,6 +112,14 @@ class SnapshotRepository {
     [[nodiscard]] std::filesystem::path path() const { return settings_.repository_dir; }
     [[nodiscard]] const SnapshotBundleFactory& bundle_factory() const { return *bundle_factory_; }
 
+    //! The cache of decoded words shared by all snapshots in this repository (null if disabled)
+    [[nodiscard]] const SnapshotWordCache* word_cache() const { return word_cache_.get(); }
+
+    //! The counters of the decoded word cache (all zero if disabled)
+    [[nodiscard]] SnapshotWordCacheStats word_cache_stats() const {
+        return word_cache_ ? word_cache_->stats() : SnapshotWordCacheStats{};
+    }
+
     void reopen_folder();
     void close();
 
@@ -73,7 +137,8 @@ class SnapshotRepository {
     [[nodiscard]] std::vector<std::shared_ptr<IndexBuilder>> missing_indexes() const;
     void remove_stale_indexes() const;
 
-    auto view_bundles() const { return make_map_values_view(bundles_); }
+    //! The bundles available when called: bundles added later are not visible through the returned view
+    [[nodiscard]] SnapshotBundlesView view_bundles() const;
     auto view_bundles_reverse() const { return std::ranges::reverse_view(view_bundles()); }
 
     [[nodiscard]] std::optional<SnapshotAndIndex> find_segment(SnapshotType type, BlockNum number) const;
@@ -81,6 +146,10 @@ class SnapshotRepository {
   private:
     const SnapshotBundle* find_bundle(BlockNum number) const;
 
+    //! Apply the configured warmup policy to the specified index files
+    void warmup_indexes(std::vector<const MemoryMappedFile*> index_files);
+    void stop_warmup();
+
     [[nodiscard]] SnapshotPathList get_segment_files() const {
         return get_files(kSegmentExtension);
     }
@@ -99,9 +168,16 @@ class SnapshotRepository {
     //! SnapshotBundle factory
     std::unique_ptr<SnapshotBundleFactory> bundle_factory_;
 
-    //! Full snapshot bundles ordered by block_from
-    std::map<BlockNum, SnapshotBundle> bundles_;
+    //! The cache of decoded words shared by all snapshots
+    std::shared_ptr<SnapshotWordCache> word_cache_;
+
+    //! Full snapshot bundles ordered by block_from, replaced as a whole (copy-on-write) when bundles are added
+    std::shared_ptr<const SnapshotBundlesView::Bundles> bundles_;
     mutable std::mutex bundles_mutex_;
+
+    //! The background thread prefaulting the index files (if required by the warmup policy)
+    std::thread warmup_thread_;
+    std::atomic_bool warmup_stop_requested_{false};
 };
 
 }  // namespace silkworm::snapshots
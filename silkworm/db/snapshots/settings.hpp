@@ -16,18 +16,31 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 
 #include <silkworm/db/snapshots/bittorrent/settings.hpp>
+#include <silkworm/db/snapshots/snapshot_word_cache.hpp>
 #include <silkworm/infra/common/directories.hpp>
 
 namespace silkworm::snapshots {
 
+//! The policy for warming up the memory-mapped snapshot files when the repository is opened
+enum class SnapshotWarmupPolicy : uint8_t {
+    kNone,      // Do nothing: pages are faulted-in on demand by the first accesses
+    kAdvise,    // Hint the kernel to read ahead the index files asynchronously (MADV_WILLNEED)
+    kPrefault,  // Fault-in all the pages of the index files on a background thread
+};
+
 struct SnapshotSettings {
     std::filesystem::path repository_dir{DataDirectory{}.snapshots().path()};  // Path to the snapshot repository on disk
     bool enabled{true};                                                        // Flag indicating if snapshots are enabled
     bool no_downloader{false};                                                 // Flag indicating if snapshots download is disabled
     bittorrent::BitTorrentSettings bittorrent_settings;                        // The Bittorrent protocol settings
+    std::size_t word_cache_capacity{kDefaultSnapshotWordCacheCapacity};        // Max decoded words in snapshot cache (0 disables it)
+    SnapshotWarmupPolicy warmup_policy{SnapshotWarmupPolicy::kAdvise};         // Warmup policy applied to index files at startup
+    bool index_huge_pages{true};                                               // Flag indicating if huge pages are requested for indexes
 };
 
 }  // namespace silkworm::snapshots
@@ -20,6 +20,12 @@
 
 namespace silkworm::snapshots {
 
+void SnapshotBundle::set_word_cache(const std::shared_ptr<SnapshotWordCache>& word_cache) {
+    for (auto& snapshot_ref : snapshots()) {
+        snapshot_ref.get().set_word_cache(word_cache);
+    }
+}
+
 void SnapshotBundle::reopen() {
     for (auto& snapshot_ref : snapshots()) {
         snapshot_ref.get().reopen_segment();
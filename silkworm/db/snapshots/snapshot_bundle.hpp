@@ -19,12 +19,14 @@
 #include <array>
 #include <cassert>
 #include <functional>
+#include <memory>
 
 #include <silkworm/core/common/base.hpp>
 
 #include "index.hpp"
 #include "snapshot_and_index.hpp"
 #include "snapshot_reader.hpp"
+#include "snapshot_word_cache.hpp"
 
 namespace silkworm::snapshots {
 
@@ -118,6 +120,9 @@ struct SnapshotBundle {
     BlockNum block_to() const { return header_snapshot.block_to(); }
     BlockNumRange block_range() const { return {block_from(), block_to()}; }
 
+    //! Share the specified decoded word cache among all the snapshots in this bundle
+    void set_word_cache(const std::shared_ptr<SnapshotWordCache>& word_cache);
+
     void reopen();
     void close();
 };
@@ -16,6 +16,7 @@
 
 #include "snapshot_reader.hpp"
 
+#include <atomic>
 #include <stdexcept>
 
 #include <silkworm/core/common/util.hpp>
@@ -23,11 +24,17 @@
 
 namespace silkworm::snapshots {
 
+static uint64_t next_segment_id() {
+    static std::atomic_uint64_t segment_id_counter{0};
+    return ++segment_id_counter;
+}
+
 Snapshot::Snapshot(
     SnapshotPath path,
     std::optional<MemoryMappedRegion> segment_region)
     : path_(std::move(path)),
-      decoder_{path_.path(), segment_region} {}
+      decoder_{path_.path(), segment_region},
+      segment_id_{next_segment_id()} {}
 
 Snapshot::~Snapshot() {
     close();
@@ -44,6 +51,9 @@ void Snapshot::reopen_segment() {
 
     // Open decompressor that opens the mapped file in turns
     decoder_.open();
+
+    // Any cached word belongs to the previous segment content: just let it be evicted
+    segment_id_ = next_segment_id();
 }
 
 Snapshot::Iterator& Snapshot::Iterator::operator++() {
@@ -34,6 +34,7 @@
 #include <silkworm/infra/common/memory_mapped_file.hpp>
 #include <silkworm/infra/common/os.hpp>
 
+#include "snapshot_word_cache.hpp"
 #include "snapshot_word_serializer.hpp"
 
 namespace silkworm::snapshots {
@@ -97,6 +98,14 @@ class Snapshot {
     [[nodiscard]] std::size_t item_count() const { return decoder_.words_count(); }
 
     [[nodiscard]] MemoryMappedRegion memory_file_region() const;
+    [[nodiscard]] const MemoryMappedFile* memory_file() const { return decoder_.memory_file(); }
+
+    //! Unique identifier of the currently opened segment, it changes whenever the segment is reopened
+    [[nodiscard]] uint64_t segment_id() const { return segment_id_; }
+
+    //! The cache of decoded words shared by all point lookups on this snapshot (optional)
+    [[nodiscard]] SnapshotWordCache* word_cache() const { return word_cache_.get(); }
+    void set_word_cache(std::shared_ptr<SnapshotWordCache> word_cache) { word_cache_ = std::move(word_cache); }
 
     void reopen_segment();
     void close();
@@ -113,6 +122,12 @@ class Snapshot {
     SnapshotPath path_;
 
     seg::Decompressor decoder_;
+
+    //! The unique identifier of the opened segment, used as cache key prefix
+    uint64_t segment_id_;
+
+    //! The cache of decoded words (if any)
+    std::shared_ptr<SnapshotWordCache> word_cache_;
 };
 
 template <SnapshotWordDeserializerConcept TWordDeserializer>
@@ -175,9 +190,25 @@ class SnapshotReader {
         return Iterator{snapshot_.seek(offset, hash_prefix, std::make_shared<TWordDeserializer>())};
     }
 
+    //! Read the word at the specified offset, using the snapshot decoded word cache (if any)
+    //! \note the hash prefix is checked only when the word is actually decoded, callers must check the full hash anyway
     std::optional<typename Iterator::value_type> seek_one(uint64_t offset, std::optional<Hash> hash_prefix = std::nullopt) const {
+        using Value = typename Iterator::value_type;
+        SnapshotWordCache* word_cache = snapshot_.word_cache();
+        const SnapshotWordCacheKey cache_key{snapshot_.segment_id(), offset};
+        if (word_cache) {
+            if (auto cached_value = word_cache->get<Value>(cache_key)) {
+                return cached_value;
+            }
+        }
         auto it = seek(offset, hash_prefix);
-        return (it != end()) ? std::optional{std::move(*it)} : std::nullopt;
+        if (it == end()) {
+            return std::nullopt;
+        }
+        if (word_cache) {
+            word_cache->put<Value>(cache_key, *it);
+        }
+        return std::optional{std::move(*it)};
     }
 
     std::vector<typename Iterator::value_type> read_into_vector(uint64_t offset, size_t count) const {
@@ -0,0 +1,42 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "snapshot_word_cache.hpp"
+
+namespace silkworm::snapshots {
+
+std::size_t SnapshotWordCache::KeyHash::operator()(const SnapshotWordCacheKey& key) const noexcept {
+    // 64-bit finalizer of MurmurHash3 applied to the combination of segment identifier and offset
+    uint64_t h = key.offset ^ (key.segment_id * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+SnapshotWordCacheStats SnapshotWordCache::stats() const {
+    return {
+        .hit_count = hit_count(),
+        .miss_count = miss_count(),
+        .eviction_count = eviction_count(),
+        .size = size(),
+        .capacity = capacity(),
+    };
+}
+
+}  // namespace silkworm::snapshots
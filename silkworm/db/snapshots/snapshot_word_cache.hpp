@@ -0,0 +1,99 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <silkworm/core/common/sharded_cache.hpp>
+
+namespace silkworm::snapshots {
+
+//! Key identifying one word within one opened snapshot segment
+struct SnapshotWordCacheKey {
+    //! The unique identifier of the opened segment (see Snapshot::segment_id)
+    uint64_t segment_id{0};
+    //! The offset of the word within the segment
+    uint64_t offset{0};
+
+    friend bool operator==(const SnapshotWordCacheKey&, const SnapshotWordCacheKey&) = default;
+};
+
+//! Point-in-time snapshot of the SnapshotWordCache counters
+struct SnapshotWordCacheStats {
+    uint64_t hit_count{0};
+    uint64_t miss_count{0};
+    uint64_t eviction_count{0};
+    std::size_t size{0};
+    std::size_t capacity{0};
+
+    friend bool operator==(const SnapshotWordCacheStats&, const SnapshotWordCacheStats&) = default;
+};
+
+constexpr std::size_t kDefaultSnapshotWordCacheCapacity{64 * 1024};
+constexpr std::size_t kDefaultSnapshotWordCacheShards{16};
+
+//! \brief Size-bounded cache of decoded snapshot words (e.g. BlockHeader, BlockBodyForStorage, Transaction).
+//! \details Values are type-erased because each segment type has exactly one decoded value type: a lookup using a
+//! different type than the one stored is counted as a miss.
+class SnapshotWordCache {
+  public:
+    explicit SnapshotWordCache(std::size_t capacity = kDefaultSnapshotWordCacheCapacity,
+                               std::size_t num_shards = kDefaultSnapshotWordCacheShards)
+        : words_{capacity, num_shards} {}
+
+    SnapshotWordCache(const SnapshotWordCache&) = delete;
+    SnapshotWordCache& operator=(const SnapshotWordCache&) = delete;
+
+    template <typename T>
+    std::optional<T> get(const SnapshotWordCacheKey& key) {
+        return words_.get_converted(key, [](const std::any& value) -> std::optional<T> {
+            if (const T* typed_value = std::any_cast<T>(&value)) {
+                return *typed_value;
+            }
+            return std::nullopt;
+        });
+    }
+
+    template <typename T>
+    void put(const SnapshotWordCacheKey& key, T value) {
+        words_.put(key, std::any{std::move(value)});
+    }
+
+    [[nodiscard]] std::size_t capacity() const { return words_.capacity(); }
+    [[nodiscard]] std::size_t size() const { return words_.size(); }
+
+    void clear() { words_.clear(); }
+
+    uint64_t hit_count() const { return words_.hit_count(); }
+    uint64_t miss_count() const { return words_.miss_count(); }
+    uint64_t eviction_count() const { return words_.eviction_count(); }
+
+    [[nodiscard]] SnapshotWordCacheStats stats() const;
+
+  private:
+    struct KeyHash {
+        std::size_t operator()(const SnapshotWordCacheKey& key) const noexcept;
+    };
+
+    ShardedCache<SnapshotWordCacheKey, std::any, KeyHash> words_;
+};
+
+}  // namespace silkworm::snapshots
@@ -0,0 +1,119 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "snapshot_word_cache.hpp"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm::snapshots {
+
+TEST_CASE("SnapshotWordCache::get", "[silkworm][snapshot][cache]") {
+    SnapshotWordCache cache{/*capacity=*/4, /*num_shards=*/1};
+
+    SECTION("empty") {
+        CHECK(!cache.get<std::string>({1, 0}));
+        CHECK(cache.hit_count() == 0);
+        CHECK(cache.miss_count() == 1);
+    }
+
+    SECTION("hit") {
+        cache.put<std::string>({1, 0}, "header");
+        const auto value = cache.get<std::string>({1, 0});
+        REQUIRE(value);
+        CHECK(*value == "header");
+        CHECK(cache.hit_count() == 1);
+        CHECK(cache.miss_count() == 0);
+    }
+
+    SECTION("different segment") {
+        cache.put<std::string>({1, 0}, "header");
+        CHECK(!cache.get<std::string>({2, 0}));
+        CHECK(cache.miss_count() == 1);
+    }
+
+    SECTION("type mismatch") {
+        cache.put<std::string>({1, 0}, "header");
+        CHECK(!cache.get<int>({1, 0}));
+        CHECK(cache.miss_count() == 1);
+    }
+
+    SECTION("overwrite") {
+        cache.put<std::string>({1, 0}, "old");
+        cache.put<std::string>({1, 0}, "new");
+        CHECK(cache.size() == 1);
+        CHECK(cache.get<std::string>({1, 0}) == "new");
+    }
+}
+
+TEST_CASE("SnapshotWordCache::put", "[silkworm][snapshot][cache]") {
+    SnapshotWordCache cache{/*capacity=*/4, /*num_shards=*/1};
+    REQUIRE(cache.capacity() == 4);
+
+    SECTION("within capacity") {
+        for (uint64_t offset{0}; offset < 4; ++offset) {
+            cache.put<uint64_t>({1, offset}, offset);
+        }
+        CHECK(cache.size() == 4);
+        CHECK(cache.eviction_count() == 0);
+    }
+
+    SECTION("evict unreferenced first") {
+        for (uint64_t offset{0}; offset < 4; ++offset) {
+            cache.put<uint64_t>({1, offset}, offset);
+        }
+        // Reference all but the word at offset 2, which must be the victim
+        CHECK(cache.get<uint64_t>({1, 0}));
+        CHECK(cache.get<uint64_t>({1, 1}));
+        CHECK(cache.get<uint64_t>({1, 3}));
+        cache.put<uint64_t>({1, 4}, 4);
+        CHECK(cache.size() == 4);
+        CHECK(cache.eviction_count() == 1);
+        CHECK(!cache.get<uint64_t>({1, 2}));
+        CHECK(cache.get<uint64_t>({1, 0}) == 0);
+        CHECK(cache.get<uint64_t>({1, 1}) == 1);
+        CHECK(cache.get<uint64_t>({1, 3}) == 3);
+        CHECK(cache.get<uint64_t>({1, 4}) == 4);
+    }
+
+    SECTION("clear") {
+        cache.put<uint64_t>({1, 0}, 0);
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(!cache.get<uint64_t>({1, 0}));
+    }
+}
+
+TEST_CASE("SnapshotWordCache::stats", "[silkworm][snapshot][cache]") {
+    SnapshotWordCache cache{/*capacity=*/2, /*num_shards=*/1};
+    CHECK(cache.stats() == SnapshotWordCacheStats{.capacity = 2});
+
+    cache.put<uint64_t>({1, 0}, 0);
+    cache.put<uint64_t>({1, 1}, 1);
+    CHECK(cache.get<uint64_t>({1, 0}));
+    CHECK(!cache.get<uint64_t>({1, 2}));
+    cache.put<uint64_t>({1, 2}, 2);
+    CHECK(cache.stats() == SnapshotWordCacheStats{
+                               .hit_count = 1,
+                               .miss_count = 1,
+                               .eviction_count = 1,
+                               .size = 2,
+                               .capacity = 2,
+                           });
+}
+
+}  // namespace silkworm::snapshots
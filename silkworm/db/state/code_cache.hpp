@@ -0,0 +1,36 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/common/sharded_cache.hpp>
+
+namespace silkworm::db::state {
+
+//! Default capacity in bytes of the contract code cache
+inline constexpr std::size_t kCodeCacheCapacity{64_Mebi};
+
+//! \brief Bounded cache of contract code by code hash.
+//! \details Code is content-addressed, so one cache can be shared by the states at any block.
+using CodeCache = ShardedCache<evmc::bytes32, Bytes>;
+
+}  // namespace silkworm::db::state
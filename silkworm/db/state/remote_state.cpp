@@ -16,34 +16,54 @@
 
 #include "remote_state.hpp"
 
+#include <algorithm>
 #include <future>
 #include <stdexcept>
-#include <unordered_map>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/this_coro.hpp>
 #include <boost/asio/use_future.hpp>
 
+#include <silkworm/core/common/empty_hashes.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 
 namespace silkworm::db::state {
 
-std::unordered_map<evmc::bytes32, Bytes> AsyncRemoteState::code_;
-
 Task<std::optional<Account>> AsyncRemoteState::read_account(const evmc::address& address) const noexcept {
     co_return co_await state_reader_.read_account(address, block_number_ + 1);
 }
 
 Task<ByteView> AsyncRemoteState::read_code(const evmc::bytes32& code_hash) const noexcept {
-    const auto optional_code{co_await state_reader_.read_code(code_hash)};
-    if (optional_code) {
-        code_[code_hash] = *optional_code;
-        co_return code_[code_hash];  // NOLINT(runtime/arrays)
+    if (const auto cached_code{read_cached_code(code_hash)}) {
+        co_return *cached_code;
+    }
+    auto optional_code{co_await state_reader_.read_code(code_hash)};
+    if (!optional_code) {
+        co_return ByteView{};
+    }
+    if (code_cache_ && !optional_code->empty()) {
+        code_cache_->put(code_hash, *optional_code, optional_code->size());
+    }
+    const auto it{code_.emplace(code_hash, std::move(*optional_code)).first};
+    co_return it->second;
+}
+
+std::optional<ByteView> AsyncRemoteState::read_cached_code(const evmc::bytes32& code_hash) const {
+    if (const auto it{code_.find(code_hash)}; it != code_.end()) {
+        return it->second;
     }
-    co_return ByteView{};
+    // Code is content-addressed, so it can be safely shared across states at different blocks
+    if (code_cache_) {
+        if (auto code{code_cache_->get_as_copy(code_hash)}) {
+            const auto it{code_.emplace(code_hash, std::move(*code)).first};
+            return it->second;
+        }
+    }
+    return std::nullopt;
 }
 
 Task<evmc::bytes32> AsyncRemoteState::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
@@ -82,9 +102,13 @@ Task<std::optional<evmc::bytes32>> AsyncRemoteState::canonical_hash(BlockNum blo
 
 std::optional<Account> RemoteState::read_account(const evmc::address& address) const noexcept {
     SILK_DEBUG << "RemoteState::read_account address=" << address << " start";
+    if (const auto it{accounts_.find(address)}; it != accounts_.end()) {
+        return it->second;
+    }
     try {
         std::future<std::optional<Account>> result{boost::asio::co_spawn(executor_, async_state_.read_account(address), boost::asio::use_future)};
         const auto optional_account{result.get()};
+        accounts_.emplace(address, optional_account);
         SILK_DEBUG << "RemoteState::read_account account.nonce=" << (optional_account ? optional_account->nonce : 0) << " end";
         return optional_account;
     } catch (const std::exception& e) {
@@ -95,9 +119,18 @@ std::optional<Account> RemoteState::read_account(const evmc::address& address) c
 
 ByteView RemoteState::read_code(const evmc::bytes32& code_hash) const noexcept {
     SILK_DEBUG << "RemoteState::read_code code_hash=" << to_hex(code_hash) << " start";
+    if (const auto it{code_.find(code_hash)}; it != code_.end()) {
+        return it->second;
+    }
+    // The shared code cache is thread-safe, so a hit there needs no round-trip to the I/O executor
+    if (const auto cached_code{async_state_.read_cached_code(code_hash)}) {
+        code_.emplace(code_hash, *cached_code);
+        return *cached_code;
+    }
     try {
         std::future<ByteView> result{boost::asio::co_spawn(executor_, async_state_.read_code(code_hash), boost::asio::use_future)};
         const auto code{result.get()};
+        code_.emplace(code_hash, code);
         return code;
     } catch (const std::exception& e) {
         SILK_ERROR << "RemoteState::read_code exception: " << e.what();
@@ -107,9 +140,14 @@ ByteView RemoteState::read_code(const evmc::bytes32& code_hash) const noexcept {
 
 evmc::bytes32 RemoteState::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
     SILK_DEBUG << "RemoteState::read_storage address=" << address << " incarnation=" << incarnation << " location=" << to_hex(location) << " start";
+    Storage& storage{storage_[address][incarnation]};
+    if (const auto it{storage.find(location)}; it != storage.end()) {
+        return it->second;
+    }
     try {
         std::future<evmc::bytes32> result{boost::asio::co_spawn(executor_, async_state_.read_storage(address, incarnation, location), boost::asio::use_future)};
         const auto storage_value{result.get()};
+        storage.emplace(location, storage_value);
         SILK_DEBUG << "RemoteState::read_storage storage_value=" << to_hex(storage_value) << " end\n";
         return storage_value;
     } catch (const std::exception& e) {
@@ -173,4 +211,88 @@ std::optional<evmc::bytes32> RemoteState::canonical_hash(BlockNum /*block_number
     throw std::logic_error{"RemoteState::canonical_hash not yet implemented"};
 }
 
+Task<void> RemoteState::prefetch(const std::vector<evmc::address>& addresses, const std::vector<AccessListEntry>& access_list) {
+    SILK_DEBUG << "RemoteState::prefetch #addresses=" << addresses.size() << " #access_list=" << access_list.size();
+    // Prefetching is just an optimization: any value missing after a failed read will be read on demand. Each read
+    // handles its own failure, so that the parallel group never cancels the sibling reads in flight.
+    std::size_t failed_reads{0};
+
+    // Read the accounts first, because the storage locations of the access list depend on their incarnation
+    std::vector<evmc::address> accounts;
+    const auto add_account = [&](const evmc::address& address) {
+        if (!accounts_.contains(address) && std::find(accounts.cbegin(), accounts.cend(), address) == accounts.cend()) {
+            accounts.push_back(address);
+        }
+    };
+    for (const auto& address : addresses) {
+        add_account(address);
+    }
+    for (const auto& entry : access_list) {
+        add_account(entry.account);
+    }
+    const auto account_task = [&](size_t i) -> Task<void> {
+        try {
+            co_await prefetch_account(accounts[i]);
+        } catch (const std::exception& e) {
+            SILK_DEBUG << "RemoteState::prefetch account=" << accounts[i] << " exception: " << e.what();
+            ++failed_reads;
+        }
+    };
+    co_await concurrency::generate_parallel_group_task(accounts.size(), account_task);
+
+    struct StorageLocation {
+        evmc::address address;
+        uint64_t incarnation{0};
+        evmc::bytes32 location;
+    };
+    std::vector<StorageLocation> locations;
+    for (const auto& entry : access_list) {
+        const auto account_it{accounts_.find(entry.account)};
+        if (account_it == accounts_.end() || !account_it->second) {
+            continue;
+        }
+        const auto incarnation{account_it->second->incarnation};
+        const Storage* cached_storage{nullptr};
+        if (const auto storage_it{storage_.find(entry.account)}; storage_it != storage_.end()) {
+            if (const auto incarnation_it{storage_it->second.find(incarnation)}; incarnation_it != storage_it->second.end()) {
+                cached_storage = &incarnation_it->second;
+            }
+        }
+        for (const auto& location : entry.storage_keys) {
+            if (!cached_storage || !cached_storage->contains(location)) {
+                locations.push_back({entry.account, incarnation, location});
+            }
+        }
+    }
+    const auto storage_task = [&](size_t i) -> Task<void> {
+        const auto& [address, incarnation, location] = locations[i];
+        try {
+            const auto value{co_await async_state_.read_storage(address, incarnation, location)};
+            // Look up the storage after the read, concurrent reads may have rehashed the maps meanwhile
+            storage_[address][incarnation].emplace(location, value);
+        } catch (const std::exception& e) {
+            SILK_DEBUG << "RemoteState::prefetch address=" << address << " location=" << to_hex(location) << " exception: " << e.what();
+            ++failed_reads;
+        }
+    };
+    co_await concurrency::generate_parallel_group_task(locations.size(), storage_task);
+
+    if (failed_reads > 0) {
+        SILK_WARN << "RemoteState::prefetch failed reads: " << failed_reads;
+    }
+}
+
+Task<std::optional<Account>> RemoteState::prefetch_account(const evmc::address& address) {
+    if (const auto it{accounts_.find(address)}; it != accounts_.end()) {
+        co_return it->second;
+    }
+    const auto account{co_await async_state_.read_account(address)};
+    accounts_.emplace(address, account);
+    if (account && account->code_hash != kEmptyHash && !code_.contains(account->code_hash)) {
+        const auto code{co_await async_state_.read_code(account->code_hash)};
+        code_.emplace(account->code_hash, code);
+    }
+    co_return account;
+}
+
 }  // namespace silkworm::db::state
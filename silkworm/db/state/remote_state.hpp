@@ -19,30 +19,40 @@
 #include <iostream>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <boost/asio/io_context.hpp>
 #include <evmc/evmc.hpp>
 
+#include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/state/state.hpp>
+#include <silkworm/core/types/transaction.hpp>
 #include <silkworm/db/chain/chain_storage.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
+#include <silkworm/db/state/code_cache.hpp>
 #include <silkworm/db/state/state_reader.hpp>
 
 namespace silkworm::db::state {
 
 class AsyncRemoteState {
   public:
-    explicit AsyncRemoteState(kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number)
-        : storage_(storage), block_number_(block_number), state_reader_{tx} {}
+    //! \param code_cache the contract code cache shared with other states, if any
+    explicit AsyncRemoteState(kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number, CodeCache* code_cache = nullptr)
+        : storage_(storage), block_number_(block_number), state_reader_{tx}, code_cache_{code_cache} {}
 
     Task<std::optional<Account>> read_account(const evmc::address& address) const noexcept;
 
     Task<ByteView> read_code(const evmc::bytes32& code_hash) const noexcept;
 
+    //! Synchronous lookup of the contract code already read by this state or present in the shared code cache
+    std::optional<ByteView> read_cached_code(const evmc::bytes32& code_hash) const;
+
     Task<evmc::bytes32> read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept;
 
     Task<uint64_t> previous_incarnation(const evmc::address& address) const noexcept;
@@ -60,17 +70,25 @@ class AsyncRemoteState {
     Task<std::optional<evmc::bytes32>> canonical_hash(BlockNum block_number) const;
 
   private:
-    static std::unordered_map<evmc::bytes32, Bytes> code_;
-
     const chain::ChainStorage& storage_;
     BlockNum block_number_;
     StateReader state_reader_;
+    CodeCache* code_cache_;
+
+    //! Contract code read so far: node-based map to keep the returned views valid for the lifetime of this state
+    mutable std::unordered_map<evmc::bytes32, Bytes> code_;
 };
 
+//! \brief Synchronous State adapter over AsyncRemoteState used by the EVM running on worker threads.
+//! \details State at a given block is immutable, so every account, storage and code value read is kept in a read
+//! cache for the lifetime of this object. Accounts and storage locations known before execution (sender, recipient,
+//! beneficiary, access list) can be loaded in one batch by \ref prefetch, which avoids one blocking round-trip between
+//! the worker and the I/O thread for each such read. Not thread-safe: one instance must be used by one execution.
 class RemoteState : public State {
   public:
-    explicit RemoteState(boost::asio::any_io_executor& executor, kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number)
-        : executor_(executor), async_state_{tx, storage, block_number} {}
+    explicit RemoteState(boost::asio::any_io_executor& executor, kv::api::Transaction& tx, const chain::ChainStorage& storage, BlockNum block_number,
+                         CodeCache* code_cache = nullptr)
+        : executor_(executor), async_state_{tx, storage, block_number, code_cache} {}
 
     std::optional<Account> read_account(const evmc::address& address) const noexcept override;
 
@@ -92,6 +110,11 @@ class RemoteState : public State {
 
     std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override;
 
+    //! Load into the read cache the specified accounts (including their code) and the access list storage locations
+    //! \details The reads are issued concurrently, first for all the accounts and then for all the storage locations
+    //! \warning must be awaited on the I/O executor before any synchronous read, not concurrently with them
+    Task<void> prefetch(const std::vector<evmc::address>& addresses, const std::vector<AccessListEntry>& access_list);
+
     void insert_block(const Block& /*block*/, const evmc::bytes32& /*hash*/) override {}
 
     void canonize_block(BlockNum /*block_number*/, const evmc::bytes32& /*block_hash*/) override {}
@@ -125,8 +148,17 @@ class RemoteState : public State {
     void unwind_state_changes(BlockNum /*block_number*/) override {}
 
   private:
+    Task<std::optional<Account>> prefetch_account(const evmc::address& address);
+
     boost::asio::any_io_executor executor_;
     AsyncRemoteState async_state_;
+
+    using Storage = absl::flat_hash_map<evmc::bytes32, evmc::bytes32>;
+    using StorageByIncarnation = absl::btree_map<uint64_t, Storage>;
+
+    mutable absl::flat_hash_map<evmc::address, std::optional<Account>> accounts_;
+    mutable absl::flat_hash_map<evmc::address, StorageByIncarnation> storage_;
+    mutable absl::flat_hash_map<evmc::bytes32, ByteView> code_;
 };
 
 std::ostream& operator<<(std::ostream& out, const RemoteState& s);
@@ -70,6 +70,47 @@ TEST_CASE_METHOD(RemoteStateTest, "async remote buffer", "[rpc][core][remote_buf
         CHECK(code_read == ByteView{code});
     }
 
+    SECTION("read_code shared among states by the code cache") {
+        static const Bytes code{*from_hex("0x6001")};
+        EXPECT_CALL(transaction, get_one(db::table::kCodeName, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+                co_return code;
+            }));
+        const auto code_hash{0x8ee2d6e2bf7a3e2dd9a4f9b2b2c1c5cfe6f4b9d7b4e1c9f0a0a3c6d9e1f2a3b4_bytes32};
+        CodeCache code_cache{kCodeCacheCapacity};
+        AsyncRemoteState state1{transaction, chain_storage, 1'000'000, &code_cache};
+        CHECK(spawn_and_wait(state1.read_code(code_hash)) == ByteView{code});
+        AsyncRemoteState state2{transaction, chain_storage, 2'000'000, &code_cache};
+        CHECK(spawn_and_wait(state2.read_code(code_hash)) == ByteView{code});
+    }
+
+    SECTION("read_code not shared among states without code cache") {
+        static const Bytes code{*from_hex("0x6001")};
+        EXPECT_CALL(transaction, get_one(db::table::kCodeName, _))
+            .Times(2)
+            .WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> {
+                co_return code;
+            }));
+        const auto code_hash{0x8ee2d6e2bf7a3e2dd9a4f9b2b2c1c5cfe6f4b9d7b4e1c9f0a0a3c6d9e1f2a3b4_bytes32};
+        AsyncRemoteState state1{transaction, chain_storage, 1'000'000};
+        CHECK(spawn_and_wait(state1.read_code(code_hash)) == ByteView{code});
+        AsyncRemoteState state2{transaction, chain_storage, 2'000'000};
+        CHECK(spawn_and_wait(state2.read_code(code_hash)) == ByteView{code});
+    }
+
+    SECTION("read_code hit in code cache needs no database read") {
+        std::thread io_context_thread{[&]() { io_context_.run(); }};
+        static const Bytes code{*from_hex("0x6001")};
+        EXPECT_CALL(transaction, get_one(db::table::kCodeName, _)).Times(0);
+        const auto code_hash{0x8ee2d6e2bf7a3e2dd9a4f9b2b2c1c5cfe6f4b9d7b4e1c9f0a0a3c6d9e1f2a3b4_bytes32};
+        CodeCache code_cache{kCodeCacheCapacity};
+        code_cache.put(code_hash, code, code.size());
+        RemoteState state(current_executor, transaction, chain_storage, 1'000'000, &code_cache);
+        CHECK(state.read_code(code_hash) == ByteView{code});
+        io_context_.stop();
+        io_context_thread.join();
+    }
+
     SECTION("read_code with empty response from db") {
         std::thread io_context_thread{[&]() { io_context_.run(); }};
         EXPECT_CALL(transaction, get_one(db::table::kCodeName, _))
@@ -124,6 +165,70 @@ TEST_CASE_METHOD(RemoteStateTest, "async remote buffer", "[rpc][core][remote_buf
         io_context_thread.join();
     }
 
+    SECTION("read_account and read_storage are cached") {
+        std::thread io_context_thread{[&]() { io_context_.run(); }};
+        EXPECT_CALL(transaction, get(db::table::kAccountHistoryName, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+                co_return KeyValue{Bytes{}, Bytes{}};
+            }));
+        EXPECT_CALL(transaction, get_one(db::table::kPlainStateName, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<Bytes> {
+                co_return Bytes{};
+            }));
+        EXPECT_CALL(transaction, get(db::table::kStorageHistoryName, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+                co_return KeyValue{Bytes{}, Bytes{}};
+            }));
+        EXPECT_CALL(transaction, get_both_range(db::table::kPlainStateName, _, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Bytes>> {
+                co_return *from_hex("0x01");
+            }));
+        const BlockNum block_number = 1'000'000;
+        const evmc::address address{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+        const auto location{0x04491edcd115127caedbd478e2e7895ed80c7847e903431f94f9cfa579cad47f_bytes32};
+        RemoteState remote_state(current_executor, transaction, chain_storage, block_number);
+        for (int i{0}; i < 2; ++i) {
+            CHECK(remote_state.read_account(address) == std::nullopt);
+            CHECK(remote_state.read_storage(address, 0, location) == 0x0000000000000000000000000000000000000000000000000000000000000001_bytes32);
+        }
+        io_context_.stop();
+        io_context_thread.join();
+    }
+
+    SECTION("prefetch loads accounts and access list storage") {
+        static const Bytes encoded_account{Account{.nonce = 1, .balance = 10}.encode_for_storage()};
+        const evmc::address sender{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+        const evmc::address target{0x52728289eba496b6080d57d0250a90663a07e556_address};
+        const auto location{0x04491edcd115127caedbd478e2e7895ed80c7847e903431f94f9cfa579cad47f_bytes32};
+        EXPECT_CALL(transaction, get(db::table::kAccountHistoryName, _))
+            .Times(2)
+            .WillRepeatedly(InvokeWithoutArgs([]() -> Task<KeyValue> {
+                co_return KeyValue{Bytes{}, Bytes{}};
+            }));
+        EXPECT_CALL(transaction, get_one(db::table::kPlainStateName, _))
+            .Times(2)
+            .WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> {
+                co_return encoded_account;
+            }));
+        EXPECT_CALL(transaction, get(db::table::kStorageHistoryName, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+                co_return KeyValue{Bytes{}, Bytes{}};
+            }));
+        EXPECT_CALL(transaction, get_both_range(db::table::kPlainStateName, _, _))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<std::optional<Bytes>> {
+                co_return *from_hex("0x02");
+            }));
+        const BlockNum block_number = 1'000'000;
+        RemoteState remote_state(current_executor, transaction, chain_storage, block_number);
+        const std::vector<AccessListEntry> access_list{{target, {location}}};
+        spawn_and_wait(remote_state.prefetch({sender}, access_list));
+
+        // All the following reads must be served from the read cache
+        CHECK(remote_state.read_account(sender)->balance == 10);
+        CHECK(remote_state.read_account(target)->nonce == 1);
+        CHECK(remote_state.read_storage(target, 0, location) == 0x0000000000000000000000000000000000000000000000000000000000000002_bytes32);
+    }
+
     SECTION("read_header with empty response from chain storage") {
         std::thread io_context_thread{[&]() { io_context_.run(); }};
         const BlockNum block_number = 1'000'000;
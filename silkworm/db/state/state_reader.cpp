@@ -83,7 +83,7 @@ Task<std::optional<Bytes>> StateReader::read_code(const evmc::bytes32& code_hash
 Task<std::optional<Bytes>> StateReader::read_historical_account(const evmc::address& address, BlockNum block_number) const {
     const auto account_history_key{db::account_history_key(address, block_number)};
     SILK_DEBUG << "StateReader::read_historical_account account_history_key: " << account_history_key;
-    const auto kv_pair{co_await tx_.get(table::kAccountHistoryName, account_history_key)};
+    const auto kv_pair{co_await tx_.get_view(table::kAccountHistoryName, account_history_key)};
 
     SILK_DEBUG << "StateReader::read_historical_account kv_pair.key: " << to_hex(kv_pair.key);
     const ByteView address_view{address.bytes};
@@ -95,10 +95,8 @@ Task<std::optional<Bytes>> StateReader::read_historical_account(const evmc::addr
     if (kv_pair.value.empty()) {
         co_return std::nullopt;
     }
-    const auto bitmap{bitmap::parse(kv_pair.value)};
-    SILK_DEBUG << "StateReader::read_historical_account bitmap: " << bitmap.toString();
-
-    const auto change_block{bitmap::seek(bitmap, block_number)};
+    const auto change_block{bitmap::seek_serialized(kv_pair.value, block_number)};
+    SILK_DEBUG << "StateReader::read_historical_account change_block: " << (change_block ? std::to_string(*change_block) : "none");
     if (!change_block) {
         co_return std::nullopt;
     }
@@ -117,7 +115,7 @@ Task<std::optional<Bytes>> StateReader::read_historical_storage(const evmc::addr
                                                                 const evmc::bytes32& location_hash, BlockNum block_number) const {
     const auto storage_history_key{db::storage_history_key(address, location_hash, block_number)};
     SILK_DEBUG << "StateReader::read_historical_storage storage_history_key: " << storage_history_key;
-    const auto kv_pair{co_await tx_.get(table::kStorageHistoryName, storage_history_key)};
+    const auto kv_pair{co_await tx_.get_view(table::kStorageHistoryName, storage_history_key)};
 
     const ByteView address_view{address.bytes};
     const ByteView location_hash_view{location_hash.bytes};
@@ -126,10 +124,8 @@ Task<std::optional<Bytes>> StateReader::read_historical_storage(const evmc::addr
         co_return std::nullopt;
     }
 
-    const auto bitmap{bitmap::parse(kv_pair.value)};
-    SILK_DEBUG << "StateReader::read_historical_storage bitmap: " << bitmap.toString();
-
-    const auto change_block{bitmap::seek(bitmap, block_number)};
+    const auto change_block{bitmap::seek_serialized(kv_pair.value, block_number)};
+    SILK_DEBUG << "StateReader::read_historical_storage change_block: " << (change_block ? std::to_string(*change_block) : "none");
     if (!change_block) {
         co_return std::nullopt;
     }
@@ -104,6 +104,17 @@ inline constexpr db::MapConfig kDifficulty{kDifficultyName};
 inline constexpr const char* kBlockReceiptsName{"Receipt"};
 inline constexpr db::MapConfig kBlockReceipts{kBlockReceiptsName};
 
+//! \details Stores for every canonical block the fixed-size offsets of its receipts, so that one receipt can be served
+//! without decoding all the receipts and logs of the block
+//! \remarks Written along with kBlockReceipts
+//! \struct
+//! \verbatim
+//!   key   : block_num_u64 (BE)
+//!   value : for each transaction cumulative_gas_used_u64 (BE) + first_log_index_u32 (BE) + success_u8
+//! \endverbatim
+inline constexpr const char* kReceiptOffsetsName{"ReceiptOffset"};
+inline constexpr db::MapConfig kReceiptOffsets{kReceiptOffsetsName};
+
 inline constexpr const char* kBloomBitsIndexName{"BloomBitsIndex"};
 inline constexpr db::MapConfig kBloomBitsIndex{kBloomBitsIndexName};
 
@@ -425,6 +436,7 @@ inline constexpr db::MapConfig kChainDataTables[]{
     kMigrations,
     kPlainCodeHash,
     kPlainState,
+    kReceiptOffsets,
     kSenders,
     kSequence,
     kSnapshotInfo,
@@ -27,12 +27,16 @@
 #include <sys/mman.h>
 #endif
 
+#include <algorithm>
+#include <cerrno>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <gsl/util>
 
 #include "ensure.hpp"
+#include "os.hpp"
 #include "safe_strerror.hpp"
 
 namespace silkworm {
@@ -99,6 +103,19 @@ void MemoryMappedFile::advise_random() const {
 void MemoryMappedFile::advise_sequential() const {
 }
 
+void MemoryMappedFile::advise_willneed() const {
+}
+
+void MemoryMappedFile::advise_willneed(MemoryMappedRegion /*sub_region*/) const {
+}
+
+void MemoryMappedFile::advise_hugepage() const {
+}
+
+size_t MemoryMappedFile::resident_size() const {
+    return 0;
+}
+
 void* MemoryMappedFile::mmap(FileDescriptor fd, size_t size, bool read_only) {
     DWORD protection = static_cast<DWORD>(read_only ? PAGE_READONLY : PAGE_READWRITE);
 
@@ -159,6 +176,49 @@ void MemoryMappedFile::advise_sequential() const {
     advise(MADV_SEQUENTIAL);
 }
 
+void MemoryMappedFile::advise_willneed() const {
+    advise(MADV_WILLNEED);
+}
+
+void MemoryMappedFile::advise_willneed(MemoryMappedRegion sub_region) const {
+    advise(MADV_WILLNEED, sub_region);
+}
+
+void MemoryMappedFile::advise_hugepage() const {
+#ifdef MADV_HUGEPAGE
+    const int result = ::madvise(region_.data(), region_.size(), MADV_HUGEPAGE);
+    if (result == -1) {
+        // Huge pages for file mappings may be not supported by the kernel: just ignore such errors
+        if (errno != ENOSYS && errno != EINVAL) {
+            throw std::runtime_error{"madvise failed for: " + path_.string() + " error: " + safe_strerror(errno)};
+        }
+    }
+#endif  // MADV_HUGEPAGE
+}
+
+size_t MemoryMappedFile::resident_size() const {
+    if (region_.empty()) return 0;
+
+    const size_t page_size = os::page_size();
+    const auto address = reinterpret_cast<uintptr_t>(region_.data());
+    const auto aligned_address = address & ~(page_size - 1);
+    const size_t length = region_.size() + (address - aligned_address);
+#ifdef __APPLE__
+    std::vector<char> residency((length + page_size - 1) / page_size);
+#else
+    std::vector<unsigned char> residency((length + page_size - 1) / page_size);
+#endif
+    const int result = ::mincore(reinterpret_cast<void*>(aligned_address), length, residency.data());
+    if (result == -1) {
+        throw std::runtime_error{"mincore failed for: " + path_.string() + " error: " + safe_strerror(errno)};
+    }
+    size_t resident_pages{0};
+    for (const auto page_status : residency) {
+        if (page_status & 1) ++resident_pages;
+    }
+    return std::min(resident_pages * page_size, region_.size());
+}
+
 void* MemoryMappedFile::mmap(FileDescriptor fd, size_t size, bool read_only) {
     int flags = MAP_SHARED;
 
@@ -180,7 +240,20 @@ void MemoryMappedFile::unmap() {
 }
 
 void MemoryMappedFile::advise(int advice) const {
-    const int result = ::madvise(region_.data(), region_.size(), advice);
+    advise(advice, region_);
+}
+
+void MemoryMappedFile::advise(int advice, MemoryMappedRegion sub_region) const {
+    ensure(sub_region.data() >= region_.data() && sub_region.data() + sub_region.size() <= region_.data() + region_.size(),
+           [&]() { return "MemoryMappedFile: sub-region out of mapped region for: " + path_.string(); });
+
+    // The start address given to madvise must be page-aligned
+    const size_t page_size = os::page_size();
+    const auto address = reinterpret_cast<uintptr_t>(sub_region.data());
+    const auto aligned_address = address & ~(page_size - 1);
+    const size_t length = sub_region.size() + (address - aligned_address);
+
+    const int result = ::madvise(reinterpret_cast<void*>(aligned_address), length, advice);
     if (result == -1) {
         // Ignore not implemented in kernel error because it still works (from Erigon)
         if (errno != ENOSYS) {
@@ -190,4 +263,18 @@ void MemoryMappedFile::advise(int advice) const {
 }
 #endif  // _WIN32
 
+void MemoryMappedFile::prefault(MemoryMappedRegion sub_region) const {
+    ensure(sub_region.data() >= region_.data() && sub_region.data() + sub_region.size() <= region_.data() + region_.size(),
+           [&]() { return "MemoryMappedFile: sub-region out of mapped region for: " + path_.string(); });
+
+    const size_t page_size = os::page_size();
+    volatile uint8_t sink{0};
+    for (size_t offset{0}; offset < sub_region.size(); offset += page_size) {
+        sink = sink ^ sub_region[offset];
+    }
+    if (!sub_region.empty()) {
+        sink = sink ^ sub_region.back();
+    }
+}
+
 }  // namespace silkworm
@@ -105,6 +105,19 @@ class MemoryMappedFile {
     void advise_random() const;
     void advise_sequential() const;
 
+    //! Hint the kernel to asynchronously read ahead the whole mapped region
+    void advise_willneed() const;
+    //! Hint the kernel to asynchronously read ahead the specified sub-region of the mapped region
+    void advise_willneed(MemoryMappedRegion sub_region) const;
+    //! Request transparent huge pages for the mapped region (best effort, ignored if not supported)
+    void advise_hugepage() const;
+
+    //! Synchronously fault-in the specified sub-region of the mapped region by touching one byte per page
+    void prefault(MemoryMappedRegion sub_region) const;
+
+    //! Size in bytes of the mapped region currently resident in physical memory
+    [[nodiscard]] size_t resident_size() const;
+
   private:
     void map_existing(bool read_only);
 
@@ -127,6 +140,7 @@ class MemoryMappedFile {
     HANDLE mapping_ = nullptr;
 #else
     void advise(int advice) const;
+    void advise(int advice, MemoryMappedRegion sub_region) const;
 #endif
 };
 
@@ -17,12 +17,19 @@
 #include "memory_mapped_file.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <silkworm/infra/common/directories.hpp>
+#include <silkworm/infra/common/os.hpp>
 
 namespace silkworm {
 
@@ -78,6 +85,37 @@ TEST_CASE("MemoryMappedFile from file", "[silkworm][infra][common][memory_mapped
         CHECK_NOTHROW(mmf.advise_random());
     }
 
+    SECTION("advise_willneed") {
+        CHECK_NOTHROW(mmf.advise_willneed());
+        CHECK_NOTHROW(mmf.advise_willneed(mmf.region().subspan(1)));
+    }
+
+    SECTION("advise_hugepage") {
+        CHECK_NOTHROW(mmf.advise_hugepage());
+    }
+
+    SECTION("prefault") {
+        CHECK_NOTHROW(mmf.prefault(mmf.region()));
+        CHECK_NOTHROW(mmf.prefault(mmf.region().subspan(2)));
+    }
+
+#ifndef _WIN32
+    SECTION("resident_size") {
+        mmf.prefault(mmf.region());
+        // The only page of the file has been touched
+        CHECK(mmf.resident_size() == mmf.size());
+    }
+
+    SECTION("resident_size after advise_willneed") {
+        mmf.advise_willneed();
+        // The read-ahead is asynchronous
+        for (int i{0}; i < 100 && mmf.resident_size() == 0; ++i) {
+            std::this_thread::sleep_for(10ms);
+        }
+        CHECK(mmf.resident_size() > 0);
+    }
+#endif  // _WIN32
+
     SECTION("input stream") {
         MemoryMappedInputStream mmis{mmf.region()};
         std::string s;
@@ -167,4 +205,35 @@ TEST_CASE("MemoryMappedFile from memory", "[silkworm][infra][common][memory_mapp
     }
 }
 
+#ifndef _WIN32
+TEST_CASE("MemoryMappedFile residency", "[silkworm][infra][common][memory_mapped_file]") {
+    // Anonymous pages become resident only when touched, unlike file pages which may be in the page cache already
+    const std::size_t page_size{os::page_size()};
+    const std::size_t size{16 * page_size};
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(memory != MAP_FAILED);
+
+    const auto tmp_file = TemporaryDirectory::get_unique_temporary_path();
+    std::ofstream{tmp_file, std::ios_base::binary}.put('\x01');
+    {
+        MemoryMappedFile mmf{tmp_file, MemoryMappedRegion{static_cast<uint8_t*>(memory), size}};
+
+        SECTION("untouched") {
+            CHECK(mmf.resident_size() == 0);
+        }
+
+        SECTION("prefault sub-region") {
+            mmf.prefault(mmf.region().subspan(0, 4 * page_size));
+            CHECK(mmf.resident_size() == 4 * page_size);
+        }
+
+        SECTION("prefault whole region") {
+            mmf.prefault(mmf.region());
+            CHECK(mmf.resident_size() == size);
+        }
+    }
+    ::munmap(memory, size);
+}
+#endif  // _WIN32
+
 }  // namespace silkworm
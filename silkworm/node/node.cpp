@@ -103,7 +103,7 @@ NodeImpl::NodeImpl(Settings& settings, SentryClientPtr sentry_client, mdbx::env
       execution_server_{make_execution_server_settings(), execution_service_},
       execution_direct_client_{execution_service_},
       sentry_client_{std::move(sentry_client)},
-      resource_usage_log_{*settings_.data_directory} {
+      resource_usage_log_{*settings_.data_directory, &snapshot_repository_} {
     backend_ = std::make_unique<EthereumBackEnd>(settings_, &chaindata_db_, sentry_client_);
     backend_->set_node_name(settings_.build_info.node_name);
     backend_kv_rpc_server_ = std::make_unique<BackEndKvServer>(settings_.server_settings, *backend_);
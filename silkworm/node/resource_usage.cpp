@@ -17,6 +17,7 @@
 #include "resource_usage.hpp"
 
 #include <chrono>
+#include <string>
 
 #include <boost/asio/experimental/as_tuple.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -45,10 +46,17 @@ Task<void> ResourceUsageLog::run() {
             timer.expires_after(kResourceUsageInterval);
             co_await timer.async_wait(boost::asio::use_awaitable);
 
-            log::Info("Resource usage", {"mem", human_size(os::get_mem_usage()),
-                                         "chain", human_size(data_directory_.chaindata().size()),
-                                         "etl-tmp", human_size(data_directory_.etl().size()),
-                                         "uptime", StopWatch::format(steady_clock::now() - start_time)});
+            log::Args args{"mem", human_size(os::get_mem_usage()),
+                           "chain", human_size(data_directory_.chaindata().size()),
+                           "etl-tmp", human_size(data_directory_.etl().size()),
+                           "uptime", StopWatch::format(steady_clock::now() - start_time)};
+            if (snapshot_repository_ && snapshot_repository_->word_cache()) {
+                const auto word_cache_stats = snapshot_repository_->word_cache_stats();
+                args.insert(args.end(), {"snap-cache-hits", std::to_string(word_cache_stats.hit_count),
+                                         "snap-cache-misses", std::to_string(word_cache_stats.miss_count),
+                                         "snap-cache-evictions", std::to_string(word_cache_stats.eviction_count)});
+            }
+            log::Info("Resource usage", args);
         } catch (const boost::system::system_error& ex) {
             if (ex.code() == boost::system::errc::operation_canceled) {
                 co_return;
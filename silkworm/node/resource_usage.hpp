@@ -18,6 +18,7 @@
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <silkworm/db/snapshots/repository.hpp>
 #include <silkworm/infra/common/directories.hpp>
 
 namespace silkworm::node {
@@ -25,13 +26,15 @@ namespace silkworm::node {
 //! Log for resource usage
 class ResourceUsageLog {
   public:
-    explicit ResourceUsageLog(const DataDirectory& data_directory)
-        : data_directory_(data_directory) {}
+    explicit ResourceUsageLog(const DataDirectory& data_directory,
+                              const snapshots::SnapshotRepository* snapshot_repository = nullptr)
+        : data_directory_(data_directory), snapshot_repository_(snapshot_repository) {}
 
     Task<void> run();
 
   private:
     const DataDirectory& data_directory_;
+    const snapshots::SnapshotRepository* snapshot_repository_;
 };
 
 }  // namespace silkworm::node
@@ -90,8 +90,8 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
             prune_call_traces = std::min(prune_call_traces, hashstate_stage_progress - 1);
         }
 
-        static constexpr size_t kCacheSize{5'000};
-        AnalysisCache analysis_cache{kCacheSize};
+        static constexpr size_t kAnalysisCacheCapacity{64_Mebi};
+        AnalysisCache analysis_cache{kAnalysisCacheCapacity};
         ObjectPool<evmone::ExecutionState> state_pool;
 
         prefetched_blocks_.clear();
@@ -312,10 +312,11 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
 }
 
 Stage::Result Execution::unwind(db::RWTxn& txn) {
-    static const db::MapConfig unwind_tables[5] = {
+    static const db::MapConfig unwind_tables[6] = {
         db::table::kAccountChangeSet,  //
         db::table::kStorageChangeSet,  //
         db::table::kBlockReceipts,     //
+        db::table::kReceiptOffsets,    //
         db::table::kLogs,              //
         db::table::kCallTraceSet       //
     };
@@ -480,6 +481,16 @@ Stage::Result Execution::prune(db::RWTxn& txn) {
                             "elapsed", StopWatch::format(duration)});
             }
 
+            source->bind(txn, db::table::kReceiptOffsets);
+            erased = db::cursor_erase(*source, key, db::CursorMoveDirection::Reverse);
+            if (stop_watch) {
+                const auto [_, duration] = stop_watch->lap();
+                log::Trace(log_prefix_,
+                           {"source", db::table::kReceiptOffsets.name,
+                            "erased", std::to_string(erased),
+                            "elapsed", StopWatch::format(duration)});
+            }
+
             source->bind(txn, db::table::kLogs);
             erased = db::cursor_erase(*source, key, db::CursorMoveDirection::Reverse);
             if (stop_watch) {
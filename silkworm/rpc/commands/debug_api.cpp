@@ -17,6 +17,7 @@
 #include "debug_api.hpp"
 
 #include <algorithm>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -104,13 +105,24 @@ Task<void> DebugRpcApi::handle_debug_account_range(const nlohmann::json& request
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
 
+//! Write the result field listing the modified \p addresses one at a time
+static void write_modified_accounts(json::Stream& stream, const std::set<evmc::address>& addresses) {
+    stream.write_field("result");
+    stream.open_array();
+    for (const auto& address : addresses) {
+        stream.write_entry(address_to_hex(address));
+    }
+    stream.close_array();
+}
+
 // https://github.com/ethereum/retesteth/wiki/RPC-Methods#debug_getmodifiedaccountsbynumber
-Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_number(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_number(const nlohmann::json& request, json::Stream& stream) {
     const auto& params = request["params"];
     if (params.empty() || params.size() > 2) {
         auto error_msg = "invalid debug_getModifiedAccountsByNumber params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request, kInvalidParams, error_msg);
+        const auto reply = make_json_error(request, kInvalidParams, error_msg);
+        stream.write_json(reply);
         co_return;
     }
 
@@ -121,35 +133,49 @@ Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_number(const nlohm
     }
     SILK_DEBUG << "start_block_id: " << start_block_id << " end_block_id: " << end_block_id;
 
+    stream.open_object();
+    stream.write_json_field("id", request["id"]);
+    stream.write_field("jsonrpc", "2.0");
+
     auto tx = co_await database_->begin();
 
+    // Collect the modified accounts before writing the result, so that any failure is replied as error only
+    std::optional<std::set<evmc::address>> addresses;
     try {
         const auto start_block_number = co_await core::get_block_number(start_block_id, *tx);
         const auto end_block_number = co_await core::get_block_number(end_block_id, *tx);
 
-        const auto addresses = co_await get_modified_accounts(*tx, start_block_number, end_block_number);
-        reply = make_json_content(request, addresses);
+        addresses = co_await get_modified_accounts(*tx, start_block_number, end_block_number);
     } catch (const std::invalid_argument& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request, kServerError, e.what());
+        const Error error{kServerError, e.what()};
+        stream.write_json_field("error", error);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request, kInternalError, e.what());
+        const Error error{kInternalError, e.what()};
+        stream.write_json_field("error", error);
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request, kServerError, "unexpected exception");
+        const Error error{kServerError, "unexpected exception"};
+        stream.write_json_field("error", error);
     }
+    if (addresses) {
+        write_modified_accounts(stream, *addresses);
+    }
+
+    stream.close_object();
 
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
 
 // https://github.com/ethereum/retesteth/wiki/RPC-Methods#debug_getmodifiedaccountsbyhash
-Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_hash(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_hash(const nlohmann::json& request, json::Stream& stream) {
     const auto& params = request["params"];
     if (params.empty() || params.size() > 2) {
         auto error_msg = "invalid debug_getModifiedAccountsByHash params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request, kInvalidParams, error_msg);
+        const auto reply = make_json_error(request, kInvalidParams, error_msg);
+        stream.write_json(reply);
         co_return;
     }
 
@@ -160,8 +186,14 @@ Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_hash(const nlohman
     }
     SILK_DEBUG << "start_hash: " << silkworm::to_hex(start_hash) << " end_hash: " << silkworm::to_hex(end_hash);
 
+    stream.open_object();
+    stream.write_json_field("id", request["id"]);
+    stream.write_field("jsonrpc", "2.0");
+
     auto tx = co_await database_->begin();
 
+    // Collect the modified accounts before writing the result, so that any failure is replied as error only
+    std::optional<std::set<evmc::address>> addresses;
     try {
         const auto chain_storage = tx->create_storage();
 
@@ -173,20 +205,26 @@ Task<void> DebugRpcApi::handle_debug_get_modified_accounts_by_hash(const nlohman
         if (!end_block_number) {
             throw std::invalid_argument("end block " + silkworm::to_hex(end_hash) + " not found");
         }
-        const auto addresses = co_await get_modified_accounts(*tx, *start_block_number, *end_block_number);
-
-        reply = make_json_content(request, addresses);
+        addresses = co_await get_modified_accounts(*tx, *start_block_number, *end_block_number);
     } catch (const std::invalid_argument& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request, kServerError, e.what());
+        const Error error{kServerError, e.what()};
+        stream.write_json_field("error", error);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request, kInternalError, e.what());
+        const Error error{kInternalError, e.what()};
+        stream.write_json_field("error", error);
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request, kServerError, "unexpected exception");
+        const Error error{kServerError, "unexpected exception"};
+        stream.write_json_field("error", error);
+    }
+    if (addresses) {
+        write_modified_accounts(stream, *addresses);
     }
 
+    stream.close_object();
+
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
 
@@ -633,7 +671,7 @@ Task<std::set<evmc::address>> get_modified_accounts(db::kv::api::Transaction& tx
         msg << "start block (" << start_block_number << ") is later than the latest block (" << latest_block_number << ")";
         throw std::invalid_argument(msg.str());
     } else if (start_block_number <= end_block_number) {
-        auto walker = [&](const silkworm::Bytes& key, const silkworm::Bytes& value) {
+        auto walker = [&](ByteView key, ByteView value) {
             auto block_number = static_cast<BlockNum>(std::stol(silkworm::to_hex(key), nullptr, 16));
             if (block_number <= end_block_number) {
                 auto address = bytes_to_address(value.substr(0, kAddressLength));
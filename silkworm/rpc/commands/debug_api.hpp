@@ -55,10 +55,10 @@ class DebugRpcApi {
 
   protected:
     Task<void> handle_debug_account_range(const nlohmann::json& request, nlohmann::json& reply);
-    Task<void> handle_debug_get_modified_accounts_by_number(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_debug_get_modified_accounts_by_number(const nlohmann::json& request, json::Stream& stream);
     Task<void> handle_debug_storage_range_at(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_debug_account_at(const nlohmann::json& request, nlohmann::json& reply);
-    Task<void> handle_debug_get_modified_accounts_by_hash(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_debug_get_modified_accounts_by_hash(const nlohmann::json& request, json::Stream& stream);
 
     Task<void> handle_debug_trace_transaction(const nlohmann::json& request, json::Stream& stream);
     Task<void> handle_debug_trace_call(const nlohmann::json& request, json::Stream& stream);
@@ -154,7 +154,7 @@ Task<void> EthereumRpcApi::handle_eth_gas_price(const nlohmann::json& request, n
             return core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         };
 
-        GasPriceOracle gas_price_oracle{block_provider};
+        GasPriceOracle gas_price_oracle{block_provider, fee_summaries_};
         auto gas_price = co_await gas_price_oracle.suggested_price(latest_block_number);
 
         const auto block_with_hash = co_await block_provider(latest_block_number);
@@ -225,8 +225,16 @@ Task<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json&
         make_glaze_json_error(request, kInvalidParams, error_msg, reply);
         co_return;
     }
-    const auto block_id = params[0].get<std::string>();
-    auto full_tx = params[1].get<bool>();
+    const json_rpc::EthGetBlockByNumberParams typed_params{
+        .block_id = params[0].get<std::string>(),
+        .full_tx = params[1].get<bool>(),
+    };
+
+    co_await handle_eth_get_block_by_number(request, typed_params, reply);
+}
+
+Task<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json& request, const json_rpc::EthGetBlockByNumberParams& params, std::string& reply) {
+    const auto& [block_id, full_tx] = params;
     SILK_DEBUG << "block_id: " << block_id << " full_tx: " << std::boolalpha << full_tx;
 
     auto tx = co_await database_->begin();
@@ -815,7 +823,15 @@ Task<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohmann::js
         reply = make_json_error(request, kInvalidParams, error_msg);
         co_return;
     }
-    auto transaction_hash = params[0].get<evmc::bytes32>();
+    const json_rpc::EthGetTransactionReceiptParams typed_params{
+        .transaction_hash = params[0].get<evmc::bytes32>(),
+    };
+
+    co_await handle_eth_get_transaction_receipt(request, typed_params, reply);
+}
+
+Task<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohmann::json& request, const json_rpc::EthGetTransactionReceiptParams& params, nlohmann::json& reply) {
+    const auto& transaction_hash = params.transaction_hash;
     SILK_DEBUG << "transaction_hash: " << silkworm::to_hex(transaction_hash);
     auto tx = co_await database_->begin();
 
@@ -828,30 +844,40 @@ Task<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohmann::js
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
-        auto receipts = co_await core::get_receipts(*tx, *block_with_hash);
         const auto& transactions = block_with_hash->block.transactions;
-        if (receipts.size() != transactions.size()) {
-            throw std::invalid_argument{"Unexpected size for receipts in handle_eth_get_transaction_receipt"};
-        }
-
-        std::optional<std::size_t> tx_index;
+        std::optional<uint32_t> tx_index;
         for (size_t idx{0}; idx < transactions.size(); idx++) {
             auto ethash_hash = transactions[idx].hash();
 
             SILK_TRACE << "tx " << idx << ") hash: " << silkworm::to_hex(silkworm::to_bytes32({ethash_hash.bytes, silkworm::kHashLength}));
             if (std::memcmp(transaction_hash.bytes, ethash_hash.bytes, silkworm::kHashLength) == 0) {
-                tx_index = idx;
-                const intx::uint256 base_fee_per_gas{block_with_hash->block.header.base_fee_per_gas.value_or(0)};
-                const intx::uint256 effective_gas_price{transactions[idx].max_fee_per_gas >= base_fee_per_gas ? transactions[idx].effective_gas_price(base_fee_per_gas)
-                                                                                                              : transactions[idx].max_priority_fee_per_gas};
-                receipts[idx].effective_gas_price = effective_gas_price;
+                tx_index = static_cast<uint32_t>(idx);
                 break;
             }
         }
         if (!tx_index) {
             throw std::invalid_argument{"Unexpected transaction index in handle_eth_get_transaction_receipt"};
         }
-        reply = make_json_content(request, receipts[*tx_index]);
+
+        // Use the receipt offset table if available, otherwise read all the receipts in the block
+        std::optional<Receipt> receipt;
+        if (co_await receipt_offsets_->is_available(*database_)) {
+            receipt = co_await core::read_receipt(*tx, *block_with_hash, *tx_index);
+        }
+        if (!receipt) {
+            auto receipts = co_await core::get_receipts(*tx, *block_with_hash);
+            if (receipts.size() != transactions.size()) {
+                throw std::invalid_argument{"Unexpected size for receipts in handle_eth_get_transaction_receipt"};
+            }
+            receipt = std::move(receipts[*tx_index]);
+        }
+
+        const auto& transaction = transactions[*tx_index];
+        const intx::uint256 base_fee_per_gas{block_with_hash->block.header.base_fee_per_gas.value_or(0)};
+        const intx::uint256 effective_gas_price{transaction.max_fee_per_gas >= base_fee_per_gas ? transaction.effective_gas_price(base_fee_per_gas)
+                                                                                                : transaction.max_priority_fee_per_gas};
+        receipt->effective_gas_price = effective_gas_price;
+        reply = make_json_content(request, *receipt);
     } catch (const std::invalid_argument& iv) {
         reply = make_json_content(request, {});
     } catch (const std::exception& e) {
@@ -906,7 +932,8 @@ Task<void> EthereumRpcApi::handle_eth_estimate_gas(const nlohmann::json& request
             return state_reader.read_account(address, block_number + 1);
         };
 
-        rpc::EstimateGasOracle estimate_gas_oracle{block_header_provider, account_reader, chain_config, workers_, *tx, *chain_storage};
+        rpc::EstimateGasOracle estimate_gas_oracle{block_header_provider, account_reader, chain_config, workers_, *tx, *chain_storage,
+                                                   kEstimateGasProbesPerRound};
         const auto estimated_gas = co_await estimate_gas_oracle.estimate_gas(call, latest_block);
 
         reply = make_json_content(request, to_quantity(estimated_gas));
@@ -937,8 +964,16 @@ Task<void> EthereumRpcApi::handle_eth_get_balance(const nlohmann::json& request,
         reply = make_json_error(request, kInvalidParams, error_msg);
         co_return;
     }
-    const auto address = params[0].get<evmc::address>();
-    const auto block_id = params[1].get<std::string>();
+    const json_rpc::EthGetBalanceParams typed_params{
+        .address = params[0].get<evmc::address>(),
+        .block_id = params[1].get<std::string>(),
+    };
+
+    co_await handle_eth_get_balance(request, typed_params, reply);
+}
+
+Task<void> EthereumRpcApi::handle_eth_get_balance(const nlohmann::json& request, const json_rpc::EthGetBalanceParams& params, nlohmann::json& reply) {
+    const auto& [address, block_id] = params;
     SILK_DEBUG << "address: " << address << " block_id: " << block_id;
 
     auto tx = co_await database_->begin();
@@ -1105,8 +1140,16 @@ Task<void> EthereumRpcApi::handle_eth_call(const nlohmann::json& request, std::s
         make_glaze_json_error(request, kInvalidParams, error_msg, reply);
         co_return;
     }
-    const auto call = params[0].get<Call>();
-    const auto block_id = params[1].get<std::string>();
+    const json_rpc::EthCallParams typed_params{
+        .call = params[0].get<Call>(),
+        .block_id = params[1].get<std::string>(),
+    };
+
+    co_await handle_eth_call(request, typed_params, reply);
+}
+
+Task<void> EthereumRpcApi::handle_eth_call(const nlohmann::json& request, const json_rpc::EthCallParams& params, std::string& reply) {
+    const auto& [call, block_id] = params;
     SILK_DEBUG << "call: " << call << " block_id: " << block_id;
 
     auto tx = co_await database_->begin();
@@ -1231,7 +1274,7 @@ Task<void> EthereumRpcApi::handle_eth_max_priority_fee_per_gas(const nlohmann::j
             return core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         };
 
-        GasPriceOracle gas_price_oracle{block_provider};
+        GasPriceOracle gas_price_oracle{block_provider, fee_summaries_};
         auto gas_price = co_await gas_price_oracle.suggested_price(latest_block_number);
 
         reply = make_json_content(request, to_quantity(gas_price));
@@ -1606,6 +1649,18 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_changes(const nlohmann::json& r
         LogsWalker logs_walker{*block_cache_, *tx};
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
 
+        // Tracked log filters get the logs of new blocks matched incrementally, so only the missing range must be scanned
+        if (auto changes = filter_storage_->take_changes(filter_id, end)) {
+            if (changes->from_block <= changes->to_block) {
+                const LogFilterOptions options{};
+                co_await logs_walker.get_logs(changes->from_block, changes->to_block, filter.addresses, filter.topics, options,
+                                              /*desc_order=*/false, changes->logs);
+            }
+            reply = make_json_content(request, changes->logs);
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            co_return;
+        }
+
         std::vector<Log> logs;
         if (filter.start == start && filter.end != end) {
             co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
@@ -1650,51 +1705,89 @@ Task<void> EthereumRpcApi::handle_eth_uninstall_filter(const nlohmann::json& req
 }
 
 // https://eth.wiki/json-rpc/API#eth_getlogs
-Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, std::string& reply) {
+Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, json::Stream& stream) {
     if (!request.contains("params")) {
         auto error_msg = "missing value for required argument 0";
         SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(request, kInvalidParams, error_msg, reply);
+        const auto reply = make_json_error(request, kInvalidParams, error_msg);
+        stream.write_json(reply);
         co_return;
     }
     auto params = request["params"];
     if (params.size() > 1) {
         auto error_msg = "too many arguments, want at most 1";
         SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(request, kInvalidParams, error_msg, reply);
+        const auto reply = make_json_error(request, kInvalidParams, error_msg);
+        stream.write_json(reply);
         co_return;
     }
 
-    auto filter = params[0].get<Filter>();
+    const json_rpc::EthGetLogsParams typed_params{
+        .filter = params[0].get<Filter>(),
+    };
+
+    co_await handle_eth_get_logs(request, typed_params, stream);
+}
+
+Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, const json_rpc::EthGetLogsParams& params, json::Stream& stream) {
+    const auto& filter = params.filter;
     SILK_DEBUG << "filter: " << filter;
 
+    stream.open_object();
+    stream.write_json_field("id", request["id"]);
+    stream.write_field("jsonrpc", "2.0");
+
     auto tx = co_await database_->begin();
 
+    // Logs are serialized block-by-block as soon as available, but the result is written only once all the blocks have
+    // been read, so that any failure is replied as error only
+    std::string json_logs;
+    bool failed{false};
     try {
         LogsWalker logs_walker{*block_cache_, *tx};
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
             SILK_ERROR << error_msg;
-            reply = make_json_error(request, 100, error_msg);
+            const Error error{100, error_msg};
+            stream.write_json_field("error", error);
+            stream.close_object();
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
 
-        std::vector<Log> logs;
-        co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
-
-        make_glaze_json_content(request, logs, reply);
+        std::string json_log;
+        const LogFilterOptions options{};
+        co_await logs_walker.stream_logs(workers_, start, end, filter.addresses, filter.topics, options, /*desc_order=*/true,
+                                         [&](const Logs& block_logs) {
+                                             for (const auto& log : block_logs) {
+                                                 json_log.clear();
+                                                 make_glaze_json_log(log, json_log);
+                                                 json_logs += json_logs.empty() ? '[' : ',';
+                                                 json_logs += json_log;
+                                             }
+                                         });
     } catch (const std::invalid_argument& iv) {
-        std::vector<silkworm::rpc::Log> log{};
-        make_glaze_json_content(request, log, reply);
+        SILK_WARN << "invalid argument: " << iv.what() << " processing request: " << request.dump();
+        json_logs.clear();
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        make_glaze_json_error(request, kInternalError, e.what(), reply);
+        const Error error{kInternalError, e.what()};
+        stream.write_json_field("error", error);
+        failed = true;
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        make_glaze_json_error(request, kServerError, "unexpected exception", reply);
+        const Error error{kServerError, "unexpected exception"};
+        stream.write_json_field("error", error);
+        failed = true;
     }
+    if (!failed) {
+        json_logs += json_logs.empty() ? "[]" : "]";
+        stream.write_field("result");
+        stream.write_json_content(json_logs);
+    }
+
+    stream.close_object();
 
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
@@ -2038,7 +2131,8 @@ Task<void> EthereumRpcApi::handle_fee_history(const nlohmann::json& request, nlo
         };
 
         const auto chain_config = co_await chain_storage->read_chain_config();
-        rpc::fee_history::FeeHistoryOracle oracle{chain_config, block_header_provider, block_provider, receipts_provider, latest_block_provider};
+        rpc::fee_history::FeeHistoryOracle oracle{chain_config, block_header_provider, block_provider, receipts_provider,
+                                                  latest_block_provider, fee_summaries_};
 
         const auto block_number = co_await core::get_block_number(newest_block, *tx);
         const auto fee_history = co_await oracle.fee_history(block_number, block_count, reward_percentiles);
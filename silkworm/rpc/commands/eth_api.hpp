@@ -28,10 +28,14 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/common/worker_pool.hpp>
+#include <silkworm/rpc/core/fee_summary_cache.hpp>
 #include <silkworm/rpc/core/filter_storage.hpp>
+#include <silkworm/rpc/core/receipts.hpp>
 #include <silkworm/rpc/ethbackend/backend.hpp>
 #include <silkworm/rpc/ethdb/database.hpp>
+#include <silkworm/rpc/json/stream.hpp>
 #include <silkworm/rpc/json/types.hpp>
+#include <silkworm/rpc/json_rpc/typed_request.hpp>
 #include <silkworm/rpc/txpool/miner.hpp>
 #include <silkworm/rpc/txpool/transaction_pool.hpp>
 #include <silkworm/rpc/types/filter.hpp>
@@ -57,6 +61,8 @@ class EthereumRpcApi {
           miner_{must_use_private_service<txpool::Miner>(io_context_)},
           tx_pool_{must_use_private_service<txpool::TransactionPool>(io_context_)},
           filter_storage_{must_use_shared_service<FilterStorage>(io_context_)},
+          fee_summaries_{use_shared_service<FeeSummaryCache>(io_context_)},
+          receipt_offsets_{must_use_shared_service<core::ReceiptOffsetsTable>(io_context_)},
           workers_{workers} {}
 
     virtual ~EthereumRpcApi() = default;
@@ -111,7 +117,7 @@ class EthereumRpcApi {
     Task<void> handle_eth_call_many(const nlohmann::json& request, nlohmann::json& reply);
 
     // GLAZE format routine
-    Task<void> handle_eth_get_logs(const nlohmann::json& request, std::string& reply);
+    Task<void> handle_eth_get_logs(const nlohmann::json& request, json::Stream& stream);
     Task<void> handle_eth_call(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_block_by_number(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_block_by_hash(const nlohmann::json& request, std::string& reply);
@@ -119,6 +125,13 @@ class EthereumRpcApi {
     Task<void> handle_eth_get_uncle_by_block_number_and_index(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_transaction_by_hash(const nlohmann::json& request, std::string& reply);
 
+    // Typed routines of the hot methods, called with parameters parsed either from the request DOM or by typed parsing
+    Task<void> handle_eth_get_transaction_receipt(const nlohmann::json& request, const json_rpc::EthGetTransactionReceiptParams& params, nlohmann::json& reply);
+    Task<void> handle_eth_get_balance(const nlohmann::json& request, const json_rpc::EthGetBalanceParams& params, nlohmann::json& reply);
+    Task<void> handle_eth_get_logs(const nlohmann::json& request, const json_rpc::EthGetLogsParams& params, json::Stream& stream);
+    Task<void> handle_eth_call(const nlohmann::json& request, const json_rpc::EthCallParams& params, std::string& reply);
+    Task<void> handle_eth_get_block_by_number(const nlohmann::json& request, const json_rpc::EthGetBlockByNumberParams& params, std::string& reply);
+
     boost::asio::io_context& io_context_;
     BlockCache* block_cache_;
     StateCache* state_cache_;
@@ -127,6 +140,8 @@ class EthereumRpcApi {
     txpool::Miner* miner_;
     txpool::TransactionPool* tx_pool_;
     FilterStorage* filter_storage_;
+    FeeSummaryCache* fee_summaries_;  // optional: null if disabled
+    core::ReceiptOffsetsTable* receipt_offsets_;
     WorkerPool& workers_;
 
     friend class silkworm::rpc::json_rpc::RequestHandler;
@@ -141,6 +141,30 @@ TEST_CASE_METHOD(test_util::RpcApiE2ETest, "fuzzy: eth_feeHistory sigsegv valid
             "reward":[["0x0","0x0"],["0x1","0x1"],["0x1","0x1"]]}
     })"_json);
 }
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "unit: eth_getLogs in batch replies as single requests", "[rpc][api]") {
+    const auto request1 = R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"fromBlock":"0x0","toBlock":"0x9"}]})"_json;
+    const auto request2 = R"({"jsonrpc":"2.0","id":2,"method":"eth_getLogs","params":[{"fromBlock":"0x1","toBlock":"0x2"}]})"_json;
+    std::string reply1, reply2;
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request1, reply1);
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request2, reply2);
+    const auto reply1_json = nlohmann::json::parse(reply1);
+    const auto reply2_json = nlohmann::json::parse(reply2);
+    CHECK(reply1_json.contains("result"));
+    CHECK(!reply1_json.contains("error"));
+    CHECK(reply2_json.contains("result"));
+    CHECK(!reply2_json.contains("error"));
+
+    const auto batch_request = "[" + request1.dump() + R"(,{"jsonrpc":"2.0","id":3,"method":"eth_blockNumber"},)" + request2.dump() + "]";
+    std::string batch_reply;
+    run<&test_util::RequestHandler_ForTest::handle_request>(batch_request, batch_reply);
+    const auto batch_reply_json = nlohmann::json::parse(batch_reply);
+    REQUIRE(batch_reply_json.is_array());
+    REQUIRE(batch_reply_json.size() == 3);
+    CHECK(batch_reply_json[0] == reply1_json);
+    CHECK(batch_reply_json[1] == R"({"jsonrpc":"2.0","id":3,"result":"0x9"})"_json);
+    CHECK(batch_reply_json[2] == reply2_json);
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::commands
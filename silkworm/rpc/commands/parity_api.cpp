@@ -16,6 +16,7 @@
 
 #include "parity_api.hpp"
 
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -37,19 +38,27 @@ namespace silkworm::rpc::commands {
 using db::state::StateReader;
 
 // https://eth.wiki/json-rpc/API#parity_getblockreceipts
-Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json& request, json::Stream& stream) {
     auto params = request["params"];
     if (params.size() != 1) {
         auto error_msg = "invalid parity_getBlockReceipts params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request, kInvalidParams, error_msg);
+        const auto reply = make_json_error(request, kInvalidParams, error_msg);
+        stream.write_json(reply);
         co_return;
     }
     const auto block_id = params[0].get<std::string>();
     SILK_DEBUG << "block_id: " << block_id;
 
+    stream.open_object();
+    stream.write_json_field("id", request["id"]);
+    stream.write_field("jsonrpc", "2.0");
+
     auto tx = co_await database_->begin();
 
+    // Read all the receipts before writing the result, so that any failure is replied as error only
+    std::optional<Receipts> receipts;
+    bool failed{false};
     try {
         const auto chain_storage{tx->create_storage()};
 
@@ -57,28 +66,42 @@ Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json&
         const auto block_number = co_await core::get_block_number(bnoh, *tx);
         const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, block_number.first);
         if (block_with_hash) {
-            auto receipts{co_await core::get_receipts(*tx, *block_with_hash)};
-            SILK_TRACE << "#receipts: " << receipts.size();
+            receipts = co_await core::get_receipts(*tx, *block_with_hash);
+            SILK_TRACE << "#receipts: " << receipts->size();
 
-            const auto block{block_with_hash->block};
-            for (size_t i{0}; i < block.transactions.size(); i++) {
-                receipts[i].effective_gas_price = block.transactions[i].effective_gas_price(block.header.base_fee_per_gas.value_or(0));
+            const auto& block{block_with_hash->block};
+            for (size_t i{0}; i < receipts->size() && i < block.transactions.size(); i++) {
+                (*receipts)[i].effective_gas_price = block.transactions[i].effective_gas_price(block.header.base_fee_per_gas.value_or(0));
             }
-            reply = make_json_content(request, receipts);
-        } else {
-            reply = make_json_content(request, {});
         }
     } catch (const std::invalid_argument& iv) {
         SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request, {});
+        receipts.reset();
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request, kInternalError, e.what());
+        const Error error{kInternalError, e.what()};
+        stream.write_json_field("error", error);
+        failed = true;
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request, kServerError, "unexpected exception");
+        const Error error{kServerError, "unexpected exception"};
+        stream.write_json_field("error", error);
+        failed = true;
+    }
+    if (receipts && !failed) {
+        // Receipts are serialized one at a time, so that we never hold the whole result as JSON in memory
+        stream.write_field("result");
+        stream.open_array();
+        for (const auto& receipt : *receipts) {
+            stream.write_json(receipt);
+        }
+        stream.close_array();
+    } else if (!failed) {
+        stream.write_json_field("result", nlohmann::json{});
     }
 
+    stream.close_object();
+
     co_await tx->close();  // RAII not (yet) available with coroutines
 }
 
@@ -26,6 +26,7 @@
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/ethbackend/backend.hpp>
 #include <silkworm/rpc/ethdb/database.hpp>
+#include <silkworm/rpc/json/stream.hpp>
 #include <silkworm/rpc/json/types.hpp>
 
 namespace silkworm::rpc::json_rpc {
@@ -47,7 +48,7 @@ class ParityRpcApi {
     ParityRpcApi(ParityRpcApi&&) = default;
 
   protected:
-    Task<void> handle_parity_get_block_receipts(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_parity_get_block_receipts(const nlohmann::json& request, json::Stream& stream);
     Task<void> handle_parity_list_storage_keys(const nlohmann::json& request, nlohmann::json& reply);
 
   private:
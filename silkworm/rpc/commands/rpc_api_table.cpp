@@ -98,8 +98,8 @@ void RpcApiTable::add_admin_handlers() {
 
 void RpcApiTable::add_debug_handlers() {
     method_handlers_[json_rpc::method::k_debug_accountRange] = &commands::RpcApi::handle_debug_account_range;
-    method_handlers_[json_rpc::method::k_debug_getModifiedAccountsByNumber] = &commands::RpcApi::handle_debug_get_modified_accounts_by_number;
-    method_handlers_[json_rpc::method::k_debug_getModifiedAccountsByHash] = &commands::RpcApi::handle_debug_get_modified_accounts_by_hash;
+    stream_handlers_[json_rpc::method::k_debug_getModifiedAccountsByNumber] = &commands::RpcApi::handle_debug_get_modified_accounts_by_number;
+    stream_handlers_[json_rpc::method::k_debug_getModifiedAccountsByHash] = &commands::RpcApi::handle_debug_get_modified_accounts_by_hash;
     method_handlers_[json_rpc::method::k_debug_storageRangeAt] = &commands::RpcApi::handle_debug_storage_range_at;
     method_handlers_[json_rpc::method::k_debug_accountAt] = &commands::RpcApi::handle_debug_account_at;
     method_handlers_[json_rpc::method::k_debug_getRawBlock] = &commands::RpcApi::handle_debug_get_raw_block;
@@ -154,20 +154,27 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[json_rpc::method::k_eth_submitWork] = &commands::RpcApi::handle_eth_submit_work;
     method_handlers_[json_rpc::method::k_eth_subscribe] = &commands::RpcApi::handle_eth_subscribe;
     method_handlers_[json_rpc::method::k_eth_unsubscribe] = &commands::RpcApi::handle_eth_unsubscribe;
-    method_handlers_[json_rpc::method::k_eth_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
-    method_handlers_[json_rpc::method::k_eth_getTransactionReceiptsByBlock] = &commands::RpcApi::handle_parity_get_block_receipts;
+    stream_handlers_[json_rpc::method::k_eth_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
+    stream_handlers_[json_rpc::method::k_eth_getTransactionReceiptsByBlock] = &commands::RpcApi::handle_parity_get_block_receipts;
     method_handlers_[json_rpc::method::k_eth_maxPriorityFeePerGas] = &commands::RpcApi::handle_eth_max_priority_fee_per_gas;
     method_handlers_[json_rpc::method::k_eth_feeHistory] = &commands::RpcApi::handle_fee_history;
     method_handlers_[json_rpc::method::k_eth_callMany] = &commands::RpcApi::handle_eth_call_many;
 
     // GLAZE methods
-    method_handlers_glaze_[json_rpc::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
     method_handlers_glaze_[json_rpc::method::k_eth_call] = &commands::RpcApi::handle_eth_call;
     method_handlers_glaze_[json_rpc::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
     method_handlers_glaze_[json_rpc::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
     method_handlers_glaze_[json_rpc::method::k_eth_getUncleByBlockHashAndIndex] = &commands::RpcApi::handle_eth_get_uncle_by_block_hash_and_index;
     method_handlers_glaze_[json_rpc::method::k_eth_getUncleByBlockNumberAndIndex] = &commands::RpcApi::handle_eth_get_uncle_by_block_number_and_index;
     method_handlers_glaze_[json_rpc::method::k_eth_getTransactionByHash] = &commands::RpcApi::handle_eth_get_transaction_by_hash;
+
+    stream_handlers_[json_rpc::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
+
+    // Cacheable methods: pending transactions have no receipt and get a null reply, which is never cached
+    cacheable_methods_.insert(json_rpc::method::k_eth_getBlockByNumber);
+    cacheable_methods_.insert(json_rpc::method::k_eth_getBlockByHash);
+    cacheable_methods_.insert(json_rpc::method::k_eth_getTransactionReceipt);
+    cacheable_methods_.insert(json_rpc::method::k_eth_getCode);
 }
 
 void RpcApiTable::add_net_handlers() {
@@ -177,7 +184,7 @@ void RpcApiTable::add_net_handlers() {
 }
 
 void RpcApiTable::add_parity_handlers() {
-    method_handlers_[json_rpc::method::k_parity_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
+    stream_handlers_[json_rpc::method::k_parity_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
     method_handlers_[json_rpc::method::k_parity_listStorageKeys] = &commands::RpcApi::handle_parity_list_storage_keys;
 }
 
@@ -208,6 +215,9 @@ void RpcApiTable::add_trace_handlers() {
     method_handlers_[json_rpc::method::k_trace_transaction] = &commands::RpcApi::handle_trace_transaction;
 
     stream_handlers_[json_rpc::method::k_trace_filter] = &commands::RpcApi::handle_trace_filter;
+
+    // Cacheable methods
+    cacheable_methods_.insert(json_rpc::method::k_trace_block);
 }
 
 void RpcApiTable::add_web3_handlers() {
@@ -251,6 +261,10 @@ void RpcApiTable::add_ots_handlers() {
     method_handlers_[json_rpc::method::k_ots_getInternalOperations] = &commands::RpcApi::handle_ots_get_internal_operations;
     method_handlers_[json_rpc::method::k_ots_search_transactions_before] = &commands::RpcApi::handle_ots_search_transactions_before;
     method_handlers_[json_rpc::method::k_ots_search_transactions_after] = &commands::RpcApi::handle_ots_search_transactions_after;
+
+    // Cacheable methods
+    cacheable_methods_.insert(json_rpc::method::k_ots_getBlockDetails);
+    cacheable_methods_.insert(json_rpc::method::k_ots_getBlockDetailsByHash);
 }
 
 }  // namespace silkworm::rpc::commands
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 
 #include <silkworm/infra/concurrency/task.hpp>
@@ -45,6 +46,9 @@ class RpcApiTable {
     [[nodiscard]] std::optional<HandleMethodGlaze> find_json_glaze_handler(const std::string& method) const;
     [[nodiscard]] std::optional<HandleStream> find_stream_handler(const std::string& method) const;
 
+    //! \return true if the replies of \p method depend just on its params and the canonical chain, so they can be cached
+    [[nodiscard]] bool is_cacheable(const std::string& method) const { return cacheable_methods_.contains(method); }
+
   private:
     void build_handlers(const std::string& api_spec);
     void add_handlers(const std::string& api_namespace);
@@ -63,6 +67,7 @@ class RpcApiTable {
     std::map<std::string, HandleMethod> method_handlers_;
     std::map<std::string, HandleMethodGlaze> method_handlers_glaze_;
     std::map<std::string, HandleStream> stream_handlers_;
+    std::set<std::string> cacheable_methods_;
 };
 
 }  // namespace silkworm::rpc::commands
@@ -138,4 +138,18 @@ TEST_CASE("RpcApiTable default spec", "[rpc][api]") {
     check_web3_namespace(table, true);
 }
 
+TEST_CASE("RpcApiTable cacheable methods", "[rpc][api]") {
+    RpcApiTable table{kDefaultEth1ApiSpec};
+    CHECK(table.is_cacheable(json_rpc::method::k_eth_getBlockByNumber));
+    CHECK(table.is_cacheable(json_rpc::method::k_eth_getTransactionReceipt));
+    CHECK(table.is_cacheable(json_rpc::method::k_eth_getCode));
+    CHECK(table.is_cacheable(json_rpc::method::k_trace_block));
+    CHECK(!table.is_cacheable(json_rpc::method::k_eth_blockNumber));
+    CHECK(!table.is_cacheable(json_rpc::method::k_eth_getTransactionByHash));
+    CHECK(!table.is_cacheable(json_rpc::method::k_eth_call));
+
+    RpcApiTable web3_table{kWeb3ApiNamespace};
+    CHECK(!web3_table.is_cacheable(json_rpc::method::k_eth_getCode));
+}
+
 }  // namespace silkworm::rpc::commands
@@ -369,7 +369,7 @@ Task<void> TraceRpcApi::handle_trace_filter(const nlohmann::json& request, json:
 
         trace::TraceCallExecutor executor{*block_cache_, *chain_storage, workers_, *tx};
 
-        co_await executor.trace_filter(trace_filter, *chain_storage, stream);
+        co_await executor.trace_filter(trace_filter, *chain_storage, stream, [this]() { return database_->begin(); });
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
 
@@ -0,0 +1,39 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace silkworm::rpc {
+
+//! Default maximum number of requests in one JSON-RPC batch
+inline constexpr std::size_t kDefaultMaxBatchSize{1'000};
+
+//! Default maximum size in bytes of one JSON-RPC batch response
+inline constexpr std::size_t kDefaultMaxBatchResponseSize{25 * 1024 * 1024};
+
+//! Default maximum number of batch requests executed concurrently within one connection
+inline constexpr std::size_t kDefaultBatchConcurrency{8};
+
+//! Limits applied when handling JSON-RPC batch requests, zero means no limit
+struct BatchSettings {
+    std::size_t max_batch_size{kDefaultMaxBatchSize};
+    std::size_t max_response_size{kDefaultMaxBatchResponseSize};
+    std::size_t max_concurrency{kDefaultBatchConcurrency};
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,180 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "compression.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace silkworm::rpc {
+
+//! Gzip member header: no file name nor modification time, fastest compression, unknown OS
+static constexpr std::array<uint8_t, 10> kGzipHeader{0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff};
+
+//! Zlib header: DEFLATE with 32KiB window, fastest compression
+static constexpr std::array<uint8_t, 2> kZlibHeader{0x78, 0x01};
+
+//! Minimum size of the output buffer extension for each deflate call
+static constexpr std::size_t kMinOutputSize{16 * 1024};
+
+//! Maximum size of the input for each deflate call, due to the 32-bit size type in zlib API
+static constexpr std::size_t kMaxInputSize{std::numeric_limits<uInt>::max()};
+
+//! Raw DEFLATE stream: headers and trailers are written by the callers, so that compressed fragments can be spliced
+struct Compressor::DeflateStream {
+    explicit DeflateStream(int level) {
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error{"DeflateStream: cannot initialize zlib deflate stream"};
+        }
+    }
+    ~DeflateStream() { deflateEnd(&stream); }
+
+    DeflateStream(const DeflateStream&) = delete;
+    DeflateStream& operator=(const DeflateStream&) = delete;
+
+    //! Compress \p data using \p flush mode appending the compressed data to \p out
+    void deflate(std::string_view data, int flush, std::string& out) {
+        do {
+            const std::size_t input_size{std::min(data.size(), kMaxInputSize)};
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+            stream.avail_in = static_cast<uInt>(input_size);
+            data.remove_prefix(input_size);
+            const int flush_mode{data.empty() ? flush : Z_NO_FLUSH};
+            do {
+                const std::size_t offset{out.size()};
+                const std::size_t output_size{std::clamp<std::size_t>(stream.avail_in / 2, kMinOutputSize, kMaxInputSize)};
+                out.resize(offset + output_size);
+                stream.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+                stream.avail_out = static_cast<uInt>(output_size);
+                const int result{::deflate(&stream, flush_mode)};
+                out.resize(offset + output_size - stream.avail_out);
+                if (result == Z_STREAM_ERROR) {
+                    throw std::runtime_error{"DeflateStream: zlib deflate failed"};
+                }
+            } while (stream.avail_out == 0);
+        } while (!data.empty());
+    }
+
+    void reset() { deflateReset(&stream); }
+
+    z_stream stream{};
+};
+
+static void append_le32(uint32_t value, std::string& out) {
+    for (int i{0}; i < 4; ++i) {
+        out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+static void append_be32(uint32_t value, std::string& out) {
+    for (int i{3}; i >= 0; --i) {
+        out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+CompressedFragment make_compressed_fragment(std::string_view data, int level) {
+    CompressedFragment fragment;
+    fragment.deflated.reserve(data.size() / 4);
+    Compressor::DeflateStream deflate_stream{level};
+    // Sync flush terminates the non-final blocks on a byte boundary, so that other blocks can follow them
+    deflate_stream.deflate(data, Z_SYNC_FLUSH, fragment.deflated);
+    const auto* bytes{reinterpret_cast<const Bytef*>(data.data())};
+    fragment.size = data.size();
+    fragment.crc32 = static_cast<uint32_t>(crc32_z(crc32_z(0, nullptr, 0), bytes, data.size()));
+    fragment.adler32 = static_cast<uint32_t>(adler32_z(adler32_z(0, nullptr, 0), bytes, data.size()));
+    return fragment;
+}
+
+std::shared_ptr<const CompressedFragment> SharedContent::compressed() const {
+    std::shared_ptr<const CompressedFragment> compressed;
+    {
+        std::scoped_lock lock{compressed_mutex_};
+        if (compressed_) {
+            return compressed_;
+        }
+        compressed_ = std::make_shared<const CompressedFragment>(make_compressed_fragment(data_));
+        compressed = compressed_;
+    }
+    // Notify outside the lock: the callback is free to access this content again
+    if (on_compressed_) {
+        on_compressed_(*this);
+    }
+    return compressed;
+}
+
+Compressor::Compressor(CompressionFormat format, int level)
+    : deflate_stream_{std::make_unique<DeflateStream>(level)}, format_{format} {}
+
+Compressor::~Compressor() = default;
+
+void Compressor::write(std::string_view data, std::string& out) {
+    write_header(out);
+    deflate_stream_->deflate(data, Z_NO_FLUSH, out);
+    const auto* bytes{reinterpret_cast<const Bytef*>(data.data())};
+    crc32_ = static_cast<uint32_t>(crc32_z(crc32_, bytes, data.size()));
+    adler32_ = static_cast<uint32_t>(adler32_z(adler32_, bytes, data.size()));
+    size_ += data.size();
+}
+
+void Compressor::write(const CompressedFragment& fragment, std::string& out) {
+    write_header(out);
+    // Terminate the pending blocks on a byte boundary, so that the fragment blocks can follow them
+    deflate_stream_->deflate({}, Z_SYNC_FLUSH, out);
+    out.append(fragment.deflated);
+    // The fragment data is not in the deflate window, so restart the stream to prevent any reference to the data before it
+    deflate_stream_->reset();
+    crc32_ = static_cast<uint32_t>(crc32_combine(crc32_, fragment.crc32, static_cast<z_off_t>(fragment.size)));
+    adler32_ = static_cast<uint32_t>(adler32_combine(adler32_, fragment.adler32, static_cast<z_off_t>(fragment.size)));
+    size_ += fragment.size;
+}
+
+void Compressor::finish(std::string& out) {
+    write_header(out);
+    deflate_stream_->deflate({}, Z_FINISH, out);
+    if (format_ == CompressionFormat::kGzip) {
+        append_le32(crc32_, out);
+        append_le32(static_cast<uint32_t>(size_), out);  // size modulo 2^32
+    } else {
+        append_be32(adler32_, out);
+    }
+}
+
+void Compressor::write_header(std::string& out) {
+    if (header_written_) {
+        return;
+    }
+    if (format_ == CompressionFormat::kGzip) {
+        out.append(kGzipHeader.begin(), kGzipHeader.end());
+    } else {
+        out.append(kZlibHeader.begin(), kZlibHeader.end());
+    }
+    header_written_ = true;
+}
+
+std::string compress(std::string_view data, CompressionFormat format, int level) {
+    std::string compressed_data;
+    compressed_data.reserve(data.size() / 4);
+    Compressor compressor{format, level};
+    compressor.write(data, compressed_data);
+    compressor.finish(compressed_data);
+    return compressed_data;
+}
+
+}  // namespace silkworm::rpc
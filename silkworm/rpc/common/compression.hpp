@@ -0,0 +1,110 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace silkworm::rpc {
+
+//! Compressed data formats used by the HTTP content codings "gzip" and "deflate" respectively
+enum class CompressionFormat {
+    kGzip,
+    kZlib,
+};
+
+//! Fastest compression level: response latency matters more than a few percent of compression ratio
+inline constexpr int kDefaultCompressionLevel{1};
+
+//! \brief Raw DEFLATE blocks compressed independently of any other data, so that they can be spliced into any compressed
+//! stream, together with the size and checksums of the clear data.
+struct CompressedFragment {
+    std::string deflated;
+    std::size_t size{0};
+    uint32_t crc32{0};
+    uint32_t adler32{1};
+};
+
+//! \return the compressed fragment of \p data
+CompressedFragment make_compressed_fragment(std::string_view data, int level = kDefaultCompressionLevel);
+
+//! \brief Content shared by many responses (e.g. cached results) which keeps its compressed form once computed.
+//! \details Thread-safe.
+class SharedContent : public std::enable_shared_from_this<SharedContent> {
+  public:
+    //! Callback notified once the compressed form has been computed, e.g. to account for its size
+    using CompressedCallback = std::function<void(const SharedContent&)>;
+
+    explicit SharedContent(std::string data, CompressedCallback on_compressed = {})
+        : data_{std::move(data)}, on_compressed_{std::move(on_compressed)} {}
+
+    [[nodiscard]] const std::string& data() const { return data_; }
+
+    //! \return the compressed form of the content, computed at the first call
+    std::shared_ptr<const CompressedFragment> compressed() const;
+
+  private:
+    std::string data_;
+    CompressedCallback on_compressed_;
+    mutable std::mutex compressed_mutex_;
+    mutable std::shared_ptr<const CompressedFragment> compressed_;
+};
+
+using SharedContentPtr = std::shared_ptr<const SharedContent>;
+
+//! \brief Incremental compressor producing a gzip or zlib stream out of clear data and compressed fragments.
+//! \details Each call appends to the output the compressed data available so far. Not thread-safe.
+class Compressor {
+  public:
+    explicit Compressor(CompressionFormat format, int level = kDefaultCompressionLevel);
+    ~Compressor();
+
+    Compressor(const Compressor&) = delete;
+    Compressor& operator=(const Compressor&) = delete;
+
+    //! Compress \p data appending the available compressed data to \p out
+    void write(std::string_view data, std::string& out);
+
+    //! Splice the already compressed \p fragment appending the available compressed data to \p out
+    void write(const CompressedFragment& fragment, std::string& out);
+
+    //! Complete the compressed stream appending the remaining compressed data to \p out
+    void finish(std::string& out);
+
+  private:
+    void write_header(std::string& out);
+
+    struct DeflateStream;
+    friend CompressedFragment make_compressed_fragment(std::string_view data, int level);
+
+    std::unique_ptr<DeflateStream> deflate_stream_;
+    CompressionFormat format_;
+    bool header_written_{false};
+    std::size_t size_{0};
+    uint32_t crc32_{0};
+    uint32_t adler32_{1};
+};
+
+//! \return \p data compressed in the specified \p format
+std::string compress(std::string_view data, CompressionFormat format, int level = kDefaultCompressionLevel);
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,136 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "compression.hpp"
+
+#include <zlib.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm::rpc {
+
+//! Decompress \p data in gzip or zlib format (detected automatically)
+//! \return the decompressed data or std::nullopt if \p data is not a complete valid stream
+static std::optional<std::string> decompress(const std::string& data) {
+    z_stream stream{};
+    REQUIRE(inflateInit2(&stream, MAX_WBITS + 32) == Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    std::string out;
+    int result{Z_OK};
+    while (result == Z_OK) {
+        char buffer[4096];
+        stream.next_out = reinterpret_cast<Bytef*>(buffer);
+        stream.avail_out = sizeof(buffer);
+        result = inflate(&stream, Z_NO_FLUSH);
+        out.append(buffer, sizeof(buffer) - stream.avail_out);
+    }
+    const bool complete{result == Z_STREAM_END && stream.avail_in == 0};
+    inflateEnd(&stream);
+    return complete ? std::make_optional(out) : std::nullopt;
+}
+
+static std::string make_json_data(std::size_t num_items) {
+    std::string data{"["};
+    for (std::size_t i{0}; i < num_items; ++i) {
+        data += (i > 0 ? "," : "") + std::string{R"({"blockNumber":"0x)"} + std::to_string(i * 7919) + R"(","value":"0x0"})";
+    }
+    data += "]";
+    return data;
+}
+
+TEST_CASE("compress", "[rpc][common][compression]") {
+    for (const auto format : {CompressionFormat::kGzip, CompressionFormat::kZlib}) {
+        for (const std::size_t num_items : {0, 1, 1'000, 100'000}) {
+            const std::string data{make_json_data(num_items)};
+            const std::string compressed_data{compress(data, format)};
+            if (num_items > 1) {
+                CHECK(compressed_data.size() < data.size());
+            }
+            CHECK(decompress(compressed_data) == data);
+        }
+    }
+    CHECK(compress("", CompressionFormat::kGzip).starts_with("\x1f\x8b"));
+    CHECK(compress("", CompressionFormat::kZlib).starts_with("\x78\x01"));
+}
+
+TEST_CASE("Compressor", "[rpc][common][compression]") {
+    const std::string prefix{R"({"jsonrpc":"2.0","id":1,"result":)"};
+    const std::string result{make_json_data(10'000)};
+    const std::string suffix{"}"};
+    const auto fragment{make_compressed_fragment(result)};
+    CHECK(fragment.size == result.size());
+    CHECK(fragment.deflated.size() < result.size());
+
+    for (const auto format : {CompressionFormat::kGzip, CompressionFormat::kZlib}) {
+        SECTION("clear data written in chunks") {
+            Compressor compressor{format};
+            std::string compressed_data;
+            for (std::size_t offset{0}; offset < result.size(); offset += 1'000) {
+                compressor.write(std::string_view{result}.substr(offset, 1'000), compressed_data);
+            }
+            compressor.finish(compressed_data);
+            CHECK(decompress(compressed_data) == result);
+        }
+        SECTION("compressed fragment spliced between clear data") {
+            Compressor compressor{format};
+            std::string compressed_data;
+            compressor.write(prefix, compressed_data);
+            compressor.write(fragment, compressed_data);
+            compressor.write(suffix, compressed_data);
+            compressor.write(fragment, compressed_data);
+            compressor.finish(compressed_data);
+            CHECK(decompress(compressed_data) == prefix + result + suffix + result);
+        }
+        SECTION("compressed fragment only") {
+            Compressor compressor{format};
+            std::string compressed_data;
+            compressor.write(fragment, compressed_data);
+            compressor.finish(compressed_data);
+            CHECK(decompress(compressed_data) == result);
+        }
+    }
+}
+
+TEST_CASE("SharedContent", "[rpc][common][compression]") {
+    const SharedContent content{make_json_data(100)};
+    const auto compressed{content.compressed()};
+    REQUIRE(compressed);
+    CHECK(compressed->size == content.data().size());
+    // The compressed form is computed just once
+    CHECK(content.compressed() == compressed);
+}
+
+TEST_CASE("SharedContent notifies compression once", "[rpc][common][compression]") {
+    int notifications{0};
+    std::shared_ptr<const SharedContent> content;
+    content = std::make_shared<const SharedContent>(make_json_data(100), [&](const SharedContent& c) {
+        ++notifications;
+        CHECK(c.compressed());
+        CHECK(c.shared_from_this() == content);
+    });
+    CHECK(notifications == 0);
+    REQUIRE(content->compressed());
+    CHECK(notifications == 1);
+    REQUIRE(content->compressed());
+    CHECK(notifications == 1);
+}
+
+}  // namespace silkworm::rpc
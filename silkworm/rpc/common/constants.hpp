@@ -44,4 +44,13 @@ inline constexpr const char* kDefaultEth1ApiSpec{"admin,debug,eth,net,parity,eri
 inline constexpr const char* kDefaultEth2ApiSpec{"engine,eth"};
 inline constexpr const std::chrono::milliseconds kDefaultTimeout{10000};
 
+//! Default number of transactions between the intra-block state checkpoints cached for tracing
+inline constexpr std::size_t kDefaultTraceCheckpointInterval{32};
+
+//! Default number of latest canonical blocks whose fee summaries are kept for eth_gasPrice and eth_feeHistory
+inline constexpr std::size_t kDefaultFeeSummaryBlocks{4096};
+
+//! Default capacity in bytes of the cache of the results of deterministic JSON RPC methods
+inline constexpr std::size_t kDefaultResponseCacheSize{64 * 1024 * 1024};
+
 }  // namespace silkworm
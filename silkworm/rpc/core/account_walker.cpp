@@ -48,9 +48,7 @@ Task<void> AccountWalker::walk_of_accounts(BlockNum block_number, const evmc::ad
         if (cmp < 0) {
             go_on = collector(ps_kv.key, ps_kv.value);
         } else {
-            const auto bitmap = silkworm::db::bitmap::parse(s_kv.value);
-
-            const auto found = silkworm::db::bitmap::seek(bitmap, block_number);
+            const auto found = silkworm::db::bitmap::seek_serialized(s_kv.value, block_number);
             if (found) {
                 const auto block_key{silkworm::db::block_key(found.value())};
                 auto data = co_await acs_cursor->seek_both(block_key, s_kv.key1);
@@ -0,0 +1,68 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_update_queue.hpp"
+
+#include <exception>
+#include <utility>
+
+#include <boost/asio/co_spawn.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc {
+
+BlockUpdateQueue::BlockUpdateQueue(boost::asio::io_context& io_context, std::string name, BlockProcessor processor)
+    : io_context_{io_context}, name_{std::move(name)}, processor_{std::move(processor)} {}
+
+void BlockUpdateQueue::push(BlockNum block_number) {
+    pending_blocks_.push_back(block_number);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    boost::asio::co_spawn(io_context_, run(), [&](const std::exception_ptr& eptr) {
+        running_ = false;
+        if (eptr) {
+            try {
+                std::rethrow_exception(eptr);
+            } catch (const std::exception& e) {
+                SILK_ERROR << name_ << "::run unexpected exception: " << e.what();
+            }
+        }
+    });
+}
+
+void BlockUpdateQueue::on_unwind(BlockNum block_number) {
+    std::erase_if(pending_blocks_, [&](BlockNum pending_block) { return pending_block >= block_number; });
+    ++unwind_count_;
+}
+
+void BlockUpdateQueue::clear() {
+    pending_blocks_.clear();
+    ++unwind_count_;
+}
+
+Task<void> BlockUpdateQueue::run() {
+    while (!pending_blocks_.empty()) {
+        const auto block_number = pending_blocks_.front();
+        pending_blocks_.pop_front();
+
+        co_await processor_(block_number);
+    }
+}
+
+}  // namespace silkworm::rpc
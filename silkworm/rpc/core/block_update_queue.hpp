@@ -0,0 +1,71 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <silkworm/core/common/base.hpp>
+
+namespace silkworm::rpc {
+
+//! BlockUpdateQueue processes the new canonical blocks notified by the state changes one at a time and in order,
+//! keeping track of the unwinds so that the processing can discard what it read across any of them
+class BlockUpdateQueue {
+  public:
+    //! Process one new canonical block
+    using BlockProcessor = std::function<Task<void>(BlockNum)>;
+
+    //! Run \p processor on \p io_context, which must be the scheduler of the state changes notifying new blocks
+    BlockUpdateQueue(boost::asio::io_context& io_context, std::string name, BlockProcessor processor);
+
+    BlockUpdateQueue(const BlockUpdateQueue&) = delete;
+    BlockUpdateQueue& operator=(const BlockUpdateQueue&) = delete;
+
+    //! Schedule the processing of the specified new block
+    void push(BlockNum block_number);
+
+    //! Drop the pending blocks unwound starting from the specified one
+    void on_unwind(BlockNum block_number);
+
+    //! Drop all the pending blocks, e.g. when some unwinds may have been missed
+    void clear();
+
+    //! The number of unwinds (or clears) notified so far: a processor reading a block must discard the results if this
+    //! has changed meanwhile, because the block may have been unwound
+    [[nodiscard]] uint64_t unwind_count() const { return unwind_count_; }
+
+  private:
+    //! Process the pending blocks in order until none is left
+    Task<void> run();
+
+    boost::asio::io_context& io_context_;
+    std::string name_;
+    BlockProcessor processor_;
+
+    std::deque<BlockNum> pending_blocks_;
+    bool running_{false};
+    uint64_t unwind_count_{0};
+};
+
+}  // namespace silkworm::rpc
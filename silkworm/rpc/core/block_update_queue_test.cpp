@@ -0,0 +1,86 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_update_queue.hpp"
+
+#include <functional>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm::rpc {
+
+TEST_CASE("BlockUpdateQueue", "[rpc][core][block_update_queue]") {
+    boost::asio::io_context io_context;
+    std::vector<BlockNum> processed_blocks;
+    std::function<void(BlockNum)> on_process;
+    BlockUpdateQueue queue{io_context, "BlockUpdateQueue_ForTest", [&](BlockNum block_number) -> Task<void> {
+                               processed_blocks.push_back(block_number);
+                               if (on_process) {
+                                   on_process(block_number);
+                               }
+                               co_return;
+                           }};
+    CHECK(queue.unwind_count() == 0);
+
+    SECTION("blocks processed in order") {
+        queue.push(1);
+        queue.push(2);
+        queue.push(3);
+        CHECK(processed_blocks.empty());
+        io_context.run();
+        CHECK(processed_blocks == std::vector<BlockNum>{1, 2, 3});
+
+        // Processing starts again on next push
+        io_context.restart();
+        queue.push(4);
+        io_context.run();
+        CHECK(processed_blocks == std::vector<BlockNum>{1, 2, 3, 4});
+    }
+    SECTION("unwound blocks are dropped") {
+        queue.push(1);
+        queue.push(2);
+        queue.push(3);
+        queue.on_unwind(2);
+        CHECK(queue.unwind_count() == 1);
+        io_context.run();
+        CHECK(processed_blocks == std::vector<BlockNum>{1});
+    }
+    SECTION("unwind while processing") {
+        on_process = [&](BlockNum block_number) {
+            if (block_number == 1 && queue.unwind_count() == 0) {
+                queue.on_unwind(1);
+                queue.push(1);
+            }
+        };
+        queue.push(1);
+        queue.push(2);
+        io_context.run();
+        CHECK(processed_blocks == std::vector<BlockNum>{1, 1});
+        CHECK(queue.unwind_count() == 1);
+    }
+    SECTION("clear drops all the blocks") {
+        queue.push(1);
+        queue.push(2);
+        queue.clear();
+        CHECK(queue.unwind_count() == 1);
+        io_context.run();
+        CHECK(processed_blocks.empty());
+    }
+}
+
+}  // namespace silkworm::rpc
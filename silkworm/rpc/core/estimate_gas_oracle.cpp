@@ -16,12 +16,15 @@
 
 #include "estimate_gas_oracle.hpp"
 
+#include <memory>
 #include <string>
 
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/core/blocks.hpp>
+#include <silkworm/rpc/core/pre_state_cache.hpp>
 
 namespace silkworm::rpc {
 
@@ -80,46 +83,73 @@ Task<intx::uint256> EstimateGasOracle::estimate_gas(const Call& call, const silk
     SILK_DEBUG << "hi: " << hi << ", lo: " << lo << ", cap: " << cap;
 
     auto this_executor = co_await boost::asio::this_coro::executor;
-    auto exec_result = co_await async_task(workers_.executor(), [&]() -> ExecutionResult {
-        auto state = transaction_.create_state(this_executor, storage_, block_number);
+    const auto pre_state = std::make_shared<state::PreStateCache>(transaction_.create_state(this_executor, storage_, block_number));
+    const silkworm::Transaction transaction{call.to_transaction(block.header.base_fee_per_gas)};
+
+    // Execute once at the highest gas limit: if it fails, every lower limit fails too and the search is over; otherwise,
+    // the state accessed by the transaction is now in memory and reused by all the following probes
+    auto result = (co_await try_executions(pre_state, block, transaction, {hi})).front();
+    SILK_DEBUG << "HI == cap tested with " << (result.success() ? "succeed" : "failed");
+    if (!result.success()) {
+        throw_exception(result);
+    }
 
-        ExecutionResult result{evmc_status_code::EVMC_SUCCESS};
-        silkworm::Transaction transaction{call.to_transaction(block.header.base_fee_per_gas)};
-        while (lo + 1 < hi) {
-            EVMExecutor executor{config_, workers_, state};
-            auto mid = (hi + lo) / 2;
-            transaction.gas_limit = mid;
-            result = try_execution(executor, block, transaction);
-            if (result.success()) {
-                hi = mid;
-            } else {
-                if (result.pre_check_error_code && result.pre_check_error_code != PreCheckErrorCode::kIntrinsicGasTooLow) {
-                    result.error_code = evmc_status_code::EVMC_SUCCESS;
-                    return result;
-                }
-                lo = mid;
-            }
-        }
+    while (lo + 1 < hi) {
+        const auto gas_limits = probe_gas_limits(lo, hi, probes_per_round_);
+        auto results = co_await try_executions(pre_state, block, transaction, gas_limits);
 
-        if (hi == cap) {
-            EVMExecutor executor{config_, workers_, state};
-            transaction.gas_limit = hi;
-            result = try_execution(executor, block, transaction);
-            SILK_DEBUG << "HI == cap tested again with " << (result.error_code == evmc_status_code::EVMC_SUCCESS ? "succeed" : "failed");
-        } else if (!result.pre_check_error_code || result.pre_check_error_code == PreCheckErrorCode::kIntrinsicGasTooLow) {
-            result.pre_check_error = std::nullopt;
-            result.error_code = evmc_status_code::EVMC_SUCCESS;
+        // The estimate falls between the highest failing gas limit and the lowest succeeding one
+        uint64_t new_hi = hi;
+        for (std::size_t i{0}; i < gas_limits.size(); ++i) {
+            if (results[i].success()) {
+                new_hi = gas_limits[i];
+                break;
+            }
+            if (results[i].pre_check_error_code && results[i].pre_check_error_code != PreCheckErrorCode::kIntrinsicGasTooLow) {
+                throw_exception(results[i]);
+            }
+            lo = gas_limits[i];
         }
+        hi = new_hi;
+    }
 
-        SILK_DEBUG << "EstimateGasOracle::estimate_gas returns " << hi;
+    SILK_DEBUG << "EstimateGasOracle::estimate_gas returns " << hi;
+    co_return hi;
+}
 
-        return result;
-    });
+std::vector<uint64_t> EstimateGasOracle::probe_gas_limits(uint64_t lo, uint64_t hi, std::size_t count) {
+    // Split (lo, hi) evenly into count + 1 intervals: one probe amounts to the bisection
+    std::vector<uint64_t> gas_limits;
+    gas_limits.reserve(count);
+    const uint64_t range{hi - lo};
+    for (std::size_t i{1}; i <= count; ++i) {
+        const uint64_t gas_limit = lo + range * i / (count + 1);
+        if (gas_limit > lo && gas_limit < hi && (gas_limits.empty() || gas_limit > gas_limits.back())) {
+            gas_limits.push_back(gas_limit);
+        }
+    }
+    return gas_limits;
+}
 
-    if (!exec_result.success()) {
-        throw_exception(exec_result);
+Task<std::vector<ExecutionResult>> EstimateGasOracle::try_executions(const std::shared_ptr<silkworm::State>& state,
+                                                                     const silkworm::Block& block,
+                                                                     const silkworm::Transaction& transaction,
+                                                                     const std::vector<uint64_t>& gas_limits) {
+    std::vector<ExecutionResult> results(gas_limits.size());
+    auto execute = [&](std::size_t index) -> Task<void> {
+        results[index] = co_await async_task(workers_.executor(), [&]() -> ExecutionResult {
+            EVMExecutor executor{config_, workers_, state};
+            silkworm::Transaction probe{transaction};
+            probe.gas_limit = gas_limits[index];
+            return try_execution(executor, block, probe);
+        });
+    };
+    if (gas_limits.size() == 1) {
+        co_await execute(0);
+    } else {
+        co_await concurrency::generate_parallel_group_task(gas_limits.size(), execute);
     }
-    co_return hi;
+    co_return results;
 }
 
 ExecutionResult EstimateGasOracle::try_execution(EVMExecutor& executor, const silkworm::Block& block, const silkworm::Transaction& transaction) {
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -39,6 +42,9 @@ namespace silkworm::rpc {
 const std::uint64_t kTxGas = 21'000;
 const std::uint64_t kGasCap = 50'000'000;
 
+//! Number of gas limits probed concurrently in each round of the gas estimation search served by eth_estimateGas
+inline constexpr std::size_t kEstimateGasProbesPerRound{3};
+
 using BlockHeaderProvider = std::function<Task<std::optional<silkworm::BlockHeader>>(uint64_t)>;
 using AccountReader = std::function<Task<std::optional<silkworm::Account>>(const evmc::address&, uint64_t)>;
 
@@ -81,24 +87,37 @@ class EstimateGasOracle {
                                const silkworm::ChainConfig& config,
                                WorkerPool& workers,
                                db::kv::api::Transaction& tx,
-                               const ChainStorage& chain_storage)
+                               const ChainStorage& chain_storage,
+                               std::size_t probes_per_round = 1)
         : block_header_provider_(block_header_provider),
           account_reader_{account_reader},
           config_{config},
           workers_{workers},
           transaction_{tx},
-          storage_{chain_storage} {}
+          storage_{chain_storage},
+          probes_per_round_{std::max<std::size_t>(probes_per_round, 1)} {}
     virtual ~EstimateGasOracle() = default;
 
     EstimateGasOracle(const EstimateGasOracle&) = delete;
     EstimateGasOracle& operator=(const EstimateGasOracle&) = delete;
 
+    //! Estimate the gas needed by \p call searching the gas limit range by executing the call at several gas limits.
+    //! The call is executed first at the highest gas limit, which records the accessed state in memory for the following
+    //! executions; then each round probes the configured number of gas limits concurrently (one probe is a bisection).
     Task<intx::uint256> estimate_gas(const Call& call, const silkworm::Block& latest_block);
 
   protected:
     virtual ExecutionResult try_execution(EVMExecutor& executor, const silkworm::Block& _block, const silkworm::Transaction& transaction);
 
   private:
+    //! \return up to \p count distinct gas limits evenly spaced within the open range (lo, hi), in ascending order
+    static std::vector<uint64_t> probe_gas_limits(uint64_t lo, uint64_t hi, std::size_t count);
+
+    Task<std::vector<ExecutionResult>> try_executions(const std::shared_ptr<silkworm::State>& state,
+                                                      const silkworm::Block& block,
+                                                      const silkworm::Transaction& transaction,
+                                                      const std::vector<uint64_t>& gas_limits);
+
     void throw_exception(ExecutionResult& result);
 
     const BlockHeaderProvider& block_header_provider_;
@@ -107,6 +126,7 @@ class EstimateGasOracle {
     WorkerPool& workers_;
     db::kv::api::Transaction& transaction_;
     const ChainStorage& storage_;
+    std::size_t probes_per_round_;
 };
 
 }  // namespace silkworm::rpc
@@ -51,6 +51,7 @@ struct RemoteDatabaseTest : db::test_util::KVTestBase {
 };
 
 using testing::_;
+using testing::Invoke;
 using testing::Return;
 
 TEST_CASE("EstimateGasException") {
@@ -109,11 +110,12 @@ TEST_CASE("estimate gas") {
     const db::chain::RemoteChainStorage storage{*tx, ethdb::kv::block_provider(&backend), ethdb::kv::block_number_from_txn_hash_provider(&backend)};
     MockEstimateGasOracle estimate_gas_oracle{block_header_provider, account_reader, config, workers, *tx, storage};
 
-    SECTION("Call empty, always fails but success in last step") {
+    SECTION("Call empty, succeeds at cap and always fails but success in last step") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(16)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -138,7 +140,7 @@ TEST_CASE("estimate gas") {
 
     SECTION("Call empty, always succeeds") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
-        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(14).WillRepeatedly(Return(expect_result_ok));
+        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(15).WillRepeatedly(Return(expect_result_ok));
         auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
         const intx::uint256& estimate_gas = result.get();
         CHECK(estimate_gas == kTxGas);
@@ -148,7 +150,8 @@ TEST_CASE("estimate gas") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-            .Times(14)
+            .Times(15)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
@@ -173,7 +176,8 @@ TEST_CASE("estimate gas") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-            .Times(14)
+            .Times(15)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_ok))
@@ -201,7 +205,8 @@ TEST_CASE("estimate gas") {
             .pre_check_error_code = PreCheckErrorCode::kIntrinsicGasTooLow};
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-            .Times(14)
+            .Times(15)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail_pre_check))
             .WillOnce(Return(expect_result_ok))
@@ -222,12 +227,13 @@ TEST_CASE("estimate gas") {
         CHECK(estimate_gas == 0x6d5e);
     }
 
-    SECTION("Call with gas, always fails but succes last step") {
+    SECTION("Call with gas, succeeds at cap and always fails but success in last step") {
         call.gas = kTxGas * 4;
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(17)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -255,7 +261,7 @@ TEST_CASE("estimate gas") {
         call.gas = kTxGas * 4;
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-            .Times(15)
+            .Times(16)
             .WillRepeatedly(Return(expect_result_ok));
         auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
         const intx::uint256& estimate_gas = result.get();
@@ -271,6 +277,7 @@ TEST_CASE("estimate gas") {
 
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(16)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -301,6 +308,7 @@ TEST_CASE("estimate gas") {
 
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(13)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -329,6 +337,7 @@ TEST_CASE("estimate gas") {
 
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(16)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -360,6 +369,7 @@ TEST_CASE("estimate gas") {
 
         EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
             .Times(13)
+            .WillOnce(Return(expect_result_ok))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
             .WillOnce(Return(expect_result_fail))
@@ -382,7 +392,7 @@ TEST_CASE("estimate gas") {
     SECTION("Call gas above allowance, always succeeds, gas capped") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         call.gas = kGasCap * 2;
-        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(25).WillRepeatedly(Return(expect_result_ok));
+        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(26).WillRepeatedly(Return(expect_result_ok));
         auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
         const intx::uint256& estimate_gas = result.get();
 
@@ -393,19 +403,34 @@ TEST_CASE("estimate gas") {
         ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         call.gas = kTxGas / 2;
 
-        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(14).WillRepeatedly(Return(expect_result_ok));
+        EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(15).WillRepeatedly(Return(expect_result_ok));
         auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
         const intx::uint256& estimate_gas = result.get();
 
         CHECK(estimate_gas == kTxGas);
     }
 
-    SECTION("Call with too high value, exception") {
+    SECTION("Call with several probes per round") {
+        MockEstimateGasOracle k_ary_oracle{block_header_provider, account_reader, config, workers, *tx, storage, /*probes_per_round=*/3};
+        ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
+        ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
+        EXPECT_CALL(k_ary_oracle, try_execution(_, _, _))
+            .Times(23)
+            .WillRepeatedly(Invoke([&](EVMExecutor&, const silkworm::Block&, const silkworm::Transaction& txn) {
+                return txn.gas_limit >= 30'000 ? expect_result_ok : expect_result_fail;
+            }));
+        auto result = boost::asio::co_spawn(pool, k_ary_oracle.estimate_gas(call, block), boost::asio::use_future);
+        const intx::uint256& estimate_gas = result.get();
+
+        CHECK(estimate_gas == 30'000);
+    }
+
+    SECTION("Call with too high value, exception at cap") {
         ExecutionResult expect_result_fail{.error_code = evmc_status_code::EVMC_OUT_OF_GAS};
         call.value = intx::uint256{2'000'000'000};
 
         try {
-            EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(16).WillRepeatedly(Return(expect_result_fail));
+            EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _)).Times(1).WillRepeatedly(Return(expect_result_fail));
             auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
             result.get();
             CHECK(false);
@@ -419,6 +444,7 @@ TEST_CASE("estimate gas") {
     }
 
     SECTION("Call fail, try exception") {
+        ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail_pre_check{
             .pre_check_error = "insufficient funds",
             .pre_check_error_code = PreCheckErrorCode::kInsufficientFunds};
@@ -429,7 +455,8 @@ TEST_CASE("estimate gas") {
 
         try {
             EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-                .Times(2)
+                .Times(3)
+                .WillOnce(Return(expect_result_ok))
                 .WillOnce(Return(expect_result_fail))
                 .WillRepeatedly(Return(expect_result_fail_pre_check));
             auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
@@ -446,6 +473,7 @@ TEST_CASE("estimate gas") {
 
     SECTION("Call fail, try exception with data") {
         auto data = *silkworm::from_hex("2ac3c1d3e24b45c6c310534bc2dd84b5ed576335");
+        ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail_pre_check{
             .pre_check_error = "insufficient funds",
             .pre_check_error_code = PreCheckErrorCode::kInsufficientFunds};
@@ -456,7 +484,8 @@ TEST_CASE("estimate gas") {
 
         try {
             EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-                .Times(2)
+                .Times(3)
+                .WillOnce(Return(expect_result_ok))
                 .WillOnce(Return(expect_result_fail))
                 .WillRepeatedly(Return(expect_result_fail_pre_check));
             auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
@@ -472,6 +501,7 @@ TEST_CASE("estimate gas") {
     }
 
     SECTION("Call fail-EVMC_INVALID_INSTRUCTION, try exception") {
+        ExecutionResult expect_result_ok{.error_code = evmc_status_code::EVMC_SUCCESS};
         ExecutionResult expect_result_fail_pre_check{
             .pre_check_error = "insufficient funds",
             .pre_check_error_code = PreCheckErrorCode::kInsufficientFunds};
@@ -482,7 +512,8 @@ TEST_CASE("estimate gas") {
 
         try {
             EXPECT_CALL(estimate_gas_oracle, try_execution(_, _, _))
-                .Times(2)
+                .Times(3)
+                .WillOnce(Return(expect_result_ok))
                 .WillOnce(Return(expect_result_fail))
                 .WillRepeatedly(Return(expect_result_fail_pre_check));
             auto result = boost::asio::co_spawn(pool, estimate_gas_oracle.estimate_gas(call, block), boost::asio::use_future);
@@ -16,6 +16,7 @@
 
 #include "evm_debug.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -27,10 +28,12 @@
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/common/util.hpp>
 #include <silkworm/rpc/core/cached_chain.hpp>
 #include <silkworm/rpc/core/evm_executor.hpp>
+#include <silkworm/rpc/core/state_checkpoint.hpp>
 #include <silkworm/rpc/json/types.hpp>
 
 namespace silkworm::rpc::debug {
@@ -480,12 +483,16 @@ Task<void> DebugExecutor::execute(
     const auto chain_config = co_await storage.read_chain_config();
     auto current_executor = co_await boost::asio::this_coro::executor;
     co_await async_task(workers_.executor(), [&]() {
-        auto state = tx_.create_state(current_executor, storage, block_number);
-        EVMExecutor executor{chain_config, workers_, state};
-
-        for (auto idx{0}; idx < index; idx++) {
-            silkworm::Transaction txn{block.transactions[std::size_t(idx)]};
+        // Checkpoints are valid only when replaying a block transaction on top of the state at the beginning of the block
+        auto* checkpoint_cache = index != -1 ? use_shared_service<state::StateCheckpointCache>(workers_) : nullptr;
+        const auto txn_index = static_cast<std::size_t>(std::max(index, 0));
+        state::CheckpointedReplay replay{checkpoint_cache, block, tx_.create_state(current_executor, storage, block_number), txn_index};
+        EVMExecutor executor{chain_config, workers_, replay.state()};
+
+        for (auto idx{replay.first_index()}; idx < txn_index; idx++) {
+            silkworm::Transaction txn{block.transactions[idx]};
             executor.call(block, txn);
+            replay.on_executed(idx, executor.get_ibs_state());
         }
         executor.reset();
 
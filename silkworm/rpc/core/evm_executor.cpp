@@ -19,6 +19,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <evmc/evmc.hpp>
 #include <intx/intx.hpp>
@@ -28,6 +29,7 @@
 #include <silkworm/core/protocol/intrinsic_gas.hpp>
 #include <silkworm/core/protocol/param.hpp>
 #include <silkworm/core/types/address.hpp>
+#include <silkworm/db/state/remote_state.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/common/util.hpp>
@@ -190,6 +192,28 @@ void EVMExecutor::reset() {
     ibs_state_.clear_journal_and_substate();
 }
 
+//! The execution contexts released by the executors on each thread
+static thread_local std::vector<std::unique_ptr<ExecutionContext>> pooled_contexts;
+
+void ExecutionContextRecycler::operator()(ExecutionContext* context) const noexcept {
+    std::unique_ptr<ExecutionContext> owned_context{context};
+    if (pooled_contexts.size() < kMaxPooledExecutionContexts) {
+        // Drop the references to the state of the finished execution right away
+        owned_context->ibs_state.reset(owned_context->ibs_state.db());
+        pooled_contexts.push_back(std::move(owned_context));
+    }
+}
+
+ExecutionContextPtr EVMExecutor::acquire_context(State& state) {
+    if (pooled_contexts.empty()) {
+        return ExecutionContextPtr{new ExecutionContext{state}};
+    }
+    ExecutionContextPtr context{pooled_contexts.back().release()};
+    pooled_contexts.pop_back();
+    context->ibs_state.reset(state);
+    return context;
+}
+
 std::optional<EVMExecutor::PreCheckResult> EVMExecutor::pre_check(const EVM& evm, const silkworm::Transaction& txn,
                                                                   const intx::uint256& base_fee_per_gas, const intx::uint128& g0) {
     const evmc_revision rev{evm.revision()};
@@ -239,10 +263,9 @@ ExecutionResult EVMExecutor::call(
     SILK_DEBUG << "EVMExecutor::call: blockNumber: " << block.header.number << " gasLimit: " << txn.gas_limit << " refund: " << refund << " gasBailout: " << gas_bailout;
     SILK_DEBUG << "EVMExecutor::call: transaction: " << rpc::Transaction{txn};
 
-    auto& svc = use_service<AnalysisCacheService>(workers_);
     EVM evm{block, ibs_state_, config_, gas_bailout};
-    evm.analysis_cache = svc.get_analysis_cache();
-    evm.state_pool = svc.get_object_pool();
+    evm.analysis_cache = analysis_cache_;
+    evm.state_pool = &context_->state_pool;
     evm.beneficiary = rule_set_->get_beneficiary(block.header);
 
     for (auto& tracer : tracers) {
@@ -362,8 +385,19 @@ Task<ExecutionResult> EVMExecutor::call(
     bool refund,
     bool gas_bailout) {
     auto this_executor = co_await boost::asio::this_coro::executor;
+    auto state = state_factory(this_executor, block.header.number, chain_storage);
+    if (auto remote_state = std::dynamic_pointer_cast<db::state::RemoteState>(state)) {
+        // Load the accounts touched by any call asynchronously here instead of blocking on each read in the worker
+        std::vector<evmc::address> addresses{block.header.beneficiary};
+        if (txn.sender()) {
+            addresses.push_back(*txn.sender());
+        }
+        if (txn.to) {
+            addresses.push_back(*txn.to);
+        }
+        co_await remote_state->prefetch(addresses, txn.access_list);
+    }
     const auto execution_result = co_await async_task(workers.executor(), [&]() -> ExecutionResult {
-        auto state = state_factory(this_executor, block.header.number, chain_storage);
         EVMExecutor executor{config, workers, state};
         return executor.call(block, txn, tracers, refund, gas_bailout);
     });
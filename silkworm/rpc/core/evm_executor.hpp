@@ -64,25 +64,44 @@ struct ExecutionResult {
     std::string error_message(bool full_error = true) const;
 };
 
-constexpr int kCacheSize = 32000;
+constexpr std::size_t kAnalysisCacheCapacity{256_Mebi};
 
 template <typename T>
 using ServiceBase = boost::asio::detail::execution_context_service_base<T>;
 
+//! Code analysis cache keyed by code hash shared by all the workers, whose shards limit the lock contention among them
 class AnalysisCacheService : public ServiceBase<AnalysisCacheService> {
   public:
     explicit AnalysisCacheService(boost::asio::execution_context& owner)
         : ServiceBase<AnalysisCacheService>(owner) {}
 
     void shutdown() override {}
-    ObjectPool<evmone::ExecutionState>* get_object_pool() { return &state_pool_; }
     AnalysisCache* get_analysis_cache() { return &analysis_cache_; }
 
   private:
-    ObjectPool<evmone::ExecutionState> state_pool_{true};
-    AnalysisCache analysis_cache_{kCacheSize, true};
+    AnalysisCache analysis_cache_{kAnalysisCacheCapacity};
 };
 
+//! \brief Resettable EVM execution context reused across the executions happening on the same thread.
+//! \details The intra-block state keeps the allocated capacity of its containers and the evmone execution states are
+//! recycled with no locking, because a context is owned by one executor at a time.
+struct ExecutionContext {
+    explicit ExecutionContext(State& state) : ibs_state{state} {}
+
+    IntraBlockState ibs_state;
+    ObjectPool<evmone::ExecutionState> state_pool;
+};
+
+//! Give back the execution context to the pool of the current thread when the executor is done with it
+struct ExecutionContextRecycler {
+    void operator()(ExecutionContext* context) const noexcept;
+};
+
+using ExecutionContextPtr = std::unique_ptr<ExecutionContext, ExecutionContextRecycler>;
+
+//! Max number of execution contexts kept by each thread, i.e. of executors alive at the same time on the same thread
+constexpr std::size_t kMaxPooledExecutionContexts{4};
+
 using db::chain::ChainStorage;
 using Tracers = std::vector<std::shared_ptr<EvmTracer>>;
 
@@ -106,12 +125,11 @@ class EVMExecutor {
         : config_(config),
           workers_{workers},
           state_{std::move(state)},
-          ibs_state_{*state_},
+          context_{acquire_context(*state_)},
+          ibs_state_{context_->ibs_state},
+          analysis_cache_{use_service<AnalysisCacheService>(workers_).get_analysis_cache()},
           rule_set_{protocol::rule_set_factory(config)} {
         SILKWORM_ASSERT(rule_set_);
-        if (!has_service<AnalysisCacheService>(workers_)) {
-            make_service<AnalysisCacheService>(workers_);
-        }
     }
     virtual ~EVMExecutor() = default;
 
@@ -129,7 +147,7 @@ class EVMExecutor {
 
     void call_first_n(const silkworm::Block& block, uint64_t n, const Tracers& tracers = {}, bool refund = true, bool gas_bailout = false);
 
-    const IntraBlockState& get_ibs_state() { return ibs_state_; }
+    IntraBlockState& get_ibs_state() { return ibs_state_; }
 
   private:
     struct PreCheckResult {
@@ -140,10 +158,15 @@ class EVMExecutor {
                                                    const intx::uint256& base_fee_per_gas, const intx::uint128& g0);
     uint64_t refund_gas(const EVM& evm, const silkworm::Transaction& txn, uint64_t gas_left, uint64_t gas_refund);
 
+    //! Take an execution context from the pool of the current thread (or a new one) bound to \p state
+    static ExecutionContextPtr acquire_context(State& state);
+
     const silkworm::ChainConfig& config_;
     WorkerPool& workers_;
     std::shared_ptr<State> state_;
-    IntraBlockState ibs_state_;
+    ExecutionContextPtr context_;
+    IntraBlockState& ibs_state_;
+    AnalysisCache* analysis_cache_;
     protocol::RuleSetPtr rule_set_;
 };
 
@@ -0,0 +1,90 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <bit>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <ethash/keccak.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+#include <silkworm/rpc/common/worker_pool.hpp>
+
+#include "evm_executor.hpp"
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address;
+
+static const evmc::address kSender{0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address};
+static const evmc::address kContract{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+
+//! Contract code reading the storage slots from 0 to \p num_slots - 1
+static Bytes make_sload_code(uint8_t num_slots) {
+    Bytes code;
+    for (uint8_t slot{0}; slot < num_slots; ++slot) {
+        code.append({0x60, slot, 0x54, 0x50});  // PUSH1 slot SLOAD POP
+    }
+    code.push_back(0x00);  // STOP
+    return code;
+}
+
+//! Execute one eth_call-like transaction per iteration touching state.range(0) storage slots
+static void benchmark_evm_executor_call(benchmark::State& state) {
+    const auto num_slots = static_cast<uint8_t>(state.range(0));
+
+    auto in_memory_state = std::make_shared<InMemoryState>();
+    const Bytes code{make_sload_code(num_slots)};
+    const auto code_hash{std::bit_cast<evmc_bytes32>(keccak256(code))};
+    in_memory_state->update_account(kSender, std::nullopt, Account{.balance = 1'000'000'000});
+    in_memory_state->update_account(kContract, std::nullopt, Account{.code_hash = code_hash, .incarnation = kDefaultIncarnation});
+    in_memory_state->update_account_code(kContract, kDefaultIncarnation, code_hash, code);
+    for (uint8_t slot{0}; slot < num_slots; ++slot) {
+        evmc::bytes32 location{};
+        location.bytes[31] = slot;
+        evmc::bytes32 value{};
+        value.bytes[31] = 1;
+        in_memory_state->update_storage(kContract, kDefaultIncarnation, location, {}, value);
+    }
+
+    Block block;
+    block.header.number = 20'000'000;
+    block.header.timestamp = 1'720'000'000;
+    block.header.gas_limit = 30'000'000;
+    block.header.base_fee_per_gas = 0;
+    block.header.excess_blob_gas = 0;
+    Transaction txn;
+    txn.type = TransactionType::kDynamicFee;
+    txn.to = kContract;
+    txn.gas_limit = 10'000'000;
+    txn.set_sender(kSender);
+
+    WorkerPool workers{1};
+    for ([[maybe_unused]] auto _ : state) {
+        EVMExecutor executor{kMainnetConfig, workers, in_memory_state};
+        const auto result = executor.call(block, txn);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(benchmark_evm_executor_call)->Arg(1);
+BENCHMARK(benchmark_evm_executor_call)->Arg(16);
+BENCHMARK(benchmark_evm_executor_call)->Arg(128);
+
+}  // namespace silkworm::rpc
@@ -25,6 +25,7 @@
 #include <evmc/evmc.hpp>
 #include <gmock/gmock.h>
 
+#include <silkworm/core/state/in_memory_state.hpp>
 #include <silkworm/db/chain/remote_chain_storage.hpp>
 #include <silkworm/db/kv/api/endpoint/key_value.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
@@ -128,8 +129,8 @@ TEST_CASE_METHOD(EVMExecutorTest, "EVMExecutor") {
     }
 
     SECTION("doesn't fail if transaction cost greater user amount && gasBailout == true") {
-        EXPECT_CALL(transaction, get(_, _)).Times(7).WillRepeatedly(InvokeWithoutArgs([]() -> Task<KeyValue> { co_return KeyValue{}; }));
-        EXPECT_CALL(transaction, get_one(_, _)).Times(7).WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> { co_return Bytes{}; }));
+        EXPECT_CALL(transaction, get(_, _)).Times(3).WillRepeatedly(InvokeWithoutArgs([]() -> Task<KeyValue> { co_return KeyValue{}; }));
+        EXPECT_CALL(transaction, get_one(_, _)).Times(3).WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> { co_return Bytes{}; }));
 
         silkworm::Block block{};
         block.header.base_fee_per_gas = 0x1;
@@ -155,8 +156,8 @@ TEST_CASE_METHOD(EVMExecutorTest, "EVMExecutor") {
     };
 
     SECTION("call returns SUCCESS") {
-        EXPECT_CALL(transaction, get(_, _)).Times(6).WillRepeatedly(InvokeWithoutArgs([]() -> Task<KeyValue> { co_return KeyValue{}; }));
-        EXPECT_CALL(transaction, get_one(_, _)).Times(6).WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> { co_return Bytes{}; }));
+        EXPECT_CALL(transaction, get(_, _)).Times(3).WillRepeatedly(InvokeWithoutArgs([]() -> Task<KeyValue> { co_return KeyValue{}; }));
+        EXPECT_CALL(transaction, get_one(_, _)).Times(3).WillRepeatedly(InvokeWithoutArgs([]() -> Task<Bytes> { co_return Bytes{}; }));
 
         silkworm::Block block{};
         block.header.number = block_number;
@@ -305,4 +306,30 @@ TEST_CASE_METHOD(EVMExecutorTest, "EVMExecutor") {
 }
 #endif  // SILKWORM_SANITIZE
 
+TEST_CASE("EVMExecutor reuses the execution contexts of the current thread", "[rpc][core][evm_executor]") {
+    WorkerPool workers{1};
+    auto state1 = std::make_shared<InMemoryState>();
+    auto state2 = std::make_shared<InMemoryState>();
+    const evmc::address address{0xa872626373628737383927236382161739290870_address};
+    state2->update_account(address, std::nullopt, Account{.balance = 100});
+
+    IntraBlockState* ibs_state{nullptr};
+    {
+        EVMExecutor executor{kMainnetConfig, workers, state1};
+        ibs_state = &executor.get_ibs_state();
+        executor.get_ibs_state().set_balance(address, 1'000);
+    }
+    {
+        EVMExecutor executor{kMainnetConfig, workers, state2};
+        CHECK(&executor.get_ibs_state() == ibs_state);
+        CHECK(&executor.get_ibs_state().db() == state2.get());
+        CHECK(executor.get_ibs_state().get_balance(address) == 100);
+
+        // Executors alive at the same time do not share their context
+        EVMExecutor nested_executor{kMainnetConfig, workers, state1};
+        CHECK(&nested_executor.get_ibs_state() != ibs_state);
+        CHECK(nested_executor.get_ibs_state().get_balance(address) == 0);
+    }
+}
+
 }  // namespace silkworm::rpc
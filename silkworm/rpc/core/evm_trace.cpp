@@ -17,6 +17,7 @@
 #include "evm_trace.hpp"
 
 #include <algorithm>
+#include <exception>
 #include <memory>
 #include <set>
 #include <stack>
@@ -35,9 +36,12 @@
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/common/util.hpp>
 #include <silkworm/rpc/core/cached_chain.hpp>
+#include <silkworm/rpc/core/state_checkpoint.hpp>
 #include <silkworm/rpc/json/call.hpp>
 #include <silkworm/rpc/json/types.hpp>
 
@@ -1206,6 +1210,22 @@ void IntraBlockStateTracer::on_reward_granted(const silkworm::CallResult& result
 
 Task<std::vector<Trace>> TraceCallExecutor::trace_block(const BlockWithHash& block_with_hash, Filter& filter, json::Stream* stream) {
     std::vector<Trace> traces;
+    auto block_traces = co_await collect_block_traces(block_with_hash, filter);
+    filter_block_traces(block_traces, filter, [&](Trace&& trace) {
+        if (stream != nullptr) {
+            stream->write_json(trace);
+        } else {
+            traces.push_back(std::move(trace));
+        }
+    });
+    co_return traces;
+}
+
+Task<TraceCallExecutor::BlockTraces> TraceCallExecutor::collect_block_traces(const BlockWithHash& block_with_hash, const Filter& filter) {
+    BlockTraces block_traces;
+
+    // Neither more traces than the ones skipped plus the ones returned nor the rewards are needed after reaching the count
+    const auto max_traces{static_cast<std::size_t>(filter.after) + filter.count};
 
     const TraceConfig trace_block_config{
         .vm_trace = false,
@@ -1221,6 +1241,9 @@ Task<std::vector<Trace>> TraceCallExecutor::trace_block(const BlockWithHash& blo
         const auto& call_traces = trace_call_result.traces.trace;
 
         for (const auto& call_trace : call_traces) {
+            if (block_traces.transaction_traces.size() == max_traces) {
+                co_return block_traces;
+            }
             Trace trace{call_trace};
             bool skip = !(filter.from_addresses.empty() && filter.to_addresses.empty());
 
@@ -1238,85 +1261,83 @@ Task<std::vector<Trace>> TraceCallExecutor::trace_block(const BlockWithHash& blo
                 }
             }
             if (!skip) {
-                if (filter.after > 0) {
-                    filter.after--;
-                } else {
-                    trace.block_number = block_with_hash.block.header.number;
-                    trace.block_hash = block_with_hash.hash;
-                    trace.transaction_position = pos;
-                    trace.transaction_hash = tnx_hash;
-
-                    if (stream != nullptr) {
-                        stream->write_json(trace);
-                    } else {
-                        traces.push_back(trace);
-                    }
-                    filter.count--;
-                }
-            }
-            if (filter.count == 0) {
-                break;
+                trace.block_number = block_with_hash.block.header.number;
+                trace.block_hash = block_with_hash.hash;
+                trace.transaction_position = pos;
+                trace.transaction_hash = tnx_hash;
+                block_traces.transaction_traces.push_back(std::move(trace));
             }
         }
-        if (filter.count == 0) {
-            break;
-        }
     }
 
     if (!filter.from_addresses.empty() || !filter.to_addresses.empty()) {
-        co_return traces;
+        co_return block_traces;
     }
 
     const auto chain_config = co_await chain_storage_.read_chain_config();
     const auto rule_set_factory = protocol::rule_set_factory(chain_config);
     const auto block_rewards = rule_set_factory->compute_reward(block_with_hash.block);
 
-    if (filter.count > 0 && filter.after == 0) {
-        if (block_rewards.miner) {
-            RewardAction action;
-            action.author = block_with_hash.block.header.beneficiary;
-            action.reward_type = "block";
-            action.value = block_rewards.miner;
-
-            Trace trace;
-            trace.block_number = block_with_hash.block.header.number;
-            trace.block_hash = block_with_hash.hash;
-            trace.type = "reward";
-            trace.action = action;
-
-            if (stream != nullptr) {
-                stream->write_json(trace);
-            } else {
-                traces.push_back(trace);
-            }
+    auto& reward_traces = block_traces.reward_traces.emplace();
+    if (block_rewards.miner) {
+        RewardAction action;
+        action.author = block_with_hash.block.header.beneficiary;
+        action.reward_type = "block";
+        action.value = block_rewards.miner;
+
+        Trace trace;
+        trace.block_number = block_with_hash.block.header.number;
+        trace.block_hash = block_with_hash.hash;
+        trace.type = "reward";
+        trace.action = action;
+        reward_traces.push_back(std::move(trace));
+    }
+
+    std::size_t index{0};
+    for (auto& ommer_reward : block_rewards.ommers) {
+        RewardAction action;
+        action.author = block_with_hash.block.ommers[index].beneficiary;
+        action.reward_type = "uncle";
+        action.value = ommer_reward;
+
+        Trace trace;
+        trace.block_number = block_with_hash.block.header.number;
+        trace.block_hash = block_with_hash.hash;
+        trace.type = "reward";
+        trace.action = action;
+        reward_traces.push_back(std::move(trace));
+    }
+
+    co_return block_traces;
+}
+
+void TraceCallExecutor::filter_block_traces(BlockTraces& block_traces, Filter& filter, absl::FunctionRef<void(Trace&&)> emit) {
+    for (auto& trace : block_traces.transaction_traces) {
+        if (filter.after > 0) {
+            filter.after--;
+        } else {
+            emit(std::move(trace));
+            filter.count--;
         }
+        if (filter.count == 0) {
+            break;
+        }
+    }
 
-        std::size_t index{0};
-        for (auto& ommer_reward : block_rewards.ommers) {
-            RewardAction action;
-            action.author = block_with_hash.block.ommers[index].beneficiary;
-            action.reward_type = "uncle";
-            action.value = ommer_reward;
-
-            Trace trace;
-            trace.block_number = block_with_hash.block.header.number;
-            trace.block_hash = block_with_hash.hash;
-            trace.type = "reward";
-            trace.action = action;
-
-            if (stream != nullptr) {
-                stream->write_json(trace);
-            } else {
-                traces.push_back(trace);
-            }
+    if (!block_traces.reward_traces) {
+        return;
+    }
+
+    // Block and ommer rewards count as one single item
+    if (filter.count > 0 && filter.after == 0) {
+        for (auto& trace : *block_traces.reward_traces) {
+            emit(std::move(trace));
         }
         filter.count--;
     } else if (filter.after > 0) {
-        if (block_rewards.miner || !block_rewards.ommers.empty())
+        if (!block_traces.reward_traces->empty())
             filter.after--;
     }
-
-    co_return traces;
 }
 
 Task<std::vector<TraceCallResult>> TraceCallExecutor::trace_block_transactions(const silkworm::Block& block, const TraceConfig& config) {
@@ -1512,10 +1533,14 @@ Task<TraceEntriesResult> TraceCallExecutor::trace_transaction_entries(const Tran
     const auto trace_result = co_await async_task(workers_.executor(), [&]() -> TraceEntriesResult {
         auto state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
         silkworm::IntraBlockState initial_ibs{*state};
-        auto curr_state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
-        EVMExecutor executor{chain_config, workers_, curr_state};
-
-        executor.call_first_n(block, transaction_with_block.transaction.transaction_index);
+        const auto txn_index = transaction_with_block.transaction.transaction_index;
+        state::CheckpointedReplay replay{use_shared_service<state::StateCheckpointCache>(workers_), block,
+                                         tx_.create_state(current_executor, chain_storage_, block_number - 1), txn_index};
+        EVMExecutor executor{chain_config, workers_, replay.state()};
+        for (std::size_t idx{replay.first_index()}; idx < txn_index; idx++) {
+            executor.call(block, block.transactions[idx]);
+            replay.on_executed(idx, executor.get_ibs_state());
+        }
 
         const auto entry_tracer = std::make_shared<trace::EntryTracer>(initial_ibs);
         Tracers tracers{entry_tracer};
@@ -1538,10 +1563,14 @@ Task<std::string> TraceCallExecutor::trace_transaction_error(const TransactionWi
         auto state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
         silkworm::IntraBlockState initial_ibs{*state};
 
-        auto curr_state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
-        EVMExecutor executor{chain_config, workers_, curr_state};
-
-        executor.call_first_n(block, transaction_with_block.transaction.transaction_index);
+        const auto txn_index = transaction_with_block.transaction.transaction_index;
+        state::CheckpointedReplay replay{use_shared_service<state::StateCheckpointCache>(workers_), block,
+                                         tx_.create_state(current_executor, chain_storage_, block_number - 1), txn_index};
+        EVMExecutor executor{chain_config, workers_, replay.state()};
+        for (std::size_t idx{replay.first_index()}; idx < txn_index; idx++) {
+            executor.call(block, block.transactions[idx]);
+            replay.on_executed(idx, executor.get_ibs_state());
+        }
 
         const auto& txn = block.transactions.at(transaction_with_block.transaction.transaction_index);
         auto execution_result = executor.call(block, txn, {}, /*refund=*/true, /*gas_bailout=*/false);
@@ -1566,10 +1595,14 @@ Task<TraceOperationsResult> TraceCallExecutor::trace_operations(const Transactio
         auto state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
         silkworm::IntraBlockState initial_ibs{*state};
 
-        auto curr_state = tx_.create_state(current_executor, chain_storage_, block_number - 1);
-        EVMExecutor executor{chain_config, workers_, curr_state};
-
-        executor.call_first_n(block, transaction_with_block.transaction.transaction_index);
+        const auto txn_index = transaction_with_block.transaction.transaction_index;
+        state::CheckpointedReplay replay{use_shared_service<state::StateCheckpointCache>(workers_), block,
+                                         tx_.create_state(current_executor, chain_storage_, block_number - 1), txn_index};
+        EVMExecutor executor{chain_config, workers_, replay.state()};
+        for (std::size_t idx{replay.first_index()}; idx < txn_index; idx++) {
+            executor.call(block, block.transactions[idx]);
+            replay.on_executed(idx, executor.get_ibs_state());
+        }
 
         auto entry_tracer = std::make_shared<trace::OperationTracer>(initial_ibs);
         Tracers tracers{entry_tracer};
@@ -1618,7 +1651,8 @@ Task<bool> TraceCallExecutor::trace_touch_block(const silkworm::BlockWithHash& b
     co_return result;
 }
 
-Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream& stream) {
+Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream& stream,
+                                           const TransactionFactory& tx_factory) {
     SILK_TRACE << "TraceCallExecutor::trace_filter: filter " << trace_filter;
 
     const auto from_block_with_hash = co_await core::read_block_by_number_or_hash(block_cache_, storage, tx_, trace_filter.from_block);
@@ -1650,6 +1684,13 @@ Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, cons
     filter.after = trace_filter.after;
     filter.count = trace_filter.count;
 
+    if (tx_factory) {
+        co_await trace_block_range(from_block_with_hash->block.header.number, to_block_with_hash->block.header.number,
+                                   filter, stream, tx_factory);
+        stream.close_array();
+        co_return;
+    }
+
     auto block_number = from_block_with_hash->block.header.number;
     auto block_with_hash = from_block_with_hash;
     while (block_number++ <= to_block_with_hash->block.header.number) {
@@ -1678,6 +1719,56 @@ Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, cons
     co_return;
 }
 
+Task<void> TraceCallExecutor::trace_block_range(BlockNum from_block_number, BlockNum to_block_number, Filter& filter,
+                                                json::Stream& stream, const TransactionFactory& tx_factory) {
+    std::vector<std::optional<BlockTraces>> window_traces;
+    std::size_t window_size{1};
+    for (BlockNum first_block_number{from_block_number}; first_block_number <= to_block_number;) {
+        const auto size = static_cast<std::size_t>(std::min<BlockNum>(window_size, to_block_number - first_block_number + 1));
+        SILK_TRACE << "TraceCallExecutor::trace_block_range: tracing blocks " << first_block_number << "-" << first_block_number + size - 1;
+
+        // Each block replay only needs its parent state, but transactions cannot be shared among concurrent tasks
+        window_traces.assign(size, std::nullopt);
+        auto collect_block_traces_on_own_tx = [&](std::size_t i) -> Task<void> {
+            auto tx = co_await tx_factory();
+            std::exception_ptr exception;
+            try {
+                const auto chain_storage = tx->create_storage();
+                const auto block_with_hash = co_await core::read_block_by_number(block_cache_, *chain_storage, first_block_number + i);
+                if (block_with_hash) {
+                    TraceCallExecutor executor{block_cache_, *chain_storage, workers_, *tx};
+                    window_traces[i] = co_await executor.collect_block_traces(*block_with_hash, filter);
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        };
+        co_await concurrency::generate_parallel_group_task(size, collect_block_traces_on_own_tx);
+
+        // Emit the traces following the block order, applying the after and count limits
+        std::size_t max_block_traces{1};
+        for (auto& block_traces : window_traces) {
+            if (!block_traces) {
+                co_return;
+            }
+            max_block_traces = std::max(max_block_traces, block_traces->transaction_traces.size());
+            filter_block_traces(*block_traces, filter, [&](Trace&& trace) { stream.write_json(trace); });
+            if (filter.count == 0) {
+                co_return;
+            }
+        }
+        first_block_number += size;
+
+        // Start small and grow the window exponentially not to waste work if count is reached early, but bound the
+        // number of traces buffered in memory
+        window_size = std::clamp<std::size_t>(std::min(window_size * 2, kMaxBufferedTraces / max_block_traces), 1, kMaxParallelBlocks);
+    }
+}
+
 Task<TraceCallResult> TraceCallExecutor::execute(
     BlockNum block_number,
     const silkworm::Block& block,
@@ -1696,20 +1787,29 @@ Task<TraceCallResult> TraceCallExecutor::execute(
         auto state = tx_.create_state(current_executor, chain_storage_, block_number);
         silkworm::IntraBlockState initial_ibs{*state};
 
+        // Checkpoints are valid only when replaying a block transaction on top of the state at the beginning of the block
+        auto* checkpoint_cache = index != -1 ? use_shared_service<state::StateCheckpointCache>(workers_) : nullptr;
+        state::CheckpointedReplay replay{checkpoint_cache, block, tx_.create_state(current_executor, chain_storage_, block_number),
+                                         transaction.transaction_index};
+
+        // The addresses touched before the first replayed transaction must reflect the restored checkpoint
+        const auto replay_start_state = replay.restored(state);
+        silkworm::IntraBlockState replay_start_ibs{*replay_start_state};
+
         Tracers tracers;
-        StateAddresses state_addresses(initial_ibs);
+        StateAddresses state_addresses(replay_start_ibs);
         std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::IntraBlockStateTracer>(state_addresses);
         tracers.push_back(tracer);
 
-        auto curr_state = tx_.create_state(current_executor, chain_storage_, block_number);
-        EVMExecutor executor{chain_config, workers_, curr_state};
-        for (std::size_t idx{0}; idx < transaction.transaction_index; idx++) {
+        EVMExecutor executor{chain_config, workers_, replay.state()};
+        for (std::size_t idx{replay.first_index()}; idx < transaction.transaction_index; idx++) {
             silkworm::Transaction txn{block.transactions[idx]};
             const auto execution_result = executor.call(block, txn, tracers, /*refund=*/true, /*gas_bailout=*/true);
             if (execution_result.pre_check_error) {
                 SILK_ERROR << "execution failed for tx " << idx << " due to pre-check error: " << *execution_result.pre_check_error;
             }
             executor.reset();
+            replay.on_executed(idx, executor.get_ibs_state());
         }
 
         tracers.clear();
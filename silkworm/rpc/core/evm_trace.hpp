@@ -21,6 +21,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <stack>
 #include <string>
@@ -29,6 +30,7 @@
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <absl/functional/function_ref.h>
 #include <gsl/narrow>
 #include <nlohmann/json.hpp>
 
@@ -490,9 +492,36 @@ class TraceCallExecutor {
     Task<bool> trace_touch_block(const silkworm::BlockWithHash& block_with_hash, const evmc::address& address,
                                  uint64_t block_size, intx::uint<256> total_difficulty, const std::vector<Receipt>& receipts, TransactionsWithReceipts& results);
 
-    Task<void> trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream& stream);
+    //! Factory of transactions on the same database, used to trace blocks concurrently
+    using TransactionFactory = std::function<Task<std::unique_ptr<db::kv::api::Transaction>>()>;
+
+    //! Trace the blocks in the filter range: if \p tx_factory is provided, windows of blocks are traced concurrently
+    //! each one on its own transaction, otherwise the blocks are traced sequentially on the executor transaction
+    Task<void> trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream& stream,
+                            const TransactionFactory& tx_factory = {});
 
   private:
+    //! Max number of blocks traced concurrently by trace_filter
+    static constexpr std::size_t kMaxParallelBlocks{8};
+    //! Max number of traces buffered by trace_filter (estimated using the heaviest block in the last window)
+    static constexpr std::size_t kMaxBufferedTraces{100'000};
+
+    struct BlockTraces {
+        std::vector<Trace> transaction_traces;
+        //! The block and ommer rewards, std::nullopt if traces are filtered by address
+        std::optional<std::vector<Trace>> reward_traces;
+    };
+
+    //! Trace the transactions in the block keeping the ones matching the filter addresses, up to the after and count
+    //! limits of \p filter (the rewards are left out when the limits are reached)
+    Task<BlockTraces> collect_block_traces(const BlockWithHash& block_with_hash, const Filter& filter);
+
+    //! Apply the filter after and count limits to the block traces, passing the ones to return to \p emit
+    static void filter_block_traces(BlockTraces& block_traces, Filter& filter, absl::FunctionRef<void(Trace&&)> emit);
+
+    Task<void> trace_block_range(BlockNum from_block_number, BlockNum to_block_number, Filter& filter,
+                                 json::Stream& stream, const TransactionFactory& tx_factory);
+
     Task<TraceCallResult> execute(
         BlockNum block_number,
         const silkworm::Block& block,
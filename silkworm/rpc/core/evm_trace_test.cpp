@@ -30,6 +30,7 @@
 #include <silkworm/db/kv/api/endpoint/key_value.hpp>
 #include <silkworm/db/state/remote_state.hpp>
 #include <silkworm/db/tables.hpp>
+#include <silkworm/db/test_util/mock_chain_storage.hpp>
 #include <silkworm/db/test_util/mock_transaction.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/test_util/log.hpp>
@@ -5617,6 +5618,117 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
 }
 #endif
 
+TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter on concurrent block windows") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    // Empty pre-merge blocks having just the rewards as traces, the even ones including one ommer
+    std::optional<BlockNum> missing_block_number;
+    const auto setup_chain_storage = [&](db::test_util::MockChainStorage& storage) {
+        ON_CALL(storage, read_chain_config()).WillByDefault(InvokeWithoutArgs([]() -> Task<ChainConfig> {
+            co_return kMainnetConfig;
+        }));
+        ON_CALL(storage, read_canonical_hash(_)).WillByDefault(Invoke([&](BlockNum block_number) -> Task<std::optional<Hash>> {
+            if (block_number == missing_block_number) {
+                co_return std::nullopt;
+            }
+            co_return Hash{block_number};
+        }));
+        ON_CALL(storage, read_block(_, _, _, _)).WillByDefault(Invoke([&](HashAsSpan, BlockNum block_number, bool, Block& block) -> Task<bool> {
+            block.header.number = block_number;
+            block.header.difficulty = 1;
+            block.header.beneficiary = evmc::address{block_number};
+            if (block_number % 2 == 0) {
+                BlockHeader ommer;
+                ommer.number = block_number - 1;
+                ommer.beneficiary = evmc::address{block_number + 1'000};
+                block.ommers.push_back(ommer);
+            }
+            co_return true;
+        }));
+    };
+    testing::NiceMock<db::test_util::MockChainStorage> storage;
+    setup_chain_storage(storage);
+
+    // Each block is traced on its own transaction
+    std::size_t num_transactions{0};
+    const TraceCallExecutor::TransactionFactory tx_factory = [&]() -> Task<std::unique_ptr<db::kv::api::Transaction>> {
+        ++num_transactions;
+        auto tx = std::make_unique<testing::NiceMock<db::test_util::MockTransaction>>();
+        auto tx_storage = std::make_shared<testing::NiceMock<db::test_util::MockChainStorage>>();
+        setup_chain_storage(*tx_storage);
+        ON_CALL(*tx, create_storage()).WillByDefault(testing::Return(tx_storage));
+        ON_CALL(*tx, create_state(_, _, _)).WillByDefault(Invoke([&tx = *tx](auto& ioc, const auto& chain_storage, auto block_number) -> std::shared_ptr<State> {
+            return std::make_shared<db::state::RemoteState>(ioc, tx, chain_storage, block_number);
+        }));
+        ON_CALL(*tx, close()).WillByDefault(InvokeWithoutArgs([]() -> Task<void> { co_return; }));
+        co_return std::unique_ptr<db::kv::api::Transaction>{std::move(tx)};
+    };
+
+    TraceCallExecutor executor{block_cache, chain_storage, workers, transaction};
+    json::Stream stream{io_executor, writer};
+    const auto run_trace_filter = [&](const TraceFilter& filter) {
+        stream.open_object();
+        spawn_and_wait(executor.trace_filter(filter, storage, stream, tx_factory));
+        stream.close_object();
+        spawn_and_wait(stream.close());
+        return nlohmann::json::parse(writer.get_content());
+    };
+    // The reward traces as (block number, reward type) pairs
+    const auto reward_traces = [](const nlohmann::json& traces) {
+        std::vector<std::pair<BlockNum, std::string>> rewards;
+        for (const auto& trace : traces) {
+            CHECK(trace["type"] == "reward");
+            rewards.emplace_back(trace["blockNumber"].get<BlockNum>(), trace["action"]["rewardType"].get<std::string>());
+        }
+        return rewards;
+    };
+
+    SECTION("traces in block order across windows") {
+        const auto reply = run_trace_filter(TraceFilter{.from_block = BlockNumberOrHash{1}, .to_block = BlockNumberOrHash{20}});
+        REQUIRE(reply.contains("result"));
+        std::vector<std::pair<BlockNum, std::string>> expected_rewards;
+        for (BlockNum block_number{1}; block_number <= 20; ++block_number) {
+            expected_rewards.emplace_back(block_number, "block");
+            if (block_number % 2 == 0) {
+                expected_rewards.emplace_back(block_number, "uncle");
+            }
+        }
+        CHECK(reward_traces(reply["result"]) == expected_rewards);
+        CHECK(reply["result"][0]["action"]["author"] == "0x0000000000000000000000000000000000000001");
+        CHECK(num_transactions == 20);
+    }
+    SECTION("after and count across block boundaries") {
+        // The block and ommer rewards of each block count as one single item
+        const auto reply = run_trace_filter(TraceFilter{.from_block = BlockNumberOrHash{1}, .to_block = BlockNumberOrHash{20}, .after = 3, .count = 4});
+        REQUIRE(reply.contains("result"));
+        CHECK(reward_traces(reply["result"]) == std::vector<std::pair<BlockNum, std::string>>{
+                                                    {4, "block"},
+                                                    {4, "uncle"},
+                                                    {5, "block"},
+                                                    {6, "block"},
+                                                    {6, "uncle"},
+                                                    {7, "block"},
+                                                });
+        // The windows of 1, 2 and 4 blocks cover the count, no later block is traced
+        CHECK(num_transactions == 7);
+    }
+    SECTION("count reached in first block") {
+        const auto reply = run_trace_filter(TraceFilter{.from_block = BlockNumberOrHash{1}, .to_block = BlockNumberOrHash{20}, .count = 1});
+        REQUIRE(reply.contains("result"));
+        CHECK(reward_traces(reply["result"]) == std::vector<std::pair<BlockNum, std::string>>{{1, "block"}});
+        CHECK(num_transactions == 1);
+    }
+    SECTION("missing block stops the traces") {
+        missing_block_number = 5;
+        const auto reply = run_trace_filter(TraceFilter{.from_block = BlockNumberOrHash{1}, .to_block = BlockNumberOrHash{10}});
+        REQUIRE(reply.contains("result"));
+        const auto rewards = reward_traces(reply["result"]);
+        REQUIRE(!rewards.empty());
+        CHECK(rewards.back().first == 4);
+        CHECK(rewards.size() == 6);
+    }
+}
+
 TEST_CASE("VmTrace json serialization") {
     silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
 
@@ -108,10 +108,22 @@ Task<FeeHistory> FeeHistoryOracle::fee_history(BlockNum newest_block,
             continue;
         }
 
+        if (const auto summary = find_summary(block_number, reward_percentiles)) {
+            const auto index = block_number - oldest_block_number;
+            fee_history.rewards[index].reserve(reward_percentiles.size());
+            for (const auto percentile : reward_percentiles) {
+                fee_history.rewards[index].push_back(summary->percentile_rewards[static_cast<std::size_t>(percentile)]);
+            }
+            fee_history.base_fees_per_gas[index] = summary->base_fee;
+            fee_history.base_fees_per_gas[index + 1] = summary->next_base_fee;
+            fee_history.gas_used_ratio[index] = summary->gas_used_ratio;
+            continue;
+        }
+
         BlockFees block_fees{block_number};
 
         if (!reward_percentiles.empty()) {
-            if (block_number >= block_range.last_block->block.header.number) {
+            if (block_range.last_block && block_number >= block_range.last_block->block.header.number) {
                 block_fees.block = block_range.last_block;
                 block_fees.receipts = co_await receipts_provider_(*block_fees.block);
             } else {
@@ -164,9 +176,14 @@ Task<FeeHistory> FeeHistoryOracle::fee_history(BlockNum newest_block,
 }
 
 Task<BlockRange> FeeHistoryOracle::resolve_block_range(BlockNum newest_block, uint64_t block_count, uint64_t max_history) {
-    const auto block_with_hash = co_await block_provider_(newest_block);
-    if (!block_with_hash) {
-        co_return BlockRange{0};
+    // The newest block exists if summarized (the summaries of unwound blocks are dropped and never stored again by
+    // FeeSummaryUpdater), otherwise read it to check and reuse it
+    std::shared_ptr<BlockWithHash> block_with_hash;
+    if (!fee_summaries_ || !fee_summaries_->get(newest_block)) {
+        block_with_hash = co_await block_provider_(newest_block);
+        if (!block_with_hash) {
+            co_return BlockRange{0};
+        }
     }
 
     if (max_history != 0) {
@@ -188,63 +205,79 @@ Task<BlockRange> FeeHistoryOracle::resolve_block_range(BlockNum newest_block, ui
         block_count = newest_block + 1;
     }
 
-    const auto receipts = co_await receipts_provider_(*block_with_hash);
+    co_return BlockRange{block_count, newest_block, block_with_hash};
+}
 
-    co_return BlockRange{block_count, newest_block, block_with_hash, receipts};
+std::shared_ptr<const BlockFeeSummary> FeeHistoryOracle::find_summary(BlockNum block_number, const std::vector<int8_t>& reward_percentiles) const {
+    if (!fee_summaries_) {
+        return nullptr;
+    }
+    auto summary = fee_summaries_->get(block_number);
+    if (summary && !reward_percentiles.empty() && summary->percentile_rewards.empty()) {
+        // Rewards not summarized because of missing receipts: let the receipts be read again
+        return nullptr;
+    }
+    return summary;
 }
 
 bool sort_by_reward(std::pair<intx::uint256, uint64_t>& p1, const std::pair<intx::uint256, uint64_t>& p2) {
     return (p1.first < p2.first);
 }
 
-Task<void> FeeHistoryOracle::process_block(BlockFees& block_fees, const std::vector<int8_t>& reward_percentiles) {
-    auto& header = *(block_fees.block_header);
-    auto next_block_number = header.number + 1;
-    block_fees.base_fee = header.base_fee_per_gas.value_or(0);
-
-    block_fees.gas_used_ratio = static_cast<double>(header.gas_used) / static_cast<double>(header.gas_limit);
-
-    if (config_.is_london(next_block_number)) {
-        block_fees.next_base_fee = protocol::expected_base_fee_per_gas(header);
-    } else {
-        block_fees.next_base_fee = 0;
+Rewards block_rewards(const silkworm::Block& block, const rpc::Receipts& receipts, const std::vector<int8_t>& reward_percentiles) {
+    Rewards rewards;
+    if (receipts.size() != block.transactions.size()) {
+        return rewards;
     }
 
-    if (reward_percentiles.empty()) {
-        co_return;  // rewards were not requested, return
-    }
-    if (block_fees.receipts.size() != block_fees.block->block.transactions.size()) {
-        co_return;
-    }
-
-    if (block_fees.block->block.transactions.empty()) {
-        std::fill(block_fees.rewards.begin(), block_fees.rewards.end(), 0);
+    if (block.transactions.empty()) {
         // return an all zero row if there are no transactions to gather data from
-        for (size_t idx = 0; idx < reward_percentiles.size(); idx++) {
-            block_fees.rewards.emplace_back(0);
-        }
-        co_return;
+        rewards.resize(reward_percentiles.size(), 0);
+        return rewards;
     }
+    const auto base_fee = block.header.base_fee_per_gas.value_or(0);
     std::vector<std::pair<intx::uint256, uint64_t> > rewards_and_gas;
-    for (size_t idx = 0; idx < block_fees.block->block.transactions.size(); idx++) {
-        auto& txn = block_fees.block->block.transactions[idx];
-        const auto reward{txn.max_fee_per_gas >= block_fees.base_fee ? txn.effective_gas_price(block_fees.base_fee) - block_fees.base_fee
-                                                                     : txn.max_priority_fee_per_gas};
-        rewards_and_gas.emplace_back(reward, block_fees.receipts[idx].gas_used);
+    rewards_and_gas.reserve(block.transactions.size());
+    for (size_t idx = 0; idx < block.transactions.size(); idx++) {
+        const auto& txn = block.transactions[idx];
+        const auto reward{txn.max_fee_per_gas >= base_fee ? txn.effective_gas_price(base_fee) - base_fee
+                                                          : txn.max_priority_fee_per_gas};
+        rewards_and_gas.emplace_back(reward, receipts[idx].gas_used);
     }
     sort(rewards_and_gas.begin(), rewards_and_gas.end(), sort_by_reward);
 
     auto index = rewards_and_gas.begin();
     const auto last = --rewards_and_gas.end();
     auto sum_gas_used = index->second;
+    rewards.reserve(reward_percentiles.size());
     for (const auto percentile : reward_percentiles) {
-        const uint64_t threshold_gas_used = header.gas_used * static_cast<uint8_t>(percentile) / 100;
+        const uint64_t threshold_gas_used = block.header.gas_used * static_cast<uint8_t>(percentile) / 100;
         while (sum_gas_used < threshold_gas_used && index != last) {
             index++;
             sum_gas_used += index->second;
         }
-        block_fees.rewards.push_back(index->first);
+        rewards.push_back(index->first);
+    }
+    return rewards;
+}
+
+Task<void> FeeHistoryOracle::process_block(BlockFees& block_fees, const std::vector<int8_t>& reward_percentiles) {
+    auto& header = *(block_fees.block_header);
+    auto next_block_number = header.number + 1;
+    block_fees.base_fee = header.base_fee_per_gas.value_or(0);
+
+    block_fees.gas_used_ratio = static_cast<double>(header.gas_used) / static_cast<double>(header.gas_limit);
+
+    if (config_.is_london(next_block_number)) {
+        block_fees.next_base_fee = protocol::expected_base_fee_per_gas(header);
+    } else {
+        block_fees.next_base_fee = 0;
+    }
+
+    if (reward_percentiles.empty()) {
+        co_return;  // rewards were not requested, return
     }
+    block_fees.rewards = block_rewards(block_fees.block->block, block_fees.receipts, reward_percentiles);
 
     co_return;
 }
@@ -28,6 +28,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/transaction.hpp>
 #include <silkworm/rpc/core/blocks.hpp>
+#include <silkworm/rpc/core/fee_summary_cache.hpp>
 
 namespace silkworm::rpc::fee_history {
 
@@ -51,8 +52,7 @@ void to_json(nlohmann::json& json, const FeeHistory& fh);
 struct BlockRange {
     uint64_t num_blocks{0};
     BlockNum last_block_number{0};
-    std::shared_ptr<BlockWithHash> last_block;
-    rpc::Receipts receipts;
+    std::shared_ptr<BlockWithHash> last_block;  // not set if the last block fees are summarized
 };
 
 struct BlockFees {
@@ -66,11 +66,16 @@ struct BlockFees {
     double gas_used_ratio{0};
 };
 
+//! \return the effective priority fees at \p reward_percentiles of the gas used in \p block, empty if \p receipts do not
+//! match the block transactions and all zeros if there are no transactions
+Rewards block_rewards(const silkworm::Block& block, const rpc::Receipts& receipts, const std::vector<int8_t>& reward_percentiles);
+
 class FeeHistoryOracle {
   public:
+    //! Use the block summaries in \p fee_summaries (if any) and read the blocks through the providers otherwise
     explicit FeeHistoryOracle(const silkworm::ChainConfig& config, const BlockHeaderProvider& header_provider, const BlockProvider& block_provider, ReceiptsProvider& receipts_provider,
-                              LatestBlockProvider& latest_block_provider)
-        : config_{config}, block_header_provider_(header_provider), block_provider_(block_provider), receipts_provider_(receipts_provider), latest_block_provider_{latest_block_provider} {}
+                              LatestBlockProvider& latest_block_provider, const FeeSummaryCache* fee_summaries = nullptr)
+        : config_{config}, block_header_provider_(header_provider), block_provider_(block_provider), receipts_provider_(receipts_provider), latest_block_provider_{latest_block_provider}, fee_summaries_{fee_summaries} {}
     virtual ~FeeHistoryOracle() = default;
 
     FeeHistoryOracle(const FeeHistoryOracle&) = delete;
@@ -86,11 +91,15 @@ class FeeHistoryOracle {
     Task<BlockRange> resolve_block_range(BlockNum newest_block, uint64_t block_count, uint64_t max_history);
     Task<void> process_block(BlockFees& block_fees, const std::vector<int8_t>& reward_percentiles);
 
+    //! \return the summary of the fees in block \p block_number if available and suitable for \p reward_percentiles
+    std::shared_ptr<const BlockFeeSummary> find_summary(BlockNum block_number, const std::vector<int8_t>& reward_percentiles) const;
+
     const silkworm::ChainConfig& config_;
     const BlockHeaderProvider& block_header_provider_;
     const BlockProvider& block_provider_;
     const ReceiptsProvider& receipts_provider_;
     const LatestBlockProvider& latest_block_provider_;
+    const FeeSummaryCache* fee_summaries_;
 };
 
 }  // namespace silkworm::rpc::fee_history
@@ -16,10 +16,14 @@
 
 #include "fee_history_oracle.hpp"
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/use_future.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <silkworm/core/chain/config.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/rpc/common/worker_pool.hpp>
 
 namespace silkworm::rpc::fee_history {
 
@@ -52,4 +56,118 @@ TEST_CASE("FeeHistory: json serialization") {
         })"_json);
     }
 }
+
+static BlockFeeSummaryPtr make_summary(BlockNum block_number, const intx::uint256& base_fee, bool with_rewards = true) {
+    BlockFeeSummary summary;
+    summary.block_number = block_number;
+    summary.base_fee = base_fee;
+    summary.next_base_fee = base_fee + 1;
+    summary.gas_used_ratio = 0.25;
+    if (with_rewards) {
+        for (uint64_t percentile{0}; percentile <= 100; ++percentile) {
+            summary.percentile_rewards.emplace_back(percentile);
+        }
+    }
+    return std::make_shared<const BlockFeeSummary>(std::move(summary));
+}
+
+TEST_CASE("FeeHistoryOracle: fee history with fee summaries") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    WorkerPool pool{1};
+
+    // Pre-London empty blocks having base fee equal to their number and half of the gas limit used
+    std::vector<BlockWithHash> blocks(5);
+    for (BlockNum block_number{0}; block_number < blocks.size(); ++block_number) {
+        blocks[block_number].block.header.number = block_number;
+        blocks[block_number].block.header.base_fee_per_gas = block_number;
+        blocks[block_number].block.header.gas_limit = 1'000'000;
+        blocks[block_number].block.header.gas_used = 500'000;
+    }
+
+    std::size_t header_reads{0}, block_reads{0}, receipts_reads{0};
+    BlockHeaderProvider header_provider = [&](BlockNum block_number) -> Task<std::optional<BlockHeader>> {
+        ++header_reads;
+        co_return blocks[block_number].block.header;
+    };
+    BlockProvider block_provider = [&](BlockNum block_number) -> Task<std::shared_ptr<BlockWithHash>> {
+        ++block_reads;
+        co_return std::make_shared<BlockWithHash>(blocks[block_number]);
+    };
+    ReceiptsProvider receipts_provider = [&](const BlockWithHash&) -> Task<rpc::Receipts> {
+        ++receipts_reads;
+        co_return rpc::Receipts{};
+    };
+    LatestBlockProvider latest_block_provider = [&]() -> Task<uint64_t> {
+        co_return blocks.size() - 1;
+    };
+    FeeSummaryCache fee_summaries{16};
+    FeeHistoryOracle oracle{kMainnetConfig, header_provider, block_provider, receipts_provider, latest_block_provider, &fee_summaries};
+
+    const auto fee_history = [&](const std::vector<int8_t>& reward_percentiles) {
+        return boost::asio::co_spawn(pool, oracle.fee_history(4, 2, reward_percentiles), boost::asio::use_future).get();
+    };
+
+    SECTION("summarized blocks are not read") {
+        fee_summaries.put(make_summary(3, 0x30));
+        fee_summaries.put(make_summary(4, 0x40));
+
+        const auto history = fee_history({25, 75});
+        CHECK(history.oldest_block == 3);
+        CHECK(history.base_fees_per_gas == std::vector<intx::uint256>{0x30, 0x40, 0x41});
+        CHECK(history.gas_used_ratio == std::vector<double>{0.25, 0.25});
+        CHECK(history.rewards == std::vector<Rewards>{{25, 75}, {25, 75}});
+        CHECK(block_reads == 0);
+        CHECK(receipts_reads == 0);
+        CHECK(header_reads == 0);
+    }
+
+    SECTION("blocks without summary are read") {
+        fee_summaries.put(make_summary(4, 0x40));
+
+        const auto history = fee_history({25, 75});
+        CHECK(history.oldest_block == 3);
+        CHECK(history.base_fees_per_gas == std::vector<intx::uint256>{3, 0x40, 0x41});
+        CHECK(history.gas_used_ratio == std::vector<double>{0.5, 0.25});
+        CHECK(history.rewards == std::vector<Rewards>{{0, 0}, {25, 75}});
+        CHECK(block_reads == 1);
+        CHECK(receipts_reads == 1);
+    }
+
+    SECTION("headers without summary are read if no reward is requested") {
+        fee_summaries.put(make_summary(4, 0x40));
+
+        const auto history = fee_history({});
+        CHECK(history.oldest_block == 3);
+        CHECK(history.base_fees_per_gas == std::vector<intx::uint256>{3, 0x40, 0x41});
+        CHECK(history.gas_used_ratio == std::vector<double>{0.5, 0.25});
+        CHECK(history.rewards.empty());
+        CHECK(header_reads == 1);
+        CHECK(block_reads == 0);
+    }
+
+    SECTION("summaries without rewards are not used if rewards are requested") {
+        fee_summaries.put(make_summary(3, 0x30, /*with_rewards=*/false));
+        fee_summaries.put(make_summary(4, 0x40));
+
+        const auto history = fee_history({50});
+        CHECK(history.base_fees_per_gas == std::vector<intx::uint256>{3, 0x40, 0x41});
+        CHECK(history.rewards == std::vector<Rewards>{{0}, {50}});
+        CHECK(block_reads == 1);
+        CHECK(receipts_reads == 1);
+    }
+
+    SECTION("unwound blocks are read again") {
+        fee_summaries.put(make_summary(3, 0x30));
+        fee_summaries.put(make_summary(4, 0x40));
+        fee_summaries.remove_from(4);
+
+        const auto history = fee_history({25, 75});
+        CHECK(history.base_fees_per_gas == std::vector<intx::uint256>{0x30, 4, 0});
+        CHECK(history.gas_used_ratio == std::vector<double>{0.25, 0.5});
+        CHECK(history.rewards == std::vector<Rewards>{{25, 75}, {0, 0}});
+        CHECK(block_reads == 1);
+        CHECK(receipts_reads == 1);
+    }
+}
+
 }  // namespace silkworm::rpc::fee_history
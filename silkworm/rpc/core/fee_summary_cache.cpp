@@ -0,0 +1,85 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "fee_summary_cache.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/rpc/core/fee_history_oracle.hpp>
+#include <silkworm/rpc/core/gas_price_oracle.hpp>
+
+namespace silkworm::rpc {
+
+//! All the integer percentiles accepted by eth_feeHistory
+static const std::vector<int8_t> kAllPercentiles = [] {
+    std::vector<int8_t> percentiles(101);
+    for (std::size_t i{0}; i < percentiles.size(); ++i) {
+        percentiles[i] = static_cast<int8_t>(i);
+    }
+    return percentiles;
+}();
+
+BlockFeeSummaryPtr make_block_fee_summary(const silkworm::ChainConfig& config,
+                                          const silkworm::BlockWithHash& block_with_hash,
+                                          const Receipts& receipts) {
+    const auto& header = block_with_hash.block.header;
+    auto summary = std::make_shared<BlockFeeSummary>();
+    summary->block_number = header.number;
+    summary->block_hash = block_with_hash.hash;
+    summary->base_fee = header.base_fee_per_gas.value_or(0);
+    if (config.is_london(header.number + 1)) {
+        summary->next_base_fee = protocol::expected_base_fee_per_gas(header);
+    }
+    summary->gas_used_ratio = static_cast<double>(header.gas_used) / static_cast<double>(header.gas_limit);
+    summary->gas_price_samples = block_gas_price_samples(block_with_hash.block, kSamples);
+    summary->percentile_rewards = fee_history::block_rewards(block_with_hash.block, receipts, kAllPercentiles);
+    return summary;
+}
+
+FeeSummaryCache::FeeSummaryCache(std::size_t capacity) : slots_(std::max<std::size_t>(capacity, 1)) {}
+
+BlockFeeSummaryPtr FeeSummaryCache::get(BlockNum block_number) const {
+    std::scoped_lock lock{mutex_};
+    const auto& summary = slots_[block_number % slots_.size()];
+    return summary && summary->block_number == block_number ? summary : nullptr;
+}
+
+void FeeSummaryCache::put(BlockFeeSummaryPtr summary) {
+    std::scoped_lock lock{mutex_};
+    auto& slot = slots_[summary->block_number % slots_.size()];
+    slot = std::move(summary);
+}
+
+void FeeSummaryCache::remove_from(BlockNum block_number) {
+    std::scoped_lock lock{mutex_};
+    for (auto& slot : slots_) {
+        if (slot && slot->block_number >= block_number) {
+            slot.reset();
+        }
+    }
+}
+
+void FeeSummaryCache::clear() {
+    std::scoped_lock lock{mutex_};
+    for (auto& slot : slots_) {
+        slot.reset();
+    }
+}
+
+}  // namespace silkworm::rpc
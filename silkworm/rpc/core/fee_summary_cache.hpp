@@ -0,0 +1,83 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/rpc/common/constants.hpp>
+#include <silkworm/rpc/types/receipt.hpp>
+
+namespace silkworm::rpc {
+
+//! Fee statistics of one canonical block serving eth_gasPrice, eth_maxPriorityFeePerGas and eth_feeHistory
+struct BlockFeeSummary {
+    BlockNum block_number{0};
+    evmc::bytes32 block_hash;
+    intx::uint256 base_fee;
+    intx::uint256 next_base_fee;
+    double gas_used_ratio{0};
+    //! Lowest priority fees per gas eligible as gas price samples, in ascending order
+    std::vector<intx::uint256> gas_price_samples;
+    //! Reward at each integer percentile of the gas used from 0 to 100, empty if the receipts are not available
+    std::vector<intx::uint256> percentile_rewards;
+};
+
+using BlockFeeSummaryPtr = std::shared_ptr<const BlockFeeSummary>;
+
+//! Compute the fee summary of \p block_with_hash given its \p receipts
+BlockFeeSummaryPtr make_block_fee_summary(const silkworm::ChainConfig& config,
+                                          const silkworm::BlockWithHash& block_with_hash,
+                                          const Receipts& receipts);
+
+//! \brief Ring buffer of the fee summaries of the latest canonical blocks, shared by all the execution contexts.
+//! \details Each block number has its own slot (modulo the capacity), so a summary is replaced by the one of the next
+//! canonical block at the same height or of a block number greater by the capacity. Thread-safe.
+class FeeSummaryCache {
+  public:
+    explicit FeeSummaryCache(std::size_t capacity = kDefaultFeeSummaryBlocks);
+
+    FeeSummaryCache(const FeeSummaryCache&) = delete;
+    FeeSummaryCache& operator=(const FeeSummaryCache&) = delete;
+
+    //! \return the summary of block \p block_number or nullptr if not available
+    BlockFeeSummaryPtr get(BlockNum block_number) const;
+
+    void put(BlockFeeSummaryPtr summary);
+
+    //! Drop the summaries of the blocks from \p block_number onwards, e.g. after they have been unwound
+    void remove_from(BlockNum block_number);
+
+    //! Drop all the summaries, e.g. when some unwinds may have been missed
+    void clear();
+
+    [[nodiscard]] std::size_t capacity() const { return slots_.size(); }
+
+  private:
+    mutable std::mutex mutex_;
+    std::vector<BlockFeeSummaryPtr> slots_;
+};
+
+}  // namespace silkworm::rpc
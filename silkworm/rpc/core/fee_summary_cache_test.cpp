@@ -0,0 +1,127 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "fee_summary_cache.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/rpc/core/fee_history_oracle.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address;
+
+static const evmc::address kBeneficiary{0xe5ef458d37212a06e3f59d40c454e76150ae7c31_address};
+static const evmc::address kSender{0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address};
+
+static BlockFeeSummaryPtr make_summary(BlockNum block_number) {
+    auto summary = std::make_shared<BlockFeeSummary>();
+    summary->block_number = block_number;
+    return summary;
+}
+
+TEST_CASE("FeeSummaryCache ring buffer", "[rpc][core][fee_summary_cache]") {
+    FeeSummaryCache cache{4};
+    CHECK(cache.capacity() == 4);
+    CHECK(!cache.get(1));
+
+    for (BlockNum block_number{1}; block_number <= 6; ++block_number) {
+        cache.put(make_summary(block_number));
+    }
+    // Blocks 1 and 2 have been replaced by blocks 5 and 6
+    CHECK(!cache.get(1));
+    CHECK(!cache.get(2));
+    for (BlockNum block_number{3}; block_number <= 6; ++block_number) {
+        REQUIRE(cache.get(block_number));
+        CHECK(cache.get(block_number)->block_number == block_number);
+    }
+
+    cache.remove_from(5);
+    CHECK(cache.get(3));
+    CHECK(cache.get(4));
+    CHECK(!cache.get(5));
+    CHECK(!cache.get(6));
+
+    cache.clear();
+    CHECK(!cache.get(3));
+    CHECK(!cache.get(4));
+}
+
+TEST_CASE("make_block_fee_summary", "[rpc][core][fee_summary_cache]") {
+    silkworm::BlockWithHash block_with_hash;
+    auto& block = block_with_hash.block;
+    block.header.number = 1;
+    block.header.beneficiary = kBeneficiary;
+    block.header.base_fee_per_gas = 10;
+    block.header.gas_limit = 100;
+    block.header.gas_used = 60;
+    block.transactions.resize(3);
+    block.transactions[0].max_priority_fee_per_gas = 5;
+    block.transactions[0].max_fee_per_gas = 100;
+    block.transactions[0].set_sender(kSender);
+    block.transactions[1].max_priority_fee_per_gas = 20;
+    block.transactions[1].max_fee_per_gas = 25;
+    block.transactions[1].set_sender(kSender);
+    // Transactions sent by the beneficiary are not gas price samples
+    block.transactions[2].max_priority_fee_per_gas = 1'000;
+    block.transactions[2].max_fee_per_gas = 1'000;
+    block.transactions[2].set_sender(kBeneficiary);
+
+    Receipts receipts(3);
+    receipts[0].gas_used = 20;
+    receipts[1].gas_used = 30;
+    receipts[2].gas_used = 10;
+
+    SECTION("with receipts") {
+        const auto summary = make_block_fee_summary(kMainnetConfig, block_with_hash, receipts);
+        CHECK(summary->block_number == 1);
+        CHECK(summary->base_fee == 10);
+        CHECK(summary->gas_used_ratio == 0.6);
+        CHECK(summary->gas_price_samples == std::vector<intx::uint256>{5, 15});
+        REQUIRE(summary->percentile_rewards.size() == 101);
+
+        // Each percentile reward matches the one computed on demand
+        const std::vector<int8_t> percentiles{0, 33, 34, 50, 84, 85, 100};
+        const auto rewards = fee_history::block_rewards(block, receipts, percentiles);
+        REQUIRE(rewards.size() == percentiles.size());
+        for (std::size_t i{0}; i < percentiles.size(); ++i) {
+            CHECK(summary->percentile_rewards[static_cast<std::size_t>(percentiles[i])] == rewards[i]);
+        }
+        CHECK(summary->percentile_rewards[0] == 5);
+        CHECK(summary->percentile_rewards[50] == 15);
+        CHECK(summary->percentile_rewards[100] == 990);
+    }
+
+    SECTION("without receipts") {
+        const auto summary = make_block_fee_summary(kMainnetConfig, block_with_hash, {});
+        CHECK(summary->gas_price_samples == std::vector<intx::uint256>{5, 15});
+        CHECK(summary->percentile_rewards.empty());
+    }
+
+    SECTION("without transactions") {
+        block.transactions.clear();
+        const auto summary = make_block_fee_summary(kMainnetConfig, block_with_hash, {});
+        CHECK(summary->gas_price_samples.empty());
+        CHECK(summary->percentile_rewards == std::vector<intx::uint256>(101, 0));
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,76 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "fee_summary_updater.hpp"
+
+#include <exception>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/private_service.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/rpc/core/cached_chain.hpp>
+#include <silkworm/rpc/core/receipts.hpp>
+
+namespace silkworm::rpc {
+
+FeeSummaryUpdater::FeeSummaryUpdater(boost::asio::io_context& io_context)
+    : block_cache_{must_use_shared_service<BlockCache>(io_context)},
+      fee_summaries_{must_use_shared_service<FeeSummaryCache>(io_context)},
+      database_{must_use_private_service<ethdb::Database>(io_context)},
+      block_queue_{io_context, "FeeSummaryUpdater", [this](BlockNum block_number) { return update(block_number); }} {}
+
+void FeeSummaryUpdater::on_new_block(BlockNum block_number) {
+    block_queue_.push(block_number);
+}
+
+void FeeSummaryUpdater::on_unwind(BlockNum block_number) {
+    block_queue_.on_unwind(block_number);
+    fee_summaries_->remove_from(block_number);
+}
+
+void FeeSummaryUpdater::on_subscription() {
+    block_queue_.clear();
+    fee_summaries_->clear();
+}
+
+Task<void> FeeSummaryUpdater::update(BlockNum block_number) {
+    const auto unwind_count{block_queue_.unwind_count()};
+    auto tx = co_await database_->begin();
+    try {
+        const auto chain_storage{tx->create_storage()};
+        if (!chain_config_) {
+            chain_config_ = co_await chain_storage->read_chain_config();
+        }
+        const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, block_number);
+        if (block_with_hash) {
+            const auto receipts = co_await core::get_receipts(*tx, *block_with_hash);
+            if (unwind_count != block_queue_.unwind_count()) {
+                // The block may have been unwound while reading it: never store the summary of a stale block
+                SILK_TRACE << "FeeSummaryUpdater: block " << block_number << " skipped after unwind";
+                co_await tx->close();  // RAII not (yet) available with coroutines
+                co_return;
+            }
+            fee_summaries_->put(make_block_fee_summary(*chain_config_, *block_with_hash, receipts));
+            SILK_TRACE << "FeeSummaryUpdater: block " << block_number << " summarized";
+        }
+    } catch (const std::exception& e) {
+        // The oracles will read the block again when needed
+        SILK_WARN << "FeeSummaryUpdater: cannot summarize fees of block " << block_number << ": " << e.what();
+    }
+    co_await tx->close();  // RAII not (yet) available with coroutines
+}
+
+}  // namespace silkworm::rpc
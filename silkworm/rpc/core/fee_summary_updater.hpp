@@ -0,0 +1,66 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/rpc/core/block_update_queue.hpp>
+#include <silkworm/rpc/core/fee_summary_cache.hpp>
+#include <silkworm/rpc/ethdb/database.hpp>
+
+namespace silkworm::rpc {
+
+//! FeeSummaryUpdater computes the fee summary of each new canonical block once and stores it into FeeSummaryCache, so
+//! that the gas price and fee history oracles do not read the same blocks and receipts again on each call
+class FeeSummaryUpdater {
+  public:
+    //! Use the services of \p io_context, which must be the scheduler of the state changes notifying new blocks
+    explicit FeeSummaryUpdater(boost::asio::io_context& io_context);
+
+    FeeSummaryUpdater(const FeeSummaryUpdater&) = delete;
+    FeeSummaryUpdater& operator=(const FeeSummaryUpdater&) = delete;
+
+    //! Schedule the summary of the specified new canonical block
+    void on_new_block(BlockNum block_number);
+
+    //! Drop the pending updates and the summaries of the specified unwound block and of the following ones
+    void on_unwind(BlockNum block_number);
+
+    //! Drop the pending updates and all the summaries at each subscription to the state changes, because any unwind
+    //! notified while not subscribed has been missed
+    void on_subscription();
+
+  private:
+    //! Compute and store the fee summary of the specified new block
+    Task<void> update(BlockNum block_number);
+
+    BlockCache* block_cache_;
+    FeeSummaryCache* fee_summaries_;
+    ethdb::Database* database_;
+
+    std::optional<silkworm::ChainConfig> chain_config_;
+    BlockUpdateQueue block_queue_;
+};
+
+}  // namespace silkworm::rpc
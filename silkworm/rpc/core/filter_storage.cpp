@@ -16,11 +16,82 @@
 
 #include "filter_storage.hpp"
 
+#include <algorithm>
+
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/rpc/core/blocks.hpp>
 #include <silkworm/rpc/json/types.hpp>
 
 namespace silkworm::rpc {
 
+void LogsRingBuffer::push(const Log& log) {
+    if (capacity_ == 0) {
+        ++overwritten_count_;
+        return;
+    }
+    if (logs_.size() < capacity_) {
+        logs_.push_back(log);
+        ++size_;
+        return;
+    }
+    const auto tail{(head_ + size_) % capacity_};
+    logs_[tail] = log;
+    if (size_ < capacity_) {
+        ++size_;
+    } else {
+        head_ = (head_ + 1) % capacity_;
+        ++overwritten_count_;
+    }
+}
+
+Logs LogsRingBuffer::drain() {
+    Logs logs;
+    logs.reserve(size_);
+    for (std::size_t i{0}; i < size_; ++i) {
+        logs.push_back(std::move(logs_[(head_ + i) % logs_.size()]));
+    }
+    logs_.clear();
+    head_ = 0;
+    size_ = 0;
+    overwritten_count_ = 0;
+    return logs;
+}
+
+void LogsRingBuffer::remove_from(BlockNum block_number) {
+    while (size_ > 0) {
+        const auto newest{(head_ + size_ - 1) % logs_.size()};
+        if (logs_[newest].block_number < block_number) {
+            break;
+        }
+        if (logs_.size() < capacity_) {
+            logs_.pop_back();  // not wrapped yet, keep growing on demand
+        }
+        --size_;
+    }
+}
+
+//! Only log filters following the chain head can be matched incrementally
+static bool is_trackable(const StoredFilter& filter) {
+    return filter.type == FilterType::logs && !filter.block_hash &&
+           (!filter.to_block || filter.to_block.value() == core::kLatestBlockId);
+}
+
+static bool match_log(const Log& log, const FilterAddresses& addresses, const FilterTopics& topics) {
+    if (!addresses.empty() && std::find(addresses.begin(), addresses.end(), log.address) == addresses.end()) {
+        return false;
+    }
+    if (topics.size() > log.topics.size()) {
+        return false;
+    }
+    for (std::size_t i{0}; i < topics.size(); ++i) {
+        const auto& subtopics = topics[i];  // empty rule set == wildcard
+        if (!subtopics.empty() && std::find(subtopics.begin(), subtopics.end(), log.topics[i]) == subtopics.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::mt19937_64 random_engine{std::random_device{}()};
 
 Generator default_generator = []() { return random_engine(); };
@@ -57,7 +128,12 @@ std::optional<std::string> FilterStorage::add_filter(const StoredFilter& filter)
         return std::nullopt;
     }
 
-    storage_.emplace(filter_id, entry);
+    const auto itr = storage_.emplace(filter_id, entry).first;
+    if (is_trackable(itr->second.filter)) {
+        itr->second.tracked = true;
+        itr->second.next_block = itr->second.filter.start;
+        index(itr->second);
+    }
     return filter_id;
 }
 
@@ -68,7 +144,7 @@ bool FilterStorage::remove_filter(const std::string& filter_id) {
     if (itr == storage_.end()) {
         return false;
     }
-    storage_.erase(itr);
+    erase(itr);
 
     return true;
 }
@@ -86,7 +162,7 @@ std::optional<std::reference_wrapper<StoredFilter>> FilterStorage::get_filter(co
     auto age = itr->second.age();
     if (age > max_filter_age_) {
         SILK_TRACE << "Filter  " << filter_id << " exhausted: removed";
-        storage_.erase(itr);
+        erase(itr);
         return std::nullopt;
     }
 
@@ -94,13 +170,150 @@ std::optional<std::reference_wrapper<StoredFilter>> FilterStorage::get_filter(co
     return itr->second.filter;
 }
 
+void FilterStorage::on_new_block(BlockNum block_number, const Logs& logs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (tracked_count_ == 0) {
+        return;
+    }
+
+    for (const auto& log : logs) {
+        ++log_sequence_;
+        // Only the filters waiting for this block take its logs, the others will scan the missing range when polled
+        const auto match = [&](FilterEntry* entry) {
+            if (entry->next_block != block_number || entry->last_log_sequence == log_sequence_) {
+                return;
+            }
+            entry->last_log_sequence = log_sequence_;
+            if (match_log(log, entry->filter.addresses, entry->filter.topics)) {
+                entry->pending_logs.push(log);
+            }
+        };
+        if (const auto it = address_index_.find(log.address); it != address_index_.end()) {
+            std::for_each(it->second.begin(), it->second.end(), match);
+        }
+        for (const auto& topic : log.topics) {
+            if (const auto it = topic_index_.find(topic); it != topic_index_.end()) {
+                std::for_each(it->second.begin(), it->second.end(), match);
+            }
+        }
+        std::for_each(wildcard_filters_.begin(), wildcard_filters_.end(), match);
+    }
+
+    for (auto& [_, entry] : storage_) {
+        if (entry.tracked && entry.next_block == block_number) {
+            ++entry.next_block;
+        }
+    }
+}
+
+void FilterStorage::on_unwind(BlockNum block_number) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& [_, entry] : storage_) {
+        if (entry.tracked && entry.next_block > block_number) {
+            entry.pending_logs.remove_from(block_number);
+            entry.next_block = std::max(block_number, entry.filter.start);
+        }
+    }
+}
+
+void FilterStorage::reset_tracked_filters() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& [_, entry] : storage_) {
+        if (!entry.tracked) {
+            continue;
+        }
+        // Pending logs are buffered in block order, so the oldest one belongs to the first undelivered block
+        const auto pending_logs = entry.pending_logs.drain();
+        if (!pending_logs.empty()) {
+            entry.next_block = std::max(pending_logs.front().block_number, entry.filter.start);
+        }
+    }
+}
+
+std::optional<FilterChanges> FilterStorage::take_changes(const std::string& filter_id, BlockNum latest_block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto itr = storage_.find(filter_id);
+    if (itr == storage_.end() || !itr->second.tracked) {
+        return std::nullopt;
+    }
+    auto& entry = itr->second;
+    entry.renew();
+
+    if (entry.pending_logs.overwritten_count() > 0) {
+        SILK_WARN << "Filter " << filter_id << " lost " << entry.pending_logs.overwritten_count() << " logs, buffer capacity "
+                  << entry.pending_logs.capacity() << " exceeded";
+    }
+    FilterChanges changes{
+        .logs = entry.pending_logs.drain(),
+        .from_block = entry.next_block,
+        .to_block = latest_block,
+    };
+    entry.next_block = std::max(entry.next_block, latest_block + 1);
+    return changes;
+}
+
+std::map<std::string, FilterEntry>::iterator FilterStorage::erase(std::map<std::string, FilterEntry>::iterator itr) {
+    if (itr->second.tracked) {
+        unindex(itr->second);
+    }
+    return storage_.erase(itr);
+}
+
+void FilterStorage::index(FilterEntry& entry) {
+    const auto& filter = entry.filter;
+    if (!filter.addresses.empty()) {
+        for (const auto& address : filter.addresses) {
+            address_index_[address].push_back(&entry);
+        }
+    } else if (const auto it = std::find_if(filter.topics.begin(), filter.topics.end(), [](const auto& subtopics) { return !subtopics.empty(); });
+               it != filter.topics.end()) {
+        for (const auto& topic : *it) {
+            topic_index_[topic].push_back(&entry);
+        }
+    } else {
+        wildcard_filters_.push_back(&entry);
+    }
+    ++tracked_count_;
+}
+
+void FilterStorage::unindex(FilterEntry& entry) {
+    const auto remove_from = [&](auto& index, const auto& key) {
+        const auto it = index.find(key);
+        if (it == index.end()) {
+            return;
+        }
+        std::erase(it->second, &entry);
+        if (it->second.empty()) {
+            index.erase(it);
+        }
+    };
+    const auto& filter = entry.filter;
+    if (!filter.addresses.empty()) {
+        for (const auto& address : filter.addresses) {
+            remove_from(address_index_, address);
+        }
+    } else if (const auto it = std::find_if(filter.topics.begin(), filter.topics.end(), [](const auto& subtopics) { return !subtopics.empty(); });
+               it != filter.topics.end()) {
+        for (const auto& topic : *it) {
+            remove_from(topic_index_, topic);
+        }
+    } else {
+        std::erase(wildcard_filters_, &entry);
+    }
+    --tracked_count_;
+}
+
 void FilterStorage::clean_up() {
     auto itr = storage_.begin();
     while (itr != storage_.end()) {
         auto age = itr->second.age();
         if (age > max_filter_age_) {
             SILK_TRACE << "Filter  " << itr->first << " exhausted: removed";
-            itr = storage_.erase(itr);
+            itr = erase(itr);
         } else {
             ++itr;
         }
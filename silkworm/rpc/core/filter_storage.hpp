@@ -23,15 +23,20 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
 #include <silkworm/rpc/types/filter.hpp>
 #include <silkworm/rpc/types/log.hpp>
 
 namespace silkworm::rpc {
 
-static const std::size_t kDefaultFilterStorageSize = 1024;  // default filter storage size, ie max num for filters in storage
-static const std::size_t kDefaultMaxFilterAge = 900;        // lasting time for unused filters in seconds (15 min)
+static const std::size_t kDefaultFilterStorageSize = 1024;   // default filter storage size, ie max num for filters in storage
+static const std::size_t kDefaultMaxFilterAge = 900;         // lasting time for unused filters in seconds (15 min)
+static const std::size_t kDefaultFilterLogsCapacity = 8192;  // max num of pending logs kept for each tracked filter
 
 enum FilterType {
     logs,
@@ -45,12 +50,57 @@ struct StoredFilter : public Filter {
     std::vector<Log> logs;
 };
 
+//! Bounded FIFO buffer of logs overwriting the oldest entries when full
+class LogsRingBuffer {
+  public:
+    explicit LogsRingBuffer(std::size_t capacity = kDefaultFilterLogsCapacity) : capacity_{capacity} {}
+
+    void push(const Log& log);
+
+    //! Extract all the buffered logs in insertion order
+    Logs drain();
+
+    //! Discard the buffered logs belonging to the specified block or later ones, which are buffered last
+    void remove_from(BlockNum block_number);
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] std::size_t capacity() const { return capacity_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    //! The number of logs overwritten since the last drain
+    [[nodiscard]] std::size_t overwritten_count() const { return overwritten_count_; }
+
+  private:
+    std::size_t capacity_;
+    std::vector<Log> logs_;  // grown up to capacity on demand
+    std::size_t head_{0};    // position of the oldest log
+    std::size_t size_{0};
+    std::size_t overwritten_count_{0};
+};
+
 struct FilterEntry {
     void renew() { last_access = std::chrono::system_clock::now(); }
     [[nodiscard]] std::chrono::duration<double> age() const { return std::chrono::system_clock::now() - last_access; }
 
     StoredFilter filter;
     std::chrono::system_clock::time_point last_access = std::chrono::system_clock::now();
+
+    //! Tracked log filters get the logs of each new block matched incrementally into pending_logs
+    bool tracked{false};
+    //! The next block whose logs have not been delivered yet
+    BlockNum next_block{0};
+    LogsRingBuffer pending_logs{kDefaultFilterLogsCapacity};
+    //! The sequence number of the last log checked against this filter, used to check each log just once
+    uint64_t last_log_sequence{0};
+};
+
+//! The changes of a tracked log filter since the last poll
+struct FilterChanges {
+    //! The logs matched incrementally since the last poll
+    Logs logs;
+    //! The block range [from_block, to_block] not covered by the logs above, empty if from_block > to_block
+    BlockNum from_block{0};
+    BlockNum to_block{0};
 };
 
 typedef std::function<std::uint64_t()> Generator;
@@ -67,18 +117,52 @@ class FilterStorage {
     bool remove_filter(const std::string& filter_id);
     std::optional<std::reference_wrapper<StoredFilter>> get_filter(const std::string& filter_id);
 
+    //! Match the logs of a new canonical block against all the tracked log filters just once, appending the matches
+    //! to the pending logs of the filters waiting for that block
+    void on_new_block(BlockNum block_number, const Logs& logs);
+
+    //! Discard the pending logs of the unwound blocks starting from \p block_number and rewind the tracked log filters
+    //! waiting for later blocks, so that their next poll scans the new canonical blocks from there
+    void on_unwind(BlockNum block_number);
+
+    //! Discard the pending logs of all the tracked log filters and rewind them to their first undelivered block, because
+    //! some unwinds may have been missed: their next poll scans the current canonical blocks from there
+    void reset_tracked_filters();
+
+    //! Take the pending logs of the specified tracked log filter and the range up to \p latest_block they don't cover,
+    //! which the caller must scan: return \code std::nullopt if the filter is not found or not tracked
+    std::optional<FilterChanges> take_changes(const std::string& filter_id, BlockNum latest_block);
+
+    [[nodiscard]] bool has_tracked_filters() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tracked_count_ > 0;
+    }
+
     [[nodiscard]] auto size() const {
         return storage_.size();
     }
 
   private:
+    using FilterEntries = std::vector<FilterEntry*>;
+
     void clean_up();
+    std::map<std::string, FilterEntry>::iterator erase(std::map<std::string, FilterEntry>::iterator itr);
+    void index(FilterEntry& entry);
+    void unindex(FilterEntry& entry);
 
     Generator& generator_;
     std::size_t max_size_;
     std::chrono::duration<double> max_filter_age_;
     std::mutex mutex_;
     std::map<std::string, FilterEntry> storage_;
+
+    //! Indexes of the tracked log filters: each filter is indexed by its addresses if any, otherwise by the first
+    //! non-empty topic alternatives if any, otherwise it is a wildcard filter
+    std::unordered_map<evmc::address, FilterEntries> address_index_;
+    std::unordered_map<evmc::bytes32, FilterEntries> topic_index_;
+    FilterEntries wildcard_filters_;
+    std::size_t tracked_count_{0};
+    uint64_t log_sequence_{0};
 };
 
 }  // namespace silkworm::rpc
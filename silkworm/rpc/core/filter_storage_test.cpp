@@ -26,6 +26,8 @@
 
 namespace silkworm::rpc {
 
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
 TEST_CASE("FilterStorage base") {
     test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
 
@@ -138,4 +140,214 @@ TEST_CASE("FilterStorage enhanced") {
     }
 }
 
+TEST_CASE("LogsRingBuffer") {
+    LogsRingBuffer buffer{3};
+    const auto make_log = [](uint32_t index) { return Log{.index = index}; };
+
+    SECTION("empty") {
+        CHECK(buffer.empty());
+        CHECK(buffer.drain().empty());
+    }
+    SECTION("not full") {
+        buffer.push(make_log(1));
+        buffer.push(make_log(2));
+        CHECK(buffer.size() == 2);
+        const auto logs = buffer.drain();
+        REQUIRE(logs.size() == 2);
+        CHECK(logs[0].index == 1);
+        CHECK(logs[1].index == 2);
+        CHECK(buffer.empty());
+    }
+    SECTION("overwrite oldest when full") {
+        for (uint32_t i{1}; i <= 5; ++i) {
+            buffer.push(make_log(i));
+        }
+        CHECK(buffer.size() == 3);
+        CHECK(buffer.overwritten_count() == 2);
+        const auto logs = buffer.drain();
+        REQUIRE(logs.size() == 3);
+        CHECK(logs[0].index == 3);
+        CHECK(logs[1].index == 4);
+        CHECK(logs[2].index == 5);
+        CHECK(buffer.overwritten_count() == 0);
+    }
+    SECTION("remove logs of unwound blocks") {
+        buffer.push(Log{.block_number = 10, .index = 1});
+        buffer.push(Log{.block_number = 11, .index = 2});
+        buffer.remove_from(11);
+        CHECK(buffer.size() == 1);
+        buffer.push(Log{.block_number = 11, .index = 3});
+        const auto logs = buffer.drain();
+        REQUIRE(logs.size() == 2);
+        CHECK(logs[0].index == 1);
+        CHECK(logs[1].index == 3);
+    }
+    SECTION("remove logs of unwound blocks when wrapped") {
+        for (uint32_t i{1}; i <= 5; ++i) {
+            buffer.push(Log{.block_number = 9 + i, .index = i});
+        }
+        buffer.remove_from(13);
+        CHECK(buffer.size() == 1);
+        CHECK(buffer.overwritten_count() == 2);
+        buffer.push(Log{.block_number = 13, .index = 6});
+        buffer.push(Log{.block_number = 14, .index = 7});
+        const auto logs = buffer.drain();
+        REQUIRE(logs.size() == 3);
+        CHECK(logs[0].index == 3);
+        CHECK(logs[1].index == 6);
+        CHECK(logs[2].index == 7);
+    }
+}
+
+TEST_CASE("FilterStorage tracked filters") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    const auto address1{0x6090a6e47849629b7245dfa1ca21d94cd15878ef_address};
+    const auto address2{0xea674fdde714fd979de3edf0f56aa9716b898ec8_address};
+    const auto topic1{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+    const auto topic2{0x0000000000000000000000000000000000000000000000000000000000000002_bytes32};
+    const Logs block_logs{
+        Log{.address = address1, .topics = {topic1}, .block_number = 100, .index = 0},
+        Log{.address = address2, .topics = {topic2, topic1}, .block_number = 100, .index = 1},
+        Log{.address = address2, .topics = {topic1}, .block_number = 100, .index = 2},
+    };
+
+    FilterStorage filter_storage{10};
+    const auto add_tracked_filter = [&](FilterAddresses addresses, FilterTopics topics) {
+        StoredFilter filter;
+        filter.addresses = std::move(addresses);
+        filter.topics = std::move(topics);
+        filter.start = 100;
+        return filter_storage.add_filter(filter).value();
+    };
+
+    SECTION("filter by block hash is not tracked") {
+        StoredFilter filter;
+        filter.block_hash = "0x0000000000000000000000000000000000000000000000000000000000000001";
+        const auto filter_id = filter_storage.add_filter(filter).value();
+        CHECK_FALSE(filter_storage.has_tracked_filters());
+        CHECK_FALSE(filter_storage.take_changes(filter_id, 100).has_value());
+    }
+    SECTION("logs matched by address, topic or wildcard") {
+        const auto by_address = add_tracked_filter({address1}, {});
+        const auto by_topic = add_tracked_filter({}, {{topic1}});
+        const auto by_position = add_tracked_filter({}, {{}, {topic1}});
+        const auto wildcard = add_tracked_filter({}, {});
+        CHECK(filter_storage.has_tracked_filters());
+
+        filter_storage.on_new_block(100, block_logs);
+
+        const auto address_changes = filter_storage.take_changes(by_address, 100);
+        REQUIRE(address_changes.has_value());
+        REQUIRE(address_changes->logs.size() == 1);
+        CHECK(address_changes->logs[0].index == 0);
+        CHECK(address_changes->from_block > address_changes->to_block);
+
+        const auto topic_changes = filter_storage.take_changes(by_topic, 100);
+        REQUIRE(topic_changes.has_value());
+        REQUIRE(topic_changes->logs.size() == 2);
+        CHECK(topic_changes->logs[0].index == 0);
+        CHECK(topic_changes->logs[1].index == 2);
+
+        const auto position_changes = filter_storage.take_changes(by_position, 100);
+        REQUIRE(position_changes.has_value());
+        REQUIRE(position_changes->logs.size() == 1);
+        CHECK(position_changes->logs[0].index == 1);
+
+        const auto wildcard_changes = filter_storage.take_changes(wildcard, 100);
+        REQUIRE(wildcard_changes.has_value());
+        CHECK(wildcard_changes->logs.size() == 3);
+    }
+    SECTION("missing blocks are left for scanning") {
+        const auto filter_id = add_tracked_filter({address2}, {});
+
+        // Block 101 is not the next one expected by the filter, so it must be scanned
+        filter_storage.on_new_block(101, block_logs);
+        const auto changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(changes.has_value());
+        CHECK(changes->logs.empty());
+        CHECK(changes->from_block == 100);
+        CHECK(changes->to_block == 101);
+
+        // Already scanned blocks are skipped, the next one is matched
+        filter_storage.on_new_block(101, block_logs);
+        filter_storage.on_new_block(102, block_logs);
+        const auto next_changes = filter_storage.take_changes(filter_id, 102);
+        REQUIRE(next_changes.has_value());
+        CHECK(next_changes->logs.size() == 2);
+        CHECK(next_changes->from_block > next_changes->to_block);
+    }
+    SECTION("removed filter is unindexed") {
+        const auto filter_id = add_tracked_filter({address1, address2}, {});
+        CHECK(filter_storage.remove_filter(filter_id));
+        CHECK_FALSE(filter_storage.has_tracked_filters());
+        CHECK_NOTHROW(filter_storage.on_new_block(100, block_logs));
+    }
+    SECTION("unwound blocks are dropped and scanned again") {
+        const auto filter_id = add_tracked_filter({address2}, {});
+        filter_storage.on_new_block(100, block_logs);
+        Logs next_block_logs{block_logs};
+        for (auto& log : next_block_logs) {
+            log.block_number = 101;
+        }
+        filter_storage.on_new_block(101, next_block_logs);
+
+        // Unwinding block 101 drops its pending logs and rewinds the filter to it
+        filter_storage.on_unwind(101);
+        const auto changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(changes.has_value());
+        REQUIRE(changes->logs.size() == 2);
+        CHECK(changes->logs[0].block_number == 100);
+        CHECK(changes->logs[1].block_number == 100);
+        CHECK(changes->from_block == 101);
+        CHECK(changes->to_block == 101);
+
+        // Unwinding already delivered blocks rewinds the filter to let the new canonical blocks be scanned
+        filter_storage.on_unwind(100);
+        const auto unwound_changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(unwound_changes.has_value());
+        CHECK(unwound_changes->logs.empty());
+        CHECK(unwound_changes->from_block == 100);
+        CHECK(unwound_changes->to_block == 101);
+
+        // Filters are never rewound before their start block
+        filter_storage.on_unwind(50);
+        const auto start_changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(start_changes.has_value());
+        CHECK(start_changes->from_block == 100);
+    }
+    SECTION("reset filters drop pending logs to scan them again") {
+        const auto filter_id = add_tracked_filter({address2}, {});
+        const auto other_filter_id = add_tracked_filter({address1}, {});
+        filter_storage.on_new_block(100, block_logs);
+        CHECK(filter_storage.take_changes(other_filter_id, 100)->logs.size() == 1);
+        Logs next_block_logs{block_logs};
+        for (auto& log : next_block_logs) {
+            log.block_number = 101;
+        }
+        filter_storage.on_new_block(101, next_block_logs);
+
+        // The pending logs of blocks 100 and 101 may be not canonical anymore, so both blocks must be scanned again
+        filter_storage.reset_tracked_filters();
+        const auto changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(changes.has_value());
+        CHECK(changes->logs.empty());
+        CHECK(changes->from_block == 100);
+        CHECK(changes->to_block == 101);
+
+        // The already delivered block 100 is not scanned again, just the pending block 101
+        const auto other_changes = filter_storage.take_changes(other_filter_id, 101);
+        REQUIRE(other_changes.has_value());
+        CHECK(other_changes->logs.empty());
+        CHECK(other_changes->from_block == 101);
+        CHECK(other_changes->to_block == 101);
+
+        // Filters without pending logs are left untouched
+        filter_storage.reset_tracked_filters();
+        const auto next_changes = filter_storage.take_changes(filter_id, 101);
+        REQUIRE(next_changes.has_value());
+        CHECK(next_changes->from_block > next_changes->to_block);
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -0,0 +1,74 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "filter_updater.hpp"
+
+#include <exception>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/private_service.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/rpc/core/logs_walker.hpp>
+
+namespace silkworm::rpc {
+
+FilterUpdater::FilterUpdater(boost::asio::io_context& io_context)
+    : block_cache_{must_use_shared_service<BlockCache>(io_context)},
+      filter_storage_{must_use_shared_service<FilterStorage>(io_context)},
+      database_{must_use_private_service<ethdb::Database>(io_context)},
+      block_queue_{io_context, "FilterUpdater", [this](BlockNum block_number) { return update(block_number); }} {}
+
+void FilterUpdater::on_new_block(BlockNum block_number) {
+    block_queue_.push(block_number);
+}
+
+void FilterUpdater::on_unwind(BlockNum block_number) {
+    block_queue_.on_unwind(block_number);
+    filter_storage_->on_unwind(block_number);
+}
+
+void FilterUpdater::on_subscription() {
+    block_queue_.clear();
+    filter_storage_->reset_tracked_filters();
+}
+
+Task<void> FilterUpdater::update(BlockNum block_number) {
+    // No need to read the block logs if nobody is interested in them
+    if (!filter_storage_->has_tracked_filters()) {
+        co_return;
+    }
+
+    const auto unwind_count{block_queue_.unwind_count()};
+    auto tx = co_await database_->begin();
+    try {
+        LogsWalker logs_walker{*block_cache_, *tx};
+        const auto logs = co_await logs_walker.get_block_logs(block_number);
+        if (unwind_count != block_queue_.unwind_count()) {
+            // The block may have been unwound while reading its logs: the filters will scan it when polled
+            SILK_TRACE << "FilterUpdater: block " << block_number << " skipped after unwind";
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            co_return;
+        }
+        filter_storage_->on_new_block(block_number, logs);
+        SILK_TRACE << "FilterUpdater: block " << block_number << " matched #logs: " << logs.size();
+    } catch (const std::exception& e) {
+        // The filters waiting for this block will scan the missing range when polled
+        SILK_WARN << "FilterUpdater: cannot match logs of block " << block_number << ": " << e.what();
+    }
+    co_await tx->close();  // RAII not (yet) available with coroutines
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,61 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/rpc/core/block_update_queue.hpp>
+#include <silkworm/rpc/core/filter_storage.hpp>
+#include <silkworm/rpc/ethdb/database.hpp>
+
+namespace silkworm::rpc {
+
+//! FilterUpdater feeds the logs of each new canonical block to FilterStorage, so that the logs are read and matched
+//! against all the tracked log filters just once per block instead of once per filter poll
+class FilterUpdater {
+  public:
+    //! Use the services of \p io_context, which must be the scheduler of the state changes notifying new blocks
+    explicit FilterUpdater(boost::asio::io_context& io_context);
+
+    FilterUpdater(const FilterUpdater&) = delete;
+    FilterUpdater& operator=(const FilterUpdater&) = delete;
+
+    //! Schedule the update of the tracked filters with the logs of the specified new block
+    void on_new_block(BlockNum block_number);
+
+    //! Drop the pending updates of the blocks unwound starting from the specified one and rewind the tracked filters
+    void on_unwind(BlockNum block_number);
+
+    //! Drop the pending updates and reset the tracked filters at each subscription to the state changes, because any
+    //! unwind notified while not subscribed has been missed
+    void on_subscription();
+
+  private:
+    //! Match the logs of the specified new block against the tracked filters
+    Task<void> update(BlockNum block_number);
+
+    BlockCache* block_cache_;
+    FilterStorage* filter_storage_;
+    ethdb::Database* database_;
+    BlockUpdateQueue block_queue_;
+};
+
+}  // namespace silkworm::rpc
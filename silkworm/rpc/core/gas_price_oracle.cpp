@@ -36,7 +36,11 @@ Task<intx::uint256> GasPriceOracle::suggested_price(BlockNum block_number) {
     std::vector<intx::uint256> tx_prices;
     tx_prices.reserve(kMaxSamples);
     while (tx_prices.size() < kMaxSamples && block_number > 0) {
-        co_await load_block_prices(block_number, kSamples, tx_prices);
+        if (const auto summary = fee_summaries_ ? fee_summaries_->get(block_number) : nullptr) {
+            tx_prices.insert(tx_prices.end(), summary->gas_price_samples.begin(), summary->gas_price_samples.end());
+        } else {
+            co_await load_block_prices(block_number, kSamples, tx_prices);
+        }
         block_number--;
     }
     SILK_TRACE << "GasPriceOracle::suggested_price ending block: " << block_number;
@@ -78,10 +82,20 @@ Task<void> GasPriceOracle::load_block_prices(BlockNum block_number, uint64_t lim
     SILK_TRACE << "GasPriceOracle::load_block_prices # block base_fee: 0x" << intx::hex(base_fee);
     SILK_TRACE << "GasPriceOracle::load_block_prices # block beneficiary: " << coinbase;
 
+    for (const auto& priority_fee_per_gas : block_gas_price_samples(block_with_hash->block, limit)) {
+        SILK_TRACE << " priority_fee_per_gas : 0x" << intx::hex(priority_fee_per_gas);
+        tx_prices.push_back(priority_fee_per_gas);
+    }
+}
+
+std::vector<intx::uint256> block_gas_price_samples(const silkworm::Block& block, uint64_t limit) {
+    const auto& base_fee = block.header.base_fee_per_gas.value_or(0);
+    const auto& coinbase = block.header.beneficiary;
+
     std::vector<intx::uint256> block_prices;
     int idx = 0;
-    block_prices.reserve(block_with_hash->block.transactions.size());
-    for (const auto& transaction : block_with_hash->block.transactions) {
+    block_prices.reserve(block.transactions.size());
+    for (const auto& transaction : block.transactions) {
         const auto priority_fee_per_gas = transaction.priority_fee_per_gas(base_fee);
         SILK_TRACE << "idx: " << idx++
                    << " hash: " << silkworm::to_hex(transaction.hash().bytes)
@@ -99,14 +113,10 @@ Task<void> GasPriceOracle::load_block_prices(BlockNum block_number, uint64_t lim
     }
 
     std::sort(block_prices.begin(), block_prices.end(), PriceComparator());
-
-    for (int count = 0; const auto& priority_fee_per_gas : block_prices) {
-        SILK_TRACE << " priority_fee_per_gas : 0x" << intx::hex(priority_fee_per_gas);
-        tx_prices.push_back(priority_fee_per_gas);
-        if (++count >= int(limit)) {
-            break;
-        }
+    if (block_prices.size() > limit) {
+        block_prices.resize(limit);
     }
+    return block_prices;
 }
 
 }  // namespace silkworm::rpc
@@ -27,6 +27,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/transaction.hpp>
 #include <silkworm/rpc/core/blocks.hpp>
+#include <silkworm/rpc/core/fee_summary_cache.hpp>
 
 namespace silkworm::rpc {
 
@@ -44,9 +45,14 @@ const std::uint8_t kPercentile = 60;
 
 typedef std::function<Task<std::shared_ptr<silkworm::BlockWithHash>>(BlockNum)> BlockProvider;
 
+//! \return the lowest \p limit priority fees per gas paid in \p block eligible as gas price samples, in ascending order
+std::vector<intx::uint256> block_gas_price_samples(const silkworm::Block& block, uint64_t limit);
+
 class GasPriceOracle {
   public:
-    explicit GasPriceOracle(const BlockProvider& block_provider) : block_provider_(block_provider) {}
+    //! Use the block summaries in \p fee_summaries (if any) and read the blocks through \p block_provider otherwise
+    explicit GasPriceOracle(const BlockProvider& block_provider, const FeeSummaryCache* fee_summaries = nullptr)
+        : block_provider_(block_provider), fee_summaries_{fee_summaries} {}
     virtual ~GasPriceOracle() = default;
 
     GasPriceOracle(const GasPriceOracle&) = delete;
@@ -58,6 +64,7 @@ class GasPriceOracle {
     Task<void> load_block_prices(BlockNum block_number, uint64_t limit, std::vector<intx::uint256>& tx_prices);
 
     const BlockProvider& block_provider_;
+    const FeeSummaryCache* fee_summaries_;
 };
 
 }  // namespace silkworm::rpc
@@ -464,4 +464,60 @@ TEST_CASE("suggested price") {
     }
 }
 
+static BlockFeeSummaryPtr make_summary(BlockNum block_number, std::vector<intx::uint256> gas_price_samples) {
+    BlockFeeSummary summary;
+    summary.block_number = block_number;
+    summary.gas_price_samples = std::move(gas_price_samples);
+    return std::make_shared<const BlockFeeSummary>(std::move(summary));
+}
+
+TEST_CASE("suggested price with fee summaries") {
+    WorkerPool pool{1};
+
+    std::vector<silkworm::BlockWithHash> blocks;
+    blocks.reserve(3);
+    fill_blocks_vector(blocks, kBeneficiary, FixedBlockData{0, 0x32, 0x32, 0x32, 0x32});
+
+    std::size_t block_reads{0};
+    BlockProvider block_provider = [&](BlockNum block_number) -> Task<std::shared_ptr<silkworm::BlockWithHash>> {
+        ++block_reads;
+        co_return std::make_shared<silkworm::BlockWithHash>(blocks[block_number]);
+    };
+    FeeSummaryCache fee_summaries{16};
+    GasPriceOracle gas_price_oracle{block_provider, &fee_summaries};
+
+    SECTION("summarized blocks are not read") {
+        fee_summaries.put(make_summary(1, {0x40, 0x40}));
+        fee_summaries.put(make_summary(2, {0x40, 0x40}));
+
+        auto result = boost::asio::co_spawn(pool, gas_price_oracle.suggested_price(2), boost::asio::use_future);
+        const intx::uint256& price = result.get();
+
+        CHECK(price == 0x40);
+        CHECK(block_reads == 0);
+    }
+
+    SECTION("blocks without summary are read") {
+        fee_summaries.put(make_summary(2, {0x40, 0x40}));
+
+        auto result = boost::asio::co_spawn(pool, gas_price_oracle.suggested_price(2), boost::asio::use_future);
+        const intx::uint256& price = result.get();
+
+        CHECK(price == 0x32);
+        CHECK(block_reads == 1);
+    }
+
+    SECTION("unwound summaries are not used") {
+        fee_summaries.put(make_summary(1, {0x40, 0x40}));
+        fee_summaries.put(make_summary(2, {0x40, 0x40}));
+        fee_summaries.remove_from(1);
+
+        auto result = boost::asio::co_spawn(pool, gas_price_oracle.suggested_price(2), boost::asio::use_future);
+        const intx::uint256& price = result.get();
+
+        CHECK(price == 0x32);
+        CHECK(block_reads == 2);
+    }
+}
+
 }  // namespace silkworm::rpc
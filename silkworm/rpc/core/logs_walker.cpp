@@ -16,17 +16,24 @@
 
 #include "logs_walker.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <iterator>
 #include <string>
 
 #include <boost/endian/conversion.hpp>
 
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/rlp/decode.hpp>
+#include <silkworm/core/rlp/encode.hpp>
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/db/chain/chain.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/rpc/common/async_task.hpp>
 #include <silkworm/rpc/core/blocks.hpp>
-#include <silkworm/rpc/core/cached_chain.hpp>
 #include <silkworm/rpc/ethdb/bitmap.hpp>
 #include <silkworm/rpc/ethdb/cbor.hpp>
 #include <silkworm/rpc/ethdb/walk.hpp>
@@ -35,6 +42,20 @@ namespace silkworm::rpc {
 
 using namespace db::chain;
 
+//! Compute the transaction hash from its stored encoding without decoding the whole transaction
+static evmc::bytes32 transaction_hash(ByteView encoded_txn) {
+    // Typed transactions may be stored wrapped into an RLP string: only the EIP-2718 envelope must be hashed
+    ByteView envelope{encoded_txn};
+    if (!encoded_txn.empty() && encoded_txn[0] >= rlp::kEmptyStringCode && encoded_txn[0] < rlp::kEmptyListCode) {
+        ByteView payload{encoded_txn};
+        const auto header{rlp::decode_header(payload)};
+        if (header && !header->list && header->payload_length <= payload.size()) {
+            envelope = payload.substr(0, header->payload_length);
+        }
+    }
+    return std::bit_cast<evmc_bytes32>(keccak256(envelope));
+}
+
 Task<std::pair<uint64_t, uint64_t>> LogsWalker::get_block_numbers(const Filter& filter) {
     uint64_t start{}, end{};
     if (filter.block_hash.has_value()) {
@@ -66,11 +87,9 @@ Task<std::pair<uint64_t, uint64_t>> LogsWalker::get_block_numbers(const Filter&
     co_return std::make_pair(start, end);
 }
 
-Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
-                                const FilterAddresses& addresses, const FilterTopics& topics, const LogFilterOptions& options, bool desc_order, std::vector<Log>& logs) {
-    SILK_DEBUG << "start block: " << start << " end block: " << end;
-
-    const auto chain_storage{tx_.create_storage()};
+Task<std::vector<BlockNum>> LogsWalker::get_matching_block_numbers(std::uint64_t start, std::uint64_t end,
+                                                                   const FilterAddresses& addresses, const FilterTopics& topics,
+                                                                   bool desc_order) {
     roaring::Roaring block_numbers;
     block_numbers.addRange(start, end + 1);  // [min, max)
 
@@ -95,10 +114,6 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     SILK_DEBUG << "block_numbers.cardinality(): " << block_numbers.cardinality();
     SILK_TRACE << "block_numbers: " << block_numbers.toString();
 
-    if (block_numbers.cardinality() == 0) {
-        co_return;
-    }
-
     std::vector<BlockNum> matching_block_numbers;
     matching_block_numbers.reserve(block_numbers.cardinality());
     for (const auto& block_to_match : block_numbers) {
@@ -107,67 +122,32 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     if (desc_order) {
         std::reverse(matching_block_numbers.begin(), matching_block_numbers.end());
     }
+    co_return matching_block_numbers;
+}
+
+Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
+                                const FilterAddresses& addresses, const FilterTopics& topics, const LogFilterOptions& options, bool desc_order, std::vector<Log>& logs) {
+    SILK_DEBUG << "start block: " << start << " end block: " << end;
+
+    const auto chain_storage{tx_.create_storage()};
+    const auto matching_block_numbers = co_await get_matching_block_numbers(start, end, addresses, topics, desc_order);
+    if (matching_block_numbers.empty()) {
+        co_return;
+    }
 
     std::uint64_t log_count{0};
     std::uint64_t block_count{0};
 
-    Logs chunk_logs;
-    Logs filtered_chunk_logs;
-    Logs filtered_block_logs;
-    chunk_logs.reserve(512);
-    filtered_chunk_logs.reserve(64);
-    filtered_block_logs.reserve(256);
-
     for (const auto& block_to_match : matching_block_numbers) {
-        uint32_t log_index{0};
-
-        filtered_block_logs.clear();
-        const auto block_key = silkworm::db::block_key(block_to_match);
-        SILK_DEBUG << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
-        co_await ethdb::for_prefix(tx_, db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
-            chunk_logs.clear();
-            const bool decoding_ok{cbor_decode(v, chunk_logs)};
-            if (!decoding_ok) {
-                return false;
-            }
-            for (auto& log : chunk_logs) {
-                log.index = log_index++;
-            }
-            SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
-
-            filtered_chunk_logs.clear();
-            filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs, options.log_count == 0 ? 0 : options.log_count - log_count);
-
-            if (!filtered_chunk_logs.empty()) {
-                const auto tx_index = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
-                SILK_TRACE << "Transaction index: " << tx_index;
-                for (auto& log : filtered_chunk_logs) {
-                    log.tx_index = tx_index;
-                }
-                log_count += filtered_chunk_logs.size();
-                SILK_TRACE << "log_count: " << log_count;
-                filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
-            }
-            return options.log_count == 0 || options.log_count > log_count;
-        });
+        SILK_DEBUG << "block_to_match: " << block_to_match;
+        const auto chunks = co_await read_block_log_chunks(block_to_match);
+        auto filtered_block_logs = decode_and_filter_logs(chunks, addresses, topics, options.log_count == 0 ? 0 : options.log_count - log_count);
         SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
 
         if (!filtered_block_logs.empty()) {
-            const auto block_with_hash = co_await core::read_block_by_number(block_cache_, *chain_storage, block_to_match);
-            if (!block_with_hash) {
-                throw std::invalid_argument("read_block_by_number: block not found " + std::to_string(block_to_match));
-            }
-            SILK_TRACE << "assigning block_hash: " << silkworm::to_hex(block_with_hash->hash);
-            for (auto& log : filtered_block_logs) {
-                const auto tx_hash{block_with_hash->block.transactions[log.tx_index].hash()};
-                log.block_number = block_to_match;
-                log.block_hash = block_with_hash->hash;
-                log.tx_hash = silkworm::to_bytes32({tx_hash.bytes, silkworm::kHashLength});
-                if (options.add_timestamp) {
-                    log.timestamp = block_with_hash->block.header.timestamp;
-                }
-            }
-            logs.insert(logs.end(), filtered_block_logs.begin(), filtered_block_logs.end());
+            co_await assign_block_data(*chain_storage, block_to_match, options, filtered_block_logs);
+            log_count += filtered_block_logs.size();
+            logs.insert(logs.end(), std::make_move_iterator(filtered_block_logs.begin()), std::make_move_iterator(filtered_block_logs.end()));
         }
         block_count++;
         if (options.log_count != 0 && options.log_count <= log_count) {
@@ -182,6 +162,188 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     co_return;
 }
 
+Task<void> LogsWalker::stream_logs(WorkerPool& workers, std::uint64_t start, std::uint64_t end,
+                                   const FilterAddresses& addresses, const FilterTopics& topics,
+                                   const LogFilterOptions& options, bool desc_order,
+                                   BlockLogsConsumer consumer) {
+    SILK_DEBUG << "start block: " << start << " end block: " << end;
+
+    const auto chain_storage{tx_.create_storage()};
+    const auto matching_block_numbers = co_await get_matching_block_numbers(start, end, addresses, topics, desc_order);
+
+    std::uint64_t log_count{0};
+    std::uint64_t block_count{0};
+
+    std::vector<BlockLogChunks> window_chunks;
+    std::vector<Logs> window_logs;
+    window_chunks.reserve(kMaxParallelBlocks);
+    window_logs.reserve(kMaxParallelBlocks);
+
+    for (std::size_t offset{0}; offset < matching_block_numbers.size(); offset += kMaxParallelBlocks) {
+        const auto window_size{std::min(kMaxParallelBlocks, matching_block_numbers.size() - offset)};
+
+        // Read the log chunks sequentially because the transaction cursors cannot be shared among concurrent tasks
+        window_chunks.clear();
+        for (std::size_t i{0}; i < window_size; ++i) {
+            window_chunks.push_back(co_await read_block_log_chunks(matching_block_numbers[offset + i]));
+        }
+
+        // Decoding and filtering are CPU-bound, so let the worker pool process the blocks in the window in parallel
+        const std::size_t max_logs{options.log_count == 0 ? 0 : options.log_count - log_count};
+        window_logs.assign(window_size, Logs{});
+        auto decode_and_filter = [&](std::size_t i) -> Task<void> {
+            window_logs[i] = co_await async_task(workers.executor(), [&, i]() {
+                return decode_and_filter_logs(window_chunks[i], addresses, topics, max_logs);
+            });
+        };
+        co_await concurrency::generate_parallel_group_task(window_size, decode_and_filter);
+
+        // Emit the logs following the block order, so that memory usage is bounded by the window size
+        for (std::size_t i{0}; i < window_size; ++i) {
+            const auto block_number{matching_block_numbers[offset + i]};
+            auto& block_logs{window_logs[i]};
+            if (options.log_count != 0 && block_logs.size() > options.log_count - log_count) {
+                block_logs.resize(options.log_count - log_count);
+            }
+            SILK_DEBUG << "block_number: " << block_number << " block_logs.size(): " << block_logs.size();
+            if (!block_logs.empty()) {
+                co_await assign_block_data(*chain_storage, block_number, options, block_logs);
+                log_count += block_logs.size();
+                consumer(block_logs);
+            }
+            block_count++;
+            if (options.log_count != 0 && options.log_count <= log_count) {
+                co_return;
+            }
+            if (options.block_count != 0 && options.block_count == block_count) {
+                co_return;
+            }
+        }
+    }
+}
+
+Task<Logs> LogsWalker::get_block_logs(BlockNum block_number) {
+    const auto chain_storage{tx_.create_storage()};
+    const auto chunks = co_await read_block_log_chunks(block_number);
+
+    uint32_t log_index{0};
+    Logs chunk_logs;
+    Logs block_logs;
+    for (const auto& [tx_index, value] : chunks) {
+        chunk_logs.clear();
+        const bool decoding_ok{cbor_decode(value, chunk_logs)};
+        if (!decoding_ok) {
+            break;
+        }
+        for (auto& log : chunk_logs) {
+            log.index = log_index++;
+            log.tx_index = tx_index;
+            block_logs.push_back(std::move(log));
+        }
+    }
+    if (!block_logs.empty()) {
+        co_await assign_block_data(*chain_storage, block_number, LogFilterOptions{}, block_logs);
+    }
+    co_return block_logs;
+}
+
+Task<LogsWalker::BlockLogChunks> LogsWalker::read_block_log_chunks(BlockNum block_number) {
+    BlockLogChunks chunks;
+    const auto block_key = silkworm::db::block_key(block_number);
+    co_await ethdb::for_prefix(tx_, db::table::kLogsName, block_key, [&](ByteView k, ByteView v) {
+        const auto tx_index = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
+        chunks.emplace_back(tx_index, Bytes{v});
+        return true;
+    });
+    co_return chunks;
+}
+
+Task<void> LogsWalker::assign_block_data(const ChainStorage& storage, BlockNum block_number,
+                                         const LogFilterOptions& options, Logs& block_logs) {
+    const auto block_hash = co_await storage.read_canonical_hash(block_number);
+    if (!block_hash) {
+        throw std::invalid_argument("read_canonical_hash: block not found " + std::to_string(block_number));
+    }
+    SILK_TRACE << "assigning block_hash: " << silkworm::to_hex(*block_hash);
+
+    std::optional<BlockTime> timestamp;
+    if (const auto cached_block = block_cache_.get(*block_hash)) {
+        const auto& block{(*cached_block)->block};
+        for (auto& log : block_logs) {
+            if (log.tx_index >= block.transactions.size()) {
+                throw std::invalid_argument("invalid transaction index " + std::to_string(log.tx_index) + " in block " + std::to_string(block_number));
+            }
+            log.tx_hash = block.transactions[log.tx_index].hash();
+        }
+        timestamp = block.header.timestamp;
+    } else {
+        std::vector<Bytes> rlp_txs;
+        if (!co_await storage.read_rlp_transactions(block_number, *block_hash, rlp_txs)) {
+            throw std::invalid_argument("read_rlp_transactions: block not found " + std::to_string(block_number));
+        }
+        // Logs are grouped by transaction, so hash each transaction just once
+        std::optional<uint32_t> last_tx_index;
+        evmc::bytes32 last_tx_hash;
+        for (auto& log : block_logs) {
+            if (log.tx_index >= rlp_txs.size()) {
+                throw std::invalid_argument("invalid transaction index " + std::to_string(log.tx_index) + " in block " + std::to_string(block_number));
+            }
+            if (log.tx_index != last_tx_index) {
+                last_tx_hash = transaction_hash(rlp_txs[log.tx_index]);
+                last_tx_index = log.tx_index;
+            }
+            log.tx_hash = last_tx_hash;
+        }
+        if (options.add_timestamp) {
+            const auto header = co_await storage.read_header(block_number, *block_hash);
+            if (!header) {
+                throw std::invalid_argument("read_header: block not found " + std::to_string(block_number));
+            }
+            timestamp = header->timestamp;
+        }
+    }
+
+    for (auto& log : block_logs) {
+        log.block_number = block_number;
+        log.block_hash = *block_hash;
+        if (options.add_timestamp) {
+            log.timestamp = timestamp;
+        }
+    }
+}
+
+Logs LogsWalker::decode_and_filter_logs(const BlockLogChunks& chunks, const FilterAddresses& addresses,
+                                        const FilterTopics& topics, size_t max_logs) {
+    uint32_t log_index{0};
+    std::size_t log_count{0};
+
+    Logs chunk_logs;
+    Logs filtered_chunk_logs;
+    Logs filtered_block_logs;
+    for (const auto& [tx_index, value] : chunks) {
+        chunk_logs.clear();
+        const bool decoding_ok{cbor_decode(value, chunk_logs)};
+        if (!decoding_ok) {
+            break;
+        }
+        for (auto& log : chunk_logs) {
+            log.index = log_index++;
+        }
+
+        filtered_chunk_logs.clear();
+        filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs, max_logs == 0 ? 0 : max_logs - log_count);
+        for (auto& log : filtered_chunk_logs) {
+            log.tx_index = tx_index;
+        }
+        log_count += filtered_chunk_logs.size();
+        filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
+        if (max_logs != 0 && max_logs <= log_count) {
+            break;
+        }
+    }
+    return filtered_block_logs;
+}
+
 void LogsWalker::filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs,
                              size_t max_logs) {
     SILK_DEBUG << "filter_logs: addresses: " << addresses << ", topics: " << topics;
@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
+#include <absl/functional/function_ref.h>
 #include <boost/asio/awaitable.hpp>
 
 #include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/db/chain/chain_storage.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
+#include <silkworm/rpc/common/worker_pool.hpp>
 #include <silkworm/rpc/ethbackend/backend.hpp>
 #include <silkworm/rpc/types/filter.hpp>
 #include <silkworm/rpc/types/log.hpp>
@@ -32,6 +37,12 @@ using boost::asio::awaitable;
 
 class LogsWalker {
   public:
+    //! The max number of candidate blocks whose logs are decoded and filtered in parallel by stream_logs
+    static constexpr std::size_t kMaxParallelBlocks{16};
+
+    //! Consumer of the matching logs of one block, called following the requested block order
+    using BlockLogsConsumer = absl::FunctionRef<void(const Logs&)>;
+
     explicit LogsWalker(BlockCache& block_cache, db::kv::api::Transaction& tx)
         : block_cache_(block_cache), tx_(tx) {}
 
@@ -49,8 +60,34 @@ class LogsWalker {
                         const LogFilterOptions& options, bool desc_order,
                         std::vector<Log>& logs);
 
+    //! Stream the logs matching the filter block-by-block to \p consumer without accumulating them: candidate blocks
+    //! are read sequentially in windows of kMaxParallelBlocks, their logs are decoded and filtered in parallel on
+    //! \p workers and then emitted in the same order as get_logs
+    Task<void> stream_logs(WorkerPool& workers, std::uint64_t start, std::uint64_t end,
+                           const FilterAddresses& addresses, const FilterTopics& topics,
+                           const LogFilterOptions& options, bool desc_order,
+                           BlockLogsConsumer consumer);
+
+    //! Get all the logs of the specified block in natural order
+    Task<Logs> get_block_logs(BlockNum block_number);
+
   private:
-    void filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs, size_t max_logs);
+    //! The CBOR-encoded log chunks of one block keyed by transaction index
+    using BlockLogChunks = std::vector<std::pair<uint32_t, Bytes>>;
+
+    Task<std::vector<BlockNum>> get_matching_block_numbers(std::uint64_t start, std::uint64_t end,
+                                                           const FilterAddresses& addresses, const FilterTopics& topics,
+                                                           bool desc_order);
+    Task<BlockLogChunks> read_block_log_chunks(BlockNum block_number);
+
+    //! Assign block number, block hash, transaction hash and optionally timestamp to the logs of one block
+    //! reading just the block hash and the encoded transactions instead of the whole block
+    Task<void> assign_block_data(const db::chain::ChainStorage& storage, BlockNum block_number,
+                                 const LogFilterOptions& options, Logs& block_logs);
+
+    static Logs decode_and_filter_logs(const BlockLogChunks& chunks, const FilterAddresses& addresses,
+                                       const FilterTopics& topics, size_t max_logs);
+    static void filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs, size_t max_logs);
 
     BlockCache& block_cache_;
     db::kv::api::Transaction& tx_;
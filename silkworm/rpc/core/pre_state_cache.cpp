@@ -0,0 +1,138 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "pre_state_cache.hpp"
+
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace silkworm::rpc::state {
+
+std::size_t PreStateCache::StorageKeyHash::operator()(const StorageKey& key) const noexcept {
+    return std::hash<evmc::bytes32>{}(key.second) ^ (key.first * 0x9e3779b97f4a7c15ull);
+}
+
+PreStateCache::PreStateCache(std::shared_ptr<silkworm::State> inner_state)
+    : inner_state_{std::move(inner_state)} {}
+
+std::optional<silkworm::Account> PreStateCache::read_account(const evmc::address& address) const noexcept {
+    {
+        std::shared_lock lock{mutex_};
+        if (const auto it = accounts_.find(address); it != accounts_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock{mutex_};
+    if (const auto it = accounts_.find(address); it != accounts_.end()) {
+        return it->second;
+    }
+    auto account{inner_state_->read_account(address)};
+    accounts_.emplace(address, account);
+    return account;
+}
+
+silkworm::ByteView PreStateCache::read_code(const evmc::bytes32& code_hash) const noexcept {
+    {
+        std::shared_lock lock{mutex_};
+        if (const auto it = code_.find(code_hash); it != code_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock{mutex_};
+    if (const auto it = code_.find(code_hash); it != code_.end()) {
+        return it->second;
+    }
+    const auto [it, _] = code_.emplace(code_hash, Bytes{inner_state_->read_code(code_hash)});
+    return it->second;
+}
+
+evmc::bytes32 PreStateCache::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
+    const StorageKey key{incarnation, location};
+    {
+        std::shared_lock lock{mutex_};
+        if (const auto it = storage_.find(address); it != storage_.end()) {
+            if (const auto slot_it = it->second.find(key); slot_it != it->second.end()) {
+                return slot_it->second;
+            }
+        }
+    }
+    std::unique_lock lock{mutex_};
+    auto& slots = storage_[address];
+    if (const auto slot_it = slots.find(key); slot_it != slots.end()) {
+        return slot_it->second;
+    }
+    const auto value{inner_state_->read_storage(address, incarnation, location)};
+    slots.emplace(key, value);
+    return value;
+}
+
+uint64_t PreStateCache::previous_incarnation(const evmc::address& address) const noexcept {
+    {
+        std::shared_lock lock{mutex_};
+        if (const auto it = previous_incarnations_.find(address); it != previous_incarnations_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock{mutex_};
+    if (const auto it = previous_incarnations_.find(address); it != previous_incarnations_.end()) {
+        return it->second;
+    }
+    const auto incarnation{inner_state_->previous_incarnation(address)};
+    previous_incarnations_.emplace(address, incarnation);
+    return incarnation;
+}
+
+std::optional<silkworm::BlockHeader> PreStateCache::read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept {
+    std::unique_lock lock{mutex_};
+    return inner_state_->read_header(block_number, block_hash);
+}
+
+bool PreStateCache::read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept {
+    std::unique_lock lock{mutex_};
+    return inner_state_->read_body(block_number, block_hash, out);
+}
+
+std::optional<intx::uint256> PreStateCache::total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept {
+    std::unique_lock lock{mutex_};
+    return inner_state_->total_difficulty(block_number, block_hash);
+}
+
+evmc::bytes32 PreStateCache::state_root_hash() const {
+    std::unique_lock lock{mutex_};
+    return inner_state_->state_root_hash();
+}
+
+BlockNum PreStateCache::current_canonical_block() const {
+    std::unique_lock lock{mutex_};
+    return inner_state_->current_canonical_block();
+}
+
+std::optional<evmc::bytes32> PreStateCache::canonical_hash(BlockNum block_number) const {
+    std::unique_lock lock{mutex_};
+    return inner_state_->canonical_hash(block_number);
+}
+
+std::size_t PreStateCache::size() const {
+    std::shared_lock lock{mutex_};
+    std::size_t size{accounts_.size() + code_.size()};
+    for (const auto& [_, slots] : storage_) {
+        size += slots.size();
+    }
+    return size;
+}
+
+}  // namespace silkworm::rpc::state
@@ -0,0 +1,119 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/state/state.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/core/types/block.hpp>
+
+namespace silkworm::rpc::state {
+
+//! \brief Read-only State recording into memory every account, storage slot and code read from the inner state.
+//! \details Meant to run several executions against the same pre-state: the first one loads the accessed state from
+//! the inner state, the following ones find it in memory. Reads can be issued concurrently by executions running on
+//! different threads: the cached ones just take a shared lock, the missing ones are serialized on the inner state,
+//! which does not need to be thread-safe. Updates are ignored.
+class PreStateCache : public silkworm::State {
+  public:
+    explicit PreStateCache(std::shared_ptr<silkworm::State> inner_state);
+
+    std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
+
+    silkworm::ByteView read_code(const evmc::bytes32& code_hash) const noexcept override;
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept override;
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override;
+
+    std::optional<silkworm::BlockHeader> read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override;
+
+    bool read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept override;
+
+    std::optional<intx::uint256> total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override;
+
+    evmc::bytes32 state_root_hash() const override;
+
+    BlockNum current_canonical_block() const override;
+
+    std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override;
+
+    void insert_block(const silkworm::Block& /*block*/, const evmc::bytes32& /*hash*/) override {}
+
+    void canonize_block(BlockNum /*block_number*/, const evmc::bytes32& /*block_hash*/) override {}
+
+    void decanonize_block(BlockNum /*block_number*/) override {}
+
+    void insert_receipts(BlockNum /*block_number*/, const std::vector<silkworm::Receipt>& /*receipts*/) override {}
+
+    void insert_call_traces(BlockNum /*block_number*/, const CallTraces& /*traces*/) override {}
+
+    void begin_block(BlockNum /*block_number*/, size_t /*updated_accounts_count*/) override {}
+
+    void update_account(
+        const evmc::address& /*address*/,
+        std::optional<silkworm::Account> /*initial*/,
+        std::optional<silkworm::Account> /*current*/) override {}
+
+    void update_account_code(
+        const evmc::address& /*address*/,
+        uint64_t /*incarnation*/,
+        const evmc::bytes32& /*code_hash*/,
+        silkworm::ByteView /*code*/) override {}
+
+    void update_storage(
+        const evmc::address& /*address*/,
+        uint64_t /*incarnation*/,
+        const evmc::bytes32& /*location*/,
+        const evmc::bytes32& /*initial*/,
+        const evmc::bytes32& /*current*/) override {}
+
+    void unwind_state_changes(BlockNum /*block_number*/) override {}
+
+    //! Number of accounts, storage slots and code entries held in memory
+    [[nodiscard]] std::size_t size() const;
+
+  private:
+    //! Storage slots read at the given incarnation of one account
+    using StorageKey = std::pair<uint64_t, evmc::bytes32>;
+    struct StorageKeyHash {
+        std::size_t operator()(const StorageKey& key) const noexcept;
+    };
+
+    std::shared_ptr<silkworm::State> inner_state_;
+
+    //! Shared for the lookups, exclusive for the inner state reads and the insertions
+    mutable std::shared_mutex mutex_;
+    mutable FlatHashMap<evmc::address, std::optional<silkworm::Account>> accounts_;
+    mutable FlatHashMap<evmc::address, std::unordered_map<StorageKey, evmc::bytes32, StorageKeyHash>> storage_;
+    //! Node-based map to keep the returned views valid for the lifetime of this state
+    mutable std::unordered_map<evmc::bytes32, Bytes> code_;
+    mutable FlatHashMap<evmc::address, uint64_t> previous_incarnations_;
+};
+
+}  // namespace silkworm::rpc::state
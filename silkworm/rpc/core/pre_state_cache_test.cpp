@@ -0,0 +1,111 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "pre_state_cache.hpp"
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <ethash/keccak.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/state/in_memory_state.hpp>
+
+namespace silkworm::rpc::state {
+
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+static const evmc::address kAccount{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+static const evmc::address kMissingAccount{0x1000000000000000000000000000000000000001_address};
+static const evmc::bytes32 kLocation{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+static const evmc::bytes32 kValue{0x00000000000000000000000000000000000000000000000000000000000000ff_bytes32};
+
+//! In-memory state counting the reads it serves
+class CountingState : public InMemoryState {
+  public:
+    std::optional<Account> read_account(const evmc::address& address) const noexcept override {
+        ++reads;
+        return InMemoryState::read_account(address);
+    }
+
+    ByteView read_code(const evmc::bytes32& code_hash) const noexcept override {
+        ++reads;
+        return InMemoryState::read_code(code_hash);
+    }
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept override {
+        ++reads;
+        return InMemoryState::read_storage(address, incarnation, location);
+    }
+
+    mutable std::size_t reads{0};
+};
+
+TEST_CASE("PreStateCache reads the inner state once", "[rpc][core][pre_state_cache]") {
+    const Bytes code{0x60, 0x00, 0x60, 0x00, 0xf3};
+    const auto code_hash{std::bit_cast<evmc_bytes32>(keccak256(code))};
+    auto inner_state = std::make_shared<CountingState>();
+    inner_state->update_account(kAccount, std::nullopt, Account{.nonce = 1, .balance = 1'000, .code_hash = code_hash, .incarnation = 1});
+    inner_state->update_account_code(kAccount, 1, code_hash, code);
+    inner_state->update_storage(kAccount, 1, kLocation, {}, kValue);
+
+    PreStateCache state{inner_state};
+    for (int i{0}; i < 3; ++i) {
+        CHECK(state.read_account(kAccount)->balance == 1'000);
+        CHECK(!state.read_account(kMissingAccount));
+        CHECK(state.read_code(code_hash) == code);
+        CHECK(state.read_storage(kAccount, 1, kLocation) == kValue);
+        CHECK(state.read_storage(kAccount, 2, kLocation) == evmc::bytes32{});
+    }
+    CHECK(inner_state->reads == 5);
+    CHECK(state.size() == 5);
+
+    // Updates are not applied
+    state.update_account(kAccount, state.read_account(kAccount), std::nullopt);
+    CHECK(state.read_account(kAccount));
+    CHECK(inner_state->read_account(kAccount));
+}
+
+TEST_CASE("PreStateCache concurrent reads", "[rpc][core][pre_state_cache]") {
+    auto inner_state = std::make_shared<CountingState>();
+    inner_state->update_account(kAccount, std::nullopt, Account{.nonce = 1, .incarnation = 1});
+    inner_state->update_storage(kAccount, 1, kLocation, {}, kValue);
+
+    PreStateCache state{inner_state};
+    std::atomic_size_t mismatches{0};
+    std::vector<std::thread> readers;
+    for (int i{0}; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            for (int j{0}; j < 1'000; ++j) {
+                if (!state.read_account(kAccount) || state.read_storage(kAccount, 1, kLocation) != kValue) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    CHECK(mismatches == 0);
+    CHECK(inner_state->reads == 2);
+}
+
+}  // namespace silkworm::rpc::state
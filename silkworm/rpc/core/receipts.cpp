@@ -18,6 +18,8 @@
 
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
+#include <silkworm/db/kv/api/cursor.hpp>
+#include <silkworm/db/receipt_offsets.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/db/util.hpp>
 #include <silkworm/infra/common/log.hpp>
@@ -28,6 +30,40 @@ namespace silkworm::rpc::core {
 
 using ethdb::walk;
 
+//! Add to the receipt of the transaction at \p tx_index the fields derived from block and transaction
+static void add_derived_fields(Receipt& receipt, const silkworm::BlockWithHash& block_with_hash, uint32_t tx_index, uint32_t first_log_index) {
+    const auto& transaction{block_with_hash.block.transactions[tx_index]};
+    const BlockNum block_number{block_with_hash.block.header.number};
+
+    // The tx hash can be calculated by the tx content itself
+    auto tx_hash{transaction.hash()};
+    receipt.tx_hash = to_bytes32(tx_hash.bytes);
+    receipt.tx_index = tx_index;
+
+    receipt.block_hash = block_with_hash.hash;
+    receipt.block_number = block_number;
+
+    // When tx receiver is not set, create a contract with address depending on tx sender and its nonce
+    if (!transaction.to.has_value()) {
+        receipt.contract_address = create_address(*transaction.sender(), transaction.nonce);
+    }
+
+    receipt.from = transaction.sender();
+    receipt.to = transaction.to;
+    receipt.type = static_cast<uint8_t>(transaction.type);
+
+    // The derived fields of receipt are taken from block and transaction
+    uint32_t log_index{first_log_index};
+    for (auto& log : receipt.logs) {
+        log.block_number = block_number;
+        log.block_hash = block_with_hash.hash;
+        log.tx_hash = receipt.tx_hash;
+        log.tx_index = tx_index;
+        log.index = log_index++;
+        log.removed = false;
+    }
+}
+
 Task<Receipts> get_receipts(db::kv::api::Transaction& tx, const silkworm::BlockWithHash& block_with_hash) {
     const auto cached_receipts = co_await read_receipts(tx, block_with_hash);
     if (cached_receipts) {
@@ -42,7 +78,6 @@ Task<Receipts> get_receipts(db::kv::api::Transaction& tx, const silkworm::BlockW
 }
 
 Task<std::optional<Receipts>> read_receipts(db::kv::api::Transaction& tx, const silkworm::BlockWithHash& block_with_hash) {
-    const evmc::bytes32 block_hash = block_with_hash.hash;
     uint64_t block_number = block_with_hash.block.header.number;
     auto raw_receipts = co_await read_raw_receipts(tx, block_number);
     if (!raw_receipts || raw_receipts->empty()) {
@@ -58,18 +93,8 @@ Task<std::optional<Receipts>> read_receipts(db::kv::api::Transaction& tx, const
     }
     uint32_t log_index{0};
     for (size_t i{0}; i < receipts.size(); i++) {
-        // The tx hash can be calculated by the tx content itself
-        auto tx_hash{transactions[i].hash()};
-        receipts[i].tx_hash = to_bytes32(tx_hash.bytes);
-        receipts[i].tx_index = uint32_t(i);
-
-        receipts[i].block_hash = block_hash;
-        receipts[i].block_number = block_number;
-
-        // When tx receiver is not set, create a contract with address depending on tx sender and its nonce
-        if (!transactions[i].to.has_value()) {
-            receipts[i].contract_address = create_address(*transactions[i].sender(), transactions[i].nonce);
-        }
+        add_derived_fields(receipts[i], block_with_hash, static_cast<uint32_t>(i), log_index);
+        log_index += static_cast<uint32_t>(receipts[i].logs.size());
 
         // The gas used can be calculated by the previous receipt
         if (i == 0) {
@@ -77,20 +102,6 @@ Task<std::optional<Receipts>> read_receipts(db::kv::api::Transaction& tx, const
         } else {
             receipts[i].gas_used = receipts[i].cumulative_gas_used - receipts[i - 1].cumulative_gas_used;
         }
-
-        receipts[i].from = transactions[i].sender();
-        receipts[i].to = transactions[i].to;
-        receipts[i].type = static_cast<uint8_t>(transactions[i].type);
-
-        // The derived fields of receipt are taken from block and transaction
-        for (size_t j{0}; j < receipts[i].logs.size(); j++) {
-            receipts[i].logs[j].block_number = block_number;
-            receipts[i].logs[j].block_hash = block_hash;
-            receipts[i].logs[j].tx_hash = receipts[i].tx_hash;
-            receipts[i].logs[j].tx_index = uint32_t(i);
-            receipts[i].logs[j].index = log_index++;
-            receipts[i].logs[j].removed = false;
-        }
     }
 
     co_return raw_receipts;
@@ -116,7 +127,7 @@ Task<std::optional<Receipts>> read_raw_receipts(db::kv::api::Transaction& tx, Bl
 
     auto log_key = db::log_key(block_number, 0);
     SILK_DEBUG << "log_key: " << silkworm::to_hex(log_key);
-    auto walker = [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
+    auto walker = [&](ByteView k, ByteView v) {
         if (k.size() != sizeof(uint64_t) + sizeof(uint32_t)) {
             return false;
         }
@@ -135,4 +146,61 @@ Task<std::optional<Receipts>> read_raw_receipts(db::kv::api::Transaction& tx, Bl
     co_return receipts;
 }
 
+Task<bool> ReceiptOffsetsTable::is_available(ethdb::Database& database) {
+    const auto availability{availability_.load()};
+    if (availability != Availability::kUnknown) {
+        co_return availability == Availability::kPresent;
+    }
+
+    // Probe on a dedicated transaction: a remote one is terminated by the server when the table does not exist
+    auto tx = co_await database.begin();
+    bool present{true};
+    try {
+        co_await tx->cursor(db::table::kReceiptOffsetsName);
+    } catch (const db::kv::api::TableNotFoundError& e) {
+        SILK_INFO << "Receipt offsets not available, receipts read by block: " << e.what();
+        present = false;
+    }
+    if (present) {
+        co_await tx->close();
+    }
+    availability_ = present ? Availability::kPresent : Availability::kMissing;
+    co_return present;
+}
+
+Task<std::optional<Receipt>> read_receipt(db::kv::api::Transaction& tx, const silkworm::BlockWithHash& block_with_hash, uint32_t tx_index) {
+    const BlockNum block_number{block_with_hash.block.header.number};
+    const auto& transactions{block_with_hash.block.transactions};
+    if (tx_index >= transactions.size()) {
+        co_return std::nullopt;
+    }
+
+    const auto offsets_data = co_await tx.get_one(db::table::kReceiptOffsetsName, db::block_key(block_number));
+    if (offsets_data.empty() || db::receipt_offsets_count(offsets_data) != transactions.size()) {
+        co_return std::nullopt;
+    }
+    const auto offset{db::decode_receipt_offset(offsets_data, tx_index)};
+
+    Receipt receipt;
+    receipt.success = offset->success;
+    receipt.cumulative_gas_used = offset->cumulative_gas_used;
+    receipt.gas_used = offset->cumulative_gas_used;
+    if (tx_index > 0) {
+        const auto previous_offset{db::decode_receipt_offset(offsets_data, tx_index - 1)};
+        receipt.gas_used -= previous_offset->cumulative_gas_used;
+    }
+
+    const auto logs_data = co_await tx.get_one(db::table::kLogsName, db::log_key(block_number, tx_index));
+    if (!logs_data.empty()) {
+        if (!cbor_decode(logs_data, receipt.logs)) {
+            throw std::runtime_error("cannot decode logs for receipt: " + std::to_string(tx_index) + " in block: " + std::to_string(block_number));
+        }
+    }
+    receipt.bloom = bloom_from_logs(receipt.logs);
+
+    add_derived_fields(receipt, block_with_hash, tx_index, offset->first_log_index);
+
+    co_return receipt;
+}
+
 }  // namespace silkworm::rpc::core
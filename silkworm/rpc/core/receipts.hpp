@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <evmc/evmc.hpp>
 
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
+#include <silkworm/rpc/ethdb/database.hpp>
 #include <silkworm/rpc/types/receipt.hpp>
 
 namespace silkworm::rpc::core {
@@ -32,4 +36,25 @@ Task<std::optional<Receipts>> read_receipts(db::kv::api::Transaction& tx, const
 
 Task<std::optional<Receipts>> read_raw_receipts(db::kv::api::Transaction& tx, BlockNum block_number);
 
+//! Availability of the receipt offset table, probed once and then cached
+//! \details The table is written only by Silkworm, so it is missing when serving the database of another node
+class ReceiptOffsetsTable {
+  public:
+    //! Check if the receipt offset table exists in \p database, opening a cursor on it just the first time
+    Task<bool> is_available(ethdb::Database& database);
+
+  private:
+    enum class Availability : uint8_t {
+        kUnknown,
+        kPresent,
+        kMissing,
+    };
+    std::atomic<Availability> availability_{Availability::kUnknown};
+};
+
+//! Read the receipt of the transaction at \p tx_index using the receipt offset table, i.e. without decoding all the
+//! receipts and logs of the block. The table must exist (see ReceiptOffsetsTable). Returns std::nullopt if the
+//! receipt offsets are not available for the block.
+Task<std::optional<Receipt>> read_receipt(db::kv::api::Transaction& tx, const silkworm::BlockWithHash& block_with_hash, uint32_t tx_index);
+
 }  // namespace silkworm::rpc::core
@@ -27,11 +27,14 @@
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/db/kv/api/endpoint/key_value.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/receipt_offsets.hpp>
 #include <silkworm/db/tables.hpp>
 #include <silkworm/db/test_util/mock_cursor.hpp>
 #include <silkworm/db/test_util/mock_transaction.hpp>
 #include <silkworm/infra/test_util/log.hpp>
 #include <silkworm/rpc/common/worker_pool.hpp>
+#include <silkworm/rpc/test_util/mock_database.hpp>
 
 namespace silkworm::rpc::core {
 
@@ -391,4 +394,132 @@ TEST_CASE("read_receipts") {
 #endif
 }
 
+TEST_CASE("read_receipt") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    WorkerPool pool{1};
+    db::test_util::MockTransaction transaction;
+
+    silkworm::BlockWithHash block_with_hash;
+    block_with_hash.block.header.number = 4'000'000;
+    block_with_hash.hash = 0x608e7102f689c99c027c9f49860212348000eb2e13bff37aa4453605a0a2b9e7_bytes32;
+    block_with_hash.block.transactions.resize(2);
+    for (auto& txn : block_with_hash.block.transactions) {
+        txn.to = 0x5f62669ba0c6cf41cc162d8157ed71a0b9d6dbaf_address;
+        txn.set_sender(0x70a5c9d346416f901826581d423cd5b92d44ff5a_address);
+    }
+
+    SECTION("transaction index out of range") {
+        auto result = boost::asio::co_spawn(pool, read_receipt(transaction, block_with_hash, 2), boost::asio::use_future);
+        CHECK(!result.get());
+    }
+
+    SECTION("receipt offsets not available") {
+        EXPECT_CALL(transaction, get_one(db::table::kReceiptOffsetsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> { co_return silkworm::Bytes{}; }));
+        auto result = boost::asio::co_spawn(pool, read_receipt(transaction, block_with_hash, 0), boost::asio::use_future);
+        CHECK(!result.get());
+    }
+
+    SECTION("receipt offsets read error") {
+        EXPECT_CALL(transaction, get_one(db::table::kReceiptOffsetsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> {
+            throw std::runtime_error{"transport error"};
+            co_return silkworm::Bytes{};
+        }));
+        auto result = boost::asio::co_spawn(pool, read_receipt(transaction, block_with_hash, 0), boost::asio::use_future);
+        CHECK_THROWS_AS(result.get(), std::runtime_error);
+    }
+
+    SECTION("receipt offsets available") {
+        const std::vector<silkworm::Log> logs{
+            silkworm::Log{.address = 0x44fd3ab8381cc3d14afa7c4af7fd13cdc65026e1_address},
+            silkworm::Log{.address = 0xea674fdde714fd979de3edf0f56aa9716b898ec8_address},
+        };
+        std::vector<silkworm::Receipt> receipts(2);
+        receipts[0].success = true;
+        receipts[0].cumulative_gas_used = 21'000;
+        receipts[0].logs = {silkworm::Log{}};
+        receipts[1].success = true;
+        receipts[1].cumulative_gas_used = 71'000;
+        receipts[1].logs = logs;
+        EXPECT_CALL(transaction, get_one(db::table::kReceiptOffsetsName, _)).WillOnce(Invoke([&](Unused, Unused) -> Task<silkworm::Bytes> {
+            co_return db::encode_receipt_offsets(receipts);
+        }));
+        EXPECT_CALL(transaction, get_one(db::table::kLogsName, _)).WillOnce(Invoke([&](Unused, Unused) -> Task<silkworm::Bytes> {
+            co_return silkworm::cbor_encode(logs);
+        }));
+        auto result = boost::asio::co_spawn(pool, read_receipt(transaction, block_with_hash, 1), boost::asio::use_future);
+        const auto receipt = result.get();
+        REQUIRE(receipt);
+        CHECK(receipt->success);
+        CHECK(receipt->cumulative_gas_used == 71'000);
+        CHECK(receipt->gas_used == 50'000);
+        CHECK(receipt->tx_index == 1);
+        CHECK(receipt->block_number == 4'000'000);
+        CHECK(receipt->block_hash == block_with_hash.hash);
+        REQUIRE(receipt->logs.size() == 2);
+        CHECK(receipt->logs[0].address == logs[0].address);
+        CHECK(receipt->logs[0].index == 1);
+        CHECK(receipt->logs[1].index == 2);
+        CHECK(receipt->logs[1].tx_index == 1);
+    }
+}
+
+TEST_CASE("ReceiptOffsetsTable::is_available") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    WorkerPool pool{1};
+    test::MockDatabase database;
+    ReceiptOffsetsTable receipt_offsets;
+
+    const auto is_available = [&]() {
+        return boost::asio::co_spawn(pool, receipt_offsets.is_available(database), boost::asio::use_future).get();
+    };
+
+    SECTION("table present is probed once") {
+        EXPECT_CALL(database, begin()).WillOnce(InvokeWithoutArgs([]() -> Task<std::unique_ptr<db::kv::api::Transaction>> {
+            auto tx = std::make_unique<db::test_util::MockTransaction>();
+            EXPECT_CALL(*tx, cursor(db::table::kReceiptOffsetsName)).WillOnce(InvokeWithoutArgs([]() -> Task<std::shared_ptr<db::kv::api::Cursor>> {
+                co_return std::make_shared<db::test_util::MockCursor>();
+            }));
+            EXPECT_CALL(*tx, close()).WillOnce(InvokeWithoutArgs([]() -> Task<void> { co_return; }));
+            co_return tx;
+        }));
+        CHECK(is_available());
+        CHECK(is_available());
+    }
+
+    SECTION("table missing is probed once") {
+        EXPECT_CALL(database, begin()).WillOnce(InvokeWithoutArgs([]() -> Task<std::unique_ptr<db::kv::api::Transaction>> {
+            auto tx = std::make_unique<db::test_util::MockTransaction>();
+            EXPECT_CALL(*tx, cursor(db::table::kReceiptOffsetsName)).WillOnce(InvokeWithoutArgs([]() -> Task<std::shared_ptr<db::kv::api::Cursor>> {
+                throw db::kv::api::TableNotFoundError{db::table::kReceiptOffsetsName};
+                co_return nullptr;
+            }));
+            co_return tx;
+        }));
+        CHECK_FALSE(is_available());
+        CHECK_FALSE(is_available());
+    }
+
+    SECTION("other errors are propagated and not cached") {
+        EXPECT_CALL(database, begin())
+            .WillOnce(InvokeWithoutArgs([]() -> Task<std::unique_ptr<db::kv::api::Transaction>> {
+                auto tx = std::make_unique<db::test_util::MockTransaction>();
+                EXPECT_CALL(*tx, cursor(db::table::kReceiptOffsetsName)).WillOnce(InvokeWithoutArgs([]() -> Task<std::shared_ptr<db::kv::api::Cursor>> {
+                    throw std::runtime_error{"transport error"};
+                    co_return nullptr;
+                }));
+                co_return tx;
+            }))
+            .WillOnce(InvokeWithoutArgs([]() -> Task<std::unique_ptr<db::kv::api::Transaction>> {
+                auto tx = std::make_unique<db::test_util::MockTransaction>();
+                EXPECT_CALL(*tx, cursor(db::table::kReceiptOffsetsName)).WillOnce(InvokeWithoutArgs([]() -> Task<std::shared_ptr<db::kv::api::Cursor>> {
+                    co_return std::make_shared<db::test_util::MockCursor>();
+                }));
+                EXPECT_CALL(*tx, close()).WillOnce(InvokeWithoutArgs([]() -> Task<void> { co_return; }));
+                co_return tx;
+            }));
+        CHECK_THROWS_AS(is_available(), std::runtime_error);
+        CHECK(is_available());
+    }
+}
+
 }  // namespace silkworm::rpc::core
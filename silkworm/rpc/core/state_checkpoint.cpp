@@ -0,0 +1,196 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_checkpoint.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+#include <silkworm/infra/common/ensure.hpp>
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc::state {
+
+std::size_t StateCheckpoint::byte_size() const {
+    std::size_t size{sizeof(StateCheckpoint)};
+    size += accounts.size() * (sizeof(evmc::address) + sizeof(std::optional<Account>));
+    for (const auto& [_, changes] : storage) {
+        size += sizeof(evmc::address) + sizeof(StorageChanges) + changes.slots.size() * 2 * sizeof(evmc::bytes32);
+    }
+    for (const auto& [_, bytecode] : code) {
+        size += sizeof(evmc::bytes32) + sizeof(Bytes) + bytecode.size();
+    }
+    size += (created_incarnations.size() + previous_incarnations.size()) * (sizeof(evmc::address) + sizeof(uint64_t));
+    return size;
+}
+
+CheckpointState::CheckpointState(std::shared_ptr<silkworm::State> inner_state, StateCheckpointPtr base)
+    : inner_state_{std::move(inner_state)}, base_{std::move(base)} {}
+
+StateCheckpointPtr CheckpointState::capture(IntraBlockState& ibs) {
+    ensure(&ibs.db() == this, "CheckpointState::capture: intra-block state not built on this state");
+    pending_ = base_ ? std::make_shared<StateCheckpoint>(*base_) : std::make_shared<StateCheckpoint>();
+    // The intra-block state writes all the changes since the beginning of the block (i.e. since the base checkpoint)
+    ibs.write_to_db(/*block_number=*/0);
+    return std::exchange(pending_, nullptr);
+}
+
+std::optional<silkworm::Account> CheckpointState::read_account(const evmc::address& address) const noexcept {
+    if (base_) {
+        if (const auto it = base_->accounts.find(address); it != base_->accounts.end()) {
+            return it->second;
+        }
+    }
+    return inner_state_->read_account(address);
+}
+
+silkworm::ByteView CheckpointState::read_code(const evmc::bytes32& code_hash) const noexcept {
+    if (base_) {
+        if (const auto it = base_->code.find(code_hash); it != base_->code.end()) {
+            return it->second;
+        }
+    }
+    return inner_state_->read_code(code_hash);
+}
+
+evmc::bytes32 CheckpointState::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
+    if (base_) {
+        if (const auto it = base_->storage.find(address); it != base_->storage.end() && it->second.incarnation == incarnation) {
+            if (const auto slot_it = it->second.slots.find(location); slot_it != it->second.slots.end()) {
+                return slot_it->second;
+            }
+        }
+        if (const auto it = base_->created_incarnations.find(address); it != base_->created_incarnations.end() && it->second == incarnation) {
+            return {};
+        }
+    }
+    return inner_state_->read_storage(address, incarnation, location);
+}
+
+uint64_t CheckpointState::previous_incarnation(const evmc::address& address) const noexcept {
+    const uint64_t previous_incarnation{inner_state_->previous_incarnation(address)};
+    if (base_) {
+        if (const auto it = base_->previous_incarnations.find(address); it != base_->previous_incarnations.end()) {
+            return std::max(it->second, previous_incarnation);
+        }
+    }
+    return previous_incarnation;
+}
+
+void CheckpointState::update_account(const evmc::address& address,
+                                     std::optional<silkworm::Account> initial,
+                                     std::optional<silkworm::Account> current) {
+    if (!pending_ || initial == current) {
+        return;
+    }
+    if (current) {
+        if (!initial || initial->incarnation != current->incarnation) {
+            pending_->created_incarnations[address] = current->incarnation;
+        }
+    } else if (initial) {
+        auto& previous_incarnation = pending_->previous_incarnations[address];
+        previous_incarnation = std::max(previous_incarnation, initial->incarnation);
+    }
+    pending_->accounts.insert_or_assign(address, std::move(current));
+}
+
+void CheckpointState::update_account_code(const evmc::address& /*address*/,
+                                          uint64_t /*incarnation*/,
+                                          const evmc::bytes32& code_hash,
+                                          silkworm::ByteView code) {
+    if (!pending_) {
+        return;
+    }
+    pending_->code.try_emplace(code_hash, code);
+}
+
+void CheckpointState::update_storage(const evmc::address& address,
+                                     uint64_t incarnation,
+                                     const evmc::bytes32& location,
+                                     const evmc::bytes32& initial,
+                                     const evmc::bytes32& current) {
+    if (!pending_ || initial == current) {
+        return;
+    }
+    auto& changes = pending_->storage[address];
+    if (changes.incarnation != incarnation) {
+        // Slots written at a previous incarnation are unreachable after the account has been recreated
+        changes.incarnation = incarnation;
+        changes.slots.clear();
+    }
+    changes.slots.insert_or_assign(location, current);
+}
+
+std::size_t StateCheckpointKeyHash::operator()(const StateCheckpointKey& key) const noexcept {
+    return std::hash<evmc::bytes32>{}(key.block_hash) ^ (key.txn_count * 0x9e3779b97f4a7c15ull);
+}
+
+StateCheckpointCache::StateCheckpointCache(std::size_t interval, std::size_t capacity)
+    : interval_{std::max<std::size_t>(interval, 1)}, cache_{capacity} {}
+
+std::optional<std::pair<std::size_t, StateCheckpointPtr>> StateCheckpointCache::find_nearest(const evmc::bytes32& block_hash,
+                                                                                             std::size_t txn_count) {
+    for (std::size_t count = txn_count - txn_count % interval_; count > 0; count -= interval_) {
+        if (auto checkpoint = cache_.get_as_copy({block_hash, count})) {
+            return std::make_pair(count, std::move(*checkpoint));
+        }
+    }
+    return std::nullopt;
+}
+
+void StateCheckpointCache::put(const evmc::bytes32& block_hash, std::size_t txn_count, StateCheckpointPtr checkpoint) {
+    const std::size_t byte_size = checkpoint->byte_size();
+    cache_.put({block_hash, txn_count}, std::move(checkpoint), byte_size);
+}
+
+CheckpointedReplay::CheckpointedReplay(StateCheckpointCache* cache,
+                                       const silkworm::Block& block,
+                                       std::shared_ptr<silkworm::State> block_start_state,
+                                       std::size_t txn_index)
+    : cache_{cache} {
+    if (!cache_ || txn_index < cache_->interval()) {
+        // Too few transactions to replay: no checkpoint to restore nor to take
+        cache_ = nullptr;
+        state_ = std::move(block_start_state);
+        return;
+    }
+    block_hash_ = block.header.hash();
+    if (auto nearest = cache_->find_nearest(block_hash_, txn_index)) {
+        std::tie(first_index_, checkpoint_) = std::move(*nearest);
+        SILK_DEBUG << "CheckpointedReplay: block " << block.header.number << " restored checkpoint after " << first_index_
+                   << " transactions, replaying " << txn_index - first_index_;
+    }
+    checkpoint_state_ = std::make_shared<CheckpointState>(std::move(block_start_state), checkpoint_);
+    state_ = checkpoint_state_;
+}
+
+std::shared_ptr<silkworm::State> CheckpointedReplay::restored(std::shared_ptr<silkworm::State> block_start_state) const {
+    if (!checkpoint_) {
+        return block_start_state;
+    }
+    return std::make_shared<CheckpointState>(std::move(block_start_state), checkpoint_);
+}
+
+void CheckpointedReplay::on_executed(std::size_t index, IntraBlockState& ibs) {
+    const std::size_t txn_count{index + 1};
+    if (!cache_ || txn_count % cache_->interval() != 0) {
+        return;
+    }
+    cache_->put(block_hash_, txn_count, checkpoint_state_->capture(ibs));
+}
+
+}  // namespace silkworm::rpc::state
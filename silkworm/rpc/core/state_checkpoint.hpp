@@ -0,0 +1,214 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/common/sharded_cache.hpp>
+#include <silkworm/core/state/intra_block_state.hpp>
+#include <silkworm/core/state/state.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/rpc/common/constants.hpp>
+
+namespace silkworm::rpc::state {
+
+//! Changes applied to the state at the beginning of a block by its first transactions
+struct StateCheckpoint {
+    //! Storage slots written at the given incarnation of one account
+    struct StorageChanges {
+        uint64_t incarnation{0};
+        FlatHashMap<evmc::bytes32, evmc::bytes32> slots;
+    };
+
+    //! Current account values, std::nullopt meaning the account has been deleted
+    FlatHashMap<evmc::address, std::optional<Account>> accounts;
+    FlatHashMap<evmc::address, StorageChanges> storage;
+    FlatHashMap<evmc::bytes32, Bytes> code;
+    //! Incarnations of the accounts (re)created within the block: their storage starts empty
+    FlatHashMap<evmc::address, uint64_t> created_incarnations;
+    //! Incarnations of the accounts deleted within the block
+    FlatHashMap<evmc::address, uint64_t> previous_incarnations;
+
+    //! Approximate memory footprint in bytes
+    [[nodiscard]] std::size_t byte_size() const;
+};
+
+using StateCheckpointPtr = std::shared_ptr<const StateCheckpoint>;
+
+//! \brief State overlaying the changes of one StateCheckpoint on top of the state at the beginning of the block.
+//! \details Updates are not applied to the inner state: when an IntraBlockState writes to this state within capture,
+//! its changes are merged into a new checkpoint instead, otherwise they are ignored.
+class CheckpointState : public silkworm::State {
+  public:
+    explicit CheckpointState(std::shared_ptr<silkworm::State> inner_state, StateCheckpointPtr base = nullptr);
+
+    //! Capture the changes applied by \p ibs, which must be built on top of this state, as a new checkpoint
+    StateCheckpointPtr capture(IntraBlockState& ibs);
+
+    std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
+
+    silkworm::ByteView read_code(const evmc::bytes32& code_hash) const noexcept override;
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept override;
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override;
+
+    std::optional<silkworm::BlockHeader> read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override {
+        return inner_state_->read_header(block_number, block_hash);
+    }
+
+    bool read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept override {
+        return inner_state_->read_body(block_number, block_hash, out);
+    }
+
+    std::optional<intx::uint256> total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override {
+        return inner_state_->total_difficulty(block_number, block_hash);
+    }
+
+    evmc::bytes32 state_root_hash() const override {
+        return inner_state_->state_root_hash();
+    }
+
+    BlockNum current_canonical_block() const override {
+        return inner_state_->current_canonical_block();
+    }
+
+    std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override {
+        return inner_state_->canonical_hash(block_number);
+    }
+
+    void insert_block(const silkworm::Block& /*block*/, const evmc::bytes32& /*hash*/) override {}
+
+    void canonize_block(BlockNum /*block_number*/, const evmc::bytes32& /*block_hash*/) override {}
+
+    void decanonize_block(BlockNum /*block_number*/) override {}
+
+    void insert_receipts(BlockNum /*block_number*/, const std::vector<silkworm::Receipt>& /*receipts*/) override {}
+
+    void insert_call_traces(BlockNum /*block_number*/, const CallTraces& /*traces*/) override {}
+
+    void begin_block(BlockNum /*block_number*/, size_t /*updated_accounts_count*/) override {}
+
+    void update_account(
+        const evmc::address& address,
+        std::optional<silkworm::Account> initial,
+        std::optional<silkworm::Account> current) override;
+
+    void update_account_code(
+        const evmc::address& address,
+        uint64_t incarnation,
+        const evmc::bytes32& code_hash,
+        silkworm::ByteView code) override;
+
+    void update_storage(
+        const evmc::address& address,
+        uint64_t incarnation,
+        const evmc::bytes32& location,
+        const evmc::bytes32& initial,
+        const evmc::bytes32& current) override;
+
+    void unwind_state_changes(BlockNum /*block_number*/) override {}
+
+  private:
+    std::shared_ptr<silkworm::State> inner_state_;
+    StateCheckpointPtr base_;
+    std::shared_ptr<StateCheckpoint> pending_;
+};
+
+//! Key identifying the state after the first \p txn_count transactions of one block
+struct StateCheckpointKey {
+    evmc::bytes32 block_hash;
+    std::size_t txn_count{0};
+
+    friend bool operator==(const StateCheckpointKey&, const StateCheckpointKey&) = default;
+};
+
+struct StateCheckpointKeyHash {
+    std::size_t operator()(const StateCheckpointKey& key) const noexcept;
+};
+
+inline constexpr std::size_t kDefaultStateCheckpointCacheCapacity{256_Mebi};
+
+//! \brief Cache of the intra-block state checkpoints taken every \p interval transactions while replaying blocks.
+//! \details Tracing one transaction requires executing all the preceding ones in the same block: restoring the nearest
+//! checkpoint allows to replay at most interval - 1 transactions. Checkpoints are keyed by block hash, so they never
+//! need invalidation on reorgs and simply age out.
+class StateCheckpointCache {
+  public:
+    explicit StateCheckpointCache(std::size_t interval = kDefaultTraceCheckpointInterval,
+                                  std::size_t capacity = kDefaultStateCheckpointCacheCapacity);
+
+    [[nodiscard]] std::size_t interval() const { return interval_; }
+
+    //! Find the cached checkpoint with the highest transaction count not greater than \p txn_count
+    //! \return the transaction count of the checkpoint and the checkpoint itself, if any
+    std::optional<std::pair<std::size_t, StateCheckpointPtr>> find_nearest(const evmc::bytes32& block_hash, std::size_t txn_count);
+
+    void put(const evmc::bytes32& block_hash, std::size_t txn_count, StateCheckpointPtr checkpoint);
+
+    [[nodiscard]] std::size_t size() const { return cache_.size(); }
+
+  private:
+    std::size_t interval_;
+    ShardedCache<StateCheckpointKey, StateCheckpointPtr, StateCheckpointKeyHash> cache_;
+};
+
+//! \brief Replay of the transactions preceding a target one within a block, resuming from the nearest checkpoint.
+//! \details The replay must execute the transactions in [first_index(), txn_index) on the state returned by state()
+//! calling on_executed after each one: the intermediate states falling on the checkpoint interval get cached.
+class CheckpointedReplay {
+  public:
+    //! \param cache the checkpoint cache (if nullptr all the preceding transactions are replayed)
+    //! \param block the block containing the target transaction
+    //! \param block_start_state the state at the beginning of \p block
+    //! \param txn_index the index of the target transaction in \p block
+    CheckpointedReplay(StateCheckpointCache* cache,
+                       const silkworm::Block& block,
+                       std::shared_ptr<silkworm::State> block_start_state,
+                       std::size_t txn_index);
+
+    //! The state to replay the transactions on
+    [[nodiscard]] std::shared_ptr<silkworm::State> state() const { return state_; }
+
+    //! The index of the first transaction to replay
+    [[nodiscard]] std::size_t first_index() const { return first_index_; }
+
+    //! Wrap \p block_start_state so that it reflects the changes of the restored checkpoint (if any)
+    [[nodiscard]] std::shared_ptr<silkworm::State> restored(std::shared_ptr<silkworm::State> block_start_state) const;
+
+    //! Notify that the transaction at \p index has been executed on \p ibs, which is built on top of state()
+    void on_executed(std::size_t index, IntraBlockState& ibs);
+
+  private:
+    StateCheckpointCache* cache_;
+    evmc::bytes32 block_hash_;
+    std::size_t first_index_{0};
+    StateCheckpointPtr checkpoint_;
+    std::shared_ptr<CheckpointState> checkpoint_state_;
+    std::shared_ptr<silkworm::State> state_;
+};
+
+}  // namespace silkworm::rpc::state
@@ -0,0 +1,175 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_checkpoint.hpp"
+
+#include <bit>
+#include <memory>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+#include <ethash/keccak.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/state/in_memory_state.hpp>
+
+namespace silkworm::rpc::state {
+
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+static const evmc::address kAccount{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address};
+static const evmc::address kContract{0x6d3b8d5df3e2bbc2b5e9e55ec4f3b9a3a8c3d7e1_address};
+static const evmc::bytes32 kLocation{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+static const evmc::bytes32 kValue{0x00000000000000000000000000000000000000000000000000000000000000ff_bytes32};
+
+static std::shared_ptr<InMemoryState> make_block_start_state() {
+    auto state = std::make_shared<InMemoryState>();
+    state->update_account(kAccount, std::nullopt, Account{.nonce = 1, .balance = 1'000});
+    state->update_account(kContract, std::nullopt, Account{.nonce = 1, .incarnation = 1});
+    state->update_storage(kContract, 1, kLocation, {}, kValue);
+    return state;
+}
+
+TEST_CASE("CheckpointState without checkpoint", "[rpc][core][state_checkpoint]") {
+    auto inner_state = make_block_start_state();
+    CheckpointState state{inner_state};
+    CHECK(state.read_account(kAccount)->balance == 1'000);
+    CHECK(state.read_storage(kContract, 1, kLocation) == kValue);
+
+    // Updates outside capture are ignored
+    state.update_account(kAccount, state.read_account(kAccount), std::nullopt);
+    CHECK(inner_state->read_account(kAccount));
+}
+
+TEST_CASE("CheckpointState capture and restore", "[rpc][core][state_checkpoint]") {
+    auto inner_state = make_block_start_state();
+    const Bytes code{0x60, 0x00, 0x60, 0x00, 0xf3};
+    const auto code_hash{std::bit_cast<evmc_bytes32>(keccak256(code))};
+    const evmc::address new_contract{0x1000000000000000000000000000000000000001_address};
+
+    auto first_state = std::make_shared<CheckpointState>(inner_state);
+    IntraBlockState first_ibs{*first_state};
+    first_ibs.set_balance(kAccount, 500);
+    first_ibs.set_storage(kContract, kLocation, {});
+    first_ibs.create_contract(new_contract);
+    first_ibs.set_code(new_contract, code);
+    first_ibs.set_storage(new_contract, kLocation, kValue);
+    first_ibs.finalize_transaction(EVMC_SHANGHAI);
+    const auto first_checkpoint = first_state->capture(first_ibs);
+
+    // The block start state is left untouched
+    CHECK(inner_state->read_account(kAccount)->balance == 1'000);
+
+    auto second_state = std::make_shared<CheckpointState>(inner_state, first_checkpoint);
+    IntraBlockState second_ibs{*second_state};
+    CHECK(second_ibs.get_balance(kAccount) == 500);
+    CHECK(second_ibs.get_current_storage(kContract, kLocation) == evmc::bytes32{});
+    CHECK(second_ibs.get_code_hash(new_contract) == code_hash);
+    CHECK(second_ibs.get_code(new_contract) == code);
+    CHECK(second_ibs.get_current_storage(new_contract, kLocation) == kValue);
+
+    // A new checkpoint accumulates the changes of its base
+    second_ibs.set_nonce(kAccount, 2);
+    second_ibs.finalize_transaction(EVMC_SHANGHAI);
+    const auto second_checkpoint = second_state->capture(second_ibs);
+    CheckpointState third_state{inner_state, second_checkpoint};
+    CHECK(third_state.read_account(kAccount)->balance == 500);
+    CHECK(third_state.read_account(kAccount)->nonce == 2);
+    CHECK(third_state.read_code(code_hash) == code);
+
+    // Capture requires the intra-block state to be built on top of the capturing state
+    CHECK_THROWS_AS(third_state.capture(second_ibs), std::logic_error);
+}
+
+TEST_CASE("CheckpointState recreated and deleted accounts", "[rpc][core][state_checkpoint]") {
+    auto inner_state = make_block_start_state();
+    auto first_state = std::make_shared<CheckpointState>(inner_state);
+    IntraBlockState first_ibs{*first_state};
+
+    SECTION("recreated") {
+        first_ibs.create_contract(kContract);
+        first_ibs.set_nonce(kContract, 1);
+        first_ibs.finalize_transaction(EVMC_SHANGHAI);
+        CheckpointState second_state{inner_state, first_state->capture(first_ibs)};
+
+        const auto contract = second_state.read_account(kContract);
+        REQUIRE(contract);
+        CHECK(contract->incarnation == 2);
+        CHECK(second_state.read_storage(kContract, contract->incarnation, kLocation) == evmc::bytes32{});
+    }
+
+    SECTION("deleted") {
+        first_ibs.record_suicide(kContract);
+        first_ibs.finalize_transaction(EVMC_SHANGHAI);
+        CheckpointState second_state{inner_state, first_state->capture(first_ibs)};
+
+        CHECK(!second_state.read_account(kContract));
+        CHECK(second_state.previous_incarnation(kContract) == 1);
+    }
+}
+
+TEST_CASE("StateCheckpointCache find nearest", "[rpc][core][state_checkpoint]") {
+    StateCheckpointCache cache{/*interval=*/4};
+    const evmc::bytes32 block_hash{0x6d3b8d5df3e2bbc2b5e9e55ec4f3b9a3a8c3d7e16d3b8d5df3e2bbc2b5e9e55e_bytes32};
+    CHECK(!cache.find_nearest(block_hash, 10));
+
+    const auto checkpoint4 = std::make_shared<const StateCheckpoint>();
+    const auto checkpoint8 = std::make_shared<const StateCheckpoint>();
+    cache.put(block_hash, 4, checkpoint4);
+    cache.put(block_hash, 8, checkpoint8);
+    CHECK(cache.size() == 2);
+
+    CHECK(!cache.find_nearest(block_hash, 3));
+    CHECK(*cache.find_nearest(block_hash, 4) == std::make_pair(std::size_t{4}, StateCheckpointPtr{checkpoint4}));
+    CHECK(*cache.find_nearest(block_hash, 7) == std::make_pair(std::size_t{4}, StateCheckpointPtr{checkpoint4}));
+    CHECK(*cache.find_nearest(block_hash, 100) == std::make_pair(std::size_t{8}, StateCheckpointPtr{checkpoint8}));
+    CHECK(!cache.find_nearest(evmc::bytes32{}, 100));
+}
+
+TEST_CASE("CheckpointedReplay", "[rpc][core][state_checkpoint]") {
+    Block block;
+    block.header.number = 10;
+    auto inner_state = make_block_start_state();
+
+    SECTION("no cache") {
+        CheckpointedReplay replay{nullptr, block, inner_state, 100};
+        CHECK(replay.first_index() == 0);
+        CHECK(replay.state() == inner_state);
+        CHECK(replay.restored(inner_state) == inner_state);
+    }
+
+    SECTION("take and restore checkpoints") {
+        StateCheckpointCache cache{/*interval=*/2};
+        {
+            CheckpointedReplay replay{&cache, block, inner_state, 5};
+            CHECK(replay.first_index() == 0);
+            IntraBlockState ibs{*replay.state()};
+            for (std::size_t idx{0}; idx < 5; ++idx) {
+                ibs.set_nonce(kAccount, 2 + idx);
+                ibs.finalize_transaction(EVMC_SHANGHAI);
+                replay.on_executed(idx, ibs);
+            }
+            CHECK(cache.size() == 2);
+        }
+        CheckpointedReplay replay{&cache, block, inner_state, 5};
+        CHECK(replay.first_index() == 4);
+        CHECK(replay.state()->read_account(kAccount)->nonce == 5);
+        CHECK(replay.restored(inner_state)->read_account(kAccount)->nonce == 5);
+    }
+}
+
+}  // namespace silkworm::rpc::state
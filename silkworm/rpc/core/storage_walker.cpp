@@ -132,12 +132,7 @@ Task<void> StorageWalker::walk_of_storages(
             const auto ps_address = bytes_to_address(ps_skv.key1);
             go_on = collector(ps_address, ps_skv.key2, ps_skv.value);
         } else {
-            std::optional<uint64_t> found;
-
-            if (!sh_skv.value.empty()) {
-                const auto bitmap = silkworm::db::bitmap::parse(sh_skv.value);
-                found = silkworm::db::bitmap::seek(bitmap, block_number);
-            }
+            const auto found = silkworm::db::bitmap::seek_serialized(sh_skv.value, block_number);
             if (found) {
                 auto dup_key{silkworm::db::storage_change_key(found.value(), address, incarnation)};
 
@@ -20,6 +20,7 @@
 #include <cxxabi.h>
 #endif
 
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
 
@@ -30,11 +31,14 @@
 
 #include <silkworm/db/access_layer.hpp>
 #include <silkworm/db/snapshot_bundle_factory_impl.hpp>
+#include <silkworm/db/state/code_cache.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/common/compatibility.hpp>
+#include <silkworm/rpc/core/receipts.hpp>
+#include <silkworm/rpc/core/state_checkpoint.hpp>
 #include <silkworm/rpc/engine/remote_execution_engine.hpp>
 #include <silkworm/rpc/ethbackend/remote_backend.hpp>
 #include <silkworm/rpc/ethdb/file/local_database.hpp>
@@ -239,9 +243,54 @@ Daemon::Daemon(DaemonSettings settings, std::optional<mdbx::env> chaindata_env)
     add_shared_services();
     add_private_services();
 
-    // Create the unique KV state-changes stream feeding the state cache
+    // Create the unique KV state-changes stream feeding the state cache, the tracked log filters, the fee summaries and
+    // the response cache
     auto& context = context_pool_.next_context();
     state_changes_stream_ = std::make_unique<db::kv::grpc::client::StateChangesStream>(context, kv_stub_.get());
+    filter_updater_ = std::make_unique<FilterUpdater>(*context.io_context());
+    state_changes_stream_->add_consumer([filter_updater = filter_updater_.get()](const ::remote::StateChangeBatch& batch) {
+        for (const auto& state_change : batch.change_batch()) {
+            if (state_change.direction() == ::remote::Direction::FORWARD) {
+                filter_updater->on_new_block(state_change.block_height());
+            } else {
+                filter_updater->on_unwind(state_change.block_height());
+            }
+        }
+    });
+    // Any unwind may have been missed while not subscribed, so the tracked filters must scan their pending blocks again
+    state_changes_stream_->add_subscription_handler([filter_updater = filter_updater_.get()]() {
+        filter_updater->on_subscription();
+    });
+    if (settings_.fee_summary_blocks > 0) {
+        fee_summary_updater_ = std::make_unique<FeeSummaryUpdater>(*context.io_context());
+        state_changes_stream_->add_consumer([fee_summary_updater = fee_summary_updater_.get()](const ::remote::StateChangeBatch& batch) {
+            for (const auto& state_change : batch.change_batch()) {
+                if (state_change.direction() == ::remote::Direction::FORWARD) {
+                    fee_summary_updater->on_new_block(state_change.block_height());
+                } else {
+                    fee_summary_updater->on_unwind(state_change.block_height());
+                }
+            }
+        });
+        state_changes_stream_->add_subscription_handler([fee_summary_updater = fee_summary_updater_.get()]() {
+            fee_summary_updater->on_subscription();
+        });
+    }
+    if (settings_.response_cache_size > 0) {
+        response_cache_ = std::make_unique<json_rpc::ResponseCache>(settings_.response_cache_size);
+        state_changes_stream_->add_consumer([response_cache = response_cache_.get()](const ::remote::StateChangeBatch& batch) {
+            const bool has_unwind = std::any_of(batch.change_batch().begin(), batch.change_batch().end(), [](const auto& state_change) {
+                return state_change.direction() == ::remote::Direction::UNWIND;
+            });
+            if (has_unwind) {
+                response_cache->clear();
+            }
+        });
+        // Any unwind may have been missed while not subscribed, so start over at each (re)subscription
+        state_changes_stream_->add_subscription_handler([response_cache = response_cache_.get()]() {
+            response_cache->clear();
+        });
+    }
 
     // Set compatibility with Erigon RpcDaemon at JSON RPC level
     compatibility::set_erigon_json_api_compatibility_required(settings_.erigon_json_rpc_compatibility);
@@ -268,7 +317,8 @@ void Daemon::add_private_services() {
         if (chaindata_env_) {
             database = std::make_unique<ethdb::file::LocalDatabase>(state_cache, *chaindata_env_);
         } else {
-            database = std::make_unique<ethdb::kv::RemoteDatabase>(backend.get(), state_cache, grpc_context, grpc_channel);
+            auto* code_cache{must_use_shared_service<db::state::CodeCache>(io_context)};
+            database = std::make_unique<ethdb::kv::RemoteDatabase>(backend.get(), state_cache, grpc_context, grpc_channel, code_cache);
         }
 
         add_private_service<ethdb::Database>(io_context, std::move(database));
@@ -285,6 +335,12 @@ void Daemon::add_shared_services() {
     auto state_cache = std::make_shared<db::kv::api::CoherentStateCache>();
     // Create the unique filter storage to be shared among the execution contexts
     auto filter_storage = std::make_shared<FilterStorage>(context_pool_.num_contexts() * kDefaultFilterStorageSize);
+    // Create the unique fee summary ring buffer (if enabled) to be shared among the execution contexts
+    auto fee_summaries = settings_.fee_summary_blocks > 0 ? std::make_shared<FeeSummaryCache>(settings_.fee_summary_blocks) : nullptr;
+    // Create the unique contract code cache (if state is read remotely) to be shared among the execution contexts
+    auto code_cache = chaindata_env_ ? nullptr : std::make_shared<db::state::CodeCache>(db::state::kCodeCacheCapacity);
+    // Create the unique receipt offset table probe to be shared among the execution contexts
+    auto receipt_offsets = std::make_shared<core::ReceiptOffsetsTable>();
 
     // Add the shared state to the execution contexts
     for (std::size_t i{0}; i < settings_.context_pool_settings.num_contexts; ++i) {
@@ -296,8 +352,20 @@ void Daemon::add_shared_services() {
         add_shared_service(io_context, block_cache);
         add_shared_service<db::kv::api::StateCache>(io_context, std::move(state_cache));
         add_shared_service(io_context, filter_storage);
+        if (fee_summaries) {
+            add_shared_service(io_context, fee_summaries);
+        }
+        add_shared_service(io_context, receipt_offsets);
+        if (code_cache) {
+            add_shared_service(io_context, code_cache);
+        }
         add_shared_service<engine::ExecutionEngine>(io_context, std::move(engine));
     }
+
+    // Create the unique intra-block state checkpoint cache in the worker pool, where transactions get traced
+    if (settings_.trace_checkpoint_interval > 0) {
+        add_shared_service(worker_pool_, std::make_shared<state::StateCheckpointCache>(settings_.trace_checkpoint_interval));
+    }
 }
 
 void Daemon::add_execution_services(const std::vector<std::shared_ptr<engine::ExecutionEngine>>& engines) {
@@ -332,8 +400,10 @@ void Daemon::start() {
         commands::RpcApiTable handler_table{api_spec};
         auto make_jsonrpc_handler = [rpc_api = std::move(rpc_api),
                                      handler_table = std::move(handler_table),
-                                     ilog_settings = std::move(ilog_settings)](StreamWriter* stream_writer) mutable {
-            return std::make_unique<json_rpc::RequestHandler>(stream_writer, rpc_api, handler_table, ilog_settings);
+                                     ilog_settings = std::move(ilog_settings),
+                                     batch_settings = settings_.batch_settings,
+                                     response_cache = response_cache_.get()](StreamWriter* stream_writer) mutable {
+            return std::make_unique<json_rpc::RequestHandler>(stream_writer, rpc_api, handler_table, ilog_settings, batch_settings, response_cache);
         };
 
         return std::make_unique<http::Server>(
@@ -29,7 +29,10 @@
 #include <silkworm/infra/grpc/common/version.hpp>
 #include <silkworm/rpc/common/constants.hpp>
 #include <silkworm/rpc/common/worker_pool.hpp>
+#include <silkworm/rpc/core/fee_summary_updater.hpp>
+#include <silkworm/rpc/core/filter_updater.hpp>
 #include <silkworm/rpc/http/server.hpp>
+#include <silkworm/rpc/json_rpc/response_cache.hpp>
 
 #include "settings.hpp"
 
@@ -92,6 +95,15 @@ class Daemon {
     //! The stream handling StateChanges server-streaming RPC.
     std::unique_ptr<db::kv::grpc::client::StateChangesStream> state_changes_stream_;
 
+    //! The updater matching the logs of each new block against the tracked log filters.
+    std::unique_ptr<FilterUpdater> filter_updater_;
+
+    //! The updater summarizing the fees of each new block for the gas price and fee history oracles.
+    std::unique_ptr<FeeSummaryUpdater> fee_summary_updater_;
+
+    //! The cache of the results of deterministic JSON RPC methods shared by all the services (if enabled).
+    std::unique_ptr<json_rpc::ResponseCache> response_cache_;
+
     //! The secret key for communication from CL & EL
     std::optional<std::string> jwt_secret_;
 };
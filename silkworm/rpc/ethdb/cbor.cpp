@@ -170,7 +170,7 @@ class LogCborListener : public cbor::listener {
     int current_topic_{0};
 };
 
-bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs) {
+bool cbor_decode(ByteView bytes, std::vector<Log>& logs) {
     if (bytes.empty()) {
         return false;
     }
@@ -185,11 +185,11 @@ bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs) {
     return decode_success;
 }
 
-bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Receipt>& receipts) {
+bool cbor_decode(ByteView bytes, std::vector<Receipt>& receipts) {
     if (bytes.empty()) {
         return false;
     }
-    auto json = nlohmann::json::from_cbor(bytes);
+    auto json = nlohmann::json::from_cbor(bytes.begin(), bytes.end());
     SILK_TRACE << "cbor_decode<std::vector<Receipt>> json: " << json.dump();
     if (json.is_array()) {
         receipts = json.get<std::vector<Receipt>>();
@@ -24,8 +24,8 @@
 
 namespace silkworm::rpc {
 
-[[nodiscard]] bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs);
+[[nodiscard]] bool cbor_decode(ByteView bytes, std::vector<Log>& logs);
 
-[[nodiscard]] bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Receipt>& receipts);
+[[nodiscard]] bool cbor_decode(ByteView bytes, std::vector<Receipt>& receipts);
 
 }  // namespace silkworm::rpc
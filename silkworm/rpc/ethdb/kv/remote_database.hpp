@@ -24,6 +24,7 @@
 
 #include <silkworm/db/kv/api/state_cache.hpp>
 #include <silkworm/db/kv/api/transaction.hpp>
+#include <silkworm/db/state/code_cache.hpp>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
 #include <silkworm/rpc/ethbackend/remote_backend.hpp>
 #include <silkworm/rpc/ethdb/database.hpp>
@@ -37,11 +38,13 @@ class RemoteDatabase : public Database {
     RemoteDatabase(ethbackend::BackEnd* backend,
                    StateCache* state_cache,
                    agrpc::GrpcContext& grpc_context,
-                   const std::shared_ptr<grpc::Channel>& channel);
+                   const std::shared_ptr<grpc::Channel>& channel,
+                   db::state::CodeCache* code_cache = nullptr);
     RemoteDatabase(ethbackend::BackEnd* backend,
                    StateCache* state_cache,
                    agrpc::GrpcContext& grpc_context,
-                   std::unique_ptr<remote::KV::StubInterface>&& stub);
+                   std::unique_ptr<remote::KV::StubInterface>&& stub,
+                   db::state::CodeCache* code_cache = nullptr);
     ~RemoteDatabase() override;
 
     RemoteDatabase(const RemoteDatabase&) = delete;
@@ -54,6 +57,7 @@ class RemoteDatabase : public Database {
     StateCache* state_cache_;
     agrpc::GrpcContext& grpc_context_;
     std::unique_ptr<::remote::KV::StubInterface> stub_;
+    db::state::CodeCache* code_cache_;
 };
 
 }  // namespace silkworm::rpc::ethdb::kv
@@ -32,7 +32,7 @@ Task<void> walk(db::kv::api::Transaction& tx, const std::string& table, ByteView
 
     const auto new_cursor = co_await tx.cursor(table);
     SILK_TRACE << "rpc::ethdb::walk cursor_id: " << new_cursor->cursor_id();
-    auto kv_pair = co_await new_cursor->seek(start_key);
+    auto kv_pair = co_await new_cursor->seek_view(start_key);
     auto k = kv_pair.key;
     auto v = kv_pair.value;
     SILK_TRACE << "k: " << k << " v: " << v;
@@ -44,7 +44,7 @@ Task<void> walk(db::kv::api::Transaction& tx, const std::string& table, ByteView
         if (!go_on) {
             break;
         }
-        kv_pair = co_await new_cursor->next();
+        kv_pair = co_await new_cursor->next_view();
         k = kv_pair.key;
         v = kv_pair.value;
     }
@@ -53,7 +53,7 @@ Task<void> walk(db::kv::api::Transaction& tx, const std::string& table, ByteView
 Task<void> for_prefix(db::kv::api::Transaction& tx, const std::string& table, ByteView prefix, Walker w) {
     const auto new_cursor = co_await tx.cursor(table);
     SILK_TRACE << "rpc::ethdb::for_prefix cursor_id: " << new_cursor->cursor_id() << " prefix: " << silkworm::to_hex(prefix);
-    auto kv_pair = co_await new_cursor->seek(prefix);
+    auto kv_pair = co_await new_cursor->seek_view(prefix);
     auto k = kv_pair.key;
     auto v = kv_pair.value;
     SILK_TRACE << "rpc::ethdb::for_prefix k: " << k << " v: " << v;
@@ -62,7 +62,7 @@ Task<void> for_prefix(db::kv::api::Transaction& tx, const std::string& table, By
         if (!go_on) {
             break;
         }
-        kv_pair = co_await new_cursor->next();
+        kv_pair = co_await new_cursor->next_view();
         k = kv_pair.key;
         v = kv_pair.value;
         SILK_TRACE << "rpc::ethdb::for_prefix k: " << k << " v: " << v;
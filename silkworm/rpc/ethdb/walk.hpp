@@ -25,7 +25,8 @@
 
 namespace silkworm::rpc::ethdb {
 
-using Walker = std::function<bool(Bytes&, Bytes&)>;
+//! The key/value views passed to the walker are valid only during the walker invocation
+using Walker = std::function<bool(ByteView, ByteView)>;
 
 Task<void> walk(db::kv::api::Transaction& tx, const std::string& table, ByteView start_key, uint32_t fixed_bits, Walker w);
 
@@ -21,15 +21,14 @@
 #include <exception>
 #include <string_view>
 
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/detached.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/beast/http/chunk_encode.hpp>
 #include <boost/beast/http/write.hpp>
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
 #include <jwt-cpp/jwt.h>
 #include <jwt-cpp/traits/nlohmann-json/defaults.h>
 
@@ -44,8 +43,15 @@ using namespace std::chrono_literals;
 static constexpr std::string_view kMaxAge{"600"};
 static constexpr auto kMaxPayloadSize{30 * kMebi};  // 30MiB
 static constexpr std::array kAcceptedContentTypes{"application/json", "application/jsonrequest", "application/json-rpc"};
-static constexpr auto kGzipEncoding{"gzip"};
-static constexpr auto kBearerTokenPrefix{"Bearer "sv};  // space matters: format is `Bearer <token>`
+static constexpr std::string_view kGzipEncoding{"gzip"};
+static constexpr std::string_view kDeflateEncoding{"deflate"};
+static constexpr auto kSupportedEncodings{"gzip, deflate"};
+static constexpr std::size_t kMinCompressionSize{1024};  // smaller responses are not worth compressing
+static constexpr auto kBearerTokenPrefix{"Bearer "sv};   // space matters: format is `Bearer <token>`
+
+static std::string content_encoding(CompressionFormat format) {
+    return std::string{format == CompressionFormat::kGzip ? kGzipEncoding : kDeflateEncoding};
+}
 
 Task<void> Connection::run_read_loop(std::shared_ptr<Connection> connection) {
     co_await connection->read_loop();
@@ -179,6 +185,7 @@ Task<void> Connection::handle_preflight(const RequestWithStringBody& req) {
 }
 
 Task<void> Connection::handle_actual_request(const RequestWithStringBody& req) {
+    compression_format_.reset();
     if (req.body().empty()) {
         co_await do_write(std::string{}, boost::beast::http::status::ok);  // just like Erigon
         co_return;
@@ -190,10 +197,12 @@ Task<void> Connection::handle_actual_request(const RequestWithStringBody& req) {
         co_return;
     }
 
-    const bool gzip_encoding_requested{accept_encoding.contains(kGzipEncoding)};
-    if (http_compression_ && !accept_encoding.empty() && !gzip_encoding_requested) {
-        co_await do_write("unsupported requested compression\n", boost::beast::http::status::unsupported_media_type, kGzipEncoding);
-        co_return;
+    if (http_compression_ && !accept_encoding.empty()) {
+        compression_format_ = negotiate_compression({accept_encoding.data(), accept_encoding.size()});
+        if (!compression_format_) {
+            co_await do_write("unsupported requested compression\n", boost::beast::http::status::unsupported_media_type, kSupportedEncodings);
+            co_return;
+        }
     }
 
     // Check HTTP method and content type [max body size is limited using beast::http::request_parser::body_limit in do_read]
@@ -222,17 +231,85 @@ Task<void> Connection::handle_actual_request(const RequestWithStringBody& req) {
 
     auto rsp_content = co_await handler_->handle(req.body());
     if (rsp_content) {
-        co_await do_write(rsp_content->append("\n"), boost::beast::http::status::ok, gzip_encoding_requested ? kGzipEncoding : "");
+        rsp_content->append("\n");
+        const bool compressed{compression_format_ && rsp_content->size() >= kMinCompressionSize};
+        co_await do_write(*rsp_content, boost::beast::http::status::ok, compressed ? content_encoding(*compression_format_) : "");
     }
 }
 
-//! Write chunked response headers
+//! Defer the chunked response headers until the first content is available, so that small responses are not compressed
 Task<void> Connection::open_stream() {
+    stream_headers_pending_ = true;
+    stream_compressor_.reset();
+    co_return;
+}
+
+Task<void> Connection::close_stream() {
+    try {
+        if (stream_headers_pending_) {
+            co_await write_stream_headers(/*compressed=*/false);
+        }
+        if (stream_compressor_) {
+            std::string compressed_content;
+            co_await async_task(workers_.executor(), [&]() -> void {
+                stream_compressor_->finish(compressed_content);
+            });
+            stream_compressor_.reset();
+            co_await write_chunk(compressed_content);
+        }
+        co_await boost::asio::async_write(socket_, boost::beast::http::make_chunk_last(), boost::asio::use_awaitable);
+    } catch (const boost::system::system_error& se) {
+        SILK_TRACE << "Connection::close system_error: " << se.what();
+        throw;
+    } catch (const std::exception& e) {
+        SILK_ERROR << "Connection::close exception: " << e.what();
+        throw;
+    }
+    co_return;
+}
+
+//! Write chunked response content to the underlying socket, compressing it on the worker pool if required
+Task<std::size_t> Connection::write(std::string_view content, bool last) {
+    if (stream_headers_pending_) {
+        // A response written all at once is small enough to know whether it is worth compressing
+        co_await write_stream_headers(compression_format_ && (!last || content.size() >= kMinCompressionSize));
+    }
+    if (stream_compressor_) {
+        std::string compressed_content;
+        co_await async_task(workers_.executor(), [&]() -> void {
+            stream_compressor_->write(content, compressed_content);
+        });
+        co_return co_await write_chunk(compressed_content);
+    }
+    co_return co_await write_chunk(content);
+}
+
+//! Write shared response content to the underlying socket, reusing its compressed form if required
+Task<std::size_t> Connection::write_shared(const SharedContentPtr& content) {
+    if (stream_headers_pending_) {
+        co_await write_stream_headers(compression_format_ && content->data().size() >= kMinCompressionSize);
+    }
+    if (stream_compressor_) {
+        std::string compressed_content;
+        co_await async_task(workers_.executor(), [&]() -> void {
+            stream_compressor_->write(*content->compressed(), compressed_content);
+        });
+        co_return co_await write_chunk(compressed_content);
+    }
+    co_return co_await write_chunk(content->data());
+}
+
+Task<void> Connection::write_stream_headers(bool compressed) {
+    stream_headers_pending_ = false;
     try {
         boost::beast::http::response<boost::beast::http::empty_body> rsp{boost::beast::http::status::ok, request_http_version_};
         rsp.set(boost::beast::http::field::content_type, "application/json");
         rsp.set(boost::beast::http::field::date, get_date_time());
         rsp.chunked(true);
+        if (compressed) {
+            rsp.set(boost::beast::http::field::content_encoding, content_encoding(*compression_format_));
+            stream_compressor_ = std::make_unique<Compressor>(*compression_format_);
+        }
 
         set_cors(rsp);
 
@@ -240,30 +317,19 @@ Task<void> Connection::open_stream() {
 
         co_await async_write_header(socket_, serializer, boost::asio::use_awaitable);
     } catch (const boost::system::system_error& se) {
-        SILK_TRACE << "Connection::open_stream system_error: " << se.what();
+        SILK_TRACE << "Connection::write_stream_headers system_error: " << se.what();
         throw;
     } catch (const std::exception& e) {
-        SILK_ERROR << "Connection::open_stream exception: " << e.what();
+        SILK_ERROR << "Connection::write_stream_headers exception: " << e.what();
         throw;
     }
     co_return;
 }
 
-Task<void> Connection::close_stream() {
-    try {
-        co_await boost::asio::async_write(socket_, boost::beast::http::make_chunk_last(), boost::asio::use_awaitable);
-    } catch (const boost::system::system_error& se) {
-        SILK_TRACE << "Connection::close system_error: " << se.what();
-        throw;
-    } catch (const std::exception& e) {
-        SILK_ERROR << "Connection::close exception: " << e.what();
-        throw;
+Task<std::size_t> Connection::write_chunk(std::string_view content) {
+    if (content.empty()) {
+        co_return 0;  // an empty chunk would terminate the response
     }
-    co_return;
-}
-
-//! Write chunked response content to the underlying socket
-Task<std::size_t> Connection::write(std::string_view content, bool /*last*/) {
     unsigned long bytes_transferred{0};
     try {
         boost::asio::const_buffer buffer{content.data(), content.size()};
@@ -299,7 +365,7 @@ Task<void> Connection::do_write(const std::string& content, boost::beast::http::
             res.set(boost::beast::http::field::content_encoding, content_encoding);
             std::string compressed_content;
 
-            co_await compress(content, compressed_content);
+            co_await compress(content, *compression_format_, compressed_content);
 
             res.content_length(compressed_content.length());
             res.body() = std::move(compressed_content);
@@ -435,14 +501,70 @@ std::string Connection::get_date_time() {
     return ss.str();
 }
 
-Task<void> Connection::compress(const std::string& clear_data, std::string& compressed_data) {
-    boost::iostreams::filtering_ostream out;
+std::optional<CompressionFormat> Connection::negotiate_compression(std::string_view accept_encoding) {
+    // Quality values have at most 3 decimal digits (https://www.rfc-editor.org/rfc/rfc9110#name-quality-values)
+    const auto parse_quality = [](std::string_view parameters) -> int {
+        const auto q_position = parameters.find("q=");
+        if (q_position == std::string_view::npos) {
+            return 1000;
+        }
+        const auto q_value = absl::StripAsciiWhitespace(parameters.substr(q_position + 2));
+        if (q_value.starts_with('1')) {
+            return 1000;
+        }
+        int quality{0};
+        if (q_value.starts_with("0.")) {
+            int weight{100};
+            for (const char digit : q_value.substr(2, 3)) {
+                if (!absl::ascii_isdigit(static_cast<unsigned char>(digit))) {
+                    break;
+                }
+                quality += (digit - '0') * weight;
+                weight /= 10;
+            }
+        }
+        return quality;
+    };
+
+    int gzip_quality{-1};
+    int deflate_quality{-1};
+    int any_quality{-1};
+    while (!accept_encoding.empty()) {
+        const auto separator_position = accept_encoding.find(',');
+        auto coding = accept_encoding.substr(0, separator_position);
+        accept_encoding.remove_prefix(separator_position == std::string_view::npos ? accept_encoding.size() : separator_position + 1);
+
+        const auto parameters_position = coding.find(';');
+        const int quality{parse_quality(parameters_position == std::string_view::npos ? "" : coding.substr(parameters_position + 1))};
+        coding = absl::StripAsciiWhitespace(coding.substr(0, parameters_position));
+        if (absl::EqualsIgnoreCase(coding, kGzipEncoding) || absl::EqualsIgnoreCase(coding, "x-gzip")) {
+            gzip_quality = quality;
+        } else if (absl::EqualsIgnoreCase(coding, kDeflateEncoding)) {
+            deflate_quality = quality;
+        } else if (coding == "*") {
+            any_quality = quality;
+        }
+    }
+    if (gzip_quality < 0) {
+        gzip_quality = any_quality;
+    }
+    if (deflate_quality < 0) {
+        deflate_quality = any_quality;
+    }
+
+    // Prefer gzip when equally acceptable: it is what the clients asking for gzip have always been served
+    if (gzip_quality > 0 && gzip_quality >= deflate_quality) {
+        return CompressionFormat::kGzip;
+    }
+    if (deflate_quality > 0) {
+        return CompressionFormat::kZlib;
+    }
+    return std::nullopt;
+}
+
+Task<void> Connection::compress(const std::string& clear_data, CompressionFormat format, std::string& compressed_data) {
     co_await async_task(workers_.executor(), [&]() -> void {
-#ifndef SILKWORM_SANITIZE
-        out.push(boost::iostreams::gzip_compressor());
-#endif
-        out.push(boost::iostreams::back_inserter(compressed_data));
-        boost::iostreams::copy(boost::make_iterator_range(clear_data), out);
+        compressed_data = rpc::compress(clear_data, format);
     });
 }
 
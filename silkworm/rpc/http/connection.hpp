@@ -18,7 +18,9 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
@@ -30,6 +32,7 @@
 #include <boost/system/error_code.hpp>
 
 #include <silkworm/rpc/commands/rpc_api_table.hpp>
+#include <silkworm/rpc/common/compression.hpp>
 #include <silkworm/rpc/common/constants.hpp>
 #include <silkworm/rpc/common/interface_log.hpp>
 #include <silkworm/rpc/common/worker_pool.hpp>
@@ -66,6 +69,7 @@ class Connection : public StreamWriter {
     Task<void> open_stream() override;
     Task<void> close_stream() override;
     Task<std::size_t> write(std::string_view content, bool last) override;
+    Task<std::size_t> write_shared(const SharedContentPtr& content) override;
 
   protected:
     //! Start the asynchronous read loop for the connection
@@ -96,7 +100,16 @@ class Connection : public StreamWriter {
 
     static std::string get_date_time();
 
-    Task<void> compress(const std::string& clear_data, std::string& compressed_data);
+    //! \return the supported compression format preferred by the client in \p accept_encoding or std::nullopt if none
+    static std::optional<CompressionFormat> negotiate_compression(std::string_view accept_encoding);
+
+    Task<void> compress(const std::string& clear_data, CompressionFormat format, std::string& compressed_data);
+
+    //! Write the headers of the chunked response, compressing its content as negotiated if \p compressed is true
+    Task<void> write_stream_headers(bool compressed);
+
+    //! Write one chunk of the chunked response, unless \p content is empty
+    Task<std::size_t> write_chunk(std::string_view content);
 
     //! Socket for the connection.
     boost::asio::ip::tcp::socket socket_;
@@ -120,6 +133,15 @@ class Connection : public StreamWriter {
 
     bool http_compression_;
 
+    //! The compression format negotiated for the current request, if any
+    std::optional<CompressionFormat> compression_format_;
+
+    //! Whether the headers of the current chunked response are still to be written
+    bool stream_headers_pending_{false};
+
+    //! The compressor of the current chunked response, if compressed
+    std::unique_ptr<Compressor> stream_compressor_;
+
     WorkerPool& workers_;
 
     std::string vary_;
@@ -36,6 +36,7 @@ class Connection_ForTest : public Connection {
   public:
     using Connection::Connection;
     using Connection::is_request_authorized;
+    using Connection::negotiate_compression;
 };
 
 TEST_CASE("connection creation", "[rpc][http][connection]") {
@@ -60,6 +61,28 @@ TEST_CASE("connection creation", "[rpc][http][connection]") {
     }
 }
 
+TEST_CASE("negotiate_compression", "[rpc][http][connection]") {
+    CHECK(Connection_ForTest::negotiate_compression("gzip") == CompressionFormat::kGzip);
+    CHECK(Connection_ForTest::negotiate_compression("x-gzip") == CompressionFormat::kGzip);
+    CHECK(Connection_ForTest::negotiate_compression("br, GZIP") == CompressionFormat::kGzip);
+    CHECK(Connection_ForTest::negotiate_compression("deflate") == CompressionFormat::kZlib);
+    CHECK(Connection_ForTest::negotiate_compression("*") == CompressionFormat::kGzip);
+
+    SECTION("gzip is preferred when equally acceptable") {
+        CHECK(Connection_ForTest::negotiate_compression("gzip, deflate") == CompressionFormat::kGzip);
+        CHECK(Connection_ForTest::negotiate_compression("deflate, gzip") == CompressionFormat::kGzip);
+        CHECK(Connection_ForTest::negotiate_compression("gzip;q=0.5, deflate;q=1.0") == CompressionFormat::kZlib);
+        CHECK(Connection_ForTest::negotiate_compression("gzip;q=0, *") == CompressionFormat::kZlib);
+        CHECK(Connection_ForTest::negotiate_compression(" gzip ; q=0.001") == CompressionFormat::kGzip);
+    }
+    SECTION("no supported encoding") {
+        CHECK(!Connection_ForTest::negotiate_compression("identity"));
+        CHECK(!Connection_ForTest::negotiate_compression("br"));
+        CHECK(!Connection_ForTest::negotiate_compression("gzip;q=0"));
+        CHECK(!Connection_ForTest::negotiate_compression("*;q=0"));
+    }
+}
+
 static constexpr auto kSampleJWTKey{
     "NTNv7j0TuYARvmNMmWXo6fKvM4o6nv/aUi9ryX38ZH+L1bkrnD1ObOQ8JAUmHCBq7Iy7otZcyAagBLHVKvvYaIpmMuxmARQ97jUVG16Jkpkp1wXO"
     "PsrF9zwew6TpczyHkHgX5EuLg2MeBuiT/qJACs1J0apruOOJCg/gOtkjB4c="sv};
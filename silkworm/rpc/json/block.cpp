@@ -16,6 +16,7 @@
 
 #include "block.hpp"
 
+#include <silkworm/core/common/hex.hpp>
 #include <silkworm/rpc/common/compatibility.hpp>
 #include <silkworm/rpc/json/types.hpp>
 
@@ -78,6 +79,7 @@ void to_json(nlohmann::json& json, const Block& b) {
     }
 }
 
+//! Fields of the block result preceding the transactions
 struct GlazeJsonBlock {
     char block_number[kInt64HexSize];
     char hash[kHashHexSize];
@@ -98,11 +100,7 @@ struct GlazeJsonBlock {
     char mix_hash[kHashHexSize];
     char extra_data[kDataSize];
 
-    std::vector<std::string> ommers_hashes;
     std::optional<std::string> base_fee_per_gas;
-    std::optional<std::vector<std::string>> transaction_hashes;
-    std::optional<std::vector<GlazeJsonTransaction>> transactions;
-    std::optional<std::vector<GlazeJsonWithdrawals>> withdrawals;
     std::optional<std::string> withdrawals_root;
     std::optional<std::string> blob_gas_used;
     std::optional<std::string> excess_blob_gas;
@@ -133,25 +131,20 @@ struct GlazeJsonBlock {
             "mixHash", &T::mix_hash,
             "extraData", &T::extra_data,
             "baseFeePerGas", &T::base_fee_per_gas,
-            "gasUsed", &T::gas_used,
-            "transactions", &T::transaction_hashes,
-            "transactions", &T::transactions,
-            "uncles", &T::ommers_hashes,
-            "withdrawals", &T::withdrawals);
+            "gasUsed", &T::gas_used);
     };
 };
 
-struct GlazeJsonBlockReply {
-    std::string_view jsonrpc = kJsonVersion;
-    JsonRpcId id;
-    GlazeJsonBlock result;
+//! Fields of the block result following the transactions
+struct GlazeJsonBlockTail {
+    std::vector<std::string> ommers_hashes;
+    std::optional<std::vector<GlazeJsonWithdrawals>> withdrawals;
 
     struct glaze {
-        using T = GlazeJsonBlockReply;
+        using T = GlazeJsonBlockTail;
         static constexpr auto value = glz::object(
-            "jsonrpc", &T::jsonrpc,
-            "id", &T::id,
-            "result", &T::result);
+            "uncles", &T::ommers_hashes,
+            "withdrawals", &T::withdrawals);
     };
 };
 
@@ -176,13 +169,24 @@ void make_glaze_json_null_content(const nlohmann::json& request_json, std::strin
     glz::write<glz::opts{.skip_null_members = false}>(block_json_data, json_reply);
 }
 
+//! Upper bound of the serialized size of the block header fields in a reply, excluding the extra data
+static constexpr std::size_t kBlockFixedSize{4096};
+
+//! Upper bound of the serialized size of \p transaction within a block, used to preallocate the reply
+static std::size_t max_json_transaction_size(const silkworm::Transaction& transaction) {
+    static constexpr std::size_t kFixedSize{1024};
+    static constexpr std::size_t kAccessListEntrySize{2 * kAddressHexSize};
+    std::size_t size{kFixedSize + 2 * transaction.data.size()};
+    for (const auto& entry : transaction.access_list) {
+        size += kAccessListEntrySize + entry.storage_keys.size() * (kHashHexSize + 3);
+    }
+    return size;
+}
+
 void make_glaze_json_content(const nlohmann::json& request_json, const Block& b, std::string& json_reply) {
     auto& block = b.block_with_hash->block;
-    GlazeJsonBlockReply block_json_data{};
+    GlazeJsonBlock result{};
     auto& header = block.header;
-    auto& result = block_json_data.result;
-
-    block_json_data.id = make_jsonrpc_id(request_json);
 
     to_quantity(std::span(result.block_number), header.number);
     to_hex(std::span(result.hash), b.block_with_hash->hash.bytes);
@@ -220,37 +224,65 @@ void make_glaze_json_content(const nlohmann::json& request_json, const Block& b,
     }
     to_quantity(std::span(result.timestamp), header.timestamp);
 
-    if (b.full_tx) {
-        std::vector<GlazeJsonTransaction> transaction_data_list;
-        transaction_data_list.reserve(block.transactions.size());
-        for (std::size_t i{0}; i < block.transactions.size(); i++) {
-            const silkworm::Transaction& transaction = block.transactions[i];
+    GlazeJsonBlockTail tail{};
+    tail.ommers_hashes.reserve(block.ommers.size());
+    for (const auto& ommer : block.ommers) {
+        tail.ommers_hashes.push_back("0x" + silkworm::to_hex(ommer.hash()));
+    }
+    if (block.withdrawals) {
+        tail.withdrawals = make_glaze_json_withdrawals(block);
+    }
+
+    // The transactions are serialized one at a time straight into the reply, which is allocated just once: building
+    // all of them before writing would keep both their glaze representation and their serialization in memory
+    std::size_t reply_size{kBlockFixedSize + 2 * header.extra_data.size() + (block.ommers.size() + 1) * kHashHexSize};
+    for (const auto& transaction : block.transactions) {
+        reply_size += b.full_tx ? max_json_transaction_size(transaction) : kHashHexSize + 3;
+    }
+    if (block.withdrawals) {
+        reply_size += block.withdrawals->size() * sizeof(GlazeJsonWithdrawals) * 2;
+    }
+    json_reply.clear();
+    json_reply.reserve(reply_size);
+
+    std::string fragment;
+    json_reply.append(R"({"jsonrpc":")").append(kJsonVersion).append(R"(","id":)");
+    glz::write_json(make_jsonrpc_id(request_json), fragment);
+    json_reply.append(fragment);
+    json_reply.append(R"(,"result":)");
+    glz::write_json(result, fragment);
+    json_reply.append(fragment, 0, fragment.size() - 1);  // leave the result object open
+
+    json_reply.append(R"(,"transactions":[)");
+    for (std::size_t i{0}; i < block.transactions.size(); i++) {
+        const silkworm::Transaction& transaction = block.transactions[i];
+        if (i > 0) {
+            json_reply.push_back(',');
+        }
+        if (b.full_tx) {
             GlazeJsonTransaction item{};
             to_quantity(std::span(item.transaction_index), i);
             to_quantity(std::span(item.block_number), header.number);
             to_hex(std::span(item.block_hash), b.block_with_hash->hash.bytes);
             to_quantity(std::span(item.gas_price), transaction.effective_gas_price(header.base_fee_per_gas.value_or(0)));
             make_glaze_json_transaction(transaction, item);
-            transaction_data_list.push_back(std::move(item));
-        }
-        result.transactions = make_optional(std::move(transaction_data_list));
-    } else {
-        std::vector<std::string> transaction_hashes;
-        transaction_hashes.reserve(block.transactions.size());
-        for (const auto& transaction : block.transactions) {
-            transaction_hashes.push_back("0x" + silkworm::to_hex(transaction.hash()));
+            glz::write_json(item, fragment);
+            json_reply.append(fragment);
+        } else {
+            const auto hash{transaction.hash()};
+            json_reply.append(R"("0x)");
+            const auto hash_position{json_reply.size()};
+            json_reply.resize(hash_position + 2 * kHashLength);
+            hex::encode(hash.bytes, json_reply.data() + hash_position);
+            json_reply.push_back('"');
         }
-        result.transaction_hashes = std::make_optional(std::move(transaction_hashes));
-    }
-    result.ommers_hashes.reserve(block.ommers.size());
-    for (const auto& ommer : block.ommers) {
-        result.ommers_hashes.push_back("0x" + silkworm::to_hex(ommer.hash()));
     }
+    json_reply.push_back(']');
 
-    if (block.withdrawals) {
-        result.withdrawals = make_glaze_json_withdrawals(block);
-    }
-    glz::write_json(block_json_data, json_reply);
+    glz::write_json(tail, fragment);
+    json_reply.push_back(',');
+    json_reply.append(fragment, 1);  // the tail object closes the result object
+    json_reply.push_back('}');
 }
 
 }  // namespace silkworm::rpc
@@ -23,6 +23,24 @@
 
 namespace silkworm::rpc {
 
+//! RLP encoding of a block containing one legacy and one EIP-2930 transaction
+static constexpr const char* kEip2718BlockRlpHex{
+    "f90319f90211a00000000000000000000000000000000000000000000000000000000000000000a01dcc4de8dec75d7aab85b567b6ccd4"
+    "1ad312451b948a7413f0a142fd40d49347948888f1f195afa192cfee860698584c030f4c9db1a0ef1552a40b7165c3cd773806b9e0c165"
+    "b75356e0314bf0706f279c729f51e017a0e6e49996c7ec59f7a23d22b83239a60151512c65613bf84a0d7da336399ebc4aa0cafe75574d"
+    "59780665a97fbfd11365c7545aa8f1abf4e5e12e8243334ef7286bb9010000000000000000000000000000000000000000000000000000"
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "000000000000000000000083020000820200832fefd882a410845506eb0796636f6f6c65737420626c6f636b206f6e20636861696ea0bd"
+    "4472abb6659ebe3ee06ee4d7b72a00a9f4d001caca51342001075469aff49888a13a5a8c8f2bb1c4f90101f85f800a82c35094095e7bae"
+    "a6a6c7c4c2dfeb977efac326af552d870a801ba09bea4c4daac7c7c52e093e6a4c35dbbcf8856f1af7b059ba20253e70848d094fa08a8f"
+    "ae537ce25ed8cb5af9adac3f141af69bd515bd2ba031522df09b97dd72b1b89e01f89b01800a8301e24194095e7baea6a6c7c4c2dfeb97"
+    "7efac326af552d878080f838f7940000000000000000000000000000000000000001e1a000000000000000000000000000000000000000"
+    "0000000000000000000000000001a03dbacc8d0259f2508625e97fdfc57cd85fdd16e5821bc2c10bdd1a52649e8335a0476e10695b183a"
+    "87b0aa292a7f4b78ef0c3fbe62aa2c42c84e1d9c3da159ef14c0"};
+
 TEST_CASE("serialize block with baseFeePerGas", "[rpc][to_json]") {
     silkworm::BlockWithHash block_with_hash{
         {/* Block */
@@ -167,23 +185,7 @@ TEST_CASE("serialize empty block", "[rpc][to_json]") {
 }
 
 TEST_CASE("serialize EIP-2718 block", "[rpc][to_json]") {
-    const char* rlp_hex{
-        "f90319f90211a00000000000000000000000000000000000000000000000000000000000000000a01dcc4de8dec75d7aab85b567b6ccd4"
-        "1ad312451b948a7413f0a142fd40d49347948888f1f195afa192cfee860698584c030f4c9db1a0ef1552a40b7165c3cd773806b9e0c165"
-        "b75356e0314bf0706f279c729f51e017a0e6e49996c7ec59f7a23d22b83239a60151512c65613bf84a0d7da336399ebc4aa0cafe75574d"
-        "59780665a97fbfd11365c7545aa8f1abf4e5e12e8243334ef7286bb9010000000000000000000000000000000000000000000000000000"
-        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-        "000000000000000000000083020000820200832fefd882a410845506eb0796636f6f6c65737420626c6f636b206f6e20636861696ea0bd"
-        "4472abb6659ebe3ee06ee4d7b72a00a9f4d001caca51342001075469aff49888a13a5a8c8f2bb1c4f90101f85f800a82c35094095e7bae"
-        "a6a6c7c4c2dfeb977efac326af552d870a801ba09bea4c4daac7c7c52e093e6a4c35dbbcf8856f1af7b059ba20253e70848d094fa08a8f"
-        "ae537ce25ed8cb5af9adac3f141af69bd515bd2ba031522df09b97dd72b1b89e01f89b01800a8301e24194095e7baea6a6c7c4c2dfeb97"
-        "7efac326af552d878080f838f7940000000000000000000000000000000000000001e1a000000000000000000000000000000000000000"
-        "0000000000000000000000000001a03dbacc8d0259f2508625e97fdfc57cd85fdd16e5821bc2c10bdd1a52649e8335a0476e10695b183a"
-        "87b0aa292a7f4b78ef0c3fbe62aa2c42c84e1d9c3da159ef14c0"};
-    silkworm::Bytes rlp_bytes{*silkworm::from_hex(rlp_hex)};
+    silkworm::Bytes rlp_bytes{*silkworm::from_hex(kEip2718BlockRlpHex)};
     silkworm::ByteView view{rlp_bytes};
 
     auto block_with_hash = std::make_shared<BlockWithHash>();
@@ -224,4 +226,84 @@ TEST_CASE("serialize EIP-2718 block", "[rpc][to_json]") {
     })"_json);
 }
 
+static std::shared_ptr<BlockWithHash> make_eip2718_block() {
+    silkworm::Bytes rlp_bytes{*silkworm::from_hex(kEip2718BlockRlpHex)};
+    silkworm::ByteView view{rlp_bytes};
+    auto block_with_hash = std::make_shared<BlockWithHash>();
+    if (!silkworm::rlp::decode(view, block_with_hash->block)) {
+        return nullptr;
+    }
+    return block_with_hash;
+}
+
+TEST_CASE("make_glaze_json_content block", "[rpc][make_glaze_json_content]") {
+    const auto request = R"({"jsonrpc":"2.0","id":5,"method":"eth_getBlockByNumber","params":["0x200",false]})"_json;
+    std::string reply;
+
+    SECTION("empty block") {
+        silkworm::rpc::Block block{std::make_shared<BlockWithHash>()};
+        make_glaze_json_content(request, block, reply);
+        CHECK(reply.starts_with(R"({"jsonrpc":"2.0","id":5,"result":{"number":"0x0",)"));
+        CHECK(reply.ends_with(R"(,"transactions":[],"uncles":[]}})"));
+        CHECK(nlohmann::json::parse(reply) == nlohmann::json{{"jsonrpc", "2.0"}, {"id", 5}, {"result", block}});
+    }
+
+    SECTION("block with transaction hashes") {
+        silkworm::rpc::Block block{make_eip2718_block()};
+        REQUIRE(block.block_with_hash);
+        make_glaze_json_content(request, block, reply);
+        CHECK(reply.find(R"("transactions":["0x77b19baa4de67e45a7b26e4a220bccdbb6731885aa9927064e239ca232023215",)"
+                         R"("0x554af720acf477830f996f1bc5d11e54c38aa40042aeac6f66cb66f9084a959d"],"uncles":[]}})") != std::string::npos);
+        CHECK(nlohmann::json::parse(reply) == nlohmann::json{{"jsonrpc", "2.0"}, {"id", 5}, {"result", block}});
+    }
+
+    SECTION("block with full transactions") {
+        silkworm::rpc::Block block{make_eip2718_block()};
+        REQUIRE(block.block_with_hash);
+        block.full_tx = true;
+        make_glaze_json_content(request, block, reply);
+        const auto reply_json = nlohmann::json::parse(reply);
+        auto expected_result = nlohmann::json(block);
+        expected_result.erase("transactions");
+        auto result = reply_json["result"];
+        const auto transactions = result["transactions"];
+        result.erase("transactions");
+        CHECK(result == expected_result);
+        REQUIRE(transactions.size() == 2);
+        CHECK(transactions[0]["hash"] == "0x77b19baa4de67e45a7b26e4a220bccdbb6731885aa9927064e239ca232023215");
+        CHECK(transactions[0]["transactionIndex"] == "0x0");
+        CHECK(transactions[1]["hash"] == "0x554af720acf477830f996f1bc5d11e54c38aa40042aeac6f66cb66f9084a959d");
+        CHECK(transactions[1]["transactionIndex"] == "0x1");
+        for (const auto& transaction : transactions) {
+            CHECK(transaction["blockNumber"] == "0x200");
+            CHECK(transaction["blockHash"] == "0x0000000000000000000000000000000000000000000000000000000000000000");
+        }
+    }
+
+    SECTION("block with ommers and withdrawals") {
+        auto block_with_hash = make_eip2718_block();
+        REQUIRE(block_with_hash);
+        block_with_hash->block.ommers.resize(2);
+        block_with_hash->block.ommers[1].number = 1;
+        block_with_hash->block.withdrawals = std::vector<Withdrawal>{
+            {.index = 1, .validator_index = 2, .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address, .amount = 3},
+            {.index = 4, .validator_index = 5, .address = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address, .amount = 6},
+        };
+        silkworm::rpc::Block block{block_with_hash};
+        make_glaze_json_content(request, block, reply);
+        CHECK(reply.ends_with(R"(,"amount":"0x6"}]}})"));
+        const auto reply_json = nlohmann::json::parse(reply);
+        CHECK(reply_json == nlohmann::json{{"jsonrpc", "2.0"}, {"id", 5}, {"result", block}});
+        CHECK(reply_json["result"]["uncles"].size() == 2);
+        CHECK(reply_json["result"]["withdrawals"].size() == 2);
+    }
+
+    SECTION("string request id") {
+        silkworm::rpc::Block block{std::make_shared<BlockWithHash>()};
+        make_glaze_json_content(R"({"jsonrpc":"2.0","id":"abc","method":"eth_getBlockByNumber","params":["0x0",false]})"_json, block, reply);
+        CHECK(reply.starts_with(R"({"jsonrpc":"2.0","id":"abc","result":{)"));
+        CHECK(nlohmann::json::parse(reply)["id"] == "abc");
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -135,6 +135,23 @@ struct GlazeJsonLog {
     };
 };
 
+static void make_glaze_json_log_item(const Log& log, GlazeJsonLogItem& item) {
+    to_hex(std::span(item.address), log.address.bytes);
+    to_hex(std::span(item.tx_hash), log.tx_hash.bytes);
+    to_hex(std::span(item.block_hash), log.block_hash.bytes);
+    to_quantity(std::span(item.block_number), log.block_number);
+    to_quantity(std::span(item.tx_index), log.tx_index);
+    to_quantity(std::span(item.index), log.index);
+    item.removed = log.removed;
+    to_hex(item.data, log.data);
+    if (log.timestamp) {
+        item.timestamp = to_quantity(*(log.timestamp));
+    }
+    for (const auto& t : log.topics) {
+        item.topics.push_back(silkworm::to_hex(t, true));
+    }
+}
+
 void make_glaze_json_content(const nlohmann::json& request_json, const Logs& logs, std::string& json_reply) {
     GlazeJsonLog log_json_data{};
 
@@ -143,24 +160,18 @@ void make_glaze_json_content(const nlohmann::json& request_json, const Logs& log
 
     for (const auto& l : logs) {
         GlazeJsonLogItem item{};
-        to_hex(std::span(item.address), l.address.bytes);
-        to_hex(std::span(item.tx_hash), l.tx_hash.bytes);
-        to_hex(std::span(item.block_hash), l.block_hash.bytes);
-        to_quantity(std::span(item.block_number), l.block_number);
-        to_quantity(std::span(item.tx_index), l.tx_index);
-        to_quantity(std::span(item.index), l.index);
-        item.removed = l.removed;
-        to_hex(item.data, l.data);
-        if (l.timestamp) {
-            item.timestamp = to_quantity(*(l.timestamp));
-        }
-        for (const auto& t : l.topics) {
-            item.topics.push_back(silkworm::to_hex(t, true));
-        }
+        make_glaze_json_log_item(l, item);
         log_json_data.log_json_list.push_back(std::move(item));
     }
 
     glz::write_json(log_json_data, json_reply);
 }
 
+void make_glaze_json_log(const Log& log, std::string& json_log) {
+    GlazeJsonLogItem item{};
+    make_glaze_json_log_item(log, item);
+
+    glz::write_json(item, json_log);
+}
+
 }  // namespace silkworm::rpc
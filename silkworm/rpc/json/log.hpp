@@ -28,4 +28,7 @@ void to_json(nlohmann::json& json, const std::vector<Logs>& logs);
 
 void make_glaze_json_content(const nlohmann::json& request_json, const Logs& logs, std::string& json_reply);
 
+//! Serialize one log as JSON object in \p json_log
+void make_glaze_json_log(const Log& log, std::string& json_log);
+
 }  // namespace silkworm::rpc
@@ -145,4 +145,28 @@ TEST_CASE("make empty glaze Log", "[make_glaze_content(Log)]") {
                    \"result\":[]}]"));
 }
 
+TEST_CASE("make glaze Log item", "[make_glaze_content(Log)]") {
+    Log log{
+        .address = 0xea674fdde714fd979de3edf0f56aa9716b898ec8_address,
+        .topics = {0x0000000000000000000000000000000000000000000000000000000000000001_bytes32},
+        .data = *from_hex("0x0102"),
+        .block_number = 4206337,
+        .tx_hash = 0x2e77b2bf0b2b2fcd4c1e3e5b8d0e2f2a4b4e8c3a7d1e6f5b9c0a1d2e3f4a5b6c_bytes32,
+        .tx_index = 3,
+        .block_hash = 0x8a5b6e9e1c4d2f3a7b0c6d5e4f3a2b1c0d9e8f7a6b5c4d3e2f1a0b9c8d7e6f5a_bytes32,
+        .index = 12,
+    };
+    std::string json_log;
+
+    SECTION("without timestamp") {
+        make_glaze_json_log(log, json_log);
+        CHECK(nlohmann::json::parse(json_log) == nlohmann::json(log));
+    }
+    SECTION("with timestamp") {
+        log.timestamp = 1'700'000'000;
+        make_glaze_json_log(log, json_log);
+        CHECK(nlohmann::json::parse(json_log) == nlohmann::json(log));
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -28,6 +28,7 @@
 #include <boost/asio/experimental/use_promise.hpp>
 #endif  // _WIN32
 
+#include <silkworm/core/common/hex.hpp>
 #include <silkworm/infra/common/log.hpp>
 
 namespace silkworm::rpc::json {
@@ -130,6 +131,11 @@ void Stream::close_array() {
 }
 
 void Stream::write_json(const nlohmann::json& json) {
+    const auto content = json.dump(/*indent=*/-1, /*indent_char=*/' ', /*ensure_ascii=*/false, nlohmann::json::error_handler_t::replace);
+    write_json_content(content);
+}
+
+void Stream::write_json_content(std::string_view content) {
     const bool is_entry = !stack_.empty() && (stack_.top() == kArrayOpen || stack_.top() == kEntryWritten);
     if (is_entry) {
         if (stack_.top() != kEntryWritten) {
@@ -139,7 +145,6 @@ void Stream::write_json(const nlohmann::json& json) {
         }
     }
 
-    const auto content = json.dump(/*indent=*/-1, /*indent_char=*/' ', /*ensure_ascii=*/false, nlohmann::json::error_handler_t::replace);
     write(content);
 }
 
@@ -191,7 +196,9 @@ void Stream::write_field(std::string_view name, evmc::bytes32 value) {
     ensure_separator();
     write_string(name);
     write(kColon);
-    write_string("0x" + to_hex(value));
+    std::array<char, 2 + 2 * sizeof(value.bytes)> hex_value{'0', 'x'};
+    hex::encode(value.bytes, hex_value.data() + 2);
+    write_string({hex_value.data(), hex_value.size()});
 }
 
 void Stream::write_field(std::string_view name, std::int32_t value) {
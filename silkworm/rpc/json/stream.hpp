@@ -62,6 +62,8 @@ class Stream {
     void close_array();
 
     void write_json(const nlohmann::json& json);
+    //! Write the already serialized JSON \p content as value or array entry
+    void write_json_content(std::string_view content);
     void write_json_field(std::string_view name, const nlohmann::json& value);
 
     void write_field(std::string_view name);
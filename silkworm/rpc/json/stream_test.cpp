@@ -121,6 +121,15 @@ TEST_CASE_METHOD(StreamTest, "json::Stream API", "[rpc][json]") {
 
         CHECK((string_writer.get_content() == "[]"));
     }
+    SECTION("array of JSON contents") {
+        stream.open_array();
+        stream.write_json_content(R"({"test":"test"})");
+        stream.write_json_content("[1,2]");
+        stream.close_array();
+        spawn_and_wait(stream.close());
+
+        CHECK((string_writer.get_content() == "[{\"test\":\"test\"},[1,2]]"));
+    }
     SECTION("simple object 1") {
         stream.open_object();
         stream.write_json_field("null", kJsonNull);
@@ -23,6 +23,7 @@
 #include <intx/intx.hpp>
 
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/hex.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
@@ -32,8 +33,28 @@
 
 namespace silkworm::rpc {
 
+//! Write the hex form of \p bytes without leading zero nibbles into \p dest (e.g. "0" for zero, nothing if empty)
+//! \return the number of chars written, at most 2 * bytes.size()
+static std::size_t write_hex_no_leading_zeros(silkworm::ByteView bytes, char* dest) {
+    static constexpr std::string_view kHexDigits{"0123456789abcdef"};
+    if (bytes.empty()) {
+        return 0;
+    }
+    auto significant_bytes{silkworm::zeroless_view(bytes)};
+    if (significant_bytes.empty()) {
+        *dest = '0';
+        return 1;
+    }
+    std::size_t length{0};
+    if (significant_bytes[0] < 0x10) {
+        dest[length++] = kHexDigits[significant_bytes[0]];
+        significant_bytes.remove_prefix(1);
+    }
+    hex::encode(significant_bytes, dest + length);
+    return length + 2 * significant_bytes.size();
+}
+
 void to_hex(std::span<char> hex_bytes, silkworm::ByteView bytes) {
-    static const char* kHexDigits{"0123456789abcdef"};
     if (bytes.size() * 2 + 2 + 1 > hex_bytes.size()) {
         SILK_ERROR << "req buffer length: " << bytes.size() * 2 + 2 + 1 << "  buffer length: " << hex_bytes.size() << "\n";
         throw std::invalid_argument("to_hex: hex_bytes too small");
@@ -41,15 +62,11 @@ void to_hex(std::span<char> hex_bytes, silkworm::ByteView bytes) {
     char* dest = hex_bytes.data();
     *dest++ = '0';
     *dest++ = 'x';
-    for (const auto& b : bytes) {
-        *dest++ = kHexDigits[b >> 4];    // Hi
-        *dest++ = kHexDigits[b & 0x0f];  // Lo
-    }
-    *dest = '\0';
+    hex::encode(bytes, dest);
+    dest[bytes.size() * 2] = '\0';
 }
 
 void to_hex_no_leading_zeros(std::span<char> hex_bytes, silkworm::ByteView bytes) {
-    static const char* kHexDigits{"0123456789abcdef"};
     size_t len = bytes.length();
     if (len * 2 + 2 + 1 > hex_bytes.size()) {
         SILK_ERROR << "req buffer length: " << len * 2 + 2 + 1 << "  buffer length: " << hex_bytes.size() << "\n";
@@ -58,26 +75,7 @@ void to_hex_no_leading_zeros(std::span<char> hex_bytes, silkworm::ByteView bytes
     char* dest = hex_bytes.data();
     *dest++ = '0';
     *dest++ = 'x';
-
-    bool found_nonzero{false};
-    for (size_t i{0}; i < len; ++i) {
-        auto x{bytes[i]};
-        char lo{kHexDigits[x & 0x0f]};
-        char hi{kHexDigits[x >> 4]};
-        if (!found_nonzero && hi != '0') {
-            found_nonzero = true;
-        }
-        if (found_nonzero) {
-            *dest++ = hi;
-        }
-        if (!found_nonzero && lo != '0') {
-            found_nonzero = true;
-        }
-        if (found_nonzero || i == len - 1) {
-            *dest++ = lo;
-        }
-    }
-    *dest = '\0';
+    dest[write_hex_no_leading_zeros(bytes, dest)] = '\0';
 }
 
 void to_quantity(std::span<char> quantity_hex_bytes, silkworm::ByteView bytes) {
@@ -102,37 +100,11 @@ void to_quantity(std::span<char> quantity_hex_bytes, intx::uint256 number) {
 }
 
 std::string to_hex_no_leading_zeros(silkworm::ByteView bytes) {
-    static const char* kHexDigits{"0123456789abcdef"};
-
-    std::string out{};
-
-    if (bytes.length() == 0) {
-        out.reserve(1);
-        out.push_back('0');
-        return out;
+    if (bytes.empty()) {
+        return "0";
     }
-
-    out.reserve(2 * bytes.length());
-
-    bool found_nonzero{false};
-    for (size_t i{0}; i < bytes.length(); ++i) {
-        uint8_t x{bytes[i]};
-        char lo{kHexDigits[x & 0x0f]};
-        char hi{kHexDigits[x >> 4]};
-        if (!found_nonzero && hi != '0') {
-            found_nonzero = true;
-        }
-        if (found_nonzero) {
-            out.push_back(hi);
-        }
-        if (!found_nonzero && lo != '0') {
-            found_nonzero = true;
-        }
-        if (found_nonzero || i == bytes.length() - 1) {
-            out.push_back(lo);
-        }
-    }
-
+    std::string out(2 * bytes.length(), '\0');
+    out.resize(write_hex_no_leading_zeros(bytes, out.data()));
     return out;
 }
 
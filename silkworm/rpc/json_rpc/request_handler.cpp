@@ -17,26 +17,55 @@
 #include "request_handler.hpp"
 
 #include <algorithm>
-#include <sstream>
+#include <optional>
+#include <variant>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
 #include <silkworm/infra/common/clock_time.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/rpc/commands/eth_api.hpp>
+#include <silkworm/rpc/json/types.hpp>
 #include <silkworm/rpc/protocol/errors.hpp>
 #include <silkworm/rpc/transport/stream_writer.hpp>
 
 namespace silkworm::rpc::json_rpc {
 
+//! Minimum size of the cached results written as shared content, so that compressed replies can reuse their compressed form
+static constexpr std::size_t kMinSharedResultSize{64 * 1024};
+
+//! Capacity of the stream buffer used to collect the replies of stream handlers into a string
+static constexpr std::size_t kStringStreamBufferCapacity{16 * 1024};
+
+//! \return the cache key of \p request, built from its typed parameters so that it matches the key of the generic path
+static std::optional<std::string> make_cache_key(const TypedRequest& request) {
+    nlohmann::json params_json;
+    if (const auto* block_params = std::get_if<EthGetBlockByNumberParams>(&request.params)) {
+        params_json = nlohmann::json::array({block_params->block_id, block_params->full_tx});
+    } else if (const auto* receipt_params = std::get_if<EthGetTransactionReceiptParams>(&request.params)) {
+        params_json = nlohmann::json::array({receipt_params->transaction_hash});
+    } else if (const auto* balance_params = std::get_if<EthGetBalanceParams>(&request.params)) {
+        params_json = nlohmann::json::array({balance_params->address, balance_params->block_id});
+    } else {
+        return std::nullopt;
+    }
+    return ResponseCache::make_key(request.method, params_json);
+}
+
 RequestHandler::RequestHandler(StreamWriter* stream_writer,
                                commands::RpcApi& rpc_api,
                                const commands::RpcApiTable& rpc_api_table,
-                               InterfaceLogSettings ifc_log_settings)
+                               InterfaceLogSettings ifc_log_settings,
+                               BatchSettings batch_settings,
+                               ResponseCache* response_cache)
     : stream_writer_{stream_writer},
       rpc_api_{rpc_api},
       rpc_api_table_{rpc_api_table},
-      ifc_log_{ifc_log_settings.enabled ? std::make_shared<InterfaceLog>(std::move(ifc_log_settings)) : nullptr} {}
+      ifc_log_{ifc_log_settings.enabled ? std::make_shared<InterfaceLog>(std::move(ifc_log_settings)) : nullptr},
+      batch_settings_{batch_settings},
+      response_cache_{response_cache} {}
 
 Task<std::optional<std::string>> RequestHandler::handle(const std::string& request) {
     const auto start = clock_time::now();
@@ -46,33 +75,20 @@ Task<std::optional<std::string>> RequestHandler::handle(const std::string& reque
         if (ifc_log_) {
             ifc_log_->log_req(request);
         }
-        const auto request_json = prevalidate_and_parse(request);
-        if (request_json.is_object()) {
-            if (const auto valid_result{is_valid_jsonrpc(request_json)}; !valid_result) {
-                response = make_json_error(request_json, kInvalidRequest, valid_result.error()).dump() + "\n";
-            } else {
-                return_reply = co_await handle_request_and_create_reply(request_json, response);
-            }
+        // Hot methods are parsed straight into their typed parameters, skipping the request DOM and its validation
+        if (const auto typed_request = parse_typed_request(request); typed_request && is_typed_request_enabled(*typed_request)) {
+            return_reply = co_await handle_typed_request_and_create_reply(*typed_request, response);
         } else {
-            std::stringstream batch_reply_content;
-            batch_reply_content << "[";
-            int index = 0;
-            for (auto& item : request_json.items()) {
-                const auto& single_request_json{item.value()};
-                if (index++ > 0) {
-                    batch_reply_content << ",";
-                }
-
-                if (const auto valid_result{is_valid_jsonrpc(single_request_json)}; !valid_result) {
-                    batch_reply_content << make_json_error(request_json, kInvalidRequest, valid_result.error()).dump();
+            const auto request_json = prevalidate_and_parse(request);
+            if (request_json.is_object()) {
+                if (const auto valid_result{is_valid_jsonrpc(request_json)}; !valid_result) {
+                    response = make_json_error(request_json, kInvalidRequest, valid_result.error()).dump() + "\n";
                 } else {
-                    std::string single_reply;
-                    return_reply = co_await handle_request_and_create_reply(single_request_json, single_reply);
-                    batch_reply_content << single_reply;
+                    return_reply = co_await handle_request_and_create_reply(request_json, response, /*allow_stream=*/true);
                 }
+            } else {
+                return_reply = co_await handle_batch_and_create_reply(request_json, response);
             }
-            batch_reply_content << "]";
-            response = batch_reply_content.str();
         }
     } catch (const nlohmann::json::exception& e) {
         SILK_ERROR << "RequestHandler::handle nlohmann::json::exception: " << e.what();
@@ -103,6 +119,11 @@ Task<std::optional<std::string>> RequestHandler::handle(const std::string& reque
  * @return The parsed JSON request
  */
 nlohmann::json RequestHandler::prevalidate_and_parse(const std::string& request) {
+    // Fast path: the quote-aware scan is needed only if there is at least one nil character
+    if (request.find('\0') == std::string::npos) {
+        return nlohmann::json::parse(request);
+    }
+
     bool inside_quote = false;
     bool previous_char_escape = false;
     for (auto ch : request) {
@@ -123,7 +144,141 @@ ValidationResult RequestHandler::is_valid_jsonrpc(const nlohmann::json& request_
     return json_rpc_validator_.validate(request_json);
 }
 
-Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, std::string& response) {
+bool RequestHandler::is_typed_request_enabled(const TypedRequest& request) const {
+    const auto& method = request.method;
+    return rpc_api_table_.find_json_glaze_handler(method) || rpc_api_table_.find_json_handler(method) ||
+           rpc_api_table_.find_stream_handler(method);
+}
+
+Task<bool> RequestHandler::handle_typed_request_and_create_reply(const TypedRequest& request, std::string& response) {
+    const auto& request_json = request.envelope;
+    SILK_TRACE << "--> handle RPC typed request: " << request.method;
+    if (const auto* logs_params = std::get_if<EthGetLogsParams>(&request.params)) {
+        const auto handle_stream = [&](json::Stream& stream) {
+            return rpc_api_.handle_eth_get_logs(request_json, *logs_params, stream);
+        };
+        if (stream_writer_) {
+            co_await handle_stream_request(request_json, handle_stream, *stream_writer_, json::Stream::kDefaultCapacity);
+            SILK_TRACE << "<-- handle RPC typed request: " << request.method;
+            co_return false;
+        }
+        StringWriter string_writer;
+        co_await handle_stream_request(request_json, handle_stream, string_writer, kStringStreamBufferCapacity);
+        response = string_writer.get_content();
+        SILK_TRACE << "<-- handle RPC typed request: " << request.method;
+        co_return true;
+    }
+
+    // Replies of deterministic methods are served from the response cache (if any) when possible
+    std::optional<std::string> cache_key;
+    uint64_t cache_epoch{0};
+    if (response_cache_ && rpc_api_table_.is_cacheable(request.method)) {
+        cache_key = make_cache_key(request);
+        if (cache_key) {
+            if (const auto reply_written = co_await handle_cached_reply(request.method, *cache_key, request_json, response, /*allow_stream=*/true)) {
+                co_return *reply_written;
+            }
+            cache_epoch = response_cache_->epoch();
+        }
+    }
+
+    try {
+        if (const auto* call_params = std::get_if<EthCallParams>(&request.params)) {
+            response.reserve(2048);
+            co_await rpc_api_.handle_eth_call(request_json, *call_params, response);
+        } else if (const auto* block_params = std::get_if<EthGetBlockByNumberParams>(&request.params)) {
+            response.reserve(2048);
+            co_await rpc_api_.handle_eth_get_block_by_number(request_json, *block_params, response);
+        } else {
+            nlohmann::json reply_json;
+            if (const auto* receipt_params = std::get_if<EthGetTransactionReceiptParams>(&request.params)) {
+                co_await rpc_api_.handle_eth_get_transaction_receipt(request_json, *receipt_params, reply_json);
+            } else if (const auto* balance_params = std::get_if<EthGetBalanceParams>(&request.params)) {
+                co_await rpc_api_.handle_eth_get_balance(request_json, *balance_params, reply_json);
+            }
+            response = reply_json.dump(
+                /*indent=*/-1, /*indent_char=*/' ', /*ensure_ascii=*/false, nlohmann::json::error_handler_t::replace);
+        }
+    } catch (const std::exception& e) {
+        SILK_ERROR << "exception: " << e.what();
+        response = make_json_error(request_json, 100, e.what()).dump();
+    } catch (...) {
+        SILK_ERROR << "unexpected exception";
+        response = make_json_error(request_json, 100, "unexpected exception").dump();
+    }
+    SILK_TRACE << "<-- handle RPC typed request: " << request.method;
+
+    if (cache_key) {
+        response_cache_->put(*cache_key, cache_epoch, response);
+    }
+    co_return true;
+}
+
+Task<bool> RequestHandler::handle_batch_and_create_reply(const nlohmann::json& request_json, std::string& response) {
+    const std::size_t batch_size = request_json.size();
+    if (batch_settings_.max_batch_size > 0 && batch_size > batch_settings_.max_batch_size) {
+        response = make_json_error(request_json, kInvalidRequest, "batch too large").dump();
+        co_return true;
+    }
+
+    // All workers run on the connection executor, so the shared indexes need no synchronization
+    std::vector<std::string> replies(batch_size);
+    std::size_t next_index{0};
+    std::size_t replies_size{0};
+    auto batch_worker = [&](std::size_t /*worker_index*/) -> Task<void> {
+        while (next_index < batch_size) {
+            const std::size_t index = next_index++;
+            const auto& item_json = request_json[index];
+            if (batch_settings_.max_response_size > 0 && replies_size > batch_settings_.max_response_size) {
+                // Do not execute any more requests if the response is already too large
+                replies[index] = make_json_error(item_json, kServerError, "response too large").dump();
+                continue;
+            }
+            co_await handle_batch_item(item_json, replies[index]);
+            replies_size += replies[index].size();
+        }
+    };
+    const std::size_t num_workers = batch_settings_.max_concurrency > 0
+                                        ? std::min(batch_settings_.max_concurrency, batch_size)
+                                        : batch_size;
+    co_await concurrency::generate_parallel_group_task(num_workers, batch_worker);
+
+    // Assemble the replies in request order, replacing all the ones exceeding the max response size
+    bool response_too_large{false};
+    std::size_t response_size{2};  // enclosing square brackets
+    for (std::size_t i{0}; i < batch_size; ++i) {
+        auto& reply = replies[i];
+        if (!response_too_large && batch_settings_.max_response_size > 0) {
+            response_too_large = response_size + reply.size() + 1 > batch_settings_.max_response_size;
+        }
+        if (response_too_large) {
+            reply = make_json_error(request_json[i], kServerError, "response too large").dump();
+        }
+        response_size += reply.size() + 1;
+    }
+    response.clear();
+    response.reserve(response_size);
+    response.push_back('[');
+    for (std::size_t i{0}; i < batch_size; ++i) {
+        if (i > 0) {
+            response.push_back(',');
+        }
+        response.append(replies[i]);
+    }
+    response.push_back(']');
+
+    co_return true;
+}
+
+Task<void> RequestHandler::handle_batch_item(const nlohmann::json& item_json, std::string& response) {
+    if (const auto valid_result{is_valid_jsonrpc(item_json)}; !valid_result) {
+        response = make_json_error(item_json, kInvalidRequest, valid_result.error()).dump();
+        co_return;
+    }
+    co_await handle_request_and_create_reply(item_json, response);
+}
+
+Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, std::string& response, bool allow_stream) {
     if (!request_json.contains("method")) {
         response = make_json_error(request_json, kInvalidRequest, "invalid request").dump();
         co_return true;
@@ -137,25 +292,48 @@ Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json&
 
     // Dispatch JSON handlers in this order: 1) glaze JSON 2) nlohmann JSON 3) JSON streaming
     const auto json_glaze_handler = rpc_api_table_.find_json_glaze_handler(method);
-    if (json_glaze_handler) {
-        SILK_TRACE << "--> handle RPC request: " << method;
-        co_await handle_request(*json_glaze_handler, request_json, response);
-        SILK_TRACE << "<-- handle RPC request: " << method;
-        co_return true;
-    }
-    const auto json_handler = rpc_api_table_.find_json_handler(method);
-    if (json_handler) {
+    const auto json_handler = json_glaze_handler ? std::nullopt : rpc_api_table_.find_json_handler(method);
+    if (json_glaze_handler || json_handler) {
+        // Replies of deterministic methods are served from the response cache (if any) when possible
+        std::optional<std::string> cache_key;
+        uint64_t cache_epoch{0};
+        if (response_cache_ && rpc_api_table_.is_cacheable(method)) {
+            cache_key = ResponseCache::make_key(method, request_json.contains("params") ? request_json["params"] : nlohmann::json{});
+            if (cache_key) {
+                if (const auto reply_written = co_await handle_cached_reply(method, *cache_key, request_json, response, allow_stream)) {
+                    co_return *reply_written;
+                }
+                cache_epoch = response_cache_->epoch();
+            }
+        }
+
         SILK_TRACE << "--> handle RPC request: " << method;
-        co_await handle_request(*json_handler, request_json, response);
+        if (json_glaze_handler) {
+            co_await handle_request(*json_glaze_handler, request_json, response);
+        } else {
+            co_await handle_request(*json_handler, request_json, response);
+        }
         SILK_TRACE << "<-- handle RPC request: " << method;
+
+        if (cache_key) {
+            response_cache_->put(*cache_key, cache_epoch, response);
+        }
         co_return true;
     }
     const auto stream_handler = rpc_api_table_.find_stream_handler(method);
     if (stream_handler) {
         SILK_TRACE << "--> handle RPC stream request: " << method;
-        co_await handle_request(*stream_handler, request_json);
+        if (allow_stream && stream_writer_) {
+            co_await handle_request(*stream_handler, request_json, *stream_writer_);
+            SILK_TRACE << "<-- handle RPC stream request: " << method;
+            co_return false;
+        }
+        // Replies that cannot be written directly to the stream writer (e.g. batch items) are collected into the response
+        StringWriter string_writer;
+        co_await handle_request(*stream_handler, request_json, string_writer, kStringStreamBufferCapacity);
+        response = string_writer.get_content();
         SILK_TRACE << "<-- handle RPC stream request: " << method;
-        co_return false;
+        co_return true;
     }
 
     response = make_json_error(request_json, kMethodNotFound, "the method " + method + " does not exist/is not available").dump();
@@ -194,15 +372,28 @@ Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleMethod ha
     }
 }
 
-Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json) {
+Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler,
+                                          const nlohmann::json& request_json,
+                                          StreamWriter& stream_writer,
+                                          std::size_t buffer_capacity) {
+    const auto handle_stream = [&](json::Stream& stream) {
+        return (rpc_api_.*handler)(request_json, stream);
+    };
+    co_await handle_stream_request(request_json, handle_stream, stream_writer, buffer_capacity);
+}
+
+Task<void> RequestHandler::handle_stream_request(const nlohmann::json& request_json,
+                                                 const std::function<Task<void>(json::Stream&)>& handle_stream,
+                                                 StreamWriter& stream_writer,
+                                                 std::size_t buffer_capacity) {
     auto io_executor = co_await boost::asio::this_coro::executor;
 
     try {
-        json::Stream stream(io_executor, *stream_writer_);
+        json::Stream stream(io_executor, stream_writer, buffer_capacity);
         co_await stream.open();
 
         try {
-            co_await (rpc_api_.*handler)(request_json, stream);
+            co_await handle_stream(stream);
         } catch (const std::exception& e) {
             SILK_ERROR << "exception: " << e.what();
             const auto error = make_json_error(request_json, 100, e.what());
@@ -219,4 +410,34 @@ Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream ha
     }
 }
 
+Task<std::optional<bool>> RequestHandler::handle_cached_reply(const std::string& method,
+                                                              const std::string& cache_key,
+                                                              const nlohmann::json& request_json,
+                                                              std::string& response,
+                                                              bool allow_stream) {
+    const auto result = response_cache_->get(cache_key);
+    if (!result) {
+        co_return std::nullopt;
+    }
+    SILK_TRACE << "<-> handle RPC request from cache: " << method;
+    if (allow_stream && stream_writer_ && result->data().size() >= kMinSharedResultSize) {
+        co_await write_cached_reply(request_json, result);
+        co_return false;
+    }
+    response = ResponseCache::make_reply(request_json, result->data());
+    co_return true;
+}
+
+Task<void> RequestHandler::write_cached_reply(const nlohmann::json& request_json, const ResponseCache::ResultPtr& result) {
+    try {
+        co_await stream_writer_->open_stream();
+        co_await stream_writer_->write(ResponseCache::make_reply_prefix(request_json), /*last=*/false);
+        co_await stream_writer_->write_shared(result);
+        co_await stream_writer_->write("}", /*last=*/true);
+        co_await stream_writer_->close_stream();
+    } catch (const std::exception& e) {
+        SILK_ERROR << "exception: " << e.what();
+    }
+}
+
 }  // namespace silkworm::rpc::json_rpc
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -30,7 +32,11 @@
 
 #include <silkworm/rpc/commands/rpc_api.hpp>
 #include <silkworm/rpc/commands/rpc_api_table.hpp>
+#include <silkworm/rpc/common/batch_settings.hpp>
 #include <silkworm/rpc/common/interface_log.hpp>
+#include <silkworm/rpc/json/stream.hpp>
+#include <silkworm/rpc/json_rpc/response_cache.hpp>
+#include <silkworm/rpc/json_rpc/typed_request.hpp>
 #include <silkworm/rpc/json_rpc/validator.hpp>
 #include <silkworm/rpc/transport/request_handler.hpp>
 #include <silkworm/rpc/transport/stream_writer.hpp>
@@ -42,7 +48,9 @@ class RequestHandler : public rpc::RequestHandler {
     RequestHandler(StreamWriter* stream_writer,
                    commands::RpcApi& rpc_api,
                    const commands::RpcApiTable& rpc_api_table,
-                   InterfaceLogSettings ifc_log_settings = {});
+                   InterfaceLogSettings ifc_log_settings = {},
+                   BatchSettings batch_settings = {},
+                   ResponseCache* response_cache = nullptr);
     ~RequestHandler() override = default;
 
     RequestHandler(const RequestHandler&) = delete;
@@ -51,12 +59,23 @@ class RequestHandler : public rpc::RequestHandler {
     Task<std::optional<std::string>> handle(const std::string& request) override;
 
   protected:
-    Task<bool> handle_request_and_create_reply(const nlohmann::json& request_json, std::string& response);
+    //! \param allow_stream whether the reply can be written directly to the stream writer instead of \p response
+    //! \return true if the reply has been written into \p response, false if written directly to the stream writer
+    Task<bool> handle_request_and_create_reply(const nlohmann::json& request_json, std::string& response, bool allow_stream = false);
+
+    //! \return true if \p request can take the typed path, i.e. its method is enabled
+    bool is_typed_request_enabled(const TypedRequest& request) const;
 
   private:
     nlohmann::json prevalidate_and_parse(const std::string& request);
     ValidationResult is_valid_jsonrpc(const nlohmann::json& request_json);
 
+    //! \return true if the reply has been written into \p response, false if written directly to the stream writer
+    Task<bool> handle_typed_request_and_create_reply(const TypedRequest& request, std::string& response);
+
+    Task<bool> handle_batch_and_create_reply(const nlohmann::json& request_json, std::string& response);
+    Task<void> handle_batch_item(const nlohmann::json& item_json, std::string& response);
+
     Task<void> handle_request(
         commands::RpcApiTable::HandleMethod handler,
         const nlohmann::json& request_json,
@@ -65,7 +84,25 @@ class RequestHandler : public rpc::RequestHandler {
         commands::RpcApiTable::HandleMethodGlaze handler,
         const nlohmann::json& request_json,
         std::string& response);
-    Task<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json);
+    Task<void> handle_request(
+        commands::RpcApiTable::HandleStream handler,
+        const nlohmann::json& request_json,
+        StreamWriter& stream_writer,
+        std::size_t buffer_capacity = json::Stream::kDefaultCapacity);
+    Task<void> handle_stream_request(
+        const nlohmann::json& request_json,
+        const std::function<Task<void>(json::Stream&)>& handle_stream,
+        StreamWriter& stream_writer,
+        std::size_t buffer_capacity);
+    //! Serve the reply to \p request_json from the response cache if the result cached for \p cache_key is available
+    //! \return std::nullopt if not cached, otherwise true if the reply has been written into \p response, false if written
+    //! directly to the stream writer
+    Task<std::optional<bool>> handle_cached_reply(const std::string& method,
+                                                  const std::string& cache_key,
+                                                  const nlohmann::json& request_json,
+                                                  std::string& response,
+                                                  bool allow_stream);
+    Task<void> write_cached_reply(const nlohmann::json& request_json, const ResponseCache::ResultPtr& result);
 
     StreamWriter* stream_writer_;
 
@@ -76,6 +113,11 @@ class RequestHandler : public rpc::RequestHandler {
     Validator json_rpc_validator_;
 
     std::shared_ptr<InterfaceLog> ifc_log_;
+
+    BatchSettings batch_settings_;
+
+    //! The cache of the results of deterministic methods shared by all the handlers (if enabled)
+    ResponseCache* response_cache_;
 };
 
 }  // namespace silkworm::rpc::json_rpc
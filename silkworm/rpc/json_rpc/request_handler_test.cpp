@@ -16,12 +16,23 @@
 
 #include "request_handler.hpp"
 
+#include <set>
+#include <string>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <silkworm/core/types/log.hpp>
+#include <silkworm/db/access_layer.hpp>
+#include <silkworm/db/log_cbor.hpp>
+#include <silkworm/db/tables.hpp>
+#include <silkworm/rpc/protocol/errors.hpp>
 #include <silkworm/rpc/test_util/api_test_database.hpp>
 
 namespace silkworm::rpc::json_rpc {
 
+using evmc::literals::operator""_address;
+
 #ifndef SILKWORM_SANITIZE
 TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request no method", "[rpc][handle]") {
     const auto request = R"({"jsonrpc":"2.0","id":1})"_json;
@@ -140,6 +151,295 @@ TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request does not allow
     })"_json);
 }
 
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request batch replies in request order", "[rpc][handle_request]") {
+    std::string request{"["};
+    for (int id{1}; id <= 20; ++id) {
+        if (id > 1) {
+            request += ",";
+        }
+        request += R"({"jsonrpc":"2.0","id":)" + std::to_string(id) + R"(,"method":"eth_AAA)" + std::to_string(id) + R"("})";
+    }
+    request += "]";
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::handle_request>(request, reply);
+    const auto reply_json = nlohmann::json::parse(reply);
+    REQUIRE(reply_json.is_array());
+    REQUIRE(reply_json.size() == 20);
+    for (int id{1}; id <= 20; ++id) {
+        const auto& item_reply = reply_json[static_cast<std::size_t>(id - 1)];
+        CHECK(item_reply["id"] == id);
+        CHECK(item_reply["error"]["code"] == -32601);
+        CHECK(item_reply["error"]["message"] == "the method eth_AAA" + std::to_string(id) + " does not exist/is not available");
+    }
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request batch too large", "[rpc][handle_request]") {
+    std::string request{"["};
+    for (std::size_t i{0}; i <= kDefaultMaxBatchSize; ++i) {
+        if (i > 0) {
+            request += ",";
+        }
+        request += R"({"jsonrpc":"2.0","id":1,"method":"eth_blockNumber"})";
+    }
+    request += "]";
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::handle_request>(request, reply);
+    CHECK(reply.back() == '}');
+    CHECK(nlohmann::json::parse(reply) == R"({
+        "jsonrpc":"2.0",
+        "id":null,
+        "error":{
+             "code":-32600,
+             "message":"batch too large"
+        }
+    })"_json);
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request batch with stream requests", "[rpc][handle_request]") {
+    const auto request = R"([
+        {"jsonrpc":"2.0","id":1,"method":"eth_blockNumber"},
+        {"jsonrpc":"2.0","id":2,"method":"eth_getLogs","params":[{"fromBlock":"0x0","toBlock":"0x0"}]},
+        {"jsonrpc":"2.0","id":3,"method":"eth_blockNumber"}
+    ])";
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::handle_request>(request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"([
+        {"jsonrpc":"2.0","id":1,"result":"0x9"},
+        {"jsonrpc":"2.0","id":2,"result":[]},
+        {"jsonrpc":"2.0","id":3,"result":"0x9"}
+    ])"_json);
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request stream requests reply with either result or error", "[rpc][handle_request]") {
+    const auto handle = [&](const nlohmann::json& request) {
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request, reply);
+        const auto reply_json = nlohmann::json::parse(reply);
+        CHECK(reply_json["jsonrpc"] == "2.0");
+        CHECK(reply_json["id"] == request["id"]);
+        CHECK(reply_json.contains("result") != reply_json.contains("error"));
+        return reply_json;
+    };
+
+    SECTION("block receipts") {
+        const auto reply = handle(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockReceipts","params":["0x1"]})"_json);
+        CHECK(reply["result"].is_array());
+        CHECK(handle(R"({"jsonrpc":"2.0","id":1,"method":"eth_getTransactionReceiptsByBlock","params":["0x1"]})"_json) == reply);
+        CHECK(handle(R"({"jsonrpc":"2.0","id":1,"method":"parity_getBlockReceipts","params":["0x1"]})"_json) == reply);
+    }
+
+    SECTION("block receipts of unknown block") {
+        const auto reply = handle(R"({"jsonrpc":"2.0","id":2,"method":"eth_getBlockReceipts","params":["0x64"]})"_json);
+        CHECK(reply["result"].is_null());
+    }
+
+    SECTION("modified accounts") {
+        const auto reply = handle(R"({"jsonrpc":"2.0","id":3,"method":"debug_getModifiedAccountsByNumber","params":["0x1","0x9"]})"_json);
+        CHECK(reply["result"].is_array());
+    }
+
+    SECTION("modified accounts of unknown blocks") {
+        const auto by_number = handle(R"({"jsonrpc":"2.0","id":4,"method":"debug_getModifiedAccountsByNumber","params":["0x64"]})"_json);
+        CHECK(by_number["error"]["message"] == "start block (100) is later than the latest block (9)");
+        const auto by_hash = handle(R"({"jsonrpc":"2.0","id":5,"method":"debug_getModifiedAccountsByHash","params":[
+            "0x0000000000000000000000000000000000000000000000000000000000000001"
+        ]})"_json);
+        CHECK(by_hash["error"]["message"] == "start block 0000000000000000000000000000000000000000000000000000000000000001 not found");
+    }
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request batch with block receipts and modified accounts", "[rpc][handle_request]") {
+    const auto request = R"([
+        {"jsonrpc":"2.0","id":1,"method":"eth_getBlockReceipts","params":["0x1"]},
+        {"jsonrpc":"2.0","id":2,"method":"debug_getModifiedAccountsByNumber","params":["0x64"]},
+        {"jsonrpc":"2.0","id":3,"method":"parity_getBlockReceipts","params":["0x64"]},
+        {"jsonrpc":"2.0","id":4,"method":"debug_getModifiedAccountsByNumber","params":["0x1","0x9"]}
+    ])";
+    std::string reply;
+    run<&test_util::RequestHandler_ForTest::handle_request>(request, reply);
+    const auto reply_json = nlohmann::json::parse(reply);
+    REQUIRE(reply_json.is_array());
+    REQUIRE(reply_json.size() == 4);
+    for (std::size_t i{0}; i < reply_json.size(); ++i) {
+        const auto& item_reply = reply_json[i];
+        CHECK(item_reply["id"] == i + 1);
+        CHECK(item_reply.contains("result") != item_reply.contains("error"));
+    }
+    CHECK(reply_json[0]["result"].is_array());
+    CHECK(reply_json[1]["error"]["code"] == -32000);
+    CHECK(reply_json[2]["result"].is_null());
+    CHECK(reply_json[3]["result"].is_array());
+
+    // Each item replies as the same request outside of the batch
+    std::string single_reply;
+    run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+        R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockReceipts","params":["0x1"]})"_json, single_reply);
+    CHECK(reply_json[0] == nlohmann::json::parse(single_reply));
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request eth_getLogs failing after some blocks are read", "[rpc][handle_request]") {
+    // Blocks 1 and 2 have transactions: give both a log, so that block 2 is read and serialized before block 1
+    const std::vector<silkworm::Log> logs{{.address = 0x00000000000000000000000000000000000000aa_address}};
+    db::RWTxnManaged txn{get_mdbx_env()};
+    for (const BlockNum block_number : {1, 2}) {
+        txn.rw_cursor(db::table::kLogs)->upsert(db::to_slice(db::log_key(block_number, 0)), db::to_slice(cbor_encode(logs)));
+    }
+    const auto block1_hash = db::read_canonical_hash(txn, 1);
+    REQUIRE(block1_hash);
+
+    const auto request = R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"fromBlock":"0x1","toBlock":"0x2"}]})"_json;
+    const auto handle = [&]() {
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(request, reply);
+        const auto reply_json = nlohmann::json::parse(reply);
+        CHECK(reply_json["id"] == 1);
+        CHECK(reply_json.contains("result") != reply_json.contains("error"));
+        return reply_json;
+    };
+
+    SECTION("all blocks read") {
+        txn.commit_and_stop();
+        const auto reply = handle();
+        REQUIRE(reply["result"].is_array());
+        std::set<std::string> block_numbers;
+        for (const auto& log : reply["result"]) {
+            block_numbers.insert(log["blockNumber"].get<std::string>());
+        }
+        CHECK(block_numbers == std::set<std::string>{"0x1", "0x2"});
+    }
+
+    SECTION("failure after reading some blocks replies with error only") {
+        txn.rw_cursor(db::table::kBlockBodies)->upsert(db::to_slice(db::block_key(1, block1_hash->bytes)), db::to_slice(Bytes{0x01}));
+        txn.commit_and_stop();
+        CHECK(handle()["error"]["code"] == kInternalError);
+
+        // Same reply inside a batch
+        std::string batch_reply;
+        run<&test_util::RequestHandler_ForTest::handle_request>("[" + request.dump() + "]", batch_reply);
+        const auto batch_reply_json = nlohmann::json::parse(batch_reply);
+        REQUIRE(batch_reply_json.is_array());
+        REQUIRE(batch_reply_json.size() == 1);
+        CHECK(batch_reply_json[0] == handle());
+    }
+
+    SECTION("block not found after reading some blocks replies with empty result") {
+        txn.rw_cursor(db::table::kCanonicalHashes)->erase(db::to_slice(db::block_key(1)));
+        txn.commit_and_stop();
+        CHECK(handle() == R"({"jsonrpc":"2.0","id":1,"result":[]})"_json);
+    }
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request typed requests reply as generic ones", "[rpc][handle_request]") {
+    const std::vector<std::string> requests{
+        R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x0",false]})",
+        R"({"jsonrpc":"2.0","id":2,"method":"eth_getBlockByNumber","params":["0x1",true]})",
+        R"({"jsonrpc":"2.0","id":3,"method":"eth_getBalance","params":["0x0000000000000000000000000000000000000000","0x9"]})",
+        R"({"jsonrpc":"2.0","id":4,"method":"eth_getTransactionReceipt","params":["0x0000000000000000000000000000000000000000000000000000000000000001"]})",
+    };
+    for (const auto& request : requests) {
+        REQUIRE(parse_typed_request(request));
+        std::string typed_reply;
+        run<&test_util::RequestHandler_ForTest::handle_request>(request, typed_reply);
+        std::string generic_reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(nlohmann::json::parse(request), generic_reply);
+        CHECK(nlohmann::json::parse(typed_reply) == nlohmann::json::parse(generic_reply));
+    }
+}
+
+TEST_CASE_METHOD(test_util::RpcApiE2ETest, "check handle_request response cache", "[rpc][handle_request]") {
+    ResponseCache response_cache;
+    response_cache_ = &response_cache;
+
+    SECTION("miss then hit with request id rewritten") {
+        std::string reply1;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",false]})"_json, reply1);
+        CHECK(response_cache.size() == 1);
+        std::string reply2;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":2,"method":"eth_getBlockByNumber","params":["0x1",false]})"_json, reply2);
+        CHECK(response_cache.size() == 1);
+
+        auto expected_reply = nlohmann::json::parse(reply1);
+        CHECK(!expected_reply["result"].is_null());
+        expected_reply["id"] = 2;
+        CHECK(nlohmann::json::parse(reply2) == expected_reply);
+    }
+
+    SECTION("typed request miss then hit") {
+        const std::string request1{R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",false]})"};
+        REQUIRE(run<&test_util::RequestHandler_ForTest::typed_request_enabled>(request1));
+        std::string reply1;
+        run<&test_util::RequestHandler_ForTest::handle_request>(request1, reply1);
+        CHECK(response_cache.size() == 1);
+        CHECK(!nlohmann::json::parse(reply1)["result"].is_null());
+
+        // The key built from the typed parameters is the same as the one built by the generic path
+        std::string reply2;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":2,"method":"eth_getBlockByNumber","params":["0X1",false]})"_json, reply2);
+        CHECK(response_cache.size() == 1);
+        auto expected_reply = nlohmann::json::parse(reply1);
+        expected_reply["id"] = 2;
+        CHECK(nlohmann::json::parse(reply2) == expected_reply);
+
+        std::string reply3;
+        run<&test_util::RequestHandler_ForTest::handle_request>(
+            R"({"jsonrpc":"2.0","id":3,"method":"eth_getBlockByNumber","params":["0x1",false]})", reply3);
+        CHECK(response_cache.size() == 1);
+        expected_reply["id"] = 3;
+        CHECK(nlohmann::json::parse(reply3) == expected_reply);
+    }
+
+    SECTION("typed request hit served from the cache") {
+        const auto key = ResponseCache::make_key("eth_getTransactionReceipt", R"(["0x0000000000000000000000000000000000000000000000000000000000000001"])"_json);
+        REQUIRE(key);
+        REQUIRE(response_cache.put(*key, response_cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":{"status":"0x1"}})"));
+
+        const std::string request{R"({"jsonrpc":"2.0","id":8,"method":"eth_getTransactionReceipt","params":["0x0000000000000000000000000000000000000000000000000000000000000001"]})"};
+        REQUIRE(run<&test_util::RequestHandler_ForTest::typed_request_enabled>(request));
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::handle_request>(request, reply);
+        CHECK(nlohmann::json::parse(reply) == R"({"jsonrpc":"2.0","id":8,"result":{"status":"0x1"}})"_json);
+    }
+
+    SECTION("hit served from the cache") {
+        const auto params = R"(["0x1",false])"_json;
+        const auto key = ResponseCache::make_key("eth_getBlockByNumber", params);
+        REQUIRE(key);
+        REQUIRE(response_cache.put(*key, response_cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":{"number":"0x1"}})"));
+
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":7,"method":"eth_getBlockByNumber","params":["0x1",false]})"_json, reply);
+        CHECK(nlohmann::json::parse(reply) == R"({"jsonrpc":"2.0","id":7,"result":{"number":"0x1"}})"_json);
+    }
+
+    SECTION("errors are not cached") {
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":3,"method":"eth_getBlockByNumber","params":[]})"_json, reply);
+        CHECK(nlohmann::json::parse(reply).contains("error"));
+        CHECK(response_cache.size() == 0);
+    }
+
+    SECTION("null results are not cached") {
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":4,"method":"eth_getBlockByNumber","params":["0x64",false]})"_json, reply);
+        CHECK(nlohmann::json::parse(reply)["result"].is_null());
+        CHECK(response_cache.size() == 0);
+    }
+
+    SECTION("moving block tags are not cached") {
+        std::string reply;
+        run<&test_util::RequestHandler_ForTest::request_and_create_reply>(
+            R"({"jsonrpc":"2.0","id":5,"method":"eth_getBlockByNumber","params":["latest",false]})"_json, reply);
+        CHECK(nlohmann::json::parse(reply).contains("result"));
+        CHECK(response_cache.size() == 0);
+    }
+}
+
 #endif
 
 }  // namespace silkworm::rpc::json_rpc
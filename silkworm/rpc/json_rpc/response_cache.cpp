@@ -0,0 +1,132 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "response_cache.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <utility>
+
+#include <silkworm/rpc/core/blocks.hpp>
+#include <silkworm/rpc/json/glaze.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+//! Key of the result member in serialized replies: any such sequence within a string value would be escaped
+static constexpr std::string_view kResultMember{"\"result\":"};
+
+//! Normalize the hex strings in \p value to lowercase
+//! \return false if \p value refers to a block tag whose meaning changes over time, true otherwise
+static bool canonicalize(nlohmann::json& value) {
+    if (value.is_string()) {
+        auto& text = value.get_ref<std::string&>();
+        if (text == core::kLatestBlockId || text == core::kPendingBlockId || text == core::kSafeBlockId ||
+            text == core::kFinalizedBlockId || text == core::kLatestExecutedBlockId) {
+            return false;
+        }
+        if (text.starts_with("0x") || text.starts_with("0X")) {
+            std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+        }
+        return true;
+    }
+    if (value.is_structured()) {
+        return std::all_of(value.begin(), value.end(), [](auto& item) { return canonicalize(item); });
+    }
+    return true;
+}
+
+ResponseCache::ResponseCache(std::size_t max_bytes) : results_{std::make_shared<Results>(max_bytes)} {}
+
+std::optional<std::string> ResponseCache::make_key(const std::string& method, const nlohmann::json& params) {
+    nlohmann::json canonical_params{params};
+    if (!canonicalize(canonical_params)) {
+        return std::nullopt;
+    }
+    // Object members are dumped in sorted order, so the same parameters always produce the same key
+    std::string key{method};
+    key.push_back('\0');
+    key.append(canonical_params.dump());
+    return key;
+}
+
+ResponseCache::ResultPtr ResponseCache::get(const std::string& key) {
+    return results_->get_as_copy(key).value_or(nullptr);
+}
+
+bool ResponseCache::put(const std::string& key, uint64_t epoch, std::string_view reply) {
+    const auto result = extract_result(reply);
+    if (!result || epoch != this->epoch()) {
+        return false;
+    }
+    const std::size_t byte_size = key.size() + result->size();
+    // The compressed form is built only when first needed, so its size is charged to the cache just then (if the
+    // result is still cached, i.e. neither evicted nor replaced)
+    auto on_compressed = [results = std::weak_ptr<Results>{results_}, key, byte_size](const SharedContent& content) {
+        if (const auto cached_results = results.lock()) {
+            cached_results->resize(key, content.shared_from_this(), byte_size + content.compressed()->deflated.size());
+        }
+    };
+    if (!results_->put(key, std::make_shared<const SharedContent>(std::string{*result}, std::move(on_compressed)), byte_size)) {
+        return false;
+    }
+    // An unwind may have happened while inserting: the clear either ran after our insertion or bumped the epoch before
+    if (epoch != this->epoch()) {
+        results_->remove(key);
+        return false;
+    }
+    return true;
+}
+
+void ResponseCache::clear() {
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+    results_->clear();
+}
+
+std::string ResponseCache::make_reply(const nlohmann::json& request_json, std::string_view result) {
+    std::string reply{make_reply_prefix(request_json)};
+    reply.reserve(reply.size() + result.size() + 1);
+    reply.append(result);
+    reply.push_back('}');
+    return reply;
+}
+
+std::string ResponseCache::make_reply_prefix(const nlohmann::json& request_json) {
+    const std::string id = request_json.contains("id") ? request_json["id"].dump() : "null";
+    std::string prefix;
+    prefix.reserve(id.size() + 40);
+    prefix.append(R"({"jsonrpc":")").append(kJsonVersion).append(R"(","id":)").append(id);
+    prefix.push_back(',');
+    prefix.append(kResultMember);
+    return prefix;
+}
+
+std::optional<std::string_view> ResponseCache::extract_result(std::string_view reply) {
+    // Both nlohmann and glaze serialize the top-level result member after the jsonrpc and id ones
+    const auto result_position = reply.find(kResultMember);
+    const auto end_position = reply.rfind('}');
+    if (result_position == std::string_view::npos || end_position == std::string_view::npos || end_position < result_position) {
+        return std::nullopt;
+    }
+    const auto result_start = result_position + kResultMember.size();
+    const auto result = reply.substr(result_start, end_position - result_start);
+    if (result.empty() || result == "null") {
+        return std::nullopt;
+    }
+    return result;
+}
+
+}  // namespace silkworm::rpc::json_rpc
@@ -0,0 +1,86 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include <silkworm/core/common/sharded_cache.hpp>
+#include <silkworm/rpc/common/compression.hpp>
+#include <silkworm/rpc/common/constants.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+//! \brief Cache of the serialized results of the deterministic JSON RPC methods, shared by all the execution contexts.
+//! \details Entries are keyed by method name and canonicalized parameters and hold the JSON bytes of the result only,
+//! so that each cached reply is rebuilt around the id of the incoming request. Requests referring to moving block tags
+//! (e.g. "latest") are never cached, null results and errors are never cached and all the entries are dropped when any
+//! block is unwound. Each result keeps its compressed form once computed, so that it can be reused by the compressed
+//! replies (accounted in the cache size once computed). Thread-safe.
+class ResponseCache {
+  public:
+    using ResultPtr = SharedContentPtr;
+
+    explicit ResponseCache(std::size_t max_bytes = kDefaultResponseCacheSize);
+
+    ResponseCache(const ResponseCache&) = delete;
+    ResponseCache& operator=(const ResponseCache&) = delete;
+
+    //! \return the cache key of \p method called with \p params or std::nullopt if the result may change over time
+    static std::optional<std::string> make_key(const std::string& method, const nlohmann::json& params);
+
+    //! \return the JSON result cached for \p key or nullptr if not available
+    ResultPtr get(const std::string& key);
+
+    //! \return the current invalidation epoch, to be captured before computing the reply passed to \ref put
+    [[nodiscard]] uint64_t epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+    //! Cache the result contained in \p reply for \p key unless it has been invalidated after \p epoch
+    //! \return true if the result has been cached, false otherwise
+    bool put(const std::string& key, uint64_t epoch, std::string_view reply);
+
+    //! Drop all the cached results, e.g. after some blocks have been unwound
+    void clear();
+
+    //! \return the reply to \p request_json containing the cached \p result
+    static std::string make_reply(const nlohmann::json& request_json, std::string_view result);
+
+    //! \return the beginning of the reply to \p request_json up to the result, which must be followed by the closing brace
+    static std::string make_reply_prefix(const nlohmann::json& request_json);
+
+    //! \return the bytes of the non-null result contained in \p reply or std::nullopt if \p reply is not a success
+    static std::optional<std::string_view> extract_result(std::string_view reply);
+
+    [[nodiscard]] std::size_t size() const { return results_->size(); }
+    [[nodiscard]] std::size_t byte_size() const { return results_->byte_size(); }
+
+  private:
+    using Results = ShardedCache<std::string, ResultPtr>;
+
+    //! Shared with the cached results, which charge the size of their compressed form once computed
+    std::shared_ptr<Results> results_;
+    std::atomic_uint64_t epoch_{0};
+};
+
+}  // namespace silkworm::rpc::json_rpc
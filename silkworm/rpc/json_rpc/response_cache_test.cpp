@@ -0,0 +1,124 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "response_cache.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+TEST_CASE("ResponseCache::make_key", "[rpc][json_rpc][response_cache]") {
+    SECTION("hex strings are canonicalized") {
+        const auto key1 = ResponseCache::make_key("eth_getCode", R"(["0xAbCd", "0x1A"])"_json);
+        const auto key2 = ResponseCache::make_key("eth_getCode", R"(["0xabcd", "0x1a"])"_json);
+        REQUIRE(key1);
+        CHECK(key1 == key2);
+        CHECK(key1 != ResponseCache::make_key("eth_getBalance", R"(["0xabcd", "0x1a"])"_json));
+    }
+    SECTION("object members are canonicalized") {
+        const auto key1 = ResponseCache::make_key("eth_getCode", R"(["0xabcd", {"blockHash": "0x01", "requireCanonical": true}])"_json);
+        const auto key2 = ResponseCache::make_key("eth_getCode", R"(["0xabcd", {"requireCanonical": true, "blockHash": "0x01"}])"_json);
+        REQUIRE(key1);
+        CHECK(key1 == key2);
+    }
+    SECTION("moving block tags are not cacheable") {
+        CHECK(ResponseCache::make_key("eth_getBlockByNumber", R"(["earliest", false])"_json));
+        CHECK(!ResponseCache::make_key("eth_getBlockByNumber", R"(["latest", false])"_json));
+        CHECK(!ResponseCache::make_key("eth_getBlockByNumber", R"(["pending", false])"_json));
+        CHECK(!ResponseCache::make_key("eth_getBlockByNumber", R"(["safe", false])"_json));
+        CHECK(!ResponseCache::make_key("eth_getBlockByNumber", R"(["finalized", false])"_json));
+        CHECK(!ResponseCache::make_key("eth_getCode", R"(["0xabcd", {"blockNumber": "latest"}])"_json));
+    }
+}
+
+TEST_CASE("ResponseCache::extract_result", "[rpc][json_rpc][response_cache]") {
+    CHECK(ResponseCache::extract_result(R"({"jsonrpc":"2.0","id":1,"result":{"a":"b"}})") == R"({"a":"b"})");
+    CHECK(ResponseCache::extract_result(R"({"id":"x","jsonrpc":"2.0","result":[{"result":1}]})") == R"([{"result":1}])");
+    CHECK(ResponseCache::extract_result(R"({"id":"\"result\":","jsonrpc":"2.0","result":"0x"})") == R"("0x")");
+    CHECK(!ResponseCache::extract_result(R"({"jsonrpc":"2.0","id":1,"result":null})"));
+    CHECK(!ResponseCache::extract_result(R"({"error":{"code":-32000,"message":"failure"},"id":1,"jsonrpc":"2.0"})"));
+    CHECK(!ResponseCache::extract_result(""));
+}
+
+TEST_CASE("ResponseCache::make_reply", "[rpc][json_rpc][response_cache]") {
+    CHECK(ResponseCache::make_reply(R"({"jsonrpc":"2.0","id":7,"method":"eth_getCode"})"_json, R"("0x00")") ==
+          R"({"jsonrpc":"2.0","id":7,"result":"0x00"})");
+    CHECK(ResponseCache::make_reply(R"({"jsonrpc":"2.0","id":"abc","method":"eth_getCode"})"_json, "[]") ==
+          R"({"jsonrpc":"2.0","id":"abc","result":[]})");
+    CHECK(ResponseCache::make_reply(R"({"jsonrpc":"2.0","method":"eth_getCode"})"_json, "1") ==
+          R"({"jsonrpc":"2.0","id":null,"result":1})");
+}
+
+TEST_CASE("ResponseCache::make_reply_prefix", "[rpc][json_rpc][response_cache]") {
+    const auto request_json = R"({"jsonrpc":"2.0","id":7,"method":"eth_getCode"})"_json;
+    CHECK(ResponseCache::make_reply_prefix(request_json) == R"({"jsonrpc":"2.0","id":7,"result":)");
+    CHECK(ResponseCache::make_reply_prefix(request_json) + R"("0x00")" + "}" == ResponseCache::make_reply(request_json, R"("0x00")"));
+}
+
+TEST_CASE("ResponseCache put and get", "[rpc][json_rpc][response_cache]") {
+    ResponseCache cache{1024 * 1024};
+    const std::string key{"eth_getCode"};
+    CHECK(!cache.get(key));
+
+    SECTION("successful reply") {
+        CHECK(cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+        REQUIRE(cache.get(key));
+        CHECK(cache.get(key)->data() == R"("0x6000")");
+        CHECK(cache.size() == 1);
+    }
+    SECTION("compressed result is charged to the cache size") {
+        CHECK(cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+        const auto byte_size = cache.byte_size();
+        CHECK(byte_size == key.size() + std::string_view{R"("0x6000")"}.size());
+        const auto compressed = cache.get(key)->compressed();
+        REQUIRE(compressed);
+        CHECK(cache.byte_size() == byte_size + compressed->deflated.size());
+        // The compressed form is charged just once
+        CHECK(cache.get(key)->compressed() == compressed);
+        CHECK(cache.byte_size() == byte_size + compressed->deflated.size());
+        CHECK(cache.size() == 1);
+    }
+    SECTION("compressed result no longer cached is not charged") {
+        CHECK(cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+        const auto content = cache.get(key);
+        cache.clear();
+        REQUIRE(content->compressed());
+        CHECK(cache.byte_size() == 0);
+        CHECK(!cache.get(key));
+    }
+    SECTION("null and error replies are not cached") {
+        CHECK(!cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":null})"));
+        CHECK(!cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"error":{"code":1,"message":"x"}})"));
+        CHECK(!cache.get(key));
+    }
+    SECTION("clear invalidates cached and in-flight replies") {
+        const auto epoch = cache.epoch();
+        CHECK(cache.put(key, epoch, R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+        cache.clear();
+        CHECK(!cache.get(key));
+        CHECK(cache.size() == 0);
+        CHECK(!cache.put(key, epoch, R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+        CHECK(!cache.get(key));
+        CHECK(cache.put(key, cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":"0x6000"})"));
+    }
+    SECTION("results exceeding the byte budget are not cached") {
+        ResponseCache small_cache{16};
+        CHECK(!small_cache.put(key, small_cache.epoch(), R"({"jsonrpc":"2.0","id":1,"result":"0x600060006000600060006000"})"));
+        CHECK(!small_cache.get(key));
+    }
+}
+
+}  // namespace silkworm::rpc::json_rpc
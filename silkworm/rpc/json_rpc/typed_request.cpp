@@ -0,0 +1,593 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "typed_request.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <limits>
+
+#include <intx/intx.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/types/address.hpp>
+#include <silkworm/core/types/evmc_bytes32.hpp>
+#include <silkworm/rpc/json_rpc/methods.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+static constexpr std::array<std::string_view, 5> kBlockTags{"earliest", "finalized", "safe", "latest", "pending"};
+
+//! Check the "0x" prefix: the uppercase variant accepted by the spec is left to the generic path
+static bool has_hex_prefix(std::string_view value) {
+    return value.size() >= 2 && value[0] == '0' && value[1] == 'x';
+}
+
+static bool is_hex_digits(std::string_view digits) {
+    return std::all_of(digits.cbegin(), digits.cend(), [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+//! Check the hex data pattern "^0x[0-9a-f]*$" (case-insensitive) optionally with exactly \p num_digits digits
+static bool is_hex_data(std::string_view value, std::optional<std::size_t> num_digits = std::nullopt) {
+    if (!has_hex_prefix(value)) {
+        return false;
+    }
+    const auto digits = value.substr(2);
+    return (!num_digits || digits.size() == *num_digits) && is_hex_digits(digits);
+}
+
+//! Check the quantity pattern "^0x([1-9a-f]+[0-9a-f]*|0)$" (case-insensitive) with at most \p max_digits digits
+static bool is_quantity(std::string_view value, std::size_t max_digits) {
+    if (!has_hex_prefix(value)) {
+        return false;
+    }
+    const auto digits = value.substr(2);
+    if (digits.empty() || digits.size() > max_digits || (digits.size() > 1 && digits[0] == '0')) {
+        return false;
+    }
+    return is_hex_digits(digits);
+}
+
+static bool is_block_tag(std::string_view value) {
+    return std::find(kBlockTags.cbegin(), kBlockTags.cend(), value) != kBlockTags.cend();
+}
+
+//! Check the "Block number or tag" schema
+static bool is_block_number_or_tag(std::string_view value) {
+    return is_quantity(value, 2 * sizeof(uint64_t)) || is_block_tag(value);
+}
+
+//! Check the "Block number, tag, or block hash" schema
+static bool is_block_number_tag_or_hash(std::string_view value) {
+    return is_block_number_or_tag(value) || is_hex_data(value, 2 * kHashLength);
+}
+
+//! Parse a 64-bit quantity exactly as std::stol(value, nullptr, 16) would do for values not exceeding its range
+static std::optional<uint64_t> parse_quantity(std::string_view value) {
+    if (!is_quantity(value, 2 * sizeof(uint64_t))) {
+        return std::nullopt;
+    }
+    uint64_t quantity{0};
+    for (const char c : value.substr(2)) {
+        const auto digit = static_cast<uint64_t>(std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(static_cast<unsigned char>(c)) - 'a' + 10);
+        quantity = (quantity << 4) | digit;
+    }
+    if (quantity > static_cast<uint64_t>(std::numeric_limits<long>::max())) {
+        return std::nullopt;
+    }
+    return quantity;
+}
+
+static std::optional<evmc::address> parse_address(std::string_view value) {
+    if (!is_hex_data(value, 2 * kAddressLength)) {
+        return std::nullopt;
+    }
+    return hex_to_address(value, /*return_zero_on_err=*/true);
+}
+
+static std::optional<evmc::bytes32> parse_hash(std::string_view value) {
+    if (!is_hex_data(value, 2 * kHashLength)) {
+        return std::nullopt;
+    }
+    return to_bytes32(from_hex(value).value_or(Bytes{}));
+}
+
+static std::optional<intx::uint256> parse_uint256(std::string_view value) {
+    if (!is_quantity(value, 2 * sizeof(intx::uint256))) {
+        return std::nullopt;
+    }
+    return intx::from_string<intx::uint256>(std::string{value});
+}
+
+//! SAX handler filling the typed request, which stops the parsing as soon as the request cannot be handled by typed parsing
+class TypedRequestParser {
+  public:
+    using number_integer_t = nlohmann::json::number_integer_t;
+    using number_unsigned_t = nlohmann::json::number_unsigned_t;
+    using number_float_t = nlohmann::json::number_float_t;
+    using string_t = nlohmann::json::string_t;
+    using binary_t = nlohmann::json::binary_t;
+
+    bool null() {
+        switch (scope()) {
+            case Scope::kCall:
+                // Contract creation: no recipient
+                return field_ == Field::kTo;
+            case Scope::kFilter:
+                // Any topic: no topics
+                return field_ == Field::kTopics;
+            case Scope::kFilterTopics:
+                // Any topic in this position: empty sub-topics
+                std::get<EthGetLogsParams>(params_).filter.topics.emplace_back();
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool boolean(bool value) {
+        if (scope() != Scope::kParams || method_ != Method::kEthGetBlockByNumber || param_index_ != 1) {
+            return false;
+        }
+        std::get<EthGetBlockByNumberParams>(params_).full_tx = value;
+        ++param_index_;
+        return true;
+    }
+
+    bool number_integer(number_integer_t value) {
+        return set_id(value);
+    }
+
+    bool number_unsigned(number_unsigned_t value) {
+        return set_id(value);
+    }
+
+    bool number_float(number_float_t /*value*/, const string_t& /*s*/) {
+        return false;
+    }
+
+    bool string(string_t& value) {
+        switch (scope()) {
+            case Scope::kRequest:
+                return request_string(value);
+            case Scope::kParams:
+                return param_string(value);
+            case Scope::kCall:
+                return call_string(value);
+            case Scope::kFilter:
+                return filter_string(value);
+            case Scope::kFilterAddresses: {
+                const auto address = parse_address(value);
+                if (!address) {
+                    return false;
+                }
+                std::get<EthGetLogsParams>(params_).filter.addresses.push_back(*address);
+                return true;
+            }
+            case Scope::kFilterTopics: {
+                const auto topic = parse_hash(value);
+                if (!topic) {
+                    return false;
+                }
+                std::get<EthGetLogsParams>(params_).filter.topics.push_back(FilterSubTopics{*topic});
+                return true;
+            }
+            case Scope::kFilterSubTopics: {
+                const auto topic = parse_hash(value);
+                if (!topic) {
+                    return false;
+                }
+                std::get<EthGetLogsParams>(params_).filter.topics.back().push_back(*topic);
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool binary(binary_t& /*value*/) {
+        return false;
+    }
+
+    bool start_object(std::size_t /*elements*/) {
+        if (depth_ == 0) {
+            return push(Scope::kRequest);
+        }
+        if (scope() == Scope::kParams && param_index_ == 0) {
+            if (method_ == Method::kEthCall) {
+                fields_ = 0;
+                return push(Scope::kCall);
+            }
+            if (method_ == Method::kEthGetLogs) {
+                fields_ = 0;
+                return push(Scope::kFilter);
+            }
+        }
+        return false;
+    }
+
+    bool key(string_t& value) {
+        switch (scope()) {
+            case Scope::kRequest:
+                field_ = request_field(value);
+                if (field_ == Field::kParams && method_ == Method::kNone) {
+                    // The method must come first for the parameters to be parsed into the proper types
+                    return false;
+                }
+                return check_duplicate(request_fields_);
+            case Scope::kCall:
+                field_ = call_field(value);
+                return check_duplicate(fields_);
+            case Scope::kFilter:
+                field_ = filter_field(value);
+                return check_duplicate(fields_);
+            default:
+                return false;
+        }
+    }
+
+    bool end_object() {
+        const auto closed_scope = pop();
+        if (closed_scope == Scope::kRequest) {
+            completed_ = true;
+        } else if (closed_scope == Scope::kCall || closed_scope == Scope::kFilter) {
+            ++param_index_;
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t /*elements*/) {
+        switch (scope()) {
+            case Scope::kRequest:
+                return field_ == Field::kParams && push(Scope::kParams);
+            case Scope::kFilter:
+                if (field_ == Field::kAddress) {
+                    return push(Scope::kFilterAddresses);
+                }
+                return field_ == Field::kTopics && push(Scope::kFilterTopics);
+            case Scope::kFilterTopics:
+                std::get<EthGetLogsParams>(params_).filter.topics.emplace_back();
+                return push(Scope::kFilterSubTopics);
+            default:
+                return false;
+        }
+    }
+
+    bool end_array() {
+        if (pop() == Scope::kParams) {
+            num_params_ = param_index_;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/, const nlohmann::detail::exception& /*ex*/) {
+        return false;
+    }
+
+    std::optional<TypedRequest> release() {
+        const uint32_t required_fields{field_bit(Field::kJsonRpc) | field_bit(Field::kId) | field_bit(Field::kMethod)};
+        if (!completed_ || (request_fields_ & required_fields) != required_fields || !num_params_ || *num_params_ != expected_num_params()) {
+            return std::nullopt;
+        }
+        // The initializer-list constructor of nlohmann::json is much slower than emplacing into an empty object
+        nlohmann::json envelope(nlohmann::json::value_t::object);
+        envelope.emplace("id", std::move(id_));
+        return TypedRequest{
+            .envelope = std::move(envelope),
+            .method = std::move(method_name_),
+            .params = std::move(params_),
+        };
+    }
+
+  private:
+    static constexpr std::size_t kMaxDepth{5};
+
+    enum class Scope {
+        kNone,
+        kRequest,
+        kParams,
+        kCall,
+        kFilter,
+        kFilterAddresses,
+        kFilterTopics,
+        kFilterSubTopics,
+    };
+
+    enum class Field {
+        kUnknown,
+        // request
+        kJsonRpc,
+        kId,
+        kMethod,
+        kParams,
+        // eth_call transaction
+        kFrom,
+        kTo,
+        kNonce,
+        kGas,
+        kGasPrice,
+        kMaxFeePerGas,
+        kMaxPriorityFeePerGas,
+        kValue,
+        kData,
+        kInput,
+        // eth_getLogs filter
+        kFromBlock,
+        kToBlock,
+        kAddress,
+        kTopics,
+    };
+
+    enum class Method {
+        kNone,
+        kEthCall,
+        kEthGetLogs,
+        kEthGetBlockByNumber,
+        kEthGetTransactionReceipt,
+        kEthGetBalance,
+    };
+
+    static constexpr uint32_t field_bit(Field field) { return uint32_t{1} << static_cast<uint32_t>(field); }
+
+    static Field request_field(std::string_view key) {
+        if (key == "jsonrpc") return Field::kJsonRpc;
+        if (key == "id") return Field::kId;
+        if (key == "method") return Field::kMethod;
+        if (key == "params") return Field::kParams;
+        return Field::kUnknown;
+    }
+
+    static Field call_field(std::string_view key) {
+        if (key == "from") return Field::kFrom;
+        if (key == "to") return Field::kTo;
+        if (key == "nonce") return Field::kNonce;
+        if (key == "gas") return Field::kGas;
+        if (key == "gasPrice") return Field::kGasPrice;
+        if (key == "maxFeePerGas") return Field::kMaxFeePerGas;
+        if (key == "maxPriorityFeePerGas") return Field::kMaxPriorityFeePerGas;
+        if (key == "value") return Field::kValue;
+        if (key == "data") return Field::kData;
+        if (key == "input") return Field::kInput;
+        return Field::kUnknown;
+    }
+
+    static Field filter_field(std::string_view key) {
+        if (key == "fromBlock") return Field::kFromBlock;
+        if (key == "toBlock") return Field::kToBlock;
+        if (key == "address") return Field::kAddress;
+        if (key == "topics") return Field::kTopics;
+        return Field::kUnknown;
+    }
+
+    Scope scope() const { return depth_ > 0 ? scopes_[depth_ - 1] : Scope::kNone; }
+
+    bool push(Scope scope) {
+        if (depth_ == kMaxDepth) {
+            return false;
+        }
+        scopes_[depth_++] = scope;
+        return true;
+    }
+
+    Scope pop() {
+        const auto closed_scope = scope();
+        --depth_;
+        return closed_scope;
+    }
+
+    //! Unknown fields are rejected by the spec and duplicate ones are left to the generic path
+    bool check_duplicate(uint32_t& fields) const {
+        if (field_ == Field::kUnknown || (fields & field_bit(field_)) != 0) {
+            return false;
+        }
+        fields |= field_bit(field_);
+        return true;
+    }
+
+    std::size_t expected_num_params() const {
+        switch (method_) {
+            case Method::kEthCall:
+            case Method::kEthGetBlockByNumber:
+            case Method::kEthGetBalance:
+                return 2;
+            default:
+                return 1;
+        }
+    }
+
+    template <typename Number>
+    bool set_id(Number value) {
+        if (scope() != Scope::kRequest || field_ != Field::kId) {
+            return false;
+        }
+        id_ = value;
+        return true;
+    }
+
+    bool request_string(const std::string& value) {
+        if (field_ == Field::kJsonRpc) {
+            // Just the type is checked by the validator, the version is not used anyway
+            return true;
+        }
+        if (field_ != Field::kMethod) {
+            return false;
+        }
+        if (value == method::k_eth_call) {
+            method_ = Method::kEthCall;
+            params_ = EthCallParams{};
+        } else if (value == method::k_eth_getLogs) {
+            method_ = Method::kEthGetLogs;
+            params_ = EthGetLogsParams{};
+        } else if (value == method::k_eth_getBlockByNumber) {
+            method_ = Method::kEthGetBlockByNumber;
+            params_ = EthGetBlockByNumberParams{};
+        } else if (value == method::k_eth_getTransactionReceipt) {
+            method_ = Method::kEthGetTransactionReceipt;
+            params_ = EthGetTransactionReceiptParams{};
+        } else if (value == method::k_eth_getBalance) {
+            method_ = Method::kEthGetBalance;
+            params_ = EthGetBalanceParams{};
+        } else {
+            return false;
+        }
+        method_name_ = value;
+        return true;
+    }
+
+    bool param_string(const std::string& value) {
+        bool valid{false};
+        switch (method_) {
+            case Method::kEthCall:
+                if (param_index_ == 1 && is_block_number_tag_or_hash(value)) {
+                    std::get<EthCallParams>(params_).block_id = value;
+                    valid = true;
+                }
+                break;
+            case Method::kEthGetBlockByNumber:
+                if (param_index_ == 0 && is_block_number_or_tag(value)) {
+                    std::get<EthGetBlockByNumberParams>(params_).block_id = value;
+                    valid = true;
+                }
+                break;
+            case Method::kEthGetTransactionReceipt:
+                if (param_index_ == 0) {
+                    if (const auto hash = parse_hash(value)) {
+                        std::get<EthGetTransactionReceiptParams>(params_).transaction_hash = *hash;
+                        valid = true;
+                    }
+                }
+                break;
+            case Method::kEthGetBalance:
+                if (param_index_ == 0) {
+                    if (const auto address = parse_address(value)) {
+                        std::get<EthGetBalanceParams>(params_).address = *address;
+                        valid = true;
+                    }
+                } else if (param_index_ == 1 && is_block_number_tag_or_hash(value)) {
+                    std::get<EthGetBalanceParams>(params_).block_id = value;
+                    valid = true;
+                }
+                break;
+            default:
+                break;
+        }
+        ++param_index_;
+        return valid;
+    }
+
+    bool call_string(const std::string& value) {
+        auto& call = std::get<EthCallParams>(params_).call;
+        switch (field_) {
+            case Field::kFrom:
+                call.from = parse_address(value);
+                return call.from.has_value();
+            case Field::kTo:
+                call.to = parse_address(value);
+                return call.to.has_value();
+            case Field::kNonce:
+                call.nonce = parse_quantity(value);
+                return call.nonce.has_value();
+            case Field::kGas:
+                call.gas = parse_quantity(value);
+                return call.gas.has_value();
+            case Field::kGasPrice:
+                call.gas_price = parse_uint256(value);
+                return call.gas_price.has_value();
+            case Field::kMaxFeePerGas:
+                call.max_fee_per_gas = parse_uint256(value);
+                return call.max_fee_per_gas.has_value();
+            case Field::kMaxPriorityFeePerGas:
+                call.max_priority_fee_per_gas = parse_uint256(value);
+                return call.max_priority_fee_per_gas.has_value();
+            case Field::kValue:
+                call.value = parse_uint256(value);
+                return call.value.has_value();
+            case Field::kData:
+                if (!is_hex_data(value)) {
+                    return false;
+                }
+                // backward compatibility: both `data` and `input` fields are accepted as input, the latter taking precedence
+                if (!has_input_) {
+                    call.data = from_hex(value);
+                }
+                return true;
+            case Field::kInput:
+                if (!is_hex_data(value)) {
+                    return false;
+                }
+                call.data = from_hex(value);
+                has_input_ = true;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool filter_string(const std::string& value) {
+        auto& filter = std::get<EthGetLogsParams>(params_).filter;
+        switch (field_) {
+            case Field::kFromBlock:
+                if (!is_quantity(value, 2 * sizeof(uint64_t))) {
+                    return false;
+                }
+                filter.from_block = value;
+                return true;
+            case Field::kToBlock:
+                if (!is_quantity(value, 2 * sizeof(uint64_t))) {
+                    return false;
+                }
+                filter.to_block = value;
+                return true;
+            case Field::kAddress: {
+                const auto address = parse_address(value);
+                if (!address) {
+                    return false;
+                }
+                filter.addresses = {*address};
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    std::array<Scope, kMaxDepth> scopes_{};
+    std::size_t depth_{0};
+    Field field_{Field::kUnknown};
+    uint32_t request_fields_{0};
+    uint32_t fields_{0};
+    bool completed_{false};
+
+    nlohmann::json id_;
+    Method method_{Method::kNone};
+    std::string method_name_;
+    std::size_t param_index_{0};
+    std::optional<std::size_t> num_params_;
+    TypedParams params_;
+    bool has_input_{false};
+};
+
+std::optional<TypedRequest> parse_typed_request(std::string_view request) {
+    TypedRequestParser parser;
+    if (!nlohmann::json::sax_parse(request, &parser)) {
+        return std::nullopt;
+    }
+    return parser.release();
+}
+
+}  // namespace silkworm::rpc::json_rpc
@@ -0,0 +1,82 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <evmc/evmc.hpp>
+#include <nlohmann/json.hpp>
+
+#include <silkworm/rpc/types/call.hpp>
+#include <silkworm/rpc/types/filter.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+//! Typed parameters of eth_call
+struct EthCallParams {
+    Call call;
+    std::string block_id;
+};
+
+//! Typed parameters of eth_getLogs
+struct EthGetLogsParams {
+    Filter filter;
+};
+
+//! Typed parameters of eth_getBlockByNumber
+struct EthGetBlockByNumberParams {
+    std::string block_id;
+    bool full_tx{false};
+};
+
+//! Typed parameters of eth_getTransactionReceipt
+struct EthGetTransactionReceiptParams {
+    evmc::bytes32 transaction_hash;
+};
+
+//! Typed parameters of eth_getBalance
+struct EthGetBalanceParams {
+    evmc::address address;
+    std::string block_id;
+};
+
+using TypedParams = std::variant<EthCallParams,
+                                 EthGetLogsParams,
+                                 EthGetBlockByNumberParams,
+                                 EthGetTransactionReceiptParams,
+                                 EthGetBalanceParams>;
+
+//! JSON RPC request of one hot method parsed straight into its typed parameters
+struct TypedRequest {
+    //! The request stripped of everything but its id, used to build the reply
+    nlohmann::json envelope;
+    std::string method;
+    TypedParams params;
+};
+
+//! \brief Parse \p request into its typed parameters without building any DOM for them.
+//! \details Only single requests for the hot methods (eth_call, eth_getLogs, eth_getBlockByNumber,
+//! eth_getTransactionReceipt, eth_getBalance) are parsed. The parameters are checked against the same constraints
+//! enforced by the JSON RPC specification, but only the shapes commonly sent by clients are accepted: anything else
+//! (including invalid requests) must go through the generic path, which produces the appropriate error reply.
+//! \return the typed request or std::nullopt if \p request must be handled by the generic path
+std::optional<TypedRequest> parse_typed_request(std::string_view request);
+
+}  // namespace silkworm::rpc::json_rpc
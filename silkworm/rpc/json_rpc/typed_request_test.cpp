@@ -0,0 +1,172 @@
+/*
+   Copyright 2024 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "typed_request.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::rpc::json_rpc {
+
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
+TEST_CASE("parse_typed_request: eth_call", "[rpc][json_rpc][typed_request]") {
+    const auto request = parse_typed_request(R"({"jsonrpc":"2.0","id":7,"method":"eth_call","params":[{
+        "from":"0x52c9a4a4a1b3b3f0a6b8d9c7e1b2a3f4d5c6b7a8",
+        "to":"0x0715a7794a1dc8e42615f059dd6e406a6594651a",
+        "gas":"0x1f4",
+        "gasPrice":"0x3B9ACA00",
+        "value":"0x0",
+        "nonce":"0x2",
+        "data":"0xa9059cbb"
+    },"latest"]})");
+    REQUIRE(request);
+    CHECK(request->envelope == R"({"id":7})"_json);
+    CHECK(request->method == "eth_call");
+    const auto* params = std::get_if<EthCallParams>(&request->params);
+    REQUIRE(params);
+    CHECK(params->call.from == 0x52c9a4a4a1b3b3f0a6b8d9c7e1b2a3f4d5c6b7a8_address);
+    CHECK(params->call.to == 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address);
+    CHECK(params->call.gas == 0x1f4);
+    CHECK(params->call.gas_price == intx::uint256{1'000'000'000});
+    CHECK(params->call.value == intx::uint256{0});
+    CHECK(params->call.nonce == 2);
+    CHECK(params->call.data == *from_hex("0xa9059cbb"));
+    CHECK(!params->call.max_fee_per_gas);
+    CHECK(!params->call.max_priority_fee_per_gas);
+    CHECK(params->block_id == "latest");
+}
+
+TEST_CASE("parse_typed_request: eth_call input and contract creation", "[rpc][json_rpc][typed_request]") {
+    SECTION("input takes precedence over data") {
+        const auto request = parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"input":"0x01","data":"0x02"},"0x1"]})");
+        REQUIRE(request);
+        const auto* params = std::get_if<EthCallParams>(&request->params);
+        REQUIRE(params);
+        CHECK(params->call.data == *from_hex("0x01"));
+        CHECK(params->block_id == "0x1");
+    }
+    SECTION("null recipient") {
+        const auto request = parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"to":null},"latest"]})");
+        REQUIRE(request);
+        const auto* params = std::get_if<EthCallParams>(&request->params);
+        REQUIRE(params);
+        CHECK(!params->call.to);
+    }
+}
+
+TEST_CASE("parse_typed_request: eth_getLogs", "[rpc][json_rpc][typed_request]") {
+    const auto request = parse_typed_request(R"({"jsonrpc":"2.0","id":2,"method":"eth_getLogs","params":[{
+        "fromBlock":"0x10",
+        "toBlock":"0x20",
+        "address":["0x0715a7794a1dc8e42615f059dd6e406a6594651a"],
+        "topics":[
+            "0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef",
+            null,
+            ["0x0000000000000000000000000000000000000000000000000000000000000001"]
+        ]
+    }]})");
+    REQUIRE(request);
+    CHECK(request->method == "eth_getLogs");
+    const auto* params = std::get_if<EthGetLogsParams>(&request->params);
+    REQUIRE(params);
+    CHECK(params->filter.from_block == "0x10");
+    CHECK(params->filter.to_block == "0x20");
+    CHECK(params->filter.addresses == FilterAddresses{0x0715a7794a1dc8e42615f059dd6e406a6594651a_address});
+    CHECK(params->filter.topics == FilterTopics{
+                                       {0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32},
+                                       {},
+                                       {0x0000000000000000000000000000000000000000000000000000000000000001_bytes32},
+                                   });
+    CHECK(!params->filter.block_hash);
+}
+
+TEST_CASE("parse_typed_request: eth_getBlockByNumber", "[rpc][json_rpc][typed_request]") {
+    const auto request = parse_typed_request(R"({"jsonrpc":"2.0","id":3,"method":"eth_getBlockByNumber","params":["0x1b4",true]})");
+    REQUIRE(request);
+    const auto* params = std::get_if<EthGetBlockByNumberParams>(&request->params);
+    REQUIRE(params);
+    CHECK(params->block_id == "0x1b4");
+    CHECK(params->full_tx);
+}
+
+TEST_CASE("parse_typed_request: eth_getTransactionReceipt", "[rpc][json_rpc][typed_request]") {
+    const auto request = parse_typed_request(
+        R"({"method":"eth_getTransactionReceipt","params":["0xb2fea9c4b24775af6990237aa90228e5e092c56bdaee74496992a53c208da1ee"],"id":4,"jsonrpc":"2.0"})");
+    REQUIRE(request);
+    const auto* params = std::get_if<EthGetTransactionReceiptParams>(&request->params);
+    REQUIRE(params);
+    CHECK(params->transaction_hash == 0xb2fea9c4b24775af6990237aa90228e5e092c56bdaee74496992a53c208da1ee_bytes32);
+}
+
+TEST_CASE("parse_typed_request: eth_getBalance", "[rpc][json_rpc][typed_request]") {
+    const auto request = parse_typed_request(
+        R"({"jsonrpc":"2.0","id":5,"method":"eth_getBalance","params":["0x0715A7794A1DC8E42615F059DD6E406A6594651A","pending"]})");
+    REQUIRE(request);
+    const auto* params = std::get_if<EthGetBalanceParams>(&request->params);
+    REQUIRE(params);
+    CHECK(params->address == 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address);
+    CHECK(params->block_id == "pending");
+}
+
+TEST_CASE("parse_typed_request: generic path", "[rpc][json_rpc][typed_request]") {
+    SECTION("other methods") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_blockNumber","params":[]})"));
+    }
+    SECTION("batch requests") {
+        CHECK(!parse_typed_request(R"([{"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",true]}])"));
+    }
+    SECTION("invalid JSON") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",true]})"
+                                   " x"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",true])"));
+    }
+    SECTION("missing or invalid request fields") {
+        CHECK(!parse_typed_request(R"({"id":1,"method":"eth_getBlockByNumber","params":["0x1",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","method":"eth_getBlockByNumber","params":["0x1",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":"1","method":"eth_getBlockByNumber","params":["0x1",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber"})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1",true],"foo":1})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"id":2,"method":"eth_getBlockByNumber","params":["0x1",true]})"));
+    }
+    SECTION("parameters before method") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"params":["0x1",true],"method":"eth_getBlockByNumber"})"));
+    }
+    SECTION("wrong number of parameters") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{},"latest",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[]})"));
+    }
+    SECTION("invalid parameters") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x01",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["Latest",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0x1","true"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBalance","params":["0x0715a7794a1dc8e42615f059dd6e406a6594651","latest"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getTransactionReceipt","params":["0x01"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"gas":1},"latest"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"data":"0xzz"},"latest"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"blockHash":"0x01"}]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getLogs","params":[{"fromBlock":"latest"}]})"));
+    }
+    SECTION("shapes left to the generic path") {
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_getBlockByNumber","params":["0X1",true]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"accessList":[]},"latest"]})"));
+        CHECK(!parse_typed_request(R"({"jsonrpc":"2.0","id":1,"method":"eth_call","params":[{"gas":"0xffffffffffffffff"},"latest"]})"));
+    }
+}
+
+}  // namespace silkworm::rpc::json_rpc
@@ -16,6 +16,10 @@
 
 #include "validator.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <limits>
 #include <string>
 
 #include <boost/regex.hpp>
@@ -31,11 +35,174 @@ static const std::string kRequestFieldParameters{"params"};
 static const std::string kRequestRequiredFields{
     kRequestFieldJsonRpc + "," + kRequestFieldId + "," + kRequestFieldMethod + "," + kRequestFieldParameters};
 
+static constexpr std::string_view kHexPrefixPattern{"^0x"};
+static constexpr std::string_view kQuantityPattern{"^0x([1-9a-f]+[0-9a-f]*|0)$"};
+static constexpr std::string_view kHexDigitsLowerPattern{"[0-9a-f]"};
+static constexpr std::string_view kHexDigitsMixedPattern{"[0-9a-fA-F]"};
+
+static bool is_hex_digit(char c) {
+    return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+static bool has_hex_prefix(std::string_view value) {
+    return value.size() >= 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X');
+}
+
+//! Parse the "{N}" or "{M,N}" repetition count of one pattern, returning the [min, max] range
+static std::optional<std::pair<std::size_t, std::size_t>> parse_repetition(std::string_view repetition) {
+    if (repetition.size() < 3 || repetition.front() != '{' || repetition.back() != '}') {
+        return std::nullopt;
+    }
+    repetition = repetition.substr(1, repetition.size() - 2);
+    const auto parse_count = [](std::string_view count) -> std::optional<std::size_t> {
+        if (count.empty() || !std::all_of(count.cbegin(), count.cend(), [](char c) { return std::isdigit(c) != 0; })) {
+            return std::nullopt;
+        }
+        return std::stoul(std::string{count});
+    };
+    const auto comma_position = repetition.find(',');
+    const auto min = parse_count(repetition.substr(0, comma_position));
+    const auto max = comma_position == std::string_view::npos ? min : parse_count(repetition.substr(comma_position + 1));
+    if (!min || !max || *min > *max) {
+        return std::nullopt;
+    }
+    return std::make_pair(*min, *max);
+}
+
+Validator::StringPattern Validator::StringPattern::compile(const std::string& pattern) {
+    StringPattern compiled;
+    const std::string_view pattern_view{pattern};
+    if (pattern_view == kQuantityPattern) {
+        compiled.kind_ = Kind::kQuantity;
+        return compiled;
+    }
+    if (pattern_view.starts_with(kHexPrefixPattern) && pattern_view.ends_with('$')) {
+        // Strip the leading ^ and the trailing $ anchors
+        const auto body = pattern_view.substr(1, pattern_view.size() - 2);
+        auto digits = body.substr(2);
+        if (digits.starts_with(kHexDigitsLowerPattern) || digits.starts_with(kHexDigitsMixedPattern)) {
+            const auto repetition = digits.substr(digits.find(']') + 1);
+            if (repetition == "*") {
+                compiled.kind_ = Kind::kHexData;
+                compiled.max_digits_ = std::numeric_limits<std::size_t>::max();
+                return compiled;
+            }
+            if (const auto range = parse_repetition(repetition)) {
+                compiled.kind_ = Kind::kHexData;
+                compiled.min_digits_ = range->first;
+                compiled.max_digits_ = range->second;
+                return compiled;
+            }
+        } else if (std::all_of(digits.cbegin(), digits.cend(), is_hex_digit)) {
+            compiled.kind_ = Kind::kLiteral;
+            compiled.literal_.reserve(body.size());
+            std::transform(body.cbegin(), body.cend(), std::back_inserter(compiled.literal_), [](char c) {
+                return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            });
+            return compiled;
+        }
+    }
+    compiled.regex_ = boost::regex(pattern, boost::regex::optimize | boost::regex::icase);
+    return compiled;
+}
+
+bool Validator::StringPattern::match(std::string_view value) const {
+    switch (kind_) {
+        case Kind::kHexData: {
+            if (!has_hex_prefix(value)) {
+                return false;
+            }
+            const auto digits = value.substr(2);
+            return digits.size() >= min_digits_ && digits.size() <= max_digits_ &&
+                   std::all_of(digits.cbegin(), digits.cend(), is_hex_digit);
+        }
+        case Kind::kQuantity: {
+            if (!has_hex_prefix(value) || value.size() == 2) {
+                return false;
+            }
+            const auto digits = value.substr(2);
+            if (digits.size() > 1 && digits[0] == '0') {
+                return false;
+            }
+            return std::all_of(digits.cbegin(), digits.cend(), is_hex_digit);
+        }
+        case Kind::kLiteral:
+            return std::equal(value.cbegin(), value.cend(), literal_.cbegin(), literal_.cend(), [](char c, char l) {
+                return std::tolower(static_cast<unsigned char>(c)) == l;
+            });
+        case Kind::kRegex:
+            return boost::regex_match(value.cbegin(), value.cend(), regex_);
+    }
+    return false;
+}
+
+Validator::Schema Validator::Schema::compile(const nlohmann::json& schema) {
+    Schema compiled;
+    if (const auto type_field = schema.find("type"); type_field != schema.end()) {
+        compiled.type_name = type_field->get<std::string>();
+        if (compiled.type_name == "string") {
+            compiled.type = Type::kString;
+        } else if (compiled.type_name == "array") {
+            compiled.type = Type::kArray;
+        } else if (compiled.type_name == "object") {
+            compiled.type = Type::kObject;
+        } else if (compiled.type_name == "boolean") {
+            compiled.type = Type::kBoolean;
+        } else if (compiled.type_name == "number") {
+            compiled.type = Type::kNumber;
+        } else if (compiled.type_name == "null") {
+            compiled.type = Type::kNull;
+        } else {
+            compiled.type = Type::kUnknown;
+        }
+    }
+    if (const auto pattern_field = schema.find("pattern"); pattern_field != schema.end()) {
+        compiled.pattern = StringPattern::compile(pattern_field->get<std::string>());
+    }
+    if (const auto enum_field = schema.find("enum"); enum_field != schema.end()) {
+        compiled.enum_values.emplace(enum_field->cbegin(), enum_field->cend());
+    }
+    if (const auto required_field = schema.find("required"); required_field != schema.end() && required_field->is_array()) {
+        for (const auto& item : *required_field) {
+            compiled.required.push_back(item.get<std::string>());
+        }
+    }
+    if (const auto properties_field = schema.find("properties"); properties_field != schema.end()) {
+        compiled.properties.emplace();
+        for (const auto& property : properties_field->items()) {
+            compiled.properties->emplace_back(property.key(), compile(property.value()));
+        }
+    }
+    if (const auto items_field = schema.find("items"); items_field != schema.end()) {
+        compiled.items.push_back(compile(*items_field));
+    }
+    auto schema_of_collection = schema.find("anyOf");
+    if (schema_of_collection == schema.end()) {
+        schema_of_collection = schema.find("oneOf");
+    }
+    if (schema_of_collection != schema.end()) {
+        compiled.any_of.emplace();
+        for (const auto& schema_of : *schema_of_collection) {
+            compiled.any_of->push_back(compile(schema_of));
+        }
+    }
+    return compiled;
+}
+
 void Validator::load_specification() {
     const auto spec = nlohmann::json::parse(specification_json, nullptr, /*allow_exceptions=*/false);
     if (spec.contains("methods")) {
+        method_specs_.clear();
         for (const auto& method : spec["methods"]) {
-            method_specs_[method["name"].get<std::string>()] = method["params"];
+            std::vector<ParameterSpec> parameter_specs;
+            for (const auto& param : method["params"]) {
+                parameter_specs.push_back(ParameterSpec{
+                    .name = param["name"].get<std::string>(),
+                    .required = param.contains("required") && param["required"].get<bool>(),
+                    .schema = Schema::compile(param["schema"]),
+                });
+            }
+            method_specs_[method["name"].get<std::string>()] = std::move(parameter_specs);
         }
     }
     if (spec.contains("openrpc")) {
@@ -88,7 +255,7 @@ ValidationResult Validator::check_request_fields(const nlohmann::json& request)
 }
 
 ValidationResult Validator::validate_params(const nlohmann::json& request) {
-    const auto& method = request.find(kRequestFieldMethod).value().get<std::string>();
+    const auto& method = request.find(kRequestFieldMethod).value().get_ref<const std::string&>();
     const auto& params_field = request.find(kRequestFieldParameters);
     const auto& params = params_field != request.end() ? params_field.value() : nlohmann::json::array();
 
@@ -108,18 +275,15 @@ ValidationResult Validator::validate_params(const nlohmann::json& request) {
 
     unsigned long idx = 0;
     for (const auto& spec : method_spec) {
-        const auto& spec_name = spec["name"].get<std::string>();
-        const auto& spec_schema = spec["schema"];
-
         if (params.size() <= idx) {
-            if (spec.contains("required") && spec["required"].get<bool>()) {
-                return tl::make_unexpected("Missing required parameter: " + spec_name);
+            if (spec.required) {
+                return tl::make_unexpected("Missing required parameter: " + spec.name);
             }
             break;
         }
 
-        if (auto result{validate_schema(params[idx], spec_schema)}; !result) {
-            return tl::make_unexpected(result.error() + " in spec: " + spec_name);
+        if (auto result{validate_schema(params[idx], spec.schema)}; !result) {
+            return tl::make_unexpected(result.error() + " in spec: " + spec.name);
         }
 
         ++idx;
@@ -128,21 +292,16 @@ ValidationResult Validator::validate_params(const nlohmann::json& request) {
     return {};
 }
 
-ValidationResult Validator::validate_schema(const nlohmann::json& value, const nlohmann::json& schema) {
-    if (schema.contains("type")) {
+ValidationResult Validator::validate_schema(const nlohmann::json& value, const Schema& schema) {
+    if (schema.type != Schema::Type::kNone) {
         if (auto result{validate_type(value, schema)}; !result) {
             return result;
         }
     }
 
-    auto schema_of_collection = schema.find("anyOf");
-    if (schema_of_collection == schema.end()) {
-        schema_of_collection = schema.find("oneOf");
-    }
-
     ValidationResult result;
-    if (schema_of_collection != schema.end()) {
-        for (const auto& schema_of : schema_of_collection.value()) {
+    if (schema.any_of) {
+        for (const auto& schema_of : *schema.any_of) {
             result = validate_type(value, schema_of);
             if (result) {
                 break;
@@ -152,59 +311,39 @@ ValidationResult Validator::validate_schema(const nlohmann::json& value, const n
     return result;
 }
 
-ValidationResult Validator::validate_type(const nlohmann::json& value, const nlohmann::json& schema) {
-    const auto& schema_type = schema["type"].get<std::string>();
-
-    if (schema_type == "string") {
-        return validate_string(value, schema);
-    } else if (schema_type == "array") {
-        return validate_array(value, schema);
-    } else if (schema_type == "object") {
-        return validate_object(value, schema);
-    } else if (schema_type == "boolean") {
-        return validate_boolean(value);
-    } else if (schema_type == "number") {
-        return validate_number(value);
-    } else if (schema_type == "null") {
-        return validate_null(value);
-    } else {
-        return tl::make_unexpected("Invalid schema type: " + schema_type);
+ValidationResult Validator::validate_type(const nlohmann::json& value, const Schema& schema) {
+    switch (schema.type) {
+        case Schema::Type::kString:
+            return validate_string(value, schema);
+        case Schema::Type::kArray:
+            return validate_array(value, schema);
+        case Schema::Type::kObject:
+            return validate_object(value, schema);
+        case Schema::Type::kBoolean:
+            return validate_boolean(value);
+        case Schema::Type::kNumber:
+            return validate_number(value);
+        case Schema::Type::kNull:
+            return validate_null(value);
+        default:
+            return tl::make_unexpected("Invalid schema type: " + schema.type_name);
     }
 }
 
-ValidationResult Validator::validate_string(const nlohmann::json& string, const nlohmann::json& schema) {
+ValidationResult Validator::validate_string(const nlohmann::json& string, const Schema& schema) {
     if (!string.is_string()) {
         return tl::make_unexpected("Invalid string: " + string.dump());
     }
 
-    const auto& schema_pattern_field = schema.find("pattern");
-    if (schema_pattern_field != schema.end()) {
-        boost::regex pattern;
-        const auto& schema_pattern = schema_pattern_field.value().get<std::string>();
-
-        const auto& pattern_field = patterns_.find(schema_pattern);
-        if (pattern_field != patterns_.end()) {
-            pattern = pattern_field->second;
-        } else {
-            pattern = boost::regex(schema_pattern, boost::regex::optimize | boost::regex::icase);
-            patterns_[schema_pattern] = pattern;
-        }
-
-        if (!boost::regex_match(string.get<std::string>(), pattern)) {
-            return tl::make_unexpected("Invalid string pattern: " + string.get<std::string>());
-        }
+    const auto& value = string.get_ref<const std::string&>();
+    if (schema.pattern && !schema.pattern->match(value)) {
+        return tl::make_unexpected("Invalid string pattern: " + value);
     }
 
-    const auto& enum_field = schema.find("enum");
-    if (enum_field != schema.end()) {
-        bool is_valid = false;
-        for (const auto& enum_value : enum_field.value()) {
-            if (string == enum_value) {
-                is_valid = true;
-                break;
-            }
-        }
-
+    if (schema.enum_values) {
+        const bool is_valid = std::any_of(schema.enum_values->cbegin(), schema.enum_values->cend(), [&](const auto& enum_value) {
+            return string == enum_value;
+        });
         if (!is_valid) {
             return tl::make_unexpected("Invalid string enum: " + string.dump());
         }
@@ -213,13 +352,16 @@ ValidationResult Validator::validate_string(const nlohmann::json& string, const
     return {};
 }
 
-ValidationResult Validator::validate_array(const nlohmann::json& array, const nlohmann::json& schema) {
+ValidationResult Validator::validate_array(const nlohmann::json& array, const Schema& schema) {
     if (!array.is_array() && !array.is_null() && array.empty()) {
         return tl::make_unexpected("Invalid array: " + array.dump());
     }
 
     ValidationResult result;
-    const auto& schema_items = schema["items"];
+    if (schema.items.empty()) {
+        return result;
+    }
+    const auto& schema_items = schema.items.front();
     for (const auto& item : array) {
         result = validate_schema(item, schema_items);
         if (!result) {
@@ -230,27 +372,31 @@ ValidationResult Validator::validate_array(const nlohmann::json& array, const nl
     return result;
 }
 
-ValidationResult Validator::validate_object(const nlohmann::json& object, const nlohmann::json& schema) {
+ValidationResult Validator::validate_object(const nlohmann::json& object, const Schema& schema) {
     if (!object.is_object()) {
         return tl::make_unexpected("Invalid object: " + object.dump());
     }
 
-    if (schema.contains("required")) {
-        for (const auto& item : schema["required"]) {
-            if (object.find(item) == object.end()) {
-                return tl::make_unexpected("Missing required field: " + item.get<std::string>());
-            }
+    for (const auto& item : schema.required) {
+        if (object.find(item) == object.end()) {
+            return tl::make_unexpected("Missing required field: " + item);
         }
     }
 
-    if (schema.contains("properties")) {
+    if (schema.properties) {
+        // backward compatibility: optional `data` field is hex data
+        static const Schema kDataSchema{Schema::compile(R"({"pattern": "^0x[0-9a-f]*$"})"_json)};
+
         for (const auto& item : object.items()) {
-            if (schema["properties"].contains(item.key())) {
-                if (auto valid_result{validate_schema(item.value(), schema["properties"][item.key()])}; !valid_result) {
+            const auto property = std::find_if(schema.properties->cbegin(), schema.properties->cend(), [&](const auto& p) {
+                return p.first == item.key();
+            });
+            if (property != schema.properties->cend()) {
+                if (auto valid_result{validate_schema(item.value(), property->second)}; !valid_result) {
                     return tl::make_unexpected(valid_result.error() + " for field: " + item.key());
                 }
-            } else if (item.key() == "data") {  // backward compatibility: optional `data` field is hex data
-                if (auto valid_result{validate_string(item.value(), R"({"pattern": "^0x[0-9a-f]*$"})"_json)}; !valid_result) {
+            } else if (item.key() == "data") {
+                if (auto valid_result{validate_string(item.value(), kDataSchema)}; !valid_result) {
                     return tl::make_unexpected(valid_result.error() + " for field: " + item.key());
                 }
             } else {
@@ -261,7 +407,6 @@ ValidationResult Validator::validate_object(const nlohmann::json& object, const
 
     return {};
 }
-
 ValidationResult Validator::validate_boolean(const nlohmann::json& boolean) {
     if (!boolean.is_boolean()) {
         return tl::make_unexpected("Invalid boolean: " + boolean.dump());
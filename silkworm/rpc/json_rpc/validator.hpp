@@ -16,8 +16,13 @@
 
 #pragma once
 
-#include <array>
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <boost/regex.hpp>
 #include <nlohmann/json.hpp>
@@ -27,6 +32,10 @@ namespace silkworm::rpc::json_rpc {
 
 using ValidationResult = tl::expected<void, std::string>;
 
+//! \brief Validator of JSON RPC requests against the OpenRPC specification.
+//! \details The specification is compiled once in load_specification into a tree of schema nodes per method, so that
+//! validating one request does not need any lookup into the specification DOM. The string patterns used in the spec for
+//! hex-encoded values are compiled into direct character checks, falling back to regular expressions otherwise.
 class Validator {
   public:
     static void load_specification();
@@ -35,20 +44,72 @@ class Validator {
     ValidationResult validate(const nlohmann::json& request);
 
   private:
+    //! String pattern compiled from the regular expression in the spec, matched case-insensitively
+    class StringPattern {
+      public:
+        static StringPattern compile(const std::string& pattern);
+
+        bool match(std::string_view value) const;
+
+      private:
+        enum class Kind {
+            kHexData,   // 0x followed by hex digits in [min_digits, max_digits]
+            kQuantity,  // 0x followed by hex digits w/o leading zeros
+            kLiteral,   // exactly the literal string
+            kRegex,     // any other regular expression
+        };
+
+        Kind kind_{Kind::kRegex};
+        std::size_t min_digits_{0};
+        std::size_t max_digits_{0};
+        std::string literal_;
+        boost::regex regex_;
+    };
+
+    //! Schema node compiled from the spec
+    struct Schema {
+        enum class Type {
+            kNone,
+            kString,
+            kArray,
+            kObject,
+            kBoolean,
+            kNumber,
+            kNull,
+            kUnknown,
+        };
+
+        static Schema compile(const nlohmann::json& schema);
+
+        Type type{Type::kNone};
+        std::string type_name;
+        std::optional<StringPattern> pattern;
+        std::optional<std::vector<nlohmann::json>> enum_values;
+        std::vector<std::string> required;
+        std::optional<std::vector<std::pair<std::string, Schema>>> properties;
+        std::vector<Schema> items;  // at most one element
+        std::optional<std::vector<Schema>> any_of;
+    };
+
+    struct ParameterSpec {
+        std::string name;
+        bool required{false};
+        Schema schema;
+    };
+
     ValidationResult check_request_fields(const nlohmann::json& request);
     ValidationResult validate_params(const nlohmann::json& request);
-    ValidationResult validate_schema(const nlohmann::json& value, const nlohmann::json& schema);
-    ValidationResult validate_type(const nlohmann::json& value, const nlohmann::json& schema);
-    ValidationResult validate_string(const nlohmann::json& string, const nlohmann::json& schema);
-    ValidationResult validate_array(const nlohmann::json& array, const nlohmann::json& schema);
-    ValidationResult validate_object(const nlohmann::json& object, const nlohmann::json& schema);
+    ValidationResult validate_schema(const nlohmann::json& value, const Schema& schema);
+    ValidationResult validate_type(const nlohmann::json& value, const Schema& schema);
+    ValidationResult validate_string(const nlohmann::json& string, const Schema& schema);
+    ValidationResult validate_array(const nlohmann::json& array, const Schema& schema);
+    ValidationResult validate_object(const nlohmann::json& object, const Schema& schema);
     ValidationResult validate_boolean(const nlohmann::json& boolean);
     ValidationResult validate_number(const nlohmann::json& number);
     ValidationResult validate_null(const nlohmann::json& value);
 
     inline static std::string openrpc_version_;
-    inline static std::map<std::string, nlohmann::json> method_specs_;
-    inline static std::map<std::string, boost::regex> patterns_;
+    inline static std::unordered_map<std::string, std::vector<ParameterSpec>> method_specs_;
     bool accept_unknown_methods_{true};
 };
 
@@ -23,7 +23,7 @@
 
 static silkworm::rpc::json_rpc::Validator validator{};
 
-const nlohmann::json requests[2] = {
+const nlohmann::json requests[3] = {
     {
         {"jsonrpc", "2.0"},
         {"method", "eth_getBlockByNumber"},
@@ -37,9 +37,20 @@ const nlohmann::json requests[2] = {
                     {"terminalTotalDifficulty", "0x1"},
                     {"terminalBlockHash", "0x76734e0205d8c4b711990ab957e86d3dc56d129600e60750552c95448a449794"},
                     {"terminalBlockNumber", "0x1"},
-                }}}}};
+                }}}},
+    {{"jsonrpc", "2.0"},
+     {"id", 1},
+     {"method", "eth_call"},
+     {"params", {{
+                     {"from", "0x52c9a4a4a1b3b3f0a6b8d9c7e1b2a3f4d5c6b7a8"},
+                     {"to", "0x0715a7794a1dc8e42615f059dd6e406a6594651a"},
+                     {"gas", "0x1f4"},
+                     {"data", "0xa9059cbb000000000000000000000000"},
+                 },
+                 "latest"}}}};
 
 static void json_rpc_validator(benchmark::State& state) {
+    silkworm::rpc::json_rpc::Validator::load_specification();
     nlohmann::json json = requests[state.range(0)];
 
     for ([[maybe_unused]] auto _ : state) {
@@ -47,4 +58,4 @@ static void json_rpc_validator(benchmark::State& state) {
     }
 }
 
-BENCHMARK(json_rpc_validator)->Arg(0)->Arg(1);
+BENCHMARK(json_rpc_validator)->Arg(0)->Arg(1)->Arg(2);
@@ -253,6 +253,30 @@ TEST_CASE("Validator validates string parameter", "[rpc][json_rpc][validator]")
     CHECK(result.error() == "Invalid string: 123 in spec: Address");
 }
 
+TEST_CASE("Validator validates quantity parameter", "[rpc][json_rpc][validator]") {
+    Validator validator{create_validator_for_test()};
+
+    for (const auto* block_number : {"0x0", "0x1", "0x1a", "0x1A", "0X1a", "0x10000000000000000"}) {
+        nlohmann::json request = {
+            {"jsonrpc", "2.0"},
+            {"method", "eth_getBlockByNumber"},
+            {"params", {block_number, true}},
+            {"id", 1},
+        };
+        CHECK(validator.validate(request));
+    }
+
+    for (const auto* block_number : {"0x", "0x00", "0x01", "0x1g", "1x1", "0x1 "}) {
+        nlohmann::json request = {
+            {"jsonrpc", "2.0"},
+            {"method", "eth_getBlockByNumber"},
+            {"params", {block_number, true}},
+            {"id", 1},
+        };
+        CHECK(!validator.validate(request));
+    }
+}
+
 TEST_CASE("Validator validates optional parameter if provided", "[rpc][json_rpc][validator]") {
     Validator validator{create_validator_for_test()};
 
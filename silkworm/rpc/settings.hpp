@@ -23,6 +23,7 @@
 #include <silkworm/infra/common/application_info.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/context_pool_settings.hpp>
+#include <silkworm/rpc/common/batch_settings.hpp>
 #include <silkworm/rpc/common/constants.hpp>
 #include <silkworm/rpc/common/interface_log.hpp>
 #include <silkworm/rpc/common/worker_pool.hpp>
@@ -34,6 +35,7 @@ struct DaemonSettings {
     log::Settings log_settings;
     InterfaceLogSettings eth_ifc_log_settings{.ifc_name = "eth_rpc_api"};
     InterfaceLogSettings engine_ifc_log_settings{.ifc_name = "engine_rpc_api"};
+    BatchSettings batch_settings;
     concurrency::ContextPoolSettings context_pool_settings;
     std::optional<std::filesystem::path> datadir;
     std::string eth_end_point{kDefaultEth1EndPoint};
@@ -48,6 +50,9 @@ struct DaemonSettings {
     bool use_websocket{false};
     bool ws_compression{false};
     bool http_compression{true};
+    std::size_t trace_checkpoint_interval{kDefaultTraceCheckpointInterval};
+    std::size_t fee_summary_blocks{kDefaultFeeSummaryBlocks};
+    std::size_t response_cache_size{kDefaultResponseCacheSize};
 };
 
 }  // namespace silkworm::rpc
@@ -60,8 +60,9 @@ class RequestHandler_ForTest : public json_rpc::RequestHandler {
   public:
     RequestHandler_ForTest(ChannelForTest* channel,
                            commands::RpcApi& rpc_api,
-                           const commands::RpcApiTable& rpc_api_table)
-        : json_rpc::RequestHandler(channel, rpc_api, rpc_api_table) {}
+                           const commands::RpcApiTable& rpc_api_table,
+                           json_rpc::ResponseCache* response_cache = nullptr)
+        : json_rpc::RequestHandler(channel, rpc_api, rpc_api_table, {}, {}, response_cache) {}
 
     Task<void> request_and_create_reply(const nlohmann::json& request_json, std::string& response) {
         co_await RequestHandler::handle_request_and_create_reply(request_json, response);
@@ -74,6 +75,11 @@ class RequestHandler_ForTest : public json_rpc::RequestHandler {
         }
     }
 
+    Task<bool> typed_request_enabled(const std::string& request) {
+        const auto typed_request = json_rpc::parse_typed_request(request);
+        co_return typed_request.has_value() && RequestHandler::is_typed_request_enabled(*typed_request);
+    }
+
   private:
     inline static const std::vector<std::string> allowed_origins;
 };
@@ -99,7 +105,7 @@ class RpcApiTestBase : public LocalContextTestBase {
     template <auto method, typename... Args>
     auto run(Args&&... args) {
         ChannelForTest channel;
-        TestRequestHandler handler{&channel, rpc_api_, rpc_api_table_};
+        TestRequestHandler handler{&channel, rpc_api_, rpc_api_table_, response_cache_};
         return spawn_and_wait((handler.*method)(std::forward<Args>(args)...));
     }
 
@@ -108,6 +114,8 @@ class RpcApiTestBase : public LocalContextTestBase {
     commands::RpcApi rpc_api_;
     commands::RpcApiTable rpc_api_table_;
     db::kv::api::CoherentStateCache state_cache_;
+    //! The response cache shared by the request handlers, if any
+    json_rpc::ResponseCache* response_cache_{nullptr};
 };
 
 class RpcApiE2ETest : public db::test_util::TestDatabaseContext, RpcApiTestBase<RequestHandler_ForTest> {
@@ -120,6 +128,7 @@ class RpcApiE2ETest : public db::test_util::TestDatabaseContext, RpcApiTestBase<
         }
     }
     using RpcApiTestBase<RequestHandler_ForTest>::run;
+    using RpcApiTestBase<RequestHandler_ForTest>::response_cache_;
 
   private:
     static inline silkworm::test_util::SetLogVerbosityGuard log_guard_{log::Level::kNone};
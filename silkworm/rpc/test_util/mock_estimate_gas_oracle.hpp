@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -33,8 +34,9 @@ namespace silkworm::rpc {
 class MockEstimateGasOracle : public EstimateGasOracle {
   public:
     explicit MockEstimateGasOracle(const BlockHeaderProvider& block_header_provider, const AccountReader& account_reader,
-                                   const silkworm::ChainConfig& config, WorkerPool& workers, db::kv::api::Transaction& tx, const ChainStorage& storage)
-        : EstimateGasOracle(block_header_provider, account_reader, config, workers, tx, storage) {}
+                                   const silkworm::ChainConfig& config, WorkerPool& workers, db::kv::api::Transaction& tx, const ChainStorage& storage,
+                                   std::size_t probes_per_round = 1)
+        : EstimateGasOracle(block_header_provider, account_reader, config, workers, tx, storage, probes_per_round) {}
 
     MOCK_METHOD((ExecutionResult), try_execution, (EVMExecutor&, const silkworm::Block&, const silkworm::Transaction&), (override));
 };
@@ -23,6 +23,7 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/rpc/core/filter_storage.hpp>
+#include <silkworm/rpc/core/receipts.hpp>
 #include <silkworm/rpc/ethbackend/remote_backend.hpp>
 #include <silkworm/rpc/ethdb/kv/remote_database.hpp>
 #include <silkworm/rpc/txpool/miner.hpp>
@@ -36,6 +37,7 @@ ServiceContextTestBase::ServiceContextTestBase()
     : ContextTestBase() {
     add_shared_service(io_context_, std::make_shared<BlockCache>());
     add_shared_service(io_context_, std::make_shared<FilterStorage>(1024));
+    add_shared_service(io_context_, std::make_shared<core::ReceiptOffsetsTable>());
     add_shared_service<db::kv::api::StateCache>(io_context_, std::make_shared<db::kv::api::CoherentStateCache>());
     add_shared_service<engine::ExecutionEngine>(io_context_, std::make_shared<ExecutionEngineMock>());
     auto* state_cache{must_use_shared_service<db::kv::api::StateCache>(io_context_)};
@@ -22,6 +22,8 @@
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <silkworm/rpc/common/compression.hpp>
+
 namespace silkworm::rpc {
 
 class StreamWriter {
@@ -31,6 +33,11 @@ class StreamWriter {
     virtual Task<void> open_stream() = 0;
     virtual Task<void> close_stream() = 0;
     virtual Task<std::size_t> write(std::string_view content, bool last) = 0;
+
+    //! Write the \p content shared with other responses: writers compressing their output can reuse its compressed form
+    virtual Task<std::size_t> write_shared(const SharedContentPtr& content) {
+        co_return co_await write(content->data(), /*last=*/false);
+    }
 };
 
 class StringWriter : public StreamWriter {